@@ -0,0 +1,135 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities object for
+ *      capturing the arguments to a printf-style format string such
+ *      that the output conversion may be performed later.
+ */
+
+#ifndef LOGUTILITIES_LOGARGUMENTS_HPP
+#define LOGUTILITIES_LOGARGUMENTS_HPP
+
+#include <cstdarg>
+#include <cstddef>
+#include <ctime>
+#include <string>
+
+#include <pthread.h>
+#include <sys/types.h>
+
+#include "LogClockBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        class Values;
+
+        /**
+         *  @brief
+         *    A compact, binary copy of the arguments to a
+         *    printf-style format string.
+         *
+         *  Capturing the arguments walks the format string and
+         *  copies each argument, as the type its conversion
+         *  directive calls for, into a flat buffer. Strings (%s and
+         *  %ls) are copied deeply, honoring any precision, such that
+         *  the caller's storage need not outlive the capture. The
+         *  text for %m is resolved at capture time, as is the time,
+         *  process, and thread the arguments were captured on. The time
+         *  is a reading of the default clock (see Clock::GetDefault),
+         *  which is converted to wall-clock time only when it is
+         *  retrieved.
+         *
+         *  Rendering walks the same format string again, performing
+         *  output conversion of each directive against its captured
+         *  argument. The format string must therefore remain valid,
+         *  and unchanged, until the arguments are rendered, which is
+         *  always the case for string literals.
+         *
+         *  Formats that cannot be captured argument-by-argument (for
+         *  example, those using positional arguments) are instead
+         *  rendered immediately at capture time.
+         *
+         *  Since the buffer is reused, capturing into the same object
+         *  repeatedly requires no heap allocation once its capacity
+         *  has settled.
+         *
+         *  The captured buffer may also be persisted (see
+         *  Log::Recorder::Binary) and restored later, in another
+         *  process built for the same platform, for rendering.
+         *
+         */
+        class Arguments
+        {
+        public:
+            Arguments(void);
+            ~Arguments(void);
+
+            void Capture(const char * inFormat, std::va_list inList);
+            void Capture(const char * inFormat, const Values & inValues);
+            void Render(std::string & inMessage, const char * inFormat) const;
+
+            bool Restore(const char *            inFormat,
+                         const void *            inData,
+                         size_t                  inSize,
+                         bool                    inPreformatted,
+                         const struct timespec & inTime,
+                         pid_t                   inProcess,
+                         pthread_t               inThread);
+
+            const std::string & GetData(void) const;
+            bool                IsPreformatted(void) const;
+
+            time_t    GetTime(void) const;
+            void      GetTimestamp(struct timespec & outTime) const;
+            pid_t     GetProcess(void) const;
+            pthread_t GetThread(void) const;
+
+        private:
+            void Begin(void);
+            bool Validate(const char * inFormat) const;
+
+            template <typename Source>
+            bool CaptureDirectives(const char * inFormat, Source & inSource, int inError);
+
+        private:
+            std::string         mData;         //!< The captured arguments.
+            bool                mPreformatted; //!< Whether @a mData holds
+                                               //!< the rendered message
+                                               //!< rather than the
+                                               //!< captured arguments.
+            Clock::Ticks        mTicks;        //!< The time of the capture.
+            const Clock::Base * mClock;        //!< The clock @a mTicks was
+                                               //!< read from or, if null,
+                                               //!< nanoseconds since the
+                                               //!< Epoch.
+            pid_t               mProcess;      //!< The process that
+                                               //!< captured the arguments.
+            pthread_t           mThread;       //!< The thread that captured
+                                               //!< the arguments.
+        };
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGARGUMENTS_HPP */
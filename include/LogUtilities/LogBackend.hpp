@@ -0,0 +1,496 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities template object
+ *      for a queue of log records drained by a dedicated backend
+ *      thread.
+ */
+
+#ifndef LOGUTILITIES_LOGBACKEND_HPP
+#define LOGUTILITIES_LOGBACKEND_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <stdint.h>
+
+#include "LogQueue.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        /**
+         *  @brief
+         *    A queue of log records drained by a dedicated backend
+         *    thread.
+         *
+         *  Any number of threads may push records; the backend
+         *  thread pops them, in order, and hands each to a drainer
+         *  function. The backend thread sleeps while the queue is
+         *  empty and pushing threads only pay for waking it when it
+         *  is actually asleep.
+         *
+         *  @tparam  Record  The type of record queued. It must be
+         *                   default constructible.
+         *
+         */
+        template <typename Record>
+        class Backend
+        {
+        public:
+            typedef std::function<void (Record &)> drainer_type;
+
+        public:
+            Backend(size_t inCapacity, bool inBlocking, const drainer_type & inDrainer);
+            ~Backend(void);
+
+            template <typename Filler>
+            bool Push(Filler inFiller);
+
+            template <typename Filler, typename Patience>
+            bool Push(Filler inFiller, Patience inPatience);
+
+            void Flush(void);
+            void Stop(void);
+
+            bool IsStopped(void) const;
+
+            size_t Capacity(void) const;
+            size_t Depth(void) const;
+            uint64_t Drained(void) const;
+            uint64_t Dropped(void) const;
+
+        private:
+            Backend(const Backend &inBackend) = delete;
+            Backend & operator =(const Backend &inBackend) = delete;
+
+            void Wake(void);
+            void Run(void);
+            size_t Drain(void);
+            void DrainStopped(void);
+
+        private:
+            static const size_t kBatchSize = 64;
+
+            const bool              mBlocking; //!< Whether pushing to a full
+                                               //!< queue waits for room.
+            const drainer_type      mDrainer;  //!< The function each record
+                                               //!< is drained through.
+            Queue<Record>           mQueue;    //!< The queue of records.
+            std::atomic<uint64_t>   mDropped;  //!< The number of records
+                                               //!< discarded due to overflow.
+            std::atomic<bool>       mSleeping; //!< Whether the backend thread
+                                               //!< is, or is about to be,
+                                               //!< waiting for records.
+            std::atomic<bool>       mStopped;  //!< Whether the backend thread
+                                               //!< has exited.
+            size_t                  mWaiters;  //!< The number of threads
+                                               //!< waiting on a flush.
+            bool                    mStopping; //!< Whether the backend thread
+                                               //!< has been asked to drain
+                                               //!< and exit.
+            std::mutex              mMutex;    //!< Guards the condition
+                                               //!< variables and stop state.
+            std::mutex              mConsumer; //!< Serializes stopping and,
+                                               //!< once stopped, draining,
+                                               //!< such that there is still
+                                               //!< a single consumer.
+            std::condition_variable mPending;  //!< Signals the backend thread
+                                               //!< that records are pending.
+            std::condition_variable mDrained;  //!< Signals flushing threads
+                                               //!< that records have drained.
+            std::thread             mThread;   //!< The backend thread.
+        };
+
+        /**
+         *  @brief
+         *    This is a class constructor.
+         *
+         *    This constructor instantiates the queue and starts the
+         *    backend thread.
+         *
+         *  @param[in]  inCapacity  The minimum number of records that
+         *                          may be queued.
+         *  @param[in]  inBlocking  Whether pushing to a full queue
+         *                          waits for room (true) or discards
+         *                          the record (false).
+         *  @param[in]  inDrainer   The function the backend thread
+         *                          invokes with each record popped.
+         *
+         */
+        template <typename Record>
+        Backend<Record>::Backend(size_t inCapacity, bool inBlocking, const drainer_type & inDrainer) :
+            mBlocking(inBlocking),
+            mDrainer(inDrainer),
+            mQueue(inCapacity),
+            mDropped(0),
+            mSleeping(false),
+            mStopped(false),
+            mWaiters(0),
+            mStopping(false),
+            mMutex(),
+            mConsumer(),
+            mPending(),
+            mDrained(),
+            mThread()
+        {
+            mThread = std::thread(&Backend::Run, this);
+        }
+
+        /**
+         *  @brief
+         *    This is the class destructor.
+         *
+         *    Any queued records are drained before the backend thread
+         *    exits.
+         *
+         */
+        template <typename Record>
+        Backend<Record>::~Backend(void)
+        {
+            Stop();
+        }
+
+        /**
+         *  @brief
+         *    Push a record for the backend thread.
+         *
+         *  If the queue is full, the record is either discarded or
+         *  this waits for room, depending on the blocking policy.
+         *
+         *  @param[in]  inFiller  A callable object taking a mutable
+         *                        record reference, which it should
+         *                        overwrite.
+         *
+         *  @returns
+         *    True if the record was pushed; otherwise, false if it was
+         *    discarded.
+         *
+         */
+        template <typename Record>
+        template <typename Filler>
+        bool
+        Backend<Record>::Push(Filler inFiller)
+        {
+            return (Push(inFiller, [](void) { return (true); }));
+        }
+
+        /**
+         *  @brief
+         *    Push a record for the backend thread, waiting for room
+         *    no longer than the caller is willing to.
+         *
+         *  If the queue is full, the record is either discarded or,
+         *  under the blocking policy, this waits for room for as long
+         *  as the specified patience allows, after which the record
+         *  is discarded.
+         *
+         *  A record pushed as the backend thread exits, and so
+         *  perhaps missed by it, is drained on the calling thread. A
+         *  record whose filler throws is discarded and the exception
+         *  rethrown.
+         *
+         *  @param[in]  inFiller    A callable object taking a mutable
+         *                          record reference, which it should
+         *                          overwrite.
+         *  @param[in]  inPatience  A callable object, taking no
+         *                          arguments, invoked each time the
+         *                          queue is found full, that returns
+         *                          whether to keep waiting.
+         *
+         *  @returns
+         *    True if the record was pushed; otherwise, false if it was
+         *    discarded.
+         *
+         */
+        template <typename Record>
+        template <typename Filler, typename Patience>
+        bool
+        Backend<Record>::Push(Filler inFiller, Patience inPatience)
+        {
+            bool thePushed;
+
+            while (true) {
+                try {
+                    thePushed = mQueue.Push(inFiller);
+
+                } catch (...) {
+                    mDropped.fetch_add(1, std::memory_order_relaxed);
+
+                    Wake();
+
+                    throw;
+
+                }
+
+                Wake();
+
+                if (thePushed) {
+                    break;
+
+                } else if (!mBlocking || !inPatience()) {
+                    mDropped.fetch_add(1, std::memory_order_relaxed);
+                    break;
+
+                } else {
+                    std::this_thread::yield();
+
+                }
+            }
+
+            return (thePushed);
+        }
+
+        /**
+         *  @brief
+         *    Wait until every record pushed before this call has been
+         *    drained.
+         *
+         */
+        template <typename Record>
+        void
+        Backend<Record>::Flush(void)
+        {
+            const size_t theTicket = mQueue.Pushed();
+            std::unique_lock<std::mutex> theLock(mMutex);
+
+            mWaiters++;
+
+            mDrained.wait(theLock, [this, theTicket](void) {
+                return (mStopped.load(std::memory_order_acquire) ||
+                        (mQueue.Popped() >= theTicket));
+            });
+
+            mWaiters--;
+        }
+
+        /**
+         *  @brief
+         *    Drain any queued records and stop the backend thread.
+         *
+         *  Stopping an already-stopped backend has no effect. This
+         *  may be called from any number of threads at once.
+         *
+         */
+        template <typename Record>
+        void
+        Backend<Record>::Stop(void)
+        {
+            std::lock_guard<std::mutex> theConsumerLock(mConsumer);
+
+            {
+                std::lock_guard<std::mutex> theLock(mMutex);
+
+                mStopping = true;
+                mPending.notify_one();
+            }
+
+            if (mThread.joinable()) {
+                mThread.join();
+            }
+
+            // Drain anything that raced with the backend thread
+            // exiting. The fence pairs with the one in Wake such that
+            // either this drain observes a record pushed meanwhile or
+            // the thread pushing it observes the backend stopped and
+            // drains it itself.
+
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            while (Drain() > 0)
+                continue;
+        }
+
+        /**
+         *  @brief
+         *    Return whether the backend thread has exited.
+         *
+         *  Once it has, callers should process records synchronously
+         *  rather than pushing them.
+         *
+         */
+        template <typename Record>
+        bool
+        Backend<Record>::IsStopped(void) const
+        {
+            return (mStopped.load(std::memory_order_acquire));
+        }
+
+        /**
+         *  @brief
+         *    Return the maximum number of records that may be queued.
+         *
+         */
+        template <typename Record>
+        size_t
+        Backend<Record>::Capacity(void) const
+        {
+            return (mQueue.Capacity());
+        }
+
+        /**
+         *  @brief
+         *    Return the number of records currently queued.
+         *
+         */
+        template <typename Record>
+        size_t
+        Backend<Record>::Depth(void) const
+        {
+            return (mQueue.Size());
+        }
+
+        /**
+         *  @brief
+         *    Return the number of records drained.
+         *
+         */
+        template <typename Record>
+        uint64_t
+        Backend<Record>::Drained(void) const
+        {
+            const size_t theSkipped = mQueue.Skipped();
+
+            return (mQueue.Popped() - theSkipped);
+        }
+
+        /**
+         *  @brief
+         *    Return the number of records discarded due to overflow.
+         *
+         */
+        template <typename Record>
+        uint64_t
+        Backend<Record>::Dropped(void) const
+        {
+            return (mDropped.load(std::memory_order_relaxed));
+        }
+
+        // Wake the backend thread if it is waiting for records or,
+        // if it has exited, drain in its place. The fence pairs with
+        // the one in Run such that either this thread observes the
+        // backend thread sleeping or the backend thread observes the
+        // record just pushed, and with the one in Stop likewise.
+
+        template <typename Record>
+        void
+        Backend<Record>::Wake(void)
+        {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (mStopped.load(std::memory_order_relaxed)) {
+                DrainStopped();
+
+            } else if (mSleeping.load(std::memory_order_relaxed)) {
+                std::lock_guard<std::mutex> theLock(mMutex);
+
+                mSleeping.store(false, std::memory_order_relaxed);
+                mPending.notify_one();
+
+            }
+        }
+
+        template <typename Record>
+        void
+        Backend<Record>::Run(void)
+        {
+            std::unique_lock<std::mutex> theLock(mMutex, std::defer_lock);
+            size_t theDrained;
+
+            while (true) {
+                theDrained = Drain();
+
+                theLock.lock();
+
+                if (mWaiters > 0) {
+                    mDrained.notify_all();
+                }
+
+                if (theDrained < kBatchSize) {
+                    mSleeping.store(true, std::memory_order_relaxed);
+
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                    if (mQueue.Empty()) {
+                        if (mStopping) {
+                            break;
+                        }
+
+                        mPending.wait(theLock, [this](void) {
+                            return (!mSleeping.load(std::memory_order_relaxed) || mStopping);
+                        });
+                    }
+
+                    mSleeping.store(false, std::memory_order_relaxed);
+                }
+
+                theLock.unlock();
+            }
+
+            // The lock is held here. With the queue drained, pushing
+            // threads now fall back to synchronous processing and
+            // flushing threads are released.
+
+            mStopped.store(true, std::memory_order_release);
+            mSleeping.store(false, std::memory_order_relaxed);
+            mDrained.notify_all();
+        }
+
+        template <typename Record>
+        size_t
+        Backend<Record>::Drain(void)
+        {
+            size_t theDrained = 0;
+
+            while (theDrained < kBatchSize) {
+                if (!mQueue.Pop(std::cref(mDrainer))) {
+                    break;
+                }
+
+                theDrained++;
+            }
+
+            return (theDrained);
+        }
+
+        // Drain every record on the calling thread, once the backend
+        // thread has exited.
+
+        template <typename Record>
+        void
+        Backend<Record>::DrainStopped(void)
+        {
+            std::lock_guard<std::mutex> theConsumerLock(mConsumer);
+
+            while (Drain() > 0)
+                continue;
+        }
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGBACKEND_HPP */
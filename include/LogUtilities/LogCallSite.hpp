@@ -0,0 +1,290 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities object for a
+ *      registered log statement call site that may be enabled and
+ *      disabled at runtime.
+ */
+
+#ifndef LOGUTILITIES_LOGCALLSITE_HPP
+#define LOGUTILITIES_LOGCALLSITE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+#include <stdint.h>
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        /**
+         *  @brief
+         *    A log statement call site, which may be individually
+         *    enabled and disabled at runtime.
+         *
+         *  Each call site of the logging macros (see LogMacros.hpp)
+         *  defines a static call site object recording its file,
+         *  line, function, and format string. The object is
+         *  constant-initialized, so defining it costs nothing at
+         *  runtime. It is added to a process-wide registry the first
+         *  time the statement runs. From then on, testing whether
+         *  the call site is enabled is a single relaxed load and a
+         *  predictable branch, made before the logger or any
+         *  argument is consulted.
+         *
+         *  Call sites are found, and enabled or disabled, by shell
+         *  glob patterns (see fnmatch(3)) on their file and
+         *  function. Each change is also recorded as a rule. Call
+         *  sites registered later, because their statements have not
+         *  yet run, take the setting of the last rule they match.
+         *  Call sites are enabled by default.
+         *
+         *  While a macro writes a message, its call site is the
+         *  current one for the writing thread (see #GetCurrent),
+         *  such that filters may key on it.
+         *
+         */
+        class CallSite
+        {
+        public:
+            class Scope;
+
+        public:
+            constexpr CallSite(const char * inFile,
+                               unsigned int inLine,
+                               const char * inFunction,
+                               const char * inFormat);
+
+            const char * GetFile(void) const;
+            unsigned int GetLine(void) const;
+            const char * GetFunction(void) const;
+            const char * GetFormat(void) const;
+
+            bool IsEnabled(void);
+            void SetEnabled(bool inEnabled);
+
+            static size_t Find(const char *                    inFilePattern,
+                               const char *                    inFunctionPattern,
+                               std::vector<const CallSite *> & outCallSites);
+            static size_t SetEnabled(const char * inFilePattern,
+                                     const char * inFunctionPattern,
+                                     bool         inEnabled);
+            static void   Reset(void);
+
+            static const CallSite * GetCurrent(void);
+
+        private:
+            CallSite(const CallSite & inCallSite) = delete;
+            CallSite & operator =(const CallSite & inCallSite) = delete;
+
+            bool Register(void);
+            bool Matches(const char * inFilePattern, const char * inFunctionPattern) const;
+
+        private:
+            enum : uint8_t
+            {
+                kUnregistered = 0,
+                kEnabled      = 1,
+                kDisabled     = 2
+            };
+
+            const char * const   mFile;     //!< The source file.
+            const unsigned int   mLine;     //!< The source line.
+            const char * const   mFunction; //!< The enclosing function.
+            const char * const   mFormat;   //!< The format string.
+            std::atomic<uint8_t> mState;    //!< Whether the call site
+                                            //!< is registered and, if
+                                            //!< so, enabled.
+            CallSite *           mNext;     //!< The next registered
+                                            //!< call site.
+
+            static thread_local const CallSite * sCurrent;
+        };
+
+        /**
+         *  @brief
+         *    An object that makes a call site the current one for the
+         *    calling thread for as long as it is in scope.
+         *
+         */
+        class CallSite::Scope
+        {
+        public:
+            Scope(const CallSite & inCallSite);
+            ~Scope(void);
+
+        private:
+            Scope(const Scope & inScope) = delete;
+            Scope & operator =(const Scope & inScope) = delete;
+
+        private:
+            const CallSite * const mPrevious; //!< The call site current
+                                              //!< before this scope.
+        };
+
+        /**
+         *  @brief
+         *    This is the class constructor.
+         *
+         *  The call site is registered the first time it is tested
+         *  (see #IsEnabled), rather than here, such that it may be
+         *  constant-initialized.
+         *
+         *  @param[in]  inFile      The source file of the call site.
+         *  @param[in]  inLine      The source line of the call site.
+         *  @param[in]  inFunction  The function enclosing the call
+         *                          site.
+         *  @param[in]  inFormat    The format string of the log
+         *                          statement at the call site, or
+         *                          null if it is not a string
+         *                          literal.
+         *
+         */
+        inline constexpr
+        CallSite::CallSite(const char * inFile,
+                           unsigned int inLine,
+                           const char * inFunction,
+                           const char * inFormat) :
+            mFile(inFile),
+            mLine(inLine),
+            mFunction(inFunction),
+            mFormat(inFormat),
+            mState(kUnregistered),
+            mNext(nullptr)
+        {
+        }
+
+        /**
+         *  @brief
+         *    Return the source file of the call site.
+         *
+         */
+        inline const char *
+        CallSite::GetFile(void) const
+        {
+            return (mFile);
+        }
+
+        /**
+         *  @brief
+         *    Return the source line of the call site.
+         *
+         */
+        inline unsigned int
+        CallSite::GetLine(void) const
+        {
+            return (mLine);
+        }
+
+        /**
+         *  @brief
+         *    Return the function enclosing the call site.
+         *
+         */
+        inline const char *
+        CallSite::GetFunction(void) const
+        {
+            return (mFunction);
+        }
+
+        /**
+         *  @brief
+         *    Return the format string of the log statement at the
+         *    call site, or null if it is not a string literal.
+         *
+         */
+        inline const char *
+        CallSite::GetFormat(void) const
+        {
+            return (mFormat);
+        }
+
+        /**
+         *  @brief
+         *    Test whether the call site is enabled, registering it
+         *    if this is the first test.
+         *
+         *  @returns
+         *    True if the call site is enabled; otherwise, false.
+         *
+         */
+        inline bool
+        CallSite::IsEnabled(void)
+        {
+            const uint8_t theState = mState.load(std::memory_order_relaxed);
+
+            if (theState == kEnabled) {
+                return (true);
+            }
+
+            return ((theState == kUnregistered) && Register());
+        }
+
+        /**
+         *  @brief
+         *    Return the call site of the message the calling thread
+         *    is writing, if any.
+         *
+         *  @returns
+         *    A pointer to the current call site or null if the
+         *    message is not being written through the logging
+         *    macros.
+         *
+         */
+        inline const CallSite *
+        CallSite::GetCurrent(void)
+        {
+            return (sCurrent);
+        }
+
+        /**
+         *  @brief
+         *    This is the class constructor.
+         *
+         *  @param[in]  inCallSite  The call site to make current.
+         *
+         */
+        inline
+        CallSite::Scope::Scope(const CallSite & inCallSite) :
+            mPrevious(sCurrent)
+        {
+            sCurrent = &inCallSite;
+        }
+
+        /**
+         *  @brief
+         *    This is the class destructor, restoring the call site
+         *    that was current before.
+         *
+         */
+        inline
+        CallSite::Scope::~Scope(void)
+        {
+            sCurrent = mPrevious;
+        }
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGCALLSITE_HPP */
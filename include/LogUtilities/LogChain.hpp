@@ -31,10 +31,13 @@
 #ifndef LOGUTILITIES_LOGCHAIN_HPP
 #define LOGUTILITIES_LOGCHAIN_HPP
 
-#include <list>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <new>
+#include <type_traits>
 
-#include <boost/next_prior.hpp>
 #include <boost/shared_ptr.hpp>
 
 namespace Nuovations
@@ -55,6 +58,13 @@ namespace Nuovations
          *  processing or multiple, sequential formats and writes to
          *  various output destinations for a single input.
          *
+         *  Links are held in contiguous storage such that walking
+         *  the chain for each input is cache-friendly and accessing
+         *  a link by index is constant time. The first few links are
+         *  held inline, without heap allocation, where they are small
+         *  enough. Links never move once pushed, such that pointers
+         *  returned by Link() remain valid until the link is popped.
+         *
          *  @tparam  Base  The abstract base type of all objects in
          *                 the chain.
          *
@@ -63,14 +73,180 @@ namespace Nuovations
         class Chain
         {
         protected:
+            class Links;
+
             /**
              *  Underlying container type for the chain.
              */
-            typedef std::list<Base *>                  container_type;
+            typedef Links                              container_type;
 
         private:
             typedef typename container_type::size_type size_type;
 
+        protected:
+            /**
+             *  @brief
+             *    Contiguous storage for the links of a chain.
+             *
+             *  This holds an array of pointers to the links, which
+             *  iterates as any other container of link pointers, and
+             *  owns the links themselves. The first kInlineLinks
+             *  links, where no larger than kInlineSize, are
+             *  constructed in place in slots within the storage
+             *  itself; others are allocated on the heap.
+             *
+             */
+            class Links
+            {
+            public:
+                typedef Base **        iterator;
+                typedef Base * const * const_iterator;
+                typedef size_t         size_type;
+
+            public:
+                Links(void) :
+                    mLinks(mInline),
+                    mSize(0),
+                    mCapacity(kInlineLinks),
+                    mHeap()
+                {
+                    return;
+                }
+
+                ~Links(void)
+                {
+                    clear();
+                }
+
+                iterator begin(void)             { return (mLinks); }
+                iterator end(void)               { return (mLinks + mSize); }
+                const_iterator begin(void) const { return (mLinks); }
+                const_iterator end(void) const   { return (mLinks + mSize); }
+
+                bool      empty(void) const { return (mSize == 0); }
+                size_type size(void) const  { return (mSize); }
+
+                Base * front(void) const                     { return (mLinks[0]); }
+                Base * back(void) const                      { return (mLinks[mSize - 1]); }
+                Base * operator [](size_type inIndex) const  { return (mLinks[inIndex]); }
+
+                /**
+                 *  @brief
+                 *    Append a copy of the specified link.
+                 *
+                 *  @tparam     Derived  The derived type of the link.
+                 *  @param[in]  inLink   An immutable reference to the
+                 *                       link to copy.
+                 *
+                 */
+                template <typename Derived>
+                void push_back(const Derived & inLink)
+                {
+                    typedef typename std::remove_cv<Derived>::type link_type;
+                    typedef std::integral_constant<bool,
+                                                   ((sizeof (link_type) <= kInlineSize) &&
+                                                    (alignof(link_type) <= alignof(slot_type)))> fits_type;
+                    Base * theLink;
+
+                    if (mSize == mCapacity) {
+                        Grow();
+                    }
+
+                    theLink = Construct<link_type>(inLink, fits_type());
+
+                    mLinks[mSize++] = theLink;
+                }
+
+                /**
+                 *  @brief
+                 *    Remove and destroy the trailing link.
+                 *
+                 */
+                void pop_back(void)
+                {
+                    Destroy(mLinks[--mSize]);
+                }
+
+                /**
+                 *  @brief
+                 *    Remove and destroy all links.
+                 *
+                 */
+                void clear(void)
+                {
+                    while (mSize > 0) {
+                        pop_back();
+                    }
+                }
+
+            private:
+                Links(const Links & inLinks) = delete;
+                Links & operator =(const Links & inLinks) = delete;
+
+                typedef typename std::aligned_storage<64, alignof(std::max_align_t)>::type slot_type;
+
+                static const size_type kInlineLinks = 4;
+                static const size_t    kInlineSize  = sizeof (slot_type);
+
+                void Grow(void)
+                {
+                    const size_type           theCapacity = std::max(mCapacity * 2, kInlineLinks * 2);
+                    std::unique_ptr<Base *[]> theHeap(new Base *[theCapacity]);
+
+                    for (size_type theLink = 0; theLink < mSize; theLink++) {
+                        theHeap[theLink] = mLinks[theLink];
+                    }
+
+                    mHeap.swap(theHeap);
+
+                    mLinks    = mHeap.get();
+                    mCapacity = theCapacity;
+                }
+
+                template <typename Derived>
+                Base * Construct(const Derived & inLink, std::true_type inFits)
+                {
+                    (void)inFits;
+
+                    if (mSize < kInlineLinks) {
+                        return (new (&mSlots[mSize]) Derived(inLink));
+                    }
+
+                    return (new Derived(inLink));
+                }
+
+                template <typename Derived>
+                Base * Construct(const Derived & inLink, std::false_type inFits)
+                {
+                    (void)inFits;
+
+                    return (new Derived(inLink));
+                }
+
+                void Destroy(Base * inLink)
+                {
+                    const std::less<const void *> theLess;
+                    const void * const            theLink = inLink;
+
+                    if (!theLess(theLink, &mSlots[0]) && theLess(theLink, &mSlots[kInlineLinks])) {
+                        inLink->~Base();
+                    } else {
+                        delete inLink;
+                    }
+                }
+
+            private:
+                Base **                   mLinks;                //!< The links.
+                size_type                 mSize;                 //!< The number of links.
+                size_type                 mCapacity;             //!< The room in @a mLinks.
+                std::unique_ptr<Base *[]> mHeap;                 //!< The links, once more
+                                                                 //!< than @a mInline holds.
+                Base *                    mInline[kInlineLinks]; //!< The first links.
+                slot_type                 mSlots[kInlineLinks];  //!< The storage for the
+                                                                 //!< first links, where
+                                                                 //!< they fit.
+            };
+
         protected:
             /**
              *  @brief
@@ -97,6 +273,24 @@ namespace Nuovations
                 return;
             }
 
+            /**
+             *  @brief
+             *    This is the class assignment operator.
+             *
+             *  @param[in]  inChain  An immutable reference to the chain
+             *                       to assign from.
+             *
+             *  @returns
+             *    A reference to the chain.
+             *
+             */
+            Chain & operator =(const Chain & inChain)
+            {
+                mImplementation = inChain.mImplementation;
+
+                return (*this);
+            }
+
         public:
             /**
              *  @brief
@@ -131,7 +325,7 @@ namespace Nuovations
                     return (NULL);
                 }
 
-                return (static_cast<Derived *>(*boost::next(Container().begin(), inIndex)));
+                return (static_cast<Derived *>(Container()[inIndex]));
             }
 
             /**
@@ -150,15 +344,7 @@ namespace Nuovations
             template <typename Derived>
             void Push(const Derived & inLink)
             {
-#if __cplusplus >= 201103L
-                std::unique_ptr<Derived> theLink(new Derived(inLink));
-#else
-                std::auto_ptr<Derived> theLink(new Derived(inLink));
-#endif
-
-                Container().push_back(theLink.get());
-
-                theLink.release();
+                Container().push_back(inLink);
             }
 
             /**
@@ -185,12 +371,6 @@ namespace Nuovations
              */
             void Pop(void)
             {
-                Base *theLink = NULL;
-
-                std::swap(theLink, Container().back());
-
-                delete theLink;
-
                 Container().pop_back();
             }
 
@@ -278,20 +458,6 @@ namespace Nuovations
 
                 void Reset(void)
                 {
-                    typedef typename container_type::iterator iterator;
-                    iterator current = mLinks.begin();
-                    iterator last = mLinks.end();
-
-                    while (current != last) {
-                        Base *theLink = NULL;
-
-                        std::swap(theLink, *current);
-
-                        delete theLink;
-
-                        std::advance(current, 1);
-                    }
-
                     mLinks.clear();
                 }
 
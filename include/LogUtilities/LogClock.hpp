@@ -0,0 +1,33 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file is an umbrella header for Nuovations Log Utilities
+ *      log clocks.
+ */
+
+#ifndef LOGUTILITIES_LOGCLOCK_HPP
+#define LOGUTILITIES_LOGCLOCK_HPP
+
+#include <LogUtilities/LogClockBase.hpp>
+#include <LogUtilities/LogClockMonotonic.hpp>
+#include <LogUtilities/LogClockRealtime.hpp>
+#include <LogUtilities/LogClockRealtimeCoarse.hpp>
+#include <LogUtilities/LogClockTSC.hpp>
+
+#endif /* LOGUTILITIES_LOGCLOCK_HPP */
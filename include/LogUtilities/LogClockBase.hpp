@@ -0,0 +1,100 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities abstract clock
+ *      object.
+ */
+
+#ifndef LOGUTILITIES_LOGCLOCKBASE_HPP
+#define LOGUTILITIES_LOGCLOCKBASE_HPP
+
+#include <ctime>
+
+#include <stdint.h>
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Clock
+        {
+
+            /**
+             *  A clock reading, in units particular to the clock that
+             *  took it.
+             */
+            typedef int64_t Ticks;
+
+            /**
+             *  @brief
+             *    Abstract, base log clock object.
+             *
+             *  Clock objects provide the time a message is logged
+             *  at. Reading a clock, which happens for every message
+             *  stamped or captured, is separate from converting the
+             *  reading to wall-clock time, which need only happen
+             *  when the message is rendered, such that clocks whose
+             *  native units are not wall-clock time pay for
+             *  conversion only then.
+             *
+             *  @ingroup clock
+             *
+             */
+            class Base
+            {
+            public:
+                virtual ~Base(void);
+
+                /**
+                 *  @brief
+                 *    Return the current clock reading.
+                 *
+                 */
+                virtual Ticks Now(void) const = 0;
+
+                /**
+                 *  @brief
+                 *    Convert a reading taken by this clock to
+                 *    wall-clock time.
+                 *
+                 *  @param[in]   inTicks  The reading to convert.
+                 *  @param[out]  outTime  A reference to storage for
+                 *                        the wall-clock time, in
+                 *                        seconds and nanoseconds
+                 *                        since the Epoch.
+                 *
+                 */
+                virtual void Convert(Ticks inTicks, struct timespec & outTime) const = 0;
+
+            protected:
+                Base(void);
+            };
+
+            extern Base & GetDefault(void);
+            extern void   SetDefault(Base & inClock);
+
+        }; // namespace Clock
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGCLOCKBASE_HPP */
@@ -0,0 +1,76 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete clock
+ *      object for the system monotonic clock.
+ */
+
+#ifndef LOGUTILITIES_LOGCLOCKMONOTONIC_HPP
+#define LOGUTILITIES_LOGCLOCKMONOTONIC_HPP
+
+#include "LogClockBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Clock
+        {
+
+            /**
+             *  @brief
+             *    Log clock object for the system monotonic clock
+             *    (that is, CLOCK_MONOTONIC).
+             *
+             *  Readings never step backward, even as the system
+             *  real-time clock is adjusted, which makes them
+             *  suitable for measuring the latency between messages.
+             *  They are converted to wall-clock time using the
+             *  offset between the two clocks at the time the clock
+             *  is instantiated, so stamps may drift from the system
+             *  real-time clock as it is adjusted thereafter.
+             *
+             *  @ingroup clock
+             *
+             */
+            class Monotonic :
+                public Base
+            {
+            public:
+                Monotonic(void);
+                virtual ~Monotonic(void);
+
+                virtual Ticks Now(void) const;
+                virtual void Convert(Ticks inTicks, struct timespec & outTime) const;
+
+            private:
+                const Ticks mOffset; //!< The real-time clock reading,
+                                     //!< in nanoseconds, less the
+                                     //!< monotonic clock reading.
+            };
+
+        }; // namespace Clock
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGCLOCKMONOTONIC_HPP */
@@ -0,0 +1,74 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete clock
+ *      object for the system real-time clock.
+ */
+
+#ifndef LOGUTILITIES_LOGCLOCKREALTIME_HPP
+#define LOGUTILITIES_LOGCLOCKREALTIME_HPP
+
+#include <ctime>
+
+#include "LogClockBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Clock
+        {
+
+            /**
+             *  @brief
+             *    Log clock object for the system real-time clock
+             *    (that is, CLOCK_REALTIME).
+             *
+             *  Readings are nanoseconds since the Epoch and so
+             *  convert to wall-clock time trivially.
+             *
+             *  @ingroup clock
+             *
+             */
+            class Realtime :
+                public Base
+            {
+            public:
+                Realtime(void);
+                virtual ~Realtime(void);
+
+                virtual Ticks Now(void) const;
+                virtual void Convert(Ticks inTicks, struct timespec & outTime) const;
+
+            protected:
+                Realtime(clockid_t inClock);
+
+            private:
+                const clockid_t mClock; //!< The POSIX clock read.
+            };
+
+        }; // namespace Clock
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGCLOCKREALTIME_HPP */
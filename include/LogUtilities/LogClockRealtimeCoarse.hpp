@@ -0,0 +1,67 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete clock
+ *      object for the coarse system real-time clock.
+ */
+
+#ifndef LOGUTILITIES_LOGCLOCKREALTIMECOARSE_HPP
+#define LOGUTILITIES_LOGCLOCKREALTIMECOARSE_HPP
+
+#include "LogClockRealtime.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Clock
+        {
+
+            /**
+             *  @brief
+             *    Log clock object for the coarse system real-time
+             *    clock (that is, CLOCK_REALTIME_COARSE).
+             *
+             *  The coarse clock is read without consulting the
+             *  hardware clock source, making it the cheapest of the
+             *  system clocks, at the expense of a resolution of the
+             *  kernel timer tick (typically one to four
+             *  milliseconds). On platforms without it, this reads
+             *  CLOCK_REALTIME instead.
+             *
+             *  @ingroup clock
+             *
+             */
+            class RealtimeCoarse :
+                public Realtime
+            {
+            public:
+                RealtimeCoarse(void);
+                virtual ~RealtimeCoarse(void);
+            };
+
+        }; // namespace Clock
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGCLOCKREALTIMECOARSE_HPP */
@@ -0,0 +1,104 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete clock
+ *      object for the processor time stamp counter.
+ */
+
+#ifndef LOGUTILITIES_LOGCLOCKTSC_HPP
+#define LOGUTILITIES_LOGCLOCKTSC_HPP
+
+#include "LogClockBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Clock
+        {
+
+            /**
+             *  @brief
+             *    Log clock object for the processor time stamp
+             *    counter (TSC).
+             *
+             *  Reading the counter is a single, unserialized
+             *  instruction, the cheapest clock available. Readings
+             *  are converted to wall-clock time, only when rendered,
+             *  using the counter frequency and the offset to the
+             *  system real-time clock, both calibrated against the
+             *  system clocks when the clock is instantiated.
+             *
+             *  Since calibration error accumulates with the time
+             *  elapsed since calibration, at a rate of roughly a
+             *  microsecond per second for the default calibration
+             *  period, long-running processes wanting stamps that
+             *  track the system real-time clock closely should
+             *  calibrate for longer or periodically instantiate a
+             *  new clock.
+             *
+             *  The counter is only used where it is invariant; that
+             *  is, where it runs at a constant rate, regardless of
+             *  processor frequency and sleep states, and is
+             *  synchronized across processors. Elsewhere, readings
+             *  fall back to the system monotonic clock.
+             *
+             *  @ingroup clock
+             *
+             */
+            class TSC :
+                public Base
+            {
+            public:
+                static const unsigned int kCalibrationDefault = 20;
+
+            public:
+                TSC(void);
+                TSC(unsigned int inCalibrationMilliseconds);
+                virtual ~TSC(void);
+
+                virtual Ticks Now(void) const;
+                virtual void Convert(Ticks inTicks, struct timespec & outTime) const;
+
+                bool   IsAvailable(void) const;
+                double GetFrequency(void) const;
+
+            private:
+                void Calibrate(unsigned int inCalibrationMilliseconds);
+
+            private:
+                bool   mAvailable; //!< Whether the counter is
+                                   //!< available and invariant.
+                Ticks  mTicks;     //!< The reading at the calibration
+                                   //!< anchor.
+                Ticks  mTime;      //!< The real-time clock reading, in
+                                   //!< nanoseconds since the Epoch, at
+                                   //!< the calibration anchor.
+                double mScale;     //!< The nanoseconds per tick.
+            };
+
+        }; // namespace Clock
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGCLOCKTSC_HPP */
@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities object for
+ *      decoding the binary records written by
+ *      Log::Recorder::Binary back into text.
+ */
+
+#ifndef LOGUTILITIES_LOGDECODER_HPP
+#define LOGUTILITIES_LOGDECODER_HPP
+
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Formatter
+        {
+
+            class Base;
+
+        }; // namespace Formatter
+
+        namespace Indenter
+        {
+
+            class Base;
+
+        }; // namespace Indenter
+
+        /**
+         *  @brief
+         *    An object for decoding the binary records written by
+         *    Log::Recorder::Binary back into text.
+         *
+         *  Loading indexes the messages in a buffer holding the
+         *  records, in a single, sequential pass, collecting the
+         *  format string definitions along the way. Thereafter,
+         *  each message may be decoded independently of the others
+         *  and, because decoding does not modify the decoder, from
+         *  any number of threads at once, provided that each uses
+         *  its own formatter and indenter.
+         *
+         *  Each message decodes to exactly the text the formatter
+         *  and indenter would have produced for it at the time it
+         *  was recorded.
+         *
+         */
+        class Decoder
+        {
+        public:
+            Decoder(void);
+            ~Decoder(void);
+
+            bool Load(const void * inData, size_t inSize);
+
+            size_t GetLoaded(void) const;
+            size_t GetMessages(void) const;
+
+            bool Decode(size_t            inMessage,
+                        Formatter::Base & inFormatter,
+                        Indenter::Base &  inIndenter,
+                        std::string &     outMessage) const;
+
+        private:
+            /**
+             *  The location of a message record.
+             */
+            struct Message
+            {
+                size_t   mOffset;  //!< The offset of the message
+                                   //!< payload.
+                size_t   mSize;    //!< The size of the message
+                                   //!< payload.
+                uint32_t mSession; //!< The header the message
+                                   //!< follows, which scopes its
+                                   //!< format identifier.
+            };
+
+            typedef std::vector<std::string> Formats;
+
+            bool LoadHeader(size_t inOffset, size_t inSize);
+            bool LoadFormat(size_t inOffset, size_t inSize);
+            bool LoadMessage(size_t inOffset, size_t inSize);
+
+        private:
+            const uint8_t *      mData;     //!< The records.
+            size_t               mLoaded;   //!< The size, in bytes, of
+                                            //!< the records loaded.
+            std::vector<Formats> mSessions; //!< The format strings
+                                            //!< defined following each
+                                            //!< header, by identifier.
+            std::vector<Message> mMessages; //!< The messages loaded.
+        };
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGDECODER_HPP */
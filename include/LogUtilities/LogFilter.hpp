@@ -28,8 +28,15 @@
 #include <LogUtilities/LogFilterBase.hpp>
 #include <LogUtilities/LogFilterBoolean.hpp>
 #include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterDedupe.hpp>
+#include <LogUtilities/LogFilterFormatList.hpp>
+#include <LogUtilities/LogFilterGate.hpp>
 #include <LogUtilities/LogFilterLevel.hpp>
 #include <LogUtilities/LogFilterNever.hpp>
+#include <LogUtilities/LogFilterPattern.hpp>
 #include <LogUtilities/LogFilterQuiet.hpp>
+#include <LogUtilities/LogFilterRateLimit.hpp>
+#include <LogUtilities/LogFilterSample.hpp>
+#include <LogUtilities/LogFilterStaticChain.hpp>
 
 #endif /* LOGUTILITIES_LOGFILTER_HPP */
@@ -48,8 +48,40 @@ namespace Nuovations
             public:
                 Always(void);
                 virtual ~Always(void);
+
+                virtual uint64_t GetLevelLimit(void) const;
+
+                virtual bool Allow(Log::Level inLevel);
+                virtual bool Allow(Log::Level inLevel, const char * inMessage);
             };
 
+            // These are defined inline, with constant results, such
+            // that a statically-composed logger (see StaticLogger)
+            // may fold them away entirely.
+
+            inline uint64_t
+            Always::GetLevelLimit(void) const
+            {
+                return (kLevelLimitAll);
+            }
+
+            inline bool
+            Always::Allow(Log::Level inLevel)
+            {
+                (void)inLevel;
+
+                return (true);
+            }
+
+            inline bool
+            Always::Allow(Log::Level inLevel, const char * inMessage)
+            {
+                (void)inLevel;
+                (void)inMessage;
+
+                return (true);
+            }
+
         }; // namespace Filter
 
     }; // namespace Log
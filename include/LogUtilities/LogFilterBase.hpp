@@ -24,6 +24,9 @@
 #ifndef LOGUTILITIES_LOGFILTERBASE_HPP
 #define LOGUTILITIES_LOGFILTERBASE_HPP
 
+#include <stdint.h>
+
+#include "LogOwned.hpp"
 #include "LogTypes.hpp"
 
 namespace Nuovations
@@ -47,11 +50,27 @@ namespace Nuovations
              *  @ingroup filter
              *
              */
-            class Base
+            class Base :
+                protected Owned
             {
+            public:
+                /**
+                 *  The level limit of a filter that rejects messages
+                 *  at every level.
+                 */
+                static const uint64_t kLevelLimitNone = 0;
+
+                /**
+                 *  The level limit of a filter that may pass messages
+                 *  at any level.
+                 */
+                static const uint64_t kLevelLimitAll  = static_cast<uint64_t>(static_cast<Level>(-1)) + 1;
+
             public:
                 virtual ~Base(void);
 
+                virtual uint64_t GetLevelLimit(void) const;
+
                 /**
                  *  @brief
                  *    Pass or reject a message based on the specified
@@ -87,8 +106,18 @@ namespace Nuovations
                  */
                 virtual bool Allow(Level inLevel, const char * inMessage) = 0;
 
+                virtual bool NeedsFormat(void) const;
+                virtual bool NeedsLast(void) const;
+                virtual bool AllowFormat(Level inLevel, const char * inFormat);
+
+                virtual bool NeedsMessage(void) const;
+                virtual bool AllowMessage(Level inLevel, const char * inMessage);
+
             protected:
                 Base(void);
+
+            private:
+                virtual void RefreshGates(void) const;
             };
 
         }; // namespace Filter
@@ -50,9 +50,13 @@ namespace Nuovations
             public:
                 virtual ~Boolean(void);
 
+                virtual uint64_t GetLevelLimit(void) const;
+
                 virtual bool Allow(Level inLevel);
                 virtual bool Allow(Level inLevel, const char * inMessage);
 
+                virtual bool NeedsMessage(void) const;
+
             protected:
                 Boolean(bool inAllow);
 
@@ -60,6 +64,22 @@ namespace Nuovations
                 bool mAllow;
             };
 
+            /**
+             *  @brief
+             *    Return whether the filter needs the content of a
+             *    message to pass or reject it.
+             *
+             *  @returns
+             *    False, since the filter decides on its instantiated
+             *    Boolean state alone.
+             *
+             */
+            inline bool
+            Boolean::NeedsMessage(void) const
+            {
+                return (false);
+            }
+
         }; // namespace Filter
 
     }; // namespace Log
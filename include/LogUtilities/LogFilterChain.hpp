@@ -26,7 +26,14 @@
 #ifndef LOGUTILITIES_LOGFILTERCHAIN_HPP
 #define LOGUTILITIES_LOGFILTERCHAIN_HPP
 
+#include <vector>
+
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
 #include "LogChain.hpp"
+#include "LogClockBase.hpp"
 #include "LogFilterBase.hpp"
 
 namespace Nuovations
@@ -38,12 +45,51 @@ namespace Nuovations
         namespace Filter
         {
 
+            class Level;
+            class Quiet;
+
             /**
              *  @brief
              *    Log writer object that performs sequential message
              *    filter operations to each link in a chain of filters
              *    on a single message filter operation to the chain.
              *
+             *  Each link is asked once, as it is pushed, whether it
+             *  needs the format string (see Base::NeedsFormat) or
+             *  message content (see Base::NeedsMessage); those that
+             *  do are kept in pre-format and post-format lists,
+             *  respectively. Level filtering (#Allow(Level)) walks
+             *  every link, while format filtering (#AllowFormat) and
+             *  content filtering (#AllowMessage) walk only their
+             *  lists, such that a chain without such links skips
+             *  those phases entirely. Consequently, whether a link
+             *  needs either must not change once it is pushed.
+             *
+             *  Links that must be consulted last on the format string
+             *  (see Base::NeedsLast), such as a rate limit, are moved
+             *  to the end of the pre-format list, whatever order they
+             *  were pushed in, and stay there in adaptive mode.
+             *
+             *  The leading level and quiet links, if any, are
+             *  likewise found once, as links are pushed, such that
+             *  they may be retrieved and adjusted at runtime without
+             *  searching the chain.
+             *
+             *  By default, each phase walks its links in push order.
+             *  In adaptive mode (see #SetAdaptive), one in every so
+             *  many walks on each thread is sampled for the time each
+             *  link takes and whether it rejects, and each phase is
+             *  periodically reordered, from those samples, such that
+             *  links likely to reject cheaply are consulted first.
+             *  Links are timed by a monotonic clock, unless the chain
+             *  is instantiated with another. Since every link must
+             *  pass a message, the outcome is the same in any order,
+             *  but which links are consulted is not: a link whose
+             *  state depends on the messages reaching it, such as a
+             *  counting sample, should be pushed as
+             *  Order::kDependent, which keeps it, and the set of
+             *  links either side of it, where it was pushed.
+             *
              *  @ingroup filter
              *
              */
@@ -51,12 +97,139 @@ namespace Nuovations
                 public Log::Chain<Base>,
                 public Base
             {
+            public:
+                /**
+                 *  Whether a link may be reordered, in adaptive mode,
+                 *  relative to others.
+                 */
+                enum class Order : uint8_t
+                {
+                    kIndependent = 0, //!< The link may be consulted
+                                      //!< in any order.
+                    kDependent   = 1  //!< The link, and which links
+                                      //!< precede it, stay as pushed.
+                };
+
             public:
                 Chain(void);
+                explicit Chain(const Clock::Base & inClock);
+                Chain(const Chain & inChain);
                 virtual ~Chain(void);
 
-                virtual bool Allow(Level inLevel);
-                virtual bool Allow(Level inLevel, const char * inMessage);
+                Chain & operator =(const Chain & inChain);
+
+                /**
+                 *  @brief
+                 *    Push a copy of the specified filter onto the
+                 *    trailing link of the chain.
+                 *
+                 *  @tparam     Derived  The derived type for the
+                 *                       filter to be pushed/added.
+                 *  @param[in]  inLink   An immutable reference to the
+                 *                       filter to be added to the
+                 *                       chain.
+                 *  @param[in]  inOrder  Whether the link may be
+                 *                       reordered in adaptive mode.
+                 *
+                 */
+                template <typename Derived>
+                void Push(const Derived & inLink, Order inOrder = Order::kIndependent)
+                {
+                    Log::Chain<Base>::Push(inLink);
+
+                    mIndex->mOrders.push_back(inOrder);
+
+                    Split();
+
+                    AdoptTrailingLink();
+
+                    InvalidateCopies();
+                }
+
+                void Pop(void);
+                void Reset(void);
+
+                void SetAdaptive(bool inAdaptive);
+                bool IsAdaptive(void) const;
+
+                Level * GetLevelLink(void) const;
+                Quiet * GetQuietLink(void) const;
+
+                virtual uint64_t GetLevelLimit(void) const;
+
+                virtual bool Allow(Log::Level inLevel);
+                virtual bool Allow(Log::Level inLevel, const char * inMessage);
+
+                virtual bool NeedsFormat(void) const;
+                virtual bool NeedsLast(void) const;
+                virtual bool AllowFormat(Log::Level inLevel, const char * inFormat);
+
+                virtual bool NeedsMessage(void) const;
+                virtual bool AllowMessage(Log::Level inLevel, const char * inMessage);
+
+            private:
+                typedef std::vector<Base *>  links_type;
+                typedef std::vector<Order>   orders_type;
+                typedef std::vector<Chain *> copies_type;
+
+                struct Adaptation;
+
+                // The links, indexed by role, such that each may be
+                // reached without walking, or testing the type of,
+                // every link.
+
+                struct Index
+                {
+                    links_type                    mFormatLinks;  //!< The links that
+                                                                 //!< need the format
+                                                                 //!< string.
+                    links_type                    mMessageLinks; //!< The links that
+                                                                 //!< need message
+                                                                 //!< content.
+                    Level *                       mLevelLink;    //!< The leading
+                                                                 //!< level link, if
+                                                                 //!< any.
+                    Quiet *                       mQuietLink;    //!< The leading
+                                                                 //!< quiet link, if
+                                                                 //!< any.
+                    bool                          mLast;         //!< Whether any
+                                                                 //!< link must be
+                                                                 //!< consulted last
+                                                                 //!< on the format
+                                                                 //!< string.
+                    orders_type                   mOrders;       //!< The order of
+                                                                 //!< each link, as
+                                                                 //!< pushed.
+                    copies_type                   mCopies;       //!< The copies of
+                                                                 //!< the chain
+                                                                 //!< sharing the
+                                                                 //!< links.
+                    bool                          mAdaptive;     //!< Whether the
+                                                                 //!< links are
+                                                                 //!< reordered.
+                    const Clock::Base *           mClock;        //!< The clock
+                                                                 //!< sampled links
+                                                                 //!< are timed by.
+                    boost::shared_ptr<Adaptation> mAdaptation;   //!< The samples and
+                                                                 //!< order of each
+                                                                 //!< phase, if
+                                                                 //!< adaptive.
+                };
+
+                void Split(void);
+
+                void AdoptLinks(void);
+                void DisownLinks(void);
+                void AdoptTrailingLink(void);
+                void DisownTrailingLink(void);
+                void DisownSharedLinks(void);
+                void InvalidateCopies(void);
+
+            private:
+                boost::shared_ptr<Index> mIndex; //!< The index of the links,
+                                                 //!< shared, as are the links
+                                                 //!< themselves, among
+                                                 //!< copies of the chain.
             };
 
         }; // namespace Filter
@@ -0,0 +1,131 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete filter
+ *      implementation that suppresses repeats of recent logged
+ *      messages.
+ */
+
+#ifndef LOGUTILITIES_LOGFILTERDEDUPE_HPP
+#define LOGUTILITIES_LOGFILTERDEDUPE_HPP
+
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include "LogClockBase.hpp"
+#include "LogFilterBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Writer
+        {
+
+            class Base;
+
+        }; // namespace Writer
+
+        namespace Filter
+        {
+
+            /**
+             *  @brief
+             *    Log filter object that suppresses repeats of recent
+             *    logged messages.
+             *
+             *  Each formatted message is hashed into a fixed-size
+             *  table of recent messages. A message whose hash was
+             *  passed less than a window ago is a repeat and is
+             *  rejected and counted; otherwise, it is passed and
+             *  takes over its slot in the table. The table is updated
+             *  with atomic operations alone, so the filter neither
+             *  locks nor allocates while filtering.
+             *
+             *  Since only hashes are kept, messages are compared by
+             *  hash alone and, since the table is direct-mapped,
+             *  recent messages that share a slot evict one another.
+             *  Concurrent writers of the same message may
+             *  occasionally both pass it.
+             *
+             *  As syslogd does, when a repeated message is passed
+             *  again after its window, "last message repeated N
+             *  times" is written, ahead of it, to the summary writer,
+             *  if any. The repeats of a message that is evicted, or
+             *  that is never written again, are instead summarized as
+             *  "earlier message repeated N times" when its slot is
+             *  taken over or when the filter is flushed,
+             *  respectively.
+             *
+             *  Copies of the filter, such as the one pushed onto a
+             *  Filter::Chain, share their table and counters.
+             *
+             *  @ingroup filter
+             *
+             */
+            class Dedupe :
+                public Base
+            {
+            public:
+                static const size_t kSlots = 256;
+
+            public:
+                Dedupe(uint32_t inWindow);
+                Dedupe(uint32_t inWindow, Writer::Base & inSummaryWriter);
+                Dedupe(Clock::Ticks        inWindow,
+                       Writer::Base *      inSummaryWriter,
+                       const Clock::Base & inClock);
+                Dedupe(const Dedupe & inFilter);
+                virtual ~Dedupe(void);
+
+                Dedupe & operator =(const Dedupe & inFilter);
+
+                Clock::Ticks GetWindow(void) const;
+
+                void         Flush(void);
+
+                // Counters
+
+                uint64_t     GetSuppressed(void) const;
+
+                virtual bool Allow(Log::Level inLevel);
+                virtual bool Allow(Log::Level inLevel, const char * inMessage);
+
+                virtual bool AllowMessage(Log::Level inLevel, const char * inMessage);
+
+            private:
+                struct Implementation;
+
+                /**
+                 *  A shared, reference-counted pointer to the filter
+                 *  implementation.
+                 */
+                boost::shared_ptr<Implementation> mImplementation;
+            };
+
+        }; // namespace Filter
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGFILTERDEDUPE_HPP */
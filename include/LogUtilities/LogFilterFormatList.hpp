@@ -0,0 +1,170 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete filter
+ *      implementation that passes or rejects logged messages, before
+ *      they are formatted, based on a list of format strings.
+ */
+
+#ifndef LOGUTILITIES_LOGFILTERFORMATLIST_HPP
+#define LOGUTILITIES_LOGFILTERFORMATLIST_HPP
+
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include "LogFilterBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Filter
+        {
+
+            /**
+             *  @brief
+             *    Log filter object that passes or rejects logged
+             *    messages, before they are formatted, based on a list
+             *    of format strings.
+             *
+             *  Since format strings are usually string literals, each
+             *  identifies its call site, so the list acts as an allow
+             *  or deny list of call sites, and a rejected message
+             *  costs neither formatting nor indentation.
+             *
+             *  Formats are keyed either by pointer identity, which is
+             *  cheapest but only matches the very literals listed
+             *  (for example, those retrieved with
+             *  Log::CallSite::Find), or by a hash of their content,
+             *  which matches equal strings anywhere.
+             *
+             *  Either way, the result for each format pointer is
+             *  cached in a fixed-size, lock-free table, such that a
+             *  format seen before costs one hash lookup.
+             *
+             *  Copies of the filter, such as the one pushed onto a
+             *  Filter::Chain, share the list and the cache.
+             *
+             *  @ingroup filter
+             *
+             */
+            class FormatList :
+                public Base
+            {
+            public:
+                /**
+                 *  @brief
+                 *    Match actions.
+                 *
+                 *    Match actions which determine what becomes of
+                 *    messages whose format is listed.
+                 */
+                enum class Action : uint8_t {
+                    kReject = 0, //!< Reject messages whose format is listed, passing the remainder.
+                    kPass   = 1  //!< Pass messages whose format is listed, rejecting the remainder.
+                };
+
+                /**
+                 *  @brief
+                 *    Format keys.
+                 *
+                 *    Format keys which determine when a format
+                 *    matches a listed one.
+                 */
+                enum class Key : uint8_t {
+                    kPointer = 0, //!< Match formats at the same address.
+                    kHash    = 1  //!< Match formats with the same content.
+                };
+
+                static const size_t kCacheSlots = 256;
+
+            public:
+                FormatList(Action inAction, Key inKey, const std::vector<const char *> & inFormats);
+                FormatList(const FormatList & inFilter);
+                virtual ~FormatList(void);
+
+                FormatList & operator =(const FormatList & inFilter);
+
+                Action GetAction(void) const;
+                Key    GetKey(void) const;
+                size_t GetFormats(void) const;
+
+                bool Contains(const char * inFormat) const;
+
+                virtual bool Allow(Log::Level inLevel);
+                virtual bool Allow(Log::Level inLevel, const char * inMessage);
+
+                virtual bool NeedsFormat(void) const;
+                virtual bool AllowFormat(Log::Level inLevel, const char * inFormat);
+
+                virtual bool NeedsMessage(void) const;
+
+            private:
+                struct Implementation;
+
+                /**
+                 *  A shared, reference-counted pointer to the filter
+                 *  implementation.
+                 */
+                boost::shared_ptr<Implementation> mImplementation;
+            };
+
+            /**
+             *  @brief
+             *    Return whether the filter needs the format string of
+             *    a message to pass or reject it.
+             *
+             *  @returns
+             *    True, since the filter decides on the format string
+             *    alone.
+             */
+            inline bool
+            FormatList::NeedsFormat(void) const
+            {
+                return (true);
+            }
+
+            /**
+             *  @brief
+             *    Return whether the filter needs the content of a
+             *    message to pass or reject it.
+             *
+             *  @returns
+             *    False, since the filter decides on the format string
+             *    alone.
+             */
+            inline bool
+            FormatList::NeedsMessage(void) const
+            {
+                return (false);
+            }
+
+        }; // namespace Filter
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGFILTERFORMATLIST_HPP */
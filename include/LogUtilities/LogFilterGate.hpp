@@ -0,0 +1,194 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities object for
+ *      testing, lock-free, whether a filter may pass messages at a
+ *      given level.
+ */
+
+#ifndef LOGUTILITIES_LOGFILTERGATE_HPP
+#define LOGUTILITIES_LOGFILTERGATE_HPP
+
+#include <atomic>
+#include <cstddef>
+
+#include <stdint.h>
+
+#include "LogTypes.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Writer
+        {
+
+            class Base;
+
+        }; // namespace Writer
+
+        namespace Filter
+        {
+
+            class Base;
+
+            /**
+             *  @brief
+             *    A lock-free, per-level enable bitmap for a filter.
+             *
+             *  A gate holds one bit for each of the first #kLevels
+             *  levels, set where its filter may pass messages at
+             *  that level, with the last bit standing for that level
+             *  and every one above it. Testing a level is then a
+             *  single, relaxed load.
+             *
+             *  Rather than being checked on each test, the bitmap is
+             *  recomputed from the level limit of the filter (see
+             *  Base::GetLevelLimit) whenever that may have changed,
+             *  which is whenever the filter, or a link it holds, is
+             *  invalidated. Only the gates of the filters so
+             *  invalidated are refreshed, under a lock, before the
+             *  change that invalidated them returns.
+             *
+             *  A gate may also be bound to a writer, in which case
+             *  only those levels the writer may write at (see
+             *  Writer::Base::GetLevels) are enabled, too.
+             *
+             *  A copy of a gate is bound to the same filter and
+             *  writer and is refreshed along with them, as any other
+             *  live gate.
+             *
+             *  @note
+             *    The filter and writer, if any, of a gate must remain
+             *    in scope for the lifetime of the gate.
+             *
+             *  @ingroup filter
+             *
+             */
+            class Gate
+            {
+            public:
+                /**
+                 *  The number of levels a gate distinguishes; levels
+                 *  at or above the last share its bit.
+                 */
+                static const Log::Level kLevels = 64;
+
+            public:
+                Gate(Base & inFilter);
+                Gate(Base & inFilter, const Writer::Base & inWriter);
+                Gate(const Gate & inGate);
+                ~Gate(void);
+
+                Gate & operator =(const Gate & inGate);
+
+                void Bind(Base & inFilter);
+                void Bind(const Writer::Base * inWriter);
+
+                bool     IsEnabled(Log::Level inLevel) const;
+                uint64_t GetLevels(void) const;
+
+                static uint64_t GetLevels(uint64_t inLevelLimit);
+                static uint64_t GetLevels(Log::Level inMinimum, Log::Level inMaximum);
+
+                static void Refresh(const Base & inFilter);
+                static void Refresh(const Writer::Base & inWriter);
+
+            private:
+                // The links of a gate into the list of the live gates
+                // of its filter or writer.
+
+                struct Links
+                {
+                    Gate * mPrevious; //!< The previous gate in the list.
+                    Gate * mNext;     //!< The next gate in the list.
+                };
+
+                void Insert(void);
+                void Remove(void);
+                void Update(void);
+
+                void Insert(Gate *& inGates, Links Gate::* inLinks);
+                void Remove(Gate *& inGates, Links Gate::* inLinks);
+
+            private:
+                static const size_t kCacheLineSize = 64;
+
+                Base *                mFilter;      //!< The filter gated.
+                const Writer::Base *  mWriter;      //!< The writer gated,
+                                                    //!< if any.
+                Links                 mFilterLinks; //!< The links among the
+                                                    //!< gates of the filter.
+                Links                 mWriterLinks; //!< The links among the
+                                                    //!< gates of the writer.
+
+                // Keep the bitmap on a cache line of its own such
+                // that reading it never contends with writes to
+                // neighboring data.
+
+                char                  mLeading[kCacheLineSize - sizeof(std::atomic<uint64_t>)];
+                std::atomic<uint64_t> mLevels;   //!< The enabled levels.
+                char                  mTrailing[kCacheLineSize - sizeof(std::atomic<uint64_t>)];
+            };
+
+            /**
+             *  @brief
+             *    Test whether the filter may pass a message at the
+             *    specified level.
+             *
+             *  @param[in]  inLevel  The level the message would be
+             *                       logged at.
+             *
+             *  @returns
+             *    False if the filter would certainly reject the
+             *    message on level alone; otherwise, true.
+             *
+             */
+            inline bool
+            Gate::IsEnabled(Log::Level inLevel) const
+            {
+                const Log::Level theBit = (inLevel < kLevels) ? inLevel : (kLevels - 1);
+
+                return (((mLevels.load(std::memory_order_relaxed) >> theBit) & 1) != 0);
+            }
+
+            /**
+             *  @brief
+             *    Return the enabled levels of the gate.
+             *
+             *  @returns
+             *    A bitmap with bit N set if messages at level N may
+             *    be passed.
+             *
+             */
+            inline uint64_t
+            Gate::GetLevels(void) const
+            {
+                return (mLevels.load(std::memory_order_relaxed));
+            }
+
+        }; // namespace Filter
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGFILTERGATE_HPP */
@@ -25,6 +25,8 @@
 #ifndef LOGUTILITIES_LOGFILTERLEVEL_HPP
 #define LOGUTILITIES_LOGFILTERLEVEL_HPP
 
+#include <atomic>
+
 #include "LogFilterBase.hpp"
 
 namespace Nuovations
@@ -56,18 +58,99 @@ namespace Nuovations
             public:
                 Level(void);
                 Level(Log::Level inLevel);
+                Level(const Level & inFilter);
                 virtual ~Level(void);
 
+                Level & operator =(const Level & inFilter);
+
                 Log::Level GetLevel(void) const;
                 void       SetLevel(Log::Level inLevel);
 
+                virtual uint64_t GetLevelLimit(void) const;
+
                 virtual bool Allow(Log::Level inLevel);
                 virtual bool Allow(Log::Level inLevel, const char * inMessage);
 
+                virtual bool NeedsMessage(void) const;
+
             private:
-                Log::Level mLevel; //!< Level setting that is compared against the logged message level to determine whether messages are passed (less than or equal to @ mLevel) or rejected (greater than @a mLevel).
+                std::atomic<Log::Level> mLevel; //!< Level setting that is compared against the logged message level to determine whether messages are passed (less than or equal to @ mLevel) or rejected (greater than @a mLevel).
             };
 
+            /**
+             *  @brief
+             *    Return the level limit of the filter.
+             *
+             *  @returns
+             *    One more than the filter level, since messages at the filter
+             *    level or lower are passed.
+             *
+             */
+            inline uint64_t
+            Level::GetLevelLimit(void) const
+            {
+                return (static_cast<uint64_t>(mLevel.load(std::memory_order_relaxed)) + 1);
+            }
+
+            /**
+             *  @brief
+             *    Pass or reject a message based on the specified level and the
+             *    current level of the filter.
+             *
+             *    Messages less than or equal to the current filter level are passed;
+             *    those greater than are rejected.
+             *
+             *  @param[in]  inLevel  The level the current message is to be logged at.
+             *
+             *  @returns
+             *    True if the log message should be passed; otherwise, false, if
+             *    the message should be rejected based on the current level of the
+             *    filter.
+             */
+            inline bool
+            Level::Allow(Log::Level inLevel)
+            {
+                return (inLevel <= mLevel.load(std::memory_order_relaxed));
+            }
+
+            /**
+             *  @brief
+             *    Pass or reject a message based on the specified level, the
+             *    message to be logged, and the current level of the filter.
+             *
+             *    Messages less than or equal to the current filter level are passed;
+             *    those greater than are rejected.
+             *
+             *  @param[in]  inLevel    The level the current message is to be logged at.
+             *  @param[in]  inMessage  The log message to be filtered.
+             *
+             *  @returns
+             *    True if the log message should be passed; otherwise, false, if
+             *    the message should be rejected based on the current level of the
+             *    filter.
+             */
+            inline bool
+            Level::Allow(Log::Level inLevel, const char * inMessage)
+            {
+                (void)inMessage;
+
+                return (Allow(inLevel));
+            }
+
+            /**
+             *  @brief
+             *    Return whether the filter needs the content of a message to
+             *    pass or reject it.
+             *
+             *  @returns
+             *    False, since the filter decides on the current level alone.
+             */
+            inline bool
+            Level::NeedsMessage(void) const
+            {
+                return (false);
+            }
+
         }; // namespace Filter
 
     }; // namespace Log
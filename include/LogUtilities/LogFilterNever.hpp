@@ -48,8 +48,40 @@ namespace Nuovations
             public:
                 Never(void);
                 virtual ~Never(void);
+
+                virtual uint64_t GetLevelLimit(void) const;
+
+                virtual bool Allow(Log::Level inLevel);
+                virtual bool Allow(Log::Level inLevel, const char * inMessage);
             };
 
+            // These are defined inline, with constant results, such
+            // that a statically-composed logger (see StaticLogger)
+            // may fold them away entirely.
+
+            inline uint64_t
+            Never::GetLevelLimit(void) const
+            {
+                return (kLevelLimitNone);
+            }
+
+            inline bool
+            Never::Allow(Log::Level inLevel)
+            {
+                (void)inLevel;
+
+                return (false);
+            }
+
+            inline bool
+            Never::Allow(Log::Level inLevel, const char * inMessage)
+            {
+                (void)inLevel;
+                (void)inMessage;
+
+                return (false);
+            }
+
         }; // namespace Filter
 
     }; // namespace Log
@@ -0,0 +1,126 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete filter
+ *      implementation that passes or rejects logged messages based on
+ *      whether they contain any of a set of patterns.
+ */
+
+#ifndef LOGUTILITIES_LOGFILTERPATTERN_HPP
+#define LOGUTILITIES_LOGFILTERPATTERN_HPP
+
+#include <string>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include "LogFilterBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Filter
+        {
+
+            /**
+             *  @brief
+             *    Log filter object that passes or rejects logged
+             *    messages based on whether they contain any of a set
+             *    of patterns.
+             *
+             *  Patterns are either literal substrings or, if they
+             *  contain any of '*', '?', '[', or '\\', shell-style
+             *  globs (see fnmatch(3)) that may match anywhere in the
+             *  message.
+             *
+             *  The patterns are compiled, once, into a single
+             *  Aho-Corasick automaton, such that a message is
+             *  searched for all of them in one pass. The automaton
+             *  matches literals directly and, for globs, their
+             *  longest literal run, only then confirming the glob
+             *  itself against the message. Globs without any literal
+             *  run are confirmed against every message.
+             *
+             *  Ahead of the automaton, a prefilter skips over bytes
+             *  that cannot begin a match, comparing sixteen at a time
+             *  where the processor supports it.
+             *
+             *  Copies of the filter, such as the one pushed onto a
+             *  Filter::Chain, share the compiled automaton, which is
+             *  immutable.
+             *
+             *  @ingroup filter
+             *
+             */
+            class Pattern :
+                public Base
+            {
+            public:
+                /**
+                 *  @brief
+                 *    Match actions.
+                 *
+                 *    Match actions which determine what becomes of
+                 *    messages that match.
+                 */
+                enum class Action : uint8_t {
+                    kReject = 0, //!< Reject messages that match any pattern, passing the remainder.
+                    kPass   = 1  //!< Pass messages that match any pattern, rejecting the remainder.
+                };
+
+            public:
+                Pattern(Action inAction, const std::vector<std::string> & inPatterns);
+                Pattern(const Pattern & inFilter);
+                virtual ~Pattern(void);
+
+                Pattern & operator =(const Pattern & inFilter);
+
+                Action GetAction(void) const;
+                size_t GetPatterns(void) const;
+
+                bool Match(const char * inMessage) const;
+
+                virtual bool Allow(Log::Level inLevel);
+                virtual bool Allow(Log::Level inLevel, const char * inMessage);
+
+                virtual bool AllowMessage(Log::Level inLevel, const char * inMessage);
+
+            private:
+                struct Implementation;
+
+                /**
+                 *  A shared, reference-counted pointer to the filter
+                 *  implementation.
+                 */
+                boost::shared_ptr<const Implementation> mImplementation;
+            };
+
+        }; // namespace Filter
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGFILTERPATTERN_HPP */
@@ -25,6 +25,8 @@
 #ifndef LOGUTILITIES_LOGFILTERQUIET_HPP
 #define LOGUTILITIES_LOGFILTERQUIET_HPP
 
+#include <atomic>
+
 #include "LogFilterBase.hpp"
 
 namespace Nuovations
@@ -51,18 +53,101 @@ namespace Nuovations
             public:
                 Quiet(void);
                 Quiet(bool inQuiet);
+                Quiet(const Quiet & inFilter);
                 virtual ~Quiet(void);
 
+                Quiet & operator =(const Quiet & inFilter);
+
                 bool GetQuiet(void) const;
                 void SetQuiet(bool inQuiet);
 
+                virtual uint64_t GetLevelLimit(void) const;
+
                 virtual bool Allow(Log::Level inLevel);
                 virtual bool Allow(Log::Level inLevel, const char * inMessage);
 
+                virtual bool NeedsMessage(void) const;
+
             private:
-                bool mQuiet; //!< Quiet setting that determines whether messages are passed (false) or rejected (true).
+                std::atomic<bool> mQuiet; //!< Quiet setting that determines whether messages are passed (false) or rejected (true).
             };
 
+            /**
+             *  @brief
+             *    Return the level limit of the filter.
+             *
+             *  @returns
+             *    #kLevelLimitNone if the filter is quiet; otherwise,
+             *    #kLevelLimitAll.
+             *
+             */
+            inline uint64_t
+            Quiet::GetLevelLimit(void) const
+            {
+                return (mQuiet.load(std::memory_order_relaxed) ? kLevelLimitNone : kLevelLimitAll);
+            }
+
+            /**
+             *  @brief
+             *    Pass or reject a message based on the specified level (unused)
+             *    and the current quiet state of the filter.
+             *
+             *    When the quiet state is asserted, messages are rejected; otherwise,
+             *    they are passed.
+             *
+             *  @param[in]  inLevel  The level the current message is to be logged at.
+             *
+             *  @returns
+             *    True if the log message should be passed; otherwise, false, if
+             *    the message should be rejected based on the current quiet state of
+             *    the filter.
+             */
+            inline bool
+            Quiet::Allow(Log::Level inLevel)
+            {
+                (void)inLevel;
+
+                return (!mQuiet.load(std::memory_order_relaxed));
+            }
+
+            /**
+             *  @brief
+             *    Pass or reject a message based on the specified level, the
+             *    message to be logged, and the current quiet state of the filter.
+             *
+             *    When the quiet state is asserted, messages are rejected; otherwise,
+             *    they are passed.
+             *
+             *  @param[in]  inLevel    The level the current message is to be logged at.
+             *  @param[in]  inMessage  The log message to be filtered.
+             *
+             *  @returns
+             *    True if the log message should be passed; otherwise, false, if
+             *    the message should be rejected based on the current quiet state of
+             *    the filter.
+             */
+            inline bool
+            Quiet::Allow(Log::Level inLevel, const char * inMessage)
+            {
+                (void)inMessage;
+
+                return (Allow(inLevel));
+            }
+
+            /**
+             *  @brief
+             *    Return whether the filter needs the content of a message to
+             *    pass or reject it.
+             *
+             *  @returns
+             *    False, since the filter decides on the current quiet state alone.
+             */
+            inline bool
+            Quiet::NeedsMessage(void) const
+            {
+                return (false);
+            }
+
         }; // namespace Filter
 
     }; // namespace Log
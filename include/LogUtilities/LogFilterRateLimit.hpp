@@ -0,0 +1,182 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete filter
+ *      implementation that limits the rate of logged messages with
+ *      per-key token buckets.
+ */
+
+#ifndef LOGUTILITIES_LOGFILTERRATELIMIT_HPP
+#define LOGUTILITIES_LOGFILTERRATELIMIT_HPP
+
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include "LogClockBase.hpp"
+#include "LogFilterBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Writer
+        {
+
+            class Base;
+
+        }; // namespace Writer
+
+        namespace Filter
+        {
+
+            /**
+             *  @brief
+             *    Log filter object that limits the rate of logged
+             *    messages with per-key token buckets.
+             *
+             *  Each key is allowed a burst of messages, after which
+             *  its messages are passed at the sustained rate and the
+             *  remainder are rejected and counted as suppressed. The
+             *  buckets are updated with a single compare-and-swap, so
+             *  the filter takes no locks.
+             *
+             *  Messages are keyed by level, by format string, or by
+             *  the call site that wrote them. Formats are seen before
+             *  formatting (see #AllowFormat) or, when filtered
+             *  without them, taken from the call site. Call sites are
+             *  only known for messages written through the logging
+             *  macros (see Log::CallSite::GetCurrent). Messages whose
+             *  key is unknown are keyed by level instead.
+             *
+             *  The buckets form fixed-size tables, one for levels and
+             *  one for other keys, such that the filter never
+             *  allocates while filtering. Each bucket records the key
+             *  that claimed it and a key whose hash collides with
+             *  another probes for the next unclaimed bucket, so
+             *  distinct keys are limited, and summarized, apart.
+             *  Once every bucket for other keys is claimed, further
+             *  keys are limited by level instead, as are levels
+             *  sharing a bucket once every level bucket is claimed.
+             *
+             *  When a key whose messages were suppressed passes a
+             *  message again, a summary of the number suppressed is
+             *  written, ahead of that message, to the summary writer,
+             *  if any. Under sustained overload, this happens once
+             *  for each message passed.
+             *
+             *  Copies of the filter, such as the one pushed onto a
+             *  Filter::Chain, share their buckets and counters.
+             *
+             *  Since passing a message consumes from its bucket, the
+             *  filter passes every message on level alone and
+             *  consumes only once consulted on its format string (see
+             *  #NeedsLast), which a chain does after every other link
+             *  has passed the message on level and format string,
+             *  wherever the filter was pushed.
+             *
+             *  @ingroup filter
+             *
+             */
+            class RateLimit :
+                public Base
+            {
+            public:
+                /**
+                 *  @brief
+                 *    Bucket keys.
+                 *
+                 *    Bucket keys which determine which messages are
+                 *    limited together.
+                 */
+                enum class Key : uint8_t {
+                    kLevel    = 0, //!< Limit the messages at each level together.
+                    kFormat   = 1, //!< Limit the messages with each format string together.
+                    kCallSite = 2  //!< Limit the messages from each call site together.
+                };
+
+                static const size_t kBuckets = 64;
+
+            public:
+                RateLimit(Key inKey, uint32_t inRate, uint32_t inBurst);
+                RateLimit(Key            inKey,
+                          uint32_t       inRate,
+                          uint32_t       inBurst,
+                          Writer::Base & inSummaryWriter);
+                RateLimit(Key                 inKey,
+                          Clock::Ticks        inInterval,
+                          uint32_t            inBurst,
+                          Writer::Base *      inSummaryWriter,
+                          const Clock::Base & inClock);
+                RateLimit(const RateLimit & inFilter);
+                virtual ~RateLimit(void);
+
+                RateLimit & operator =(const RateLimit & inFilter);
+
+                Key          GetKey(void) const;
+                Clock::Ticks GetInterval(void) const;
+                uint32_t     GetBurst(void) const;
+
+                // Counters
+
+                uint64_t     GetSuppressed(void) const;
+
+                virtual bool Allow(Log::Level inLevel);
+                virtual bool Allow(Log::Level inLevel, const char * inMessage);
+
+                virtual bool NeedsFormat(void) const;
+                virtual bool NeedsLast(void) const;
+                virtual bool AllowFormat(Log::Level inLevel, const char * inFormat);
+
+                virtual bool NeedsMessage(void) const;
+
+            private:
+                struct Implementation;
+
+                /**
+                 *  A shared, reference-counted pointer to the filter
+                 *  implementation.
+                 */
+                boost::shared_ptr<Implementation> mImplementation;
+            };
+
+            /**
+             *  @brief
+             *    Return whether the filter needs the content of a
+             *    message to pass or reject it.
+             *
+             *  @returns
+             *    False, since the filter decides on the key of the
+             *    message alone.
+             */
+            inline bool
+            RateLimit::NeedsMessage(void) const
+            {
+                return (false);
+            }
+
+        }; // namespace Filter
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGFILTERRATELIMIT_HPP */
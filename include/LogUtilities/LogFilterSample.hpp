@@ -0,0 +1,323 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete filter
+ *      implementation that passes a sample of logged messages.
+ */
+
+#ifndef LOGUTILITIES_LOGFILTERSAMPLE_HPP
+#define LOGUTILITIES_LOGFILTERSAMPLE_HPP
+
+#include <atomic>
+
+#include <stdint.h>
+
+#include "LogFilterBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Filter
+        {
+
+            /**
+             *  @brief
+             *    Log filter object that passes a sample of logged
+             *    messages.
+             *
+             *    One in every period of the messages at or above the
+             *    sampled level is passed, chosen either at random,
+             *    by counting, or by the request the message belongs
+             *    to. Messages below the sampled level, which are
+             *    the more important ones, are always passed.
+             *
+             *    Random sampling draws from a per-thread
+             *    pseudo-random generator, such that threads never
+             *    contend. Counting passes exactly every period-th
+             *    message, across all threads.
+             *
+             *    Request sampling passes all of the messages for one
+             *    in every period of the requests, such that the
+             *    messages for a request are kept or discarded
+             *    together. The request the calling thread is serving
+             *    is set with Sample::Scope and the decision is a
+             *    hash of its identifier, so it is also consistent
+             *    across processes. Messages written outside of any
+             *    request are passed.
+             *
+             *  @ingroup filter
+             *
+             */
+            class Sample :
+                public Base
+            {
+            public:
+                class Scope;
+
+                /**
+                 *  @brief
+                 *    Sampling modes.
+                 *
+                 *    Sampling modes which determine how the messages
+                 *    passed are chosen.
+                 */
+                enum class Mode : uint8_t {
+                    kRandom  = 0, //!< Pass each message with a probability of one in the period.
+                    kCount   = 1, //!< Pass every period-th message.
+                    kRequest = 2  //!< Pass the messages of one in every period of the requests.
+                };
+
+                /**
+                 *  The request identifier indicating that the calling
+                 *  thread is not serving a request.
+                 */
+                static const uint64_t kRequestNone = 0;
+
+            public:
+                Sample(Mode inMode, uint32_t inPeriod);
+                Sample(Mode inMode, uint32_t inPeriod, Log::Level inLevel);
+                Sample(const Sample & inFilter);
+                virtual ~Sample(void);
+
+                Sample & operator =(const Sample & inFilter);
+
+                Mode       GetMode(void) const;
+                uint32_t   GetPeriod(void) const;
+                Log::Level GetLevel(void) const;
+
+                virtual bool Allow(Log::Level inLevel);
+                virtual bool Allow(Log::Level inLevel, const char * inMessage);
+
+                virtual bool NeedsMessage(void) const;
+
+                static uint64_t GetRequest(void);
+
+            private:
+                bool Choose(void);
+
+                static uint64_t Draw(void);
+                static uint64_t Hash(uint64_t inValue);
+
+            private:
+                Mode                  mMode;      //!< How the messages
+                                                  //!< passed are chosen.
+                uint32_t              mPeriod;    //!< One more than the
+                                                  //!< number of messages
+                                                  //!< rejected for each
+                                                  //!< one passed.
+                uint64_t              mThreshold; //!< The value below
+                                                  //!< which the upper
+                                                  //!< half of a draw or
+                                                  //!< hash passes a
+                                                  //!< message.
+                Log::Level            mLevel;     //!< The level at or
+                                                  //!< above which
+                                                  //!< messages are
+                                                  //!< sampled.
+                std::atomic<uint64_t> mCount;     //!< The number of
+                                                  //!< messages counted.
+
+                static thread_local uint64_t sRequest;
+                static thread_local uint64_t sState;
+            };
+
+            /**
+             *  @brief
+             *    An object that sets the request the calling thread
+             *    is serving for as long as it is in scope.
+             *
+             */
+            class Sample::Scope
+            {
+            public:
+                Scope(uint64_t inRequest);
+                ~Scope(void);
+
+            private:
+                Scope(const Scope & inScope) = delete;
+                Scope & operator =(const Scope & inScope) = delete;
+
+            private:
+                const uint64_t mPrevious; //!< The request served
+                                          //!< before this scope.
+            };
+
+            /**
+             *  @brief
+             *    Pass or reject a message based on the specified level
+             *    and the sampling mode of the filter.
+             *
+             *  @param[in]  inLevel  The level the current message is
+             *                       to be logged at.
+             *
+             *  @returns
+             *    True if the message is below the sampled level or is
+             *    chosen by the sample; otherwise, false.
+             */
+            inline bool
+            Sample::Allow(Log::Level inLevel)
+            {
+                return ((inLevel < mLevel) || Choose());
+            }
+
+            /**
+             *  @brief
+             *    Pass or reject a message based on the specified level
+             *    and the sampling mode of the filter.
+             *
+             *  @param[in]  inLevel    The level the current message
+             *                         is to be logged at.
+             *  @param[in]  inMessage  The log message to be filtered,
+             *                         which is ignored.
+             *
+             *  @returns
+             *    True if the message is below the sampled level or is
+             *    chosen by the sample; otherwise, false.
+             */
+            inline bool
+            Sample::Allow(Log::Level inLevel, const char * inMessage)
+            {
+                (void)inMessage;
+
+                return (Allow(inLevel));
+            }
+
+            /**
+             *  @brief
+             *    Return whether the filter needs the content of a
+             *    message to pass or reject it.
+             *
+             *  @returns
+             *    False, since the filter decides without the message.
+             */
+            inline bool
+            Sample::NeedsMessage(void) const
+            {
+                return (false);
+            }
+
+            /**
+             *  @brief
+             *    Return the request the calling thread is serving.
+             *
+             *  @returns
+             *    The identifier of the current request or
+             *    #kRequestNone if there is none.
+             *
+             */
+            inline uint64_t
+            Sample::GetRequest(void)
+            {
+                return (sRequest);
+            }
+
+            // Return whether the sample chooses the current message.
+
+            inline bool
+            Sample::Choose(void)
+            {
+                switch (mMode) {
+
+                case Mode::kRandom:
+                    return ((Draw() >> 32) < mThreshold);
+
+                case Mode::kCount:
+                    return ((mCount.fetch_add(1, std::memory_order_relaxed) % mPeriod) == 0);
+
+                case Mode::kRequest:
+                    return ((sRequest == kRequestNone) ||
+                            ((Hash(sRequest) >> 32) < mThreshold));
+
+                }
+
+                return (true);
+            }
+
+            // Return the next value from the calling thread's
+            // xorshift64* generator, seeding it on first use.
+
+            inline uint64_t
+            Sample::Draw(void)
+            {
+                uint64_t theState = sState;
+
+                if (theState == 0) {
+                    theState = Hash(reinterpret_cast<uintptr_t>(&sState)) | 1;
+                }
+
+                theState ^= theState >> 12;
+                theState ^= theState << 25;
+                theState ^= theState >> 27;
+
+                sState = theState;
+
+                return (theState * 0x2545F4914F6CDD1DULL);
+            }
+
+            // Return a well-mixed hash of the specified value.
+
+            inline uint64_t
+            Sample::Hash(uint64_t inValue)
+            {
+                inValue ^= inValue >> 33;
+                inValue *= 0xFF51AFD7ED558CCDULL;
+                inValue ^= inValue >> 33;
+                inValue *= 0xC4CEB9FE1A85EC53ULL;
+                inValue ^= inValue >> 33;
+
+                return (inValue);
+            }
+
+            /**
+             *  @brief
+             *    This is the class constructor.
+             *
+             *  @param[in]  inRequest  The identifier of the request the
+             *                         calling thread is serving.
+             *
+             */
+            inline
+            Sample::Scope::Scope(uint64_t inRequest) :
+                mPrevious(sRequest)
+            {
+                sRequest = inRequest;
+            }
+
+            /**
+             *  @brief
+             *    This is the class destructor, restoring the request
+             *    that was served before.
+             *
+             */
+            inline
+            Sample::Scope::~Scope(void)
+            {
+                sRequest = mPrevious;
+            }
+
+        }; // namespace Filter
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGFILTERSAMPLE_HPP */
@@ -0,0 +1,672 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities template filter
+ *      that composes a fixed chain of filters at compile time.
+ */
+
+#ifndef LOGUTILITIES_LOGFILTERSTATICCHAIN_HPP
+#define LOGUTILITIES_LOGFILTERSTATICCHAIN_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+#include <stdint.h>
+
+#include "LogFilterBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Filter
+        {
+
+            /**
+             *  @brief
+             *    Log filter object that passes a message only if
+             *    every link in a chain of filters, fixed at compile
+             *    time, passes it.
+             *
+             *  Unlike Chain, the links are held by value, in order,
+             *  and each is invoked directly rather than through its
+             *  virtual interface. Links whose filtering is inline
+             *  (for example, Always, Never, Level, and Quiet) are
+             *  therefore inlined into the chain and links with a
+             *  constant result fold away entirely.
+             *
+             *  The chain is itself a filter and may be used anywhere
+             *  one is, including by Logger.
+             *
+             *  @tparam  Filters  The concrete type of each link, in the
+             *                    order the links are consulted.
+             *
+             *  @ingroup filter
+             *
+             */
+            template <typename... Filters>
+            class StaticChain :
+                public Base
+            {
+                static_assert(sizeof...(Filters) > 0, "a static filter chain must have at least one link");
+
+            public:
+                typedef std::tuple<Filters...> container_type;
+
+                template <size_t N>
+                using link_type = typename std::tuple_element<N, container_type>::type;
+
+            public:
+                StaticChain(void);
+                explicit StaticChain(const Filters &... inLinks);
+                StaticChain(const StaticChain & inChain);
+                virtual ~StaticChain(void);
+
+                StaticChain & operator =(const StaticChain & inChain);
+
+                template <size_t N>
+                link_type<N> &       Link(void);
+                template <size_t N>
+                const link_type<N> & Link(void) const;
+
+                static constexpr size_t Size(void);
+
+                virtual uint64_t GetLevelLimit(void) const;
+
+                virtual bool Allow(Log::Level inLevel);
+                virtual bool Allow(Log::Level inLevel, const char * inMessage);
+
+                virtual bool NeedsFormat(void) const;
+                virtual bool NeedsLast(void) const;
+                virtual bool AllowFormat(Log::Level inLevel, const char * inFormat);
+
+                virtual bool NeedsMessage(void) const;
+                virtual bool AllowMessage(Log::Level inLevel, const char * inMessage);
+
+            private:
+                template <size_t N>
+                using Index = std::integral_constant<size_t, N>;
+
+                typedef Index<sizeof...(Filters)> End;
+
+                void AdoptLinks(End);
+                template <size_t N>
+                void AdoptLinks(Index<N>);
+
+                void DisownLinks(End);
+                template <size_t N>
+                void DisownLinks(Index<N>);
+
+                uint64_t GetLevelLimit(End) const;
+                template <size_t N>
+                uint64_t GetLevelLimit(Index<N>) const;
+
+                bool Allow(Log::Level inLevel, End);
+                template <size_t N>
+                bool Allow(Log::Level inLevel, Index<N>);
+
+                bool Allow(Log::Level inLevel, const char * inMessage, End);
+                template <size_t N>
+                bool Allow(Log::Level inLevel, const char * inMessage, Index<N>);
+
+                bool NeedsFormat(End) const;
+                template <size_t N>
+                bool NeedsFormat(Index<N>) const;
+
+                bool NeedsLast(End) const;
+                template <size_t N>
+                bool NeedsLast(Index<N>) const;
+
+                bool AllowFormat(Log::Level inLevel, const char * inFormat, bool inLast, End);
+                template <size_t N>
+                bool AllowFormat(Log::Level inLevel, const char * inFormat, bool inLast, Index<N>);
+
+                bool NeedsMessage(End) const;
+                template <size_t N>
+                bool NeedsMessage(Index<N>) const;
+
+                bool AllowMessage(Log::Level inLevel, const char * inMessage, End);
+                template <size_t N>
+                bool AllowMessage(Log::Level inLevel, const char * inMessage, Index<N>);
+
+            private:
+                container_type mLinks; //!< The links of the chain.
+            };
+
+            /**
+             *  @brief
+             *    This is the class default constructor, default
+             *    constructing each link.
+             *
+             */
+            template <typename... Filters>
+            StaticChain<Filters...>::StaticChain(void) :
+                Base(),
+                mLinks()
+            {
+                AdoptLinks(Index<0>());
+            }
+
+            /**
+             *  @brief
+             *    This is a class constructor, copying each link from
+             *    the specified filters.
+             *
+             *  @param[in]  inLinks  Immutable references to the filters
+             *                       to copy, in link order.
+             *
+             */
+            template <typename... Filters>
+            StaticChain<Filters...>::StaticChain(const Filters &... inLinks) :
+                Base(),
+                mLinks(inLinks...)
+            {
+                AdoptLinks(Index<0>());
+            }
+
+            /**
+             *  @brief
+             *    This is the class copy constructor, copying each link
+             *    from the specified chain.
+             *
+             *  @param[in]  inChain  An immutable reference to the chain
+             *                       to copy.
+             *
+             */
+            template <typename... Filters>
+            StaticChain<Filters...>::StaticChain(const StaticChain & inChain) :
+                Base(inChain),
+                mLinks(inChain.mLinks)
+            {
+                AdoptLinks(Index<0>());
+            }
+
+            /**
+             *  @brief
+             *    This is the class destructor.
+             *
+             */
+            template <typename... Filters>
+            StaticChain<Filters...>::~StaticChain(void)
+            {
+                DisownLinks(Index<0>());
+            }
+
+            /**
+             *  @brief
+             *    This is the class assignment operator, assigning each
+             *    link from the specified chain.
+             *
+             *  @param[in]  inChain  An immutable reference to the chain
+             *                       to assign from.
+             *
+             *  @returns
+             *    A reference to the chain.
+             *
+             */
+            template <typename... Filters>
+            StaticChain<Filters...> &
+            StaticChain<Filters...>::operator =(const StaticChain & inChain)
+            {
+                if (this != &inChain) {
+                    Base::operator =(inChain);
+
+                    mLinks = inChain.mLinks;
+
+                    Invalidate();
+                }
+
+                return (*this);
+            }
+
+            /**
+             *  @brief
+             *    Return a reference to the link at the specified
+             *    position in the chain.
+             *
+             *  @tparam  N  The zero-based position of the link.
+             *
+             */
+            template <typename... Filters>
+            template <size_t N>
+            typename StaticChain<Filters...>::template link_type<N> &
+            StaticChain<Filters...>::Link(void)
+            {
+                return (std::get<N>(mLinks));
+            }
+
+            /**
+             *  @brief
+             *    Return an immutable reference to the link at the
+             *    specified position in the chain.
+             *
+             *  @tparam  N  The zero-based position of the link.
+             *
+             */
+            template <typename... Filters>
+            template <size_t N>
+            const typename StaticChain<Filters...>::template link_type<N> &
+            StaticChain<Filters...>::Link(void) const
+            {
+                return (std::get<N>(mLinks));
+            }
+
+            /**
+             *  @brief
+             *    Return the number of links in the chain.
+             *
+             */
+            template <typename... Filters>
+            constexpr size_t
+            StaticChain<Filters...>::Size(void)
+            {
+                return (sizeof...(Filters));
+            }
+
+            /**
+             *  @brief
+             *    Return the level limit of the chain.
+             *
+             *  @returns
+             *    The lowest level limit of any link in the chain.
+             *
+             */
+            template <typename... Filters>
+            uint64_t
+            StaticChain<Filters...>::GetLevelLimit(void) const
+            {
+                return (GetLevelLimit(Index<0>()));
+            }
+
+            /**
+             *  @brief
+             *    Pass or reject a message based on the specified level.
+             *
+             *  Links are consulted in order, stopping at the first
+             *  that rejects the message.
+             *
+             *  @param[in]  inLevel  The level the current message is to
+             *                       be logged at.
+             *
+             *  @returns
+             *    True if every link passes the message; otherwise,
+             *    false.
+             *
+             */
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::Allow(Log::Level inLevel)
+            {
+                return (Allow(inLevel, Index<0>()));
+            }
+
+            /**
+             *  @brief
+             *    Pass or reject a message based on the specified level
+             *    and the message to be logged.
+             *
+             *  Links are consulted in order, stopping at the first
+             *  that rejects the message.
+             *
+             *  @param[in]  inLevel    The level the current message is
+             *                         to be logged at.
+             *  @param[in]  inMessage  The log message to be filtered.
+             *
+             *  @returns
+             *    True if every link passes the message; otherwise,
+             *    false.
+             *
+             */
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::Allow(Log::Level inLevel, const char * inMessage)
+            {
+                return (Allow(inLevel, inMessage, Index<0>()));
+            }
+
+            /**
+             *  @brief
+             *    Return whether any link in the chain needs the
+             *    format string of a message to pass or reject it.
+             *
+             *  @returns
+             *    True if any link needs the format string; otherwise,
+             *    false.
+             *
+             */
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::NeedsFormat(void) const
+            {
+                return (NeedsFormat(Index<0>()));
+            }
+
+            /**
+             *  @brief
+             *    Return whether any link in the chain must be
+             *    consulted on the format string of a message after
+             *    every other filter.
+             *
+             *  @returns
+             *    True if any link must be consulted last; otherwise,
+             *    false.
+             *
+             */
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::NeedsLast(void) const
+            {
+                return (NeedsLast(Index<0>()));
+            }
+
+            /**
+             *  @brief
+             *    Pass or reject a message, before it is formatted,
+             *    based on its format string.
+             *
+             *  Only those links that need the format string are
+             *  consulted, in order, stopping at the first that
+             *  rejects the message. Links that must be consulted last
+             *  (see Base::NeedsLast), such as a rate limit, are
+             *  consulted after the rest, whatever their position.
+             *
+             *  @param[in]  inLevel   The level the current message is
+             *                        to be logged at.
+             *  @param[in]  inFormat  The printf-style format string of
+             *                        the message to be filtered.
+             *
+             *  @returns
+             *    True if every link that needs the format string
+             *    passes the message; otherwise, false.
+             *
+             */
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::AllowFormat(Log::Level inLevel, const char * inFormat)
+            {
+                return (AllowFormat(inLevel, inFormat, false, Index<0>()) &&
+                        AllowFormat(inLevel, inFormat, true, Index<0>()));
+            }
+
+            /**
+             *  @brief
+             *    Return whether any link in the chain needs the
+             *    content of a message to pass or reject it.
+             *
+             *  @returns
+             *    True if any link needs message content; otherwise,
+             *    false.
+             *
+             */
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::NeedsMessage(void) const
+            {
+                return (NeedsMessage(Index<0>()));
+            }
+
+            /**
+             *  @brief
+             *    Pass or reject a formatted message that has already
+             *    been passed by every link on its level.
+             *
+             *  Only those links that need message content are
+             *  consulted, in order, stopping at the first that
+             *  rejects the message. For links that decide on level
+             *  alone, the check folds away at compile time.
+             *
+             *  @param[in]  inLevel    The level the current message is
+             *                         to be logged at.
+             *  @param[in]  inMessage  The log message to be filtered.
+             *
+             *  @returns
+             *    True if every link that needs message content passes
+             *    the message; otherwise, false.
+             *
+             */
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::AllowMessage(Log::Level inLevel, const char * inMessage)
+            {
+                return (AllowMessage(inLevel, inMessage, Index<0>()));
+            }
+
+            // Record that the chain holds each of its links (see
+            // Owned::Adopt), such that a change to the level limit of
+            // any one of them refreshes the gates of the chain.
+
+            template <typename... Filters>
+            void
+            StaticChain<Filters...>::AdoptLinks(End)
+            {
+                return;
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            void
+            StaticChain<Filters...>::AdoptLinks(Index<N>)
+            {
+                Adopt(std::get<N>(mLinks));
+
+                AdoptLinks(Index<N + 1>());
+            }
+
+            // Record that the chain no longer holds its links (see
+            // Owned::Disown).
+
+            template <typename... Filters>
+            void
+            StaticChain<Filters...>::DisownLinks(End)
+            {
+                return;
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            void
+            StaticChain<Filters...>::DisownLinks(Index<N>)
+            {
+                Disown(std::get<N>(mLinks));
+
+                DisownLinks(Index<N + 1>());
+            }
+
+            // Each link is invoked with a qualified call to its own
+            // type's implementation, which bypasses virtual dispatch;
+            // the link, being held by value, is known to be of
+            // exactly that type.
+
+            template <typename... Filters>
+            uint64_t
+            StaticChain<Filters...>::GetLevelLimit(End) const
+            {
+                return (kLevelLimitAll);
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            uint64_t
+            StaticChain<Filters...>::GetLevelLimit(Index<N>) const
+            {
+                typedef link_type<N> Current;
+
+                return (std::min(std::get<N>(mLinks).Current::GetLevelLimit(),
+                                 GetLevelLimit(Index<N + 1>())));
+            }
+
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::Allow(Log::Level inLevel, End)
+            {
+                (void)inLevel;
+
+                return (true);
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            bool
+            StaticChain<Filters...>::Allow(Log::Level inLevel, Index<N>)
+            {
+                typedef link_type<N> Current;
+
+                return (std::get<N>(mLinks).Current::Allow(inLevel) &&
+                        Allow(inLevel, Index<N + 1>()));
+            }
+
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::Allow(Log::Level inLevel, const char * inMessage, End)
+            {
+                (void)inLevel;
+                (void)inMessage;
+
+                return (true);
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            bool
+            StaticChain<Filters...>::Allow(Log::Level inLevel, const char * inMessage, Index<N>)
+            {
+                typedef link_type<N> Current;
+
+                return (std::get<N>(mLinks).Current::Allow(inLevel, inMessage) &&
+                        Allow(inLevel, inMessage, Index<N + 1>()));
+            }
+
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::NeedsFormat(End) const
+            {
+                return (false);
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            bool
+            StaticChain<Filters...>::NeedsFormat(Index<N>) const
+            {
+                typedef link_type<N> Current;
+
+                return (std::get<N>(mLinks).Current::NeedsFormat() ||
+                        NeedsFormat(Index<N + 1>()));
+            }
+
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::NeedsLast(End) const
+            {
+                return (false);
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            bool
+            StaticChain<Filters...>::NeedsLast(Index<N>) const
+            {
+                typedef link_type<N> Current;
+
+                return (std::get<N>(mLinks).Current::NeedsLast() ||
+                        NeedsLast(Index<N + 1>()));
+            }
+
+            // Consult, on the format string, either the links that
+            // must be consulted last or the rest.
+
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::AllowFormat(Log::Level inLevel, const char * inFormat, bool inLast, End)
+            {
+                (void)inLevel;
+                (void)inFormat;
+                (void)inLast;
+
+                return (true);
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            bool
+            StaticChain<Filters...>::AllowFormat(Log::Level inLevel, const char * inFormat, bool inLast, Index<N>)
+            {
+                typedef link_type<N> Current;
+
+                Current & theLink = std::get<N>(mLinks);
+
+                return ((!theLink.Current::NeedsFormat() ||
+                         (theLink.Current::NeedsLast() != inLast) ||
+                         theLink.Current::AllowFormat(inLevel, inFormat)) &&
+                        AllowFormat(inLevel, inFormat, inLast, Index<N + 1>()));
+            }
+
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::NeedsMessage(End) const
+            {
+                return (false);
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            bool
+            StaticChain<Filters...>::NeedsMessage(Index<N>) const
+            {
+                typedef link_type<N> Current;
+
+                return (std::get<N>(mLinks).Current::NeedsMessage() ||
+                        NeedsMessage(Index<N + 1>()));
+            }
+
+            template <typename... Filters>
+            bool
+            StaticChain<Filters...>::AllowMessage(Log::Level inLevel, const char * inMessage, End)
+            {
+                (void)inLevel;
+                (void)inMessage;
+
+                return (true);
+            }
+
+            template <typename... Filters>
+            template <size_t N>
+            bool
+            StaticChain<Filters...>::AllowMessage(Log::Level inLevel, const char * inMessage, Index<N>)
+            {
+                typedef link_type<N> Current;
+
+                Current & theLink = std::get<N>(mLinks);
+
+                return ((!theLink.Current::NeedsMessage() ||
+                         theLink.Current::AllowMessage(inLevel, inMessage)) &&
+                        AllowMessage(inLevel, inMessage, Index<N + 1>()));
+            }
+
+        }; // namespace Filter
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGFILTERSTATICCHAIN_HPP */
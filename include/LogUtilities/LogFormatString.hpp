@@ -0,0 +1,535 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines Nuovations Log Utilities parsing of
+ *      printf-style format strings: at compile time, used by the log
+ *      macros to check their arguments against their formats, and at
+ *      run time, used to capture and render arguments.
+ */
+
+#ifndef LOGUTILITIES_LOGFORMATSTRING_HPP
+#define LOGUTILITIES_LOGFORMATSTRING_HPP
+
+#include <cstdarg>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include <stdint.h>
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        /**
+         *  @brief
+         *    Parsing of printf-style format strings.
+         *
+         *  A format string is parsed into the sequence of argument
+         *  slots its directives consume: a '*' width, a '*'
+         *  precision, or a conversion. Each slot is identified by a
+         *  pointer to its character within the format string (the
+         *  '*' or the conversion specifier) and the end of the
+         *  sequence by a pointer to the terminating null character.
+         *
+         *  Every function here, but for Parse and Append, is
+         *  constexpr such that, for a string literal, parsing is done
+         *  entirely by the compiler. Text between directives is
+         *  scanned eight characters per step to keep the recursion
+         *  depth well within the compiler's constexpr limits for long
+         *  messages.
+         *
+         *  At run time, Parse breaks a single directive down into its
+         *  parts. Both it and the compile-time checks classify each
+         *  conversion with Classify, such that they agree on the type
+         *  of argument every directive consumes.
+         *
+         */
+        namespace FormatString
+        {
+
+            /**
+             *  @brief
+             *    An empty list of argument types.
+             *
+             */
+            template <typename... Args>
+            struct TypeList
+            {
+                constexpr TypeList(void) { }
+            };
+
+            /**
+             *  @brief
+             *    Deduce the list of types of the specified arguments.
+             *
+             *  This is only ever named in an unevaluated operand and
+             *  is therefore never defined.
+             *
+             */
+            template <typename... Args>
+            TypeList<Args...> TypesOf(const Args &... inArguments);
+
+            /**
+             *  @brief
+             *    Whether an expression, of the specified declared
+             *    type, is a string literal, which may be parsed at
+             *    compile time.
+             *
+             *  A string literal is an lvalue array of const char. A
+             *  pointer, or a named array, is not, and a format given
+             *  as one is only parsed at run time.
+             *
+             */
+            template <typename Format>
+            struct IsStringLiteral :
+                std::false_type
+            {
+            };
+
+            template <size_t N>
+            struct IsStringLiteral<const char (&)[N]> :
+                std::true_type
+            {
+            };
+
+            // Character classes
+
+            constexpr bool
+            IsText(char inCharacter)
+            {
+                return ((inCharacter != '%') && (inCharacter != '\0'));
+            }
+
+            constexpr bool
+            IsDigit(char inCharacter)
+            {
+                return ((inCharacter >= '0') && (inCharacter <= '9'));
+            }
+
+            constexpr bool
+            IsOneOf(char inCharacter, const char * inSet)
+            {
+                return ((*inSet != '\0') &&
+                        ((*inSet == inCharacter) || IsOneOf(inCharacter, inSet + 1)));
+            }
+
+            constexpr bool
+            IsFlag(char inCharacter)
+            {
+                return (IsOneOf(inCharacter, "-+ #0'I"));
+            }
+
+            constexpr bool
+            IsLength(char inCharacter)
+            {
+                return (IsOneOf(inCharacter, "hlLqjzZt"));
+            }
+
+            /**
+             *  @brief
+             *    The type of argument a conversion directive consumes.
+             *
+             */
+            enum class Kind : uint8_t
+            {
+                kInvalid = 0, //!< An unknown conversion.
+                kPercent,     //!< A literal '%'; no argument.
+                kInt,         //!< An int (or a promoted char or short).
+                kLong,        //!< A long.
+                kLongLong,    //!< A long long.
+                kIntMax,      //!< An intmax_t.
+                kSize,        //!< A size_t.
+                kPtrDiff,     //!< A ptrdiff_t.
+                kDouble,      //!< A double (or a promoted float).
+                kLongDouble,  //!< A long double.
+                kPointer,     //!< A void pointer.
+                kWideInt,     //!< A wint_t.
+                kString,      //!< A null-terminated narrow string.
+                kWideString,  //!< A null-terminated wide string.
+                kCount,       //!< A pointer for %n, which is not written to.
+                kError        //!< The description of errno for %m; no argument.
+            };
+
+            constexpr Kind
+            ClassifyInteger(char inLength, char inRepeat)
+            {
+                return ((inLength == 'l')                        ? ((inRepeat == 'l') ? Kind::kLongLong : Kind::kLong) :
+                        ((inLength == 'L') || (inLength == 'q')) ? Kind::kLongLong :
+                        (inLength == 'j')                        ? Kind::kIntMax :
+                        ((inLength == 'z') || (inLength == 'Z')) ? Kind::kSize :
+                        (inLength == 't')                        ? Kind::kPtrDiff :
+                        Kind::kInt);
+            }
+
+            /**
+             *  @brief
+             *    Return the type of argument consumed by a conversion
+             *    with the specified length modifier.
+             *
+             *  @param[in]  inLength      The length modifier, or the
+             *                            null character if none.
+             *  @param[in]  inRepeat      The second character of a
+             *                            doubled ("hh" or "ll")
+             *                            length modifier, or the
+             *                            null character if none.
+             *  @param[in]  inConversion  The conversion specifier.
+             *
+             */
+            constexpr Kind
+            Classify(char inLength, char inRepeat, char inConversion)
+            {
+                return (IsOneOf(inConversion, "diouxX")   ? ClassifyInteger(inLength, inRepeat) :
+                        IsOneOf(inConversion, "aAeEfFgG") ? ((inLength == 'L') ? Kind::kLongDouble : Kind::kDouble) :
+                        (inConversion == 'c')             ? ((inLength == 'l') ? Kind::kWideInt : Kind::kInt) :
+                        (inConversion == 'C')             ? Kind::kWideInt :
+                        (inConversion == 's')             ? ((inLength == 'l') ? Kind::kWideString : Kind::kString) :
+                        (inConversion == 'S')             ? Kind::kWideString :
+                        (inConversion == 'p')             ? Kind::kPointer :
+                        (inConversion == 'n')             ? Kind::kCount :
+                        (inConversion == 'm')             ? Kind::kError :
+                        Kind::kInvalid);
+            }
+
+            // Scanning
+
+            constexpr const char *
+            FindPercent(const char * inCursor)
+            {
+                return ((IsText(inCursor[0]) && IsText(inCursor[1]) &&
+                         IsText(inCursor[2]) && IsText(inCursor[3]) &&
+                         IsText(inCursor[4]) && IsText(inCursor[5]) &&
+                         IsText(inCursor[6]) && IsText(inCursor[7])) ?
+                        FindPercent(inCursor + 8) :
+                        (IsText(*inCursor) ? FindPercent(inCursor + 1) : inCursor));
+            }
+
+            constexpr const char *
+            SkipDigits(const char * inCursor)
+            {
+                return (IsDigit(*inCursor) ? SkipDigits(inCursor + 1) : inCursor);
+            }
+
+            constexpr const char *
+            SkipFlags(const char * inCursor)
+            {
+                return (IsFlag(*inCursor) ? SkipFlags(inCursor + 1) : inCursor);
+            }
+
+            constexpr const char *
+            SkipLength(const char * inCursor)
+            {
+                return (IsLength(*inCursor) ? SkipLength(inCursor + 1) : inCursor);
+            }
+
+            // Argument slots
+
+            constexpr const char * FindSlot(const char * inCursor);
+
+            constexpr const char *
+            FromConversion(const char * inCursor)
+            {
+                // %m takes no argument.
+
+                return ((*inCursor == 'm') ? FindSlot(inCursor + 1) : inCursor);
+            }
+
+            constexpr const char *
+            FromWidth(const char * inCursor)
+            {
+                return ((*inCursor == '.') ?
+                        ((inCursor[1] == '*') ?
+                         inCursor + 1 :
+                         FromConversion(SkipLength(SkipDigits(inCursor + 1)))) :
+                        FromConversion(SkipLength(inCursor)));
+            }
+
+            constexpr const char *
+            FromFlags(const char * inCursor)
+            {
+                return ((*inCursor == '*') ? inCursor : FromWidth(SkipDigits(inCursor)));
+            }
+
+            constexpr const char *
+            FromPercent(const char * inCursor)
+            {
+                return ((*inCursor == '\0') ?
+                        inCursor :
+                        ((inCursor[1] == '%') ?
+                         FindSlot(inCursor + 2) :
+                         FromFlags(SkipFlags(inCursor + 1))));
+            }
+
+            /**
+             *  @brief
+             *    Return the first argument slot at or after the
+             *    specified position, which must be outside of any
+             *    directive.
+             *
+             */
+            constexpr const char *
+            FindSlot(const char * inCursor)
+            {
+                return (FromPercent(FindPercent(inCursor)));
+            }
+
+            /**
+             *  @brief
+             *    Return the argument slot following the specified
+             *    one.
+             *
+             */
+            constexpr const char *
+            NextSlot(const char * inSlot)
+            {
+                return ((*inSlot == '*') ?
+                        ((inSlot[-1] == '.') ?
+                         FromConversion(SkipLength(inSlot + 1)) :
+                         FromWidth(inSlot + 1)) :
+                        FindSlot(inSlot + 1));
+            }
+
+            /**
+             *  @brief
+             *    Return whether the format string contains no
+             *    directives at all, such that it may be written as
+             *    is, without output conversion.
+             *
+             */
+            constexpr bool
+            IsLiteral(const char * inFormat)
+            {
+                return (*FindPercent(inFormat) == '\0');
+            }
+
+            constexpr bool IsPositional(const char * inFormat);
+
+            constexpr bool
+            IsPositionalAt(const char * inPercent)
+            {
+                return ((*inPercent != '\0') &&
+                        ((IsDigit(inPercent[1]) && (*SkipDigits(inPercent + 1) == '$')) ||
+                         IsPositional(inPercent + ((inPercent[1] == '%') ? 2 : 1))));
+            }
+
+            /**
+             *  @brief
+             *    Return whether the format string uses positional
+             *    ("n$") arguments.
+             *
+             */
+            constexpr bool
+            IsPositional(const char * inFormat)
+            {
+                return (IsPositionalAt(FindPercent(inFormat)));
+            }
+
+            // Argument kinds
+
+            template <typename T>
+            constexpr bool
+            IsInteger(void)
+            {
+                return (std::is_integral<typename std::decay<T>::type>::value ||
+                        std::is_enum<typename std::decay<T>::type>::value);
+            }
+
+            template <typename T>
+            constexpr bool
+            IsFloat(void)
+            {
+                return (std::is_floating_point<typename std::decay<T>::type>::value);
+            }
+
+            template <typename T>
+            constexpr bool
+            IsNull(void)
+            {
+                return (std::is_same<typename std::decay<T>::type, std::nullptr_t>::value);
+            }
+
+            template <typename T>
+            constexpr bool
+            IsPointer(void)
+            {
+                return (std::is_pointer<typename std::decay<T>::type>::value || IsNull<T>());
+            }
+
+            template <typename T, typename Character>
+            constexpr bool
+            IsPointerTo(void)
+            {
+                return ((std::is_pointer<typename std::decay<T>::type>::value &&
+                         std::is_same<typename std::remove_cv<typename std::remove_pointer<typename std::decay<T>::type>::type>::type,
+                                      Character>::value) ||
+                        IsNull<T>());
+            }
+
+            /**
+             *  @brief
+             *    Return whether an argument of the specified type may
+             *    be consumed as the specified kind.
+             *
+             */
+            template <typename T>
+            constexpr bool
+            AcceptsKind(Kind inKind)
+            {
+                return (((inKind == Kind::kInt)      || (inKind == Kind::kLong)   ||
+                         (inKind == Kind::kLongLong) || (inKind == Kind::kIntMax) ||
+                         (inKind == Kind::kSize)     || (inKind == Kind::kPtrDiff) ||
+                         (inKind == Kind::kWideInt))                               ? IsInteger<T>() :
+                        ((inKind == Kind::kDouble) || (inKind == Kind::kLongDouble)) ? IsFloat<T>() :
+                        (inKind == Kind::kString)                                    ? IsPointerTo<T, char>() :
+                        (inKind == Kind::kWideString)                                ? IsPointerTo<T, wchar_t>() :
+                        ((inKind == Kind::kPointer) || (inKind == Kind::kCount))     ? IsPointer<T>() :
+                        false);
+            }
+
+            /**
+             *  @brief
+             *    Return the kind of argument the conversion argument
+             *    slot consumes, from its length modifier, which
+             *    immediately precedes it, and its specifier.
+             *
+             */
+            constexpr Kind
+            ClassifySlot(const char * inSlot)
+            {
+                return (!IsLength(inSlot[-1]) ?
+                        Classify('\0', '\0', *inSlot) :
+                        ((IsOneOf(inSlot[-1], "hl") && (inSlot[-2] == inSlot[-1])) ?
+                         Classify(inSlot[-2], inSlot[-1], *inSlot) :
+                         Classify(inSlot[-1], '\0', *inSlot)));
+            }
+
+            /**
+             *  @brief
+             *    Return whether an argument of the specified type may
+             *    fill the specified argument slot.
+             *
+             */
+            template <typename T>
+            constexpr bool
+            Accepts(const char * inSlot)
+            {
+                return ((*inSlot == '*') ? IsInteger<T>() : AcceptsKind<T>(ClassifySlot(inSlot)));
+            }
+
+            template <typename... Args>
+            struct Checker;
+
+            template <>
+            struct Checker<>
+            {
+                static constexpr bool
+                MatchesAt(const char * inSlot)
+                {
+                    return (*inSlot == '\0');
+                }
+            };
+
+            template <typename T, typename... Rest>
+            struct Checker<T, Rest...>
+            {
+                static constexpr bool
+                MatchesAt(const char * inSlot)
+                {
+                    return ((*inSlot != '\0') &&
+                            Accepts<T>(inSlot) &&
+                            Checker<Rest...>::MatchesAt(NextSlot(inSlot)));
+                }
+            };
+
+            /**
+             *  @brief
+             *    Return whether the arguments, of the specified
+             *    types, match the format string, one for each of its
+             *    argument slots and each of a compatible kind.
+             *
+             *  Formats using positional arguments are not checked
+             *  here; their arguments are checked at run time.
+             *
+             *  @param[in]  inFormat  A printf-style format string
+             *                        composed of zero or more output
+             *                        conversion directives.
+             *  @param[in]  inTypes   The list of argument types,
+             *                        typically from #TypesOf.
+             *
+             */
+            template <typename... Args>
+            constexpr bool
+            Matches(const char * inFormat, TypeList<Args...> inTypes)
+            {
+                return ((void)inTypes,
+                        IsPositional(inFormat) || Checker<Args...>::MatchesAt(FindSlot(inFormat)));
+            }
+
+            /**
+             *  @brief
+             *    A conversion directive, parsed at run time.
+             *
+             */
+            struct Directive
+            {
+                size_t mSize;              //!< The length of the directive
+                                           //!< text.
+                int    mPosition;          //!< The zero-based positional
+                                           //!< argument, or -1 if none.
+                bool   mLeft;              //!< The '-' flag.
+                bool   mSign;              //!< The '+' flag.
+                bool   mSpace;             //!< The ' ' flag.
+                bool   mAlternate;         //!< The '#' flag.
+                bool   mZero;              //!< The '0' flag.
+                bool   mGrouping;          //!< The "'" or 'I' flag.
+                bool   mWidthStar;         //!< Whether the width is an
+                                           //!< argument.
+                int    mWidthPosition;     //!< The zero-based positional
+                                           //!< argument for a '*' width,
+                                           //!< or -1 if none.
+                int    mWidth;             //!< The literal width, or -1
+                                           //!< if none.
+                bool   mPrecisionStar;     //!< Whether the precision is
+                                           //!< an argument.
+                int    mPrecisionPosition; //!< The zero-based positional
+                                           //!< argument for a '*'
+                                           //!< precision, or -1 if none.
+                int    mPrecision;         //!< The literal precision, or
+                                           //!< -1 if none.
+                char   mLength[3];         //!< The length modifier, if
+                                           //!< any.
+                char   mConversion;        //!< The conversion specifier.
+                Kind   mKind;              //!< The type of argument
+                                           //!< consumed.
+            };
+
+            extern bool Parse(const char * inPercent, Directive & outDirective);
+
+            extern void Append(std::string & inMessage, const char * inFormat, ...);
+            extern void Append(std::string & inMessage, const char * inFormat, std::va_list inList);
+
+        }; // namespace FormatString
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGFORMATSTRING_HPP */
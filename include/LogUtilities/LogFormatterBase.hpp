@@ -35,6 +35,9 @@ namespace Nuovations
     namespace Log
     {
 
+        class Arguments;
+        class Values;
+
         namespace Formatter
         {
 
@@ -48,6 +51,18 @@ namespace Nuovations
              *  message has been filtered but before it has been
              *  written.
              *
+             *  Concrete formatters need only implement the variadic
+             *  and variable argument list interfaces. However, by
+             *  default, messages whose arguments were captured for
+             *  later formatting (see Log::Arguments) or passed as
+             *  typed values (see Log::Values) are rendered first and
+             *  handed to the variadic interface as the single
+             *  argument of a "%s" format, rather than with the
+             *  caller's format. A formatter that depends on the
+             *  format string itself, for example to key a prefix on
+             *  it or to check it, must therefore also override the
+             *  Format overloads taking Arguments and Values.
+             *
              *  @ingroup formatter
              *
              */
@@ -161,6 +176,28 @@ namespace Nuovations
                 virtual std::string Format(const char *inFormat,
                                            std::va_list inList) = 0;
 
+                // Format into a caller-provided buffer
+
+                virtual void Format(std::string & outMessage,
+                                    Level         inLevel,
+                                    const char *  inFormat,
+                                    std::va_list  inList);
+
+                // Format previously-captured arguments into a
+                // caller-provided buffer
+
+                virtual void Format(std::string &     outMessage,
+                                    Level             inLevel,
+                                    const char *      inFormat,
+                                    const Arguments & inArguments);
+
+                // Format typed arguments into a caller-provided buffer
+
+                virtual void Format(std::string &  outMessage,
+                                    Level          inLevel,
+                                    const char *   inFormat,
+                                    const Values & inValues);
+
             protected:
                 Base(void);
             };
@@ -71,6 +71,29 @@ namespace Nuovations
                                            ...) _LOG_CHECK_FORMAT(2, 3);
                 virtual std::string Format(const char *inFormat,
                                            std::va_list inList) _LOG_CHECK_FORMAT(2, 0);
+
+                // Format into a caller-provided buffer
+
+                virtual void Format(std::string & outMessage,
+                                    Level         inLevel,
+                                    const char *  inFormat,
+                                    std::va_list  inList) _LOG_CHECK_FORMAT(4, 0);
+                virtual void Format(std::string &     outMessage,
+                                    Level             inLevel,
+                                    const char *      inFormat,
+                                    const Arguments & inArguments);
+                virtual void Format(std::string &  outMessage,
+                                    Level          inLevel,
+                                    const char *   inFormat,
+                                    const Values & inValues);
+
+            protected:
+                static void Append(std::string & inMessage,
+                                   const char *  inFormat,
+                                   ...) _LOG_CHECK_FORMAT(2, 3);
+                static void Append(std::string & inMessage,
+                                   const char *  inFormat,
+                                   std::va_list  inList) _LOG_CHECK_FORMAT(2, 0);
             };
 
         }; // namespace Formatter
@@ -25,6 +25,13 @@
 #ifndef LOGUTILITIES_LOGFORMATTERSTAMPED_HPP
 #define LOGUTILITIES_LOGFORMATTERSTAMPED_HPP
 
+#include <ctime>
+
+#include <pthread.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "LogClockBase.hpp"
 #include "LogFormatterPlain.hpp"
 
 namespace Nuovations
@@ -43,12 +50,20 @@ namespace Nuovations
              *
              *  The formatted information stamp is of the form:
              *
-             *      <year>-<month>-<day> <hour>:<minute>:<second> [\<PID\>:<thread>] (<level>) <message>
+             *      <year>-<month>-<day> <hour>:<minute>:<second>[.<fraction>] [\<PID\>:<thread>] (<level>) <message>
+             *
+             *  where @a fraction is the fraction of the second, to the
+             *  resolution the formatter was instantiated with, @a PID
+             *  is the process identification number, @a thread is the
+             *  POSIX thread identifier/object pointer returned by
+             *  pthread_self, and @a level is the level the logged
+             *  message was specified at.
              *
-             *  where @a PID is the process identification number,
-             *  @a thread is the POSIX thread identifier/object pointer
-             *  returned by pthread_self, and @a level is the level the
-             *  logged message was specified at.
+             *  The time is read from the clock the formatter was
+             *  instantiated with or, by default, the default clock
+             *  (see Clock::GetDefault). Messages formatted from
+             *  captured arguments are instead stamped with the time
+             *  the arguments were captured at.
              *
              *  @ingroup formatter
              *
@@ -56,10 +71,26 @@ namespace Nuovations
             class Stamped :
                 public Plain
             {
+            public:
+                /**
+                 *  The resolution of the time in a stamp.
+                 */
+                enum class Resolution : uint8_t
+                {
+                    kSeconds,      //!< Whole seconds.
+                    kMilliseconds, //!< Seconds and milliseconds.
+                    kMicroseconds, //!< Seconds and microseconds.
+                    kNanoseconds   //!< Seconds and nanoseconds.
+                };
+
             public:
                 Stamped(void);
+                Stamped(Resolution inResolution);
+                Stamped(const Clock::Base & inClock, Resolution inResolution);
                 virtual ~Stamped(void);
 
+                Resolution GetResolution(void) const;
+
                 // Format with the specified level
 
                 virtual std::string Format(Level inLevel,
@@ -75,6 +106,36 @@ namespace Nuovations
                                            ...) _LOG_CHECK_FORMAT(2, 3);
                 virtual std::string Format(const char *inFormat,
                                            std::va_list inList) _LOG_CHECK_FORMAT(2, 0);
+
+                // Format into a caller-provided buffer
+
+                virtual void Format(std::string & outMessage,
+                                    Level         inLevel,
+                                    const char *  inFormat,
+                                    std::va_list  inList) _LOG_CHECK_FORMAT(4, 0);
+                virtual void Format(std::string &     outMessage,
+                                    Level             inLevel,
+                                    const char *      inFormat,
+                                    const Arguments & inArguments);
+                virtual void Format(std::string &  outMessage,
+                                    Level          inLevel,
+                                    const char *   inFormat,
+                                    const Values & inValues);
+
+            private:
+                void Now(struct timespec & outTime) const;
+                void Stamp(std::string &           outMessage,
+                           Level                   inLevel,
+                           const struct timespec & inTime,
+                           pid_t                   inProcess,
+                           pthread_t               inThread);
+
+            private:
+                const Clock::Base * mClock;      //!< The clock stamps are
+                                                 //!< read from or, if null,
+                                                 //!< the default clock.
+                Resolution          mResolution; //!< The resolution of the
+                                                 //!< time in stamps.
             };
 
         }; // namespace Formatter
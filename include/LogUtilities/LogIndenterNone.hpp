@@ -53,6 +53,27 @@ namespace Nuovations
                                              std::string &inMessage);
             };
 
+            /**
+             *  @brief
+             *    Performs no indentation on the provided message.
+             *
+             *  @param[in]  inIndent   The level of indendation desired for
+             *                         the provided log message, which is ignored.
+             *  @param[in]  inMessage  A reference to the log message to indent,
+             *                         which is unchanged.
+             *
+             *  @returns
+             *     A reference to @a inMessage, unchanged.
+             *
+             */
+            inline std::string &
+            None::Indent(Log::Indent inIndent, std::string & inMessage)
+            {
+                (void)inIndent;
+
+                return (inMessage);
+            }
+
         }; // namespace Indenter
 
     }; // namespace Log
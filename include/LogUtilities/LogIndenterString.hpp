@@ -25,8 +25,8 @@
 #ifndef LOGUTILITIES_LOGINDENTERSTRING_HPP
 #define LOGUTILITIES_LOGINDENTERSTRING_HPP
 
+#include <memory>
 #include <string>
-#include <vector>
 
 #include <stddef.h>
 #include <stdint.h>
@@ -48,6 +48,14 @@ namespace Nuovations
              *    using an arbitrary string, character, or repeated
              *    characters.
              *
+             *  The indent for a level is the indent string repeated
+             *  once per level. Rather than building it for each
+             *  message, the indents for the first several levels are
+             *  precomputed as a table of the string repeated, such
+             *  that the indent for any of those levels is a prefix of
+             *  the table and indenting is a copy. The table grows,
+             *  on first use, to cover deeper levels.
+             *
              *  @ingroup indenter
              *
              */
@@ -85,17 +93,45 @@ namespace Nuovations
                 virtual std::string & Indent(Log::Indent inIndent,
                                              std::string &inMessage);
 
+            protected:
+                String(char         inCharacter,
+                       size_t       inCount,
+                       const char * inPrefixes,
+                       size_t       inPrefixesSize);
+                String(char         inCharacter,
+                       size_t       inCount,
+                       Flags        inFlags,
+                       const char * inPrefixes,
+                       size_t       inPrefixesSize);
+
             private:
-                std::string & Indent(const std::string &   inIndent,
-                                     std::string &         inMessage,
-                                     std::vector<size_t> & inPositions) const;
-                void          Indent(const std::string & inIndent,
-                                     std::string &       inMessage,
-                                     size_t              inPosition) const;
+                const char * Prefixes(size_t inSize,
+                                      std::shared_ptr<const std::string> & outGrown) const;
+                void Indent(Log::Indent   inIndent,
+                            std::string & inMessage,
+                            size_t        inPosition) const;
+                void IndentEvery(Log::Indent inIndent, std::string & inMessage) const;
 
             private:
-                const std::string mString; //!< The string to use for indentation.
-                const Flags       mFlags;  //!< String indentation behavior flags.
+                const std::string  mString;         //!< The string to use for
+                                                    //!< indentation.
+                const Flags        mFlags;          //!< String indentation
+                                                    //!< behavior flags.
+                const char * const mStaticPrefixes; //!< The static table of
+                                                    //!< indents, if any,
+                                                    //!< otherwise null.
+                const std::string  mPrefixes;       //!< The table of indents
+                                                    //!< built at construction
+                                                    //!< when there is no
+                                                    //!< static table.
+                const size_t       mPrefixesSize;   //!< The size of the
+                                                    //!< static or built table.
+                mutable std::shared_ptr<const std::string>
+                                   mGrown;          //!< The table of indents
+                                                    //!< grown beyond the
+                                                    //!< static or built one,
+                                                    //!< if any. It is only
+                                                    //!< accessed atomically.
             };
 
         }; // namespace Indenter
@@ -25,11 +25,17 @@
 
 #include <cstdarg>
 #include <string>
+#include <type_traits>
+
+#include <stdint.h>
 
 #include "LogFilterBase.hpp"
+#include "LogFilterGate.hpp"
 #include "LogFormatterBase.hpp"
 #include "LogIndenterBase.hpp"
+#include "LogRecorderBase.hpp"
 #include "LogTypes.hpp"
+#include "LogValues.hpp"
 #include "LogWriterBase.hpp"
 
 namespace Nuovations
@@ -37,6 +43,8 @@ namespace Nuovations
     namespace Log
     {
 
+        class Arguments;
+
         /**
          *  @brief
          *    Generic, instantiable logger object for logging
@@ -53,9 +61,34 @@ namespace Nuovations
          *    printf-style format message string. The writer is used
          *    to output the indented and formatted message to an
          *    output destination.
+         *
+         *    A logger may optionally have a recorder, to which
+         *    messages passing the level-only filter are handed
+         *    before formatting, for example, to defer formatting and
+         *    writing to another thread.
+         *
+         *    Messages written with WriteTyped capture the type of
+         *    each argument alongside its value. Integers, pointers,
+         *    and strings are then converted directly, without the
+         *    printf engine, and a directive that does not match its
+         *    argument is reproduced verbatim rather than invoking
+         *    undefined behavior. The log macros write through these,
+         *    having checked the arguments against the format at
+         *    compile time. Messages written with Write go through
+         *    the variadic argument list, whose format the compiler
+         *    checks as it does for printf.
          */
         class Logger
         {
+        private:
+            // The format of the variadic template interfaces is
+            // deduced, rather than declared, such that an integer
+            // indent or level is never taken for a null format.
+
+            template <typename Format>
+            using EnableIfFormat = typename std::enable_if<std::is_convertible<Format, const char *>::value &&
+                                                           !std::is_arithmetic<Format>::value, int>::type;
+
         public:
             Logger(Filter::Base &    inFilter,
                    Indenter::Base &  inIndenter,
@@ -79,6 +112,12 @@ namespace Nuovations
             const Writer::Base & GetWriter(void) const;
             void                 SetWriter(Writer::Base & inWriter);
 
+            Recorder::Base *       GetRecorder(void);
+            const Recorder::Base * GetRecorder(void) const;
+            void                   SetRecorder(Recorder::Base * inRecorder);
+
+            bool IsEnabled(Log::Level inLevel) const;
+
             // Write with indent and level specified.
 
             void Write(Log::Indent  inIndent,
@@ -89,6 +128,14 @@ namespace Nuovations
                        Log::Level   inLevel,
                        const char * inFormat,
                        std::va_list inArguments) _LOG_CHECK_FORMAT(4, 0);
+            void Write(Log::Indent       inIndent,
+                       Log::Level        inLevel,
+                       const char *      inFormat,
+                       const Arguments & inArguments);
+            void Write(Log::Indent       inIndent,
+                       Log::Level        inLevel,
+                       const char *      inFormat,
+                       const Values &    inValues);
 
             // Write with no indent and level specified.
 
@@ -106,13 +153,150 @@ namespace Nuovations
             void Write(const char * inFormat,
                        std::va_list inArguments) _LOG_CHECK_FORMAT(2, 0);
 
+            // Write with typed arguments, with indent and level
+            // specified, with no indent and level specified, or with
+            // no indent at level zero (0).
+
+            template <typename... Args>
+            void WriteTyped(Log::Indent     inIndent,
+                            Log::Level      inLevel,
+                            const char *    inFormat,
+                            const Args &... inArguments);
+            template <typename Format, typename... Args, EnableIfFormat<Format> = 0>
+            void WriteTyped(Log::Level      inLevel,
+                            const Format &  inFormat,
+                            const Args &... inArguments);
+            template <typename Format, typename... Args, EnableIfFormat<Format> = 0>
+            void WriteTyped(const Format &  inFormat,
+                            const Args &... inArguments);
+
         private:
-            Filter::Base *    mFilter;
-            Indenter::Base *  mIndenter;
-            Formatter::Base * mFormatter;
-            Writer::Base *    mWriter;
+            Filter::Base *        mFilter;
+            Indenter::Base *      mIndenter;
+            Formatter::Base *     mFormatter;
+            Writer::Base *        mWriter;
+            Recorder::Base *      mRecorder;
+            Filter::Gate          mGate;     //!< The levels at which the
+                                             //!< filter may pass, and
+                                             //!< the writer may write,
+                                             //!< messages.
         };
 
+        /**
+         *  @brief
+         *    Test whether a message at the specified level might be
+         *    written by the logger.
+         *
+         *  This is a cheap, conservative test intended to be made
+         *  before evaluating the arguments to a message: if it
+         *  returns false, the filter would reject the message on
+         *  level alone or the writer would write it nowhere (see
+         *  Writer::Base::GetLevels). If it returns true, the message
+         *  may still be rejected.
+         *
+         *  This is a single, relaxed load of a per-level bitmap (see
+         *  Filter::Gate) that is kept current as the filter changes,
+         *  such that it may be made from any thread, even as another
+         *  changes the filter level.
+         *
+         *  @param[in]  inLevel  The level the message would be logged
+         *                       at.
+         *
+         *  @returns
+         *    False if the message would certainly be rejected;
+         *    otherwise, true.
+         *
+         */
+        inline bool
+        Logger::IsEnabled(Log::Level inLevel) const
+        {
+            return (mGate.IsEnabled(inLevel));
+        }
+
+        /**
+         *  @brief
+         *    Write a log message, with typed arguments, at the
+         *    specified indent and level.
+         *
+         *  @param[in]  inIndent     The level of indendation desired
+         *                           for the provided log message.
+         *  @param[in]  inLevel      The level the current message is
+         *                           to be logged at.
+         *  @param[in]  inFormat     The log message, consisting of a
+         *                           printf-style format string
+         *                           composed of zero or more output
+         *                           conversion directives.
+         *  @param[in]  inArguments  The arguments, each corresponding
+         *                           with its peer output conversion
+         *                           directive in @a inFormat.
+         *
+         */
+        template <typename... Args>
+        inline void
+        Logger::WriteTyped(Log::Indent     inIndent,
+                           Log::Level      inLevel,
+                           const char *    inFormat,
+                           const Args &... inArguments)
+        {
+            // The trailing element keeps the array from being empty.
+
+            const Value theValues[sizeof...(Args) + 1] = { Value(inArguments)..., Value(nullptr) };
+
+            Write(inIndent, inLevel, inFormat, Values(theValues, sizeof...(Args)));
+        }
+
+        /**
+         *  @brief
+         *    Write a log message, with typed arguments, with no
+         *    indent and at the provided level.
+         *
+         *  @param[in]  inLevel      The level the current message is
+         *                           to be logged at.
+         *  @param[in]  inFormat     The log message, consisting of a
+         *                           printf-style format string
+         *                           composed of zero or more output
+         *                           conversion directives.
+         *  @param[in]  inArguments  The arguments, each corresponding
+         *                           with its peer output conversion
+         *                           directive in @a inFormat.
+         *
+         */
+        template <typename Format, typename... Args, Logger::EnableIfFormat<Format>>
+        inline void
+        Logger::WriteTyped(Log::Level      inLevel,
+                           const Format &  inFormat,
+                           const Args &... inArguments)
+        {
+            static const Log::Indent kIndent = 0;
+
+            WriteTyped(kIndent, inLevel, static_cast<const char *>(inFormat), inArguments...);
+        }
+
+        /**
+         *  @brief
+         *    Write a log message, with typed arguments, with no
+         *    indent and at level zero (0).
+         *
+         *  @param[in]  inFormat     The log message, consisting of a
+         *                           printf-style format string
+         *                           composed of zero or more output
+         *                           conversion directives.
+         *  @param[in]  inArguments  The arguments, each corresponding
+         *                           with its peer output conversion
+         *                           directive in @a inFormat.
+         *
+         */
+        template <typename Format, typename... Args, Logger::EnableIfFormat<Format>>
+        inline void
+        Logger::WriteTyped(const Format &  inFormat,
+                           const Args &... inArguments)
+        {
+            static const Log::Indent kIndent = 0;
+            static const Log::Level  kLevel  = 0;
+
+            WriteTyped(kIndent, kLevel, static_cast<const char *>(inFormat), inArguments...);
+        }
+
     }; // namespace Log
 
 }; // namespace Nuovations
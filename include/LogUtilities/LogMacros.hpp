@@ -24,7 +24,239 @@
 #ifndef LOGUTILITIES_LOGMACROS_HPP
 #define LOGUTILITIES_LOGMACROS_HPP
 
+#include <limits.h>
+
+#include "LogCallSite.hpp"
+#include "LogFormatString.hpp"
 #include "LogGlobals.hpp"
+#include "LogTypes.hpp"
+#include "LogValues.hpp"
+
+/**
+ *  @def LOGUTILITIES_DEBUG_MAX_LEVEL
+ *
+ *  @brief
+ *    The highest level at which LogDebug statements are compiled in.
+ *
+ *  Statements at constant levels above this are eliminated by the
+ *  compiler, along with their arguments and format strings, such
+ *  that they cost neither code size nor cycles. By default, all
+ *  levels are compiled in.
+ *
+ */
+#if !defined(LOGUTILITIES_DEBUG_MAX_LEVEL)
+# define LOGUTILITIES_DEBUG_MAX_LEVEL UINT_MAX
+#endif
+
+/**
+ *  @def LOGUTILITIES_INFO_MAX_LEVEL
+ *
+ *  @brief
+ *    The highest level at which LogInfo statements are compiled in.
+ *
+ *  @sa LOGUTILITIES_DEBUG_MAX_LEVEL
+ *
+ */
+#if !defined(LOGUTILITIES_INFO_MAX_LEVEL)
+# define LOGUTILITIES_INFO_MAX_LEVEL UINT_MAX
+#endif
+
+/**
+ *  @def LOGUTILITIES_ERROR_MAX_LEVEL
+ *
+ *  @brief
+ *    The highest level at which LogError statements are compiled in.
+ *
+ *  @sa LOGUTILITIES_DEBUG_MAX_LEVEL
+ *
+ */
+#if !defined(LOGUTILITIES_ERROR_MAX_LEVEL)
+# define LOGUTILITIES_ERROR_MAX_LEVEL UINT_MAX
+#endif
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        /**
+         *  @brief
+         *    Test whether a log statement at the specified level is
+         *    compiled in under the specified maximum level.
+         *
+         *  This is a function rather than an expression in the
+         *  macros that use it such that comparing against a maximum
+         *  of UINT_MAX does not provoke always-true comparison
+         *  warnings.
+         *
+         *  @private
+         *
+         */
+        inline constexpr bool
+        IsCompiledIn(Level inLevel, Level inMaxLevel)
+        {
+            return (inLevel <= inMaxLevel);
+        }
+
+        /**
+         *  @brief
+         *    Check a format string against its arguments.
+         *
+         *  This is only ever named in an unevaluated operand, such
+         *  that the compiler checks the arguments to log statements
+         *  against their formats, as it does for printf, even though
+         *  they are written through the typed, variadic template
+         *  interfaces (WriteTyped), which cannot carry the format
+         *  attribute.
+         *
+         *  @private
+         *
+         */
+        inline void CheckFormat(const char * inFormat, ...) _LOG_CHECK_FORMAT(1, 2);
+
+        inline void
+        CheckFormat(const char * inFormat, ...)
+        {
+            (void)inFormat;
+        }
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+/**
+ *  @def _LogIsStringLiteral(inFormat)
+ *
+ *  @brief
+ *    Whether the format string of a log message is a string literal,
+ *    which may be parsed at compile time.
+ *
+ *  @private
+ *
+ */
+#define _LogIsStringLiteral(inFormat)                                          \
+    Nuovations::Log::FormatString::IsStringLiteral<decltype(inFormat)>::value
+
+/**
+ *  @def _LogCheckFormat(inFormat, ...)
+ *
+ *  @brief
+ *    Check, at compile time, that the arguments to a log message
+ *    match its format string, one for each argument slot and each of
+ *    a compatible kind, failing to compile if they do not.
+ *
+ *  Only a string literal format may be parsed at compile time; any
+ *  other is left to the compiler's own printf format checking,
+ *  which is applied to every format as well, for the finer points,
+ *  such as length modifiers, that it warns about.
+ *
+ *  @param[in]  inFormat  The log message, consisting of a
+ *                        printf-style format string composed of zero
+ *                        or more output conversion directives.
+ *  @param[in]  ...       A variadic argument list, where each
+ *                        argument corresponds with its peer output
+ *                        conversion directive in @a inFormat.
+ *
+ *  @private
+ *
+ */
+#define _LogCheckFormat(inFormat, ...)                                         \
+    static_assert(!_LogIsStringLiteral(inFormat) ||                            \
+                  Nuovations::Log::FormatString::Matches(                      \
+                      (inFormat),                                              \
+                      decltype(Nuovations::Log::FormatString::TypesOf(        \
+                          __VA_ARGS__))()),                                    \
+                  "log message arguments do not match the format string");     \
+    (void)sizeof((Nuovations::Log::CheckFormat(inFormat, ##__VA_ARGS__), 0))
+
+/**
+ *  @def _LogWrite(inLogger, inMaxLevel, inIndent, inLevel, inFormat, ...)
+ *
+ *  @brief
+ *    Write a log message at the specified indent and level using the
+ *    specified logger, evaluating the message arguments only if the
+ *    logger might write a message at that level.
+ *
+ *  Statements at constant levels above @a inMaxLevel are eliminated
+ *  at compile time. Otherwise, the call site (see CallSite) is tested
+ *  first, such that it may be disabled at runtime, and then a
+ *  disabled message costs a load and a branch: the logger reference
+ *  is resolved once per call site and the level is tested against
+ *  the logger's enabled levels, inline, before any argument is
+ *  evaluated or the filter is consulted.
+ *
+ *  A format string that is a string literal is parsed at compile
+ *  time and the arguments checked against it, and a message with no
+ *  directives at all is written as is, bypassing output conversion
+ *  entirely. Otherwise, the arguments are written through the typed,
+ *  variadic template interfaces (WriteTyped) of the logger, which
+ *  check them against the format at run time.
+ *
+ *  @param[in]  inLogger    An expression evaluating to a reference to
+ *                          the logger to write with.
+ *  @param[in]  inMaxLevel  The highest level compiled in.
+ *  @param[in]  inIndent    The level of indendation desired for the
+ *                          provided log message.
+ *  @param[in]  inLevel     The level the current message is to be
+ *                          logged at.
+ *  @param[in]  inFormat    The log message, consisting of a
+ *                          printf-style format string composed of
+ *                          zero or more output conversion directives.
+ *  @param[in]  ...         A variadic argument list, where each
+ *                          argument corresponds with its peer output
+ *                          conversion directive in @a inFormat.
+ *
+ *  @private
+ *
+ */
+#define _LogWrite(inLogger, inMaxLevel, inIndent, inLevel, inFormat, ...)      \
+    do {                                                                       \
+        const Nuovations::Log::Level _theLevel = (inLevel);                    \
+                                                                               \
+        _LogCheckFormat(inFormat, ##__VA_ARGS__);                              \
+                                                                               \
+        if (Nuovations::Log::IsCompiledIn(_theLevel, (inMaxLevel))) {          \
+            static Nuovations::Log::CallSite _sCallSite(                       \
+                __FILE__, __LINE__, __func__,                                  \
+                _LogIsStringLiteral(inFormat) ? (inFormat) : nullptr);         \
+                                                                               \
+            if (_sCallSite.IsEnabled()) {                                      \
+                static Nuovations::Log::Logger & _sLogger = (inLogger);        \
+                                                                               \
+                if (_sLogger.IsEnabled(_theLevel)) {                           \
+                    const Nuovations::Log::CallSite::Scope                     \
+                        _theScope(_sCallSite);                                 \
+                                                                               \
+                    _LogWriteMessage(_sLogger, inIndent, _theLevel, inFormat,  \
+                                     ##__VA_ARGS__);                           \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+    } while (0)
+
+/**
+ *  @def _LogWriteMessage(inLogger, inIndent, inLevel, inFormat, ...)
+ *
+ *  @brief
+ *    Write a log message whose arguments have been checked against
+ *    its format string, bypassing output conversion if it is a
+ *    string literal with no directives.
+ *
+ *  @private
+ *
+ */
+#define _LogWriteMessage(inLogger, inIndent, inLevel, inFormat, ...)           \
+    do {                                                                       \
+        if (std::integral_constant<bool,                                       \
+                _LogIsStringLiteral(inFormat) &&                               \
+                Nuovations::Log::FormatString::IsLiteral(inFormat)>::value) {  \
+            (inLogger).Write(inIndent, inLevel, inFormat,                      \
+                             Nuovations::Log::Values());                       \
+        } else {                                                               \
+            (inLogger).WriteTyped(inIndent, inLevel, inFormat, ##__VA_ARGS__); \
+        }                                                                      \
+    } while (0)
 
 /**
  *  @def LogDebug(inIndent, inLevel, inFormat, ...)
@@ -46,11 +278,14 @@
  *                        directive in @a inFormat.
  *
  *  @sa Debug
+ *  @sa LOGUTILITIES_DEBUG_MAX_LEVEL
  *
  */
 #if (defined(DEBUG) && DEBUG) && !defined(NDEBUG)
 # define LogDebug(inIndent, inLevel, inFormat, ...)                            \
-    Nuovations::Log::Debug().Write(inIndent, inLevel, inFormat, ##__VA_ARGS__)
+    _LogWrite(Nuovations::Log::Debug(),                                        \
+              LOGUTILITIES_DEBUG_MAX_LEVEL,                                    \
+              inIndent, inLevel, inFormat, ##__VA_ARGS__)
 #else
 # define LogDebug(inIndent, inLevel, inFormat, ...)
 #endif
@@ -74,10 +309,13 @@
  *                        directive in @a inFormat.
  *
  *  @sa Info
+ *  @sa LOGUTILITIES_INFO_MAX_LEVEL
  *
  */
 #define LogInfo(inIndent, inLevel, inFormat, ...)                              \
-    Nuovations::Log::Info().Write(inIndent, inLevel, inFormat, ##__VA_ARGS__)
+    _LogWrite(Nuovations::Log::Info(),                                         \
+              LOGUTILITIES_INFO_MAX_LEVEL,                                     \
+              inIndent, inLevel, inFormat, ##__VA_ARGS__)
 
 /**
  *  @def LogError(inIndent, inLevel, inFormat, ...)
@@ -98,9 +336,12 @@
  *                        directive in @a inFormat.
  *
  *  @sa Error
+ *  @sa LOGUTILITIES_ERROR_MAX_LEVEL
  *
  */
 #define LogError(inIndent, inLevel, inFormat, ...)                             \
-    Nuovations::Log::Error().Write(inIndent, inLevel, inFormat, ##__VA_ARGS__)
+    _LogWrite(Nuovations::Log::Error(),                                        \
+              LOGUTILITIES_ERROR_MAX_LEVEL,                                    \
+              inIndent, inLevel, inFormat, ##__VA_ARGS__)
 
 #endif /* LOGUTILITIES_LOGMACROS_HPP */
@@ -0,0 +1,88 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities base object for
+ *      filters and writers that may be held as links by others.
+ */
+
+#ifndef LOGUTILITIES_LOGOWNED_HPP
+#define LOGUTILITIES_LOGOWNED_HPP
+
+#include <vector>
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        /**
+         *  @brief
+         *    Base object for filters and writers that may be held as
+         *    links by others of their kind.
+         *
+         *  An object that holds others as links, such as a chain,
+         *  derives what it reports (for example, its level limit or
+         *  levels) from theirs. Each object therefore records those
+         *  holding it, its owners, such that, when it changes, the
+         *  gates (see Filter::Gate) of it and of every object holding
+         *  it, directly or not, may be refreshed.
+         *
+         *  A single lock guards the owners of every object.
+         *
+         */
+        class Owned
+        {
+        protected:
+            Owned(void);
+            Owned(const Owned & inOwned);
+            ~Owned(void);
+
+            Owned & operator =(const Owned & inOwned);
+
+            void Adopt(Owned & inLink);
+            void Disown(Owned & inLink);
+
+            void Invalidate(void) const;
+
+        private:
+            /**
+             *  @brief
+             *    Recompute the enabled levels of the gates of the
+             *    object.
+             *
+             *  This is invoked with the owners lock held.
+             *
+             */
+            virtual void RefreshGates(void) const = 0;
+
+            static void Refresh(const Owned & inOwned);
+
+        private:
+            std::vector<const Owned *> mOwners; //!< The objects holding
+                                                //!< this one as a link,
+                                                //!< whose gates depend
+                                                //!< on it.
+        };
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGOWNED_HPP */
@@ -0,0 +1,371 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities template object
+ *      for a bounded, lock-free, multiple-producer, single-consumer
+ *      queue of log records.
+ */
+
+#ifndef LOGUTILITIES_LOGQUEUE_HPP
+#define LOGUTILITIES_LOGQUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        /**
+         *  @brief
+         *    A bounded, lock-free, multiple-producer, single-consumer
+         *    queue of log records.
+         *
+         *  The queue is a fixed-size ring of slots, each of which
+         *  carries a sequence number that arbitrates ownership of
+         *  the slot between producers and the consumer. Records are
+         *  filled and drained in place such that storage owned by a
+         *  record (for example, string capacity) is reused from one
+         *  trip around the ring to the next rather than being
+         *  reallocated for each record.
+         *
+         *  Any number of threads may push records concurrently;
+         *  however, only a single thread at a time may pop them.
+         *
+         *  @tparam  Record  The type of record stored in each slot.
+         *                   It must be default constructible.
+         *
+         */
+        template <typename Record>
+        class Queue
+        {
+        public:
+            typedef Record record_type;
+
+        public:
+            Queue(size_t inCapacity);
+            ~Queue(void);
+
+            template <typename Filler>
+            bool Push(Filler inFiller);
+
+            template <typename Drainer>
+            bool Pop(Drainer inDrainer);
+
+            size_t Capacity(void) const;
+            size_t Size(void) const;
+            bool Empty(void) const;
+
+            size_t Pushed(void) const;
+            size_t Popped(void) const;
+            size_t Skipped(void) const;
+
+        private:
+            Queue(const Queue &inQueue) = delete;
+            Queue & operator =(const Queue &inQueue) = delete;
+
+            struct Slot
+            {
+                std::atomic<size_t> mSequence;
+                bool                mFilled;
+                Record              mRecord;
+            };
+
+            static size_t RoundUp(size_t inCapacity);
+
+        private:
+            static const size_t kCacheLineSize = 64;
+
+            Slot * const        mSlots;
+            const size_t        mMask;
+
+            // Keep the consumer and producer positions on separate
+            // cache lines such that they do not contend with one
+            // another.
+
+            std::atomic<size_t> mHead;
+            std::atomic<size_t> mSkipped;
+            char                mPadding[kCacheLineSize - (2 * sizeof(std::atomic<size_t>))];
+            std::atomic<size_t> mTail;
+        };
+
+        /**
+         *  @brief
+         *    This is a class constructor.
+         *
+         *  @param[in]  inCapacity  The minimum number of records the
+         *                          queue may hold. This is rounded
+         *                          up to the next power of two.
+         *
+         */
+        template <typename Record>
+        Queue<Record>::Queue(size_t inCapacity) :
+            mSlots(new Slot[RoundUp(inCapacity)]),
+            mMask(RoundUp(inCapacity) - 1),
+            mHead(0),
+            mSkipped(0),
+            mTail(0)
+        {
+            for (size_t i = 0; i <= mMask; i++) {
+                mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         *  @brief
+         *    This is the class destructor.
+         *
+         */
+        template <typename Record>
+        Queue<Record>::~Queue(void)
+        {
+            delete [] mSlots;
+        }
+
+        /**
+         *  @brief
+         *    Attempt to push a record onto the queue.
+         *
+         *  If a free slot is available, it is claimed and @a inFiller
+         *  is invoked with a reference to the slot record, which it
+         *  should overwrite. The record is not visible to the
+         *  consumer until @a inFiller returns.
+         *
+         *  Should @a inFiller throw, the slot is nonetheless handed
+         *  to the consumer, such that the queue does not wedge behind
+         *  it, but is skipped rather than drained, and the exception
+         *  is rethrown.
+         *
+         *  This may be called concurrently from any number of threads.
+         *
+         *  @param[in]  inFiller  A callable object taking a mutable
+         *                        record reference.
+         *
+         *  @returns
+         *    True if the record was pushed; otherwise, false if the
+         *    queue was full.
+         *
+         */
+        template <typename Record>
+        template <typename Filler>
+        bool
+        Queue<Record>::Push(Filler inFiller)
+        {
+            size_t thePosition = mTail.load(std::memory_order_relaxed);
+            Slot * theSlot;
+
+            while (true) {
+                theSlot = &mSlots[thePosition & mMask];
+
+                const size_t    theSequence   = theSlot->mSequence.load(std::memory_order_acquire);
+                const ptrdiff_t theDifference = static_cast<ptrdiff_t>(theSequence - thePosition);
+
+                if (theDifference == 0) {
+                    if (mTail.compare_exchange_weak(thePosition,
+                                                    thePosition + 1,
+                                                    std::memory_order_relaxed)) {
+                        break;
+                    }
+
+                } else if (theDifference < 0) {
+                    return (false);
+
+                } else {
+                    thePosition = mTail.load(std::memory_order_relaxed);
+
+                }
+            }
+
+            try {
+                inFiller(theSlot->mRecord);
+
+                theSlot->mFilled = true;
+
+            } catch (...) {
+                theSlot->mFilled = false;
+                theSlot->mSequence.store(thePosition + 1, std::memory_order_release);
+
+                throw;
+
+            }
+
+            theSlot->mSequence.store(thePosition + 1, std::memory_order_release);
+
+            return (true);
+        }
+
+        /**
+         *  @brief
+         *    Attempt to pop a record from the queue.
+         *
+         *  If a record is available, @a inDrainer is invoked with a
+         *  reference to it. The slot is not returned to producers
+         *  until @a inDrainer returns and, consequently, the record is
+         *  not counted as popped until it has been fully consumed.
+         *  A record whose filler threw is popped without invoking @a
+         *  inDrainer and is counted as skipped.
+         *
+         *  This may only be called from a single thread at a time.
+         *
+         *  @param[in]  inDrainer  A callable object taking a mutable
+         *                         record reference.
+         *
+         *  @returns
+         *    True if a record was popped; otherwise, false if the
+         *    queue was empty.
+         *
+         */
+        template <typename Record>
+        template <typename Drainer>
+        bool
+        Queue<Record>::Pop(Drainer inDrainer)
+        {
+            const size_t thePosition = mHead.load(std::memory_order_relaxed);
+            Slot * const theSlot     = &mSlots[thePosition & mMask];
+            const size_t theSequence = theSlot->mSequence.load(std::memory_order_acquire);
+
+            if (theSequence != thePosition + 1) {
+                return (false);
+            }
+
+            const bool theFilled = theSlot->mFilled;
+
+            if (theFilled) {
+                inDrainer(theSlot->mRecord);
+            }
+
+            theSlot->mSequence.store(thePosition + mMask + 1, std::memory_order_release);
+
+            mHead.store(thePosition + 1, std::memory_order_release);
+
+            // Counted only once popped, such that there are never
+            // more records skipped than popped.
+
+            if (!theFilled) {
+                mSkipped.fetch_add(1, std::memory_order_release);
+            }
+
+            return (true);
+        }
+
+        /**
+         *  @brief
+         *    Return the number of records the queue may hold.
+         *
+         */
+        template <typename Record>
+        size_t
+        Queue<Record>::Capacity(void) const
+        {
+            return (mMask + 1);
+        }
+
+        /**
+         *  @brief
+         *    Return an estimate of the number of records in the queue.
+         *
+         *  Since producers and the consumer may be concurrently
+         *  active, the result is advisory only.
+         *
+         */
+        template <typename Record>
+        size_t
+        Queue<Record>::Size(void) const
+        {
+            const size_t theHead = Popped();
+            const size_t theTail = Pushed();
+
+            return ((theTail > theHead) ? (theTail - theHead) : 0);
+        }
+
+        /**
+         *  @brief
+         *    Return whether the queue is empty.
+         *
+         *  Since producers and the consumer may be concurrently
+         *  active, the result is advisory only.
+         *
+         */
+        template <typename Record>
+        bool
+        Queue<Record>::Empty(void) const
+        {
+            return (Size() == 0);
+        }
+
+        /**
+         *  @brief
+         *    Return the number of records pushed (or claimed for
+         *    pushing) onto the queue since it was instantiated.
+         *
+         */
+        template <typename Record>
+        size_t
+        Queue<Record>::Pushed(void) const
+        {
+            return (mTail.load(std::memory_order_acquire));
+        }
+
+        /**
+         *  @brief
+         *    Return the number of records completely popped from the
+         *    queue since it was instantiated.
+         *
+         */
+        template <typename Record>
+        size_t
+        Queue<Record>::Popped(void) const
+        {
+            return (mHead.load(std::memory_order_acquire));
+        }
+
+        /**
+         *  @brief
+         *    Return the number of records popped without being
+         *    drained, since their fillers threw, since the queue was
+         *    instantiated.
+         *
+         */
+        template <typename Record>
+        size_t
+        Queue<Record>::Skipped(void) const
+        {
+            return (mSkipped.load(std::memory_order_acquire));
+        }
+
+        template <typename Record>
+        size_t
+        Queue<Record>::RoundUp(size_t inCapacity)
+        {
+            size_t theCapacity = 2;
+
+            while (theCapacity < inCapacity) {
+                theCapacity <<= 1;
+            }
+
+            return (theCapacity);
+        }
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGQUEUE_HPP */
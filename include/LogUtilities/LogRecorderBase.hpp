@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities abstract recorder
+ *      object.
+ */
+
+#ifndef LOGUTILITIES_LOGRECORDERBASE_HPP
+#define LOGUTILITIES_LOGRECORDERBASE_HPP
+
+#include <cstdarg>
+
+#include "LogTypes.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        class Logger;
+        class Values;
+
+        namespace Recorder
+        {
+
+            /**
+             *  @brief
+             *    Abstract, base log recorder object.
+             *
+             *  Recorder objects, when installed on a logger, take
+             *  over a message once it has passed the logger's
+             *  level-only filtering, recording the format string and
+             *  its arguments for the message to be formatted and
+             *  written later, or elsewhere, rather than on the
+             *  logging thread.
+             *
+             *  @ingroup recorder
+             *
+             */
+            class Base
+            {
+            public:
+                virtual ~Base(void);
+
+                /**
+                 *  @brief
+                 *    Record a log message at the specified indent and
+                 *    level.
+                 *
+                 *  @param[in]  inLogger     The logger the message was
+                 *                           written to.
+                 *  @param[in]  inIndent     The level of indentation
+                 *                           desired for the message.
+                 *  @param[in]  inLevel      The level the message is to
+                 *                           be logged at.
+                 *  @param[in]  inFormat     The log message, consisting
+                 *                           of a printf-style format
+                 *                           string composed of zero or
+                 *                           more output conversion
+                 *                           directives.
+                 *  @param[in]  inArguments  A variable argument list,
+                 *                           where each argument
+                 *                           corresponds with its peer
+                 *                           output conversion directive
+                 *                           in @a inFormat.
+                 *
+                 *  @returns
+                 *    True if the recorder took the message; otherwise,
+                 *    false, in which case the logger formats and
+                 *    writes the message immediately.
+                 */
+                virtual bool Record(Logger &     inLogger,
+                                    Indent       inIndent,
+                                    Level        inLevel,
+                                    const char * inFormat,
+                                    std::va_list inArguments) _LOG_CHECK_FORMAT(5, 0) = 0;
+
+                virtual bool Record(Logger &       inLogger,
+                                    Indent         inIndent,
+                                    Level          inLevel,
+                                    const char *   inFormat,
+                                    const Values & inValues);
+
+            protected:
+                Base(void);
+            };
+
+        }; // namespace Recorder
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGRECORDERBASE_HPP */
@@ -0,0 +1,155 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete recorder
+ *      implementation that writes messages, unformatted, as compact
+ *      binary records for later, offline decoding.
+ */
+
+#ifndef LOGUTILITIES_LOGRECORDERBINARY_HPP
+#define LOGUTILITIES_LOGRECORDERBINARY_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include "LogRecorderBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Writer
+        {
+
+            class Stdio;
+
+        }; // namespace Writer
+
+        namespace Recorder
+        {
+
+            /**
+             *  @brief
+             *    Log recorder object that writes messages,
+             *    unformatted, as compact binary records for later,
+             *    offline decoding.
+             *
+             *  Rather than performing output conversion on the
+             *  logging thread, each format string is registered
+             *  once, on first use, and assigned a small identifier.
+             *  Each message is then written as no more than that
+             *  identifier, its level, indent, and capture stamp, and
+             *  a compact, binary copy of its arguments (see
+             *  Log::Arguments), in a single write to the writer's
+             *  stream.
+             *
+             *  The resulting stream is decoded with Log::Decoder, or
+             *  the logutilities-decode tool built on it, into the
+             *  text the logger's formatter and indenter would have
+             *  produced. Since message content is unavailable until
+             *  then, messages taken by the recorder bypass any
+             *  content filtering.
+             *
+             *  The stream is a sequence of records, each a native
+             *  byte order, 32-bit size of the remainder of the record
+             *  followed by a one-byte record type and its payload:
+             *
+             *    - A header, written when the recorder is
+             *      instantiated, holding a magic number and the sizes
+             *      of the types arguments are captured as. Format
+             *      identifiers are scoped to the records that follow
+             *      it, up to the next header.
+             *
+             *    - A format, holding an identifier and the format
+             *      string it stands for.
+             *
+             *    - A message, holding a format identifier, level,
+             *      indent, capture time, in seconds and nanoseconds,
+             *      process and thread, and the captured arguments.
+             *
+             *  Decoding therefore requires a platform with the same
+             *  byte order and type sizes as the one recorded on.
+             *
+             *  @ingroup recorder
+             *
+             */
+            class Binary :
+                public Base
+            {
+            public:
+                /**
+                 *  @brief
+                 *    Record types.
+                 */
+                enum class Type : uint8_t {
+                    kHeader  = 0, //!< A stream header.
+                    kFormat  = 1, //!< A format string definition.
+                    kMessage = 2  //!< A message.
+                };
+
+                static const char     kMagic[8];
+                static const uint8_t  kVersion = 2;
+                static const uint32_t kByteOrder = 0x01020304;
+
+            public:
+                Binary(Writer::Stdio & inWriter);
+                virtual ~Binary(void);
+
+                virtual bool Record(Logger &     inLogger,
+                                    Indent       inIndent,
+                                    Level        inLevel,
+                                    const char * inFormat,
+                                    std::va_list inArguments) _LOG_CHECK_FORMAT(5, 0);
+                virtual bool Record(Logger &       inLogger,
+                                    Indent         inIndent,
+                                    Level          inLevel,
+                                    const char *   inFormat,
+                                    const Values & inValues);
+
+                void Flush(void);
+
+                // Counters
+
+                size_t GetFormats(void) const;
+                uint64_t GetWritten(void) const;
+
+            private:
+                Binary(const Binary & inRecorder) = delete;
+                Binary & operator =(const Binary & inRecorder) = delete;
+
+                struct Implementation;
+
+                /**
+                 *  A shared, reference-counted pointer to the recorder
+                 *  implementation.
+                 */
+                boost::shared_ptr<Implementation> mImplementation;
+            };
+
+        }; // namespace Recorder
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGRECORDERBINARY_HPP */
@@ -0,0 +1,133 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete recorder
+ *      implementation that captures message arguments on the logging
+ *      thread and formats and writes the message on a dedicated
+ *      backend thread.
+ */
+
+#ifndef LOGUTILITIES_LOGRECORDERDEFERRED_HPP
+#define LOGUTILITIES_LOGRECORDERDEFERRED_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include "LogRecorderBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Recorder
+        {
+
+            /**
+             *  @brief
+             *    Log recorder object that captures message arguments
+             *    on the logging thread and formats and writes the
+             *    message on a dedicated backend thread.
+             *
+             *  Rather than performing output conversion on the
+             *  logging thread, only the format string pointer and a
+             *  compact, binary copy of its arguments (see
+             *  Log::Arguments) are queued. The backend thread then
+             *  formats, indents, filters, and writes the message
+             *  through the formatter, indenter, filter, and writer
+             *  of the logger it was written to.
+             *
+             *  Since the format string itself is not copied, it must
+             *  remain valid until the message has been written, as
+             *  is the case for string literals. Similarly, a logger
+             *  with messages outstanding must not be destroyed until
+             *  the recorder has been flushed or stopped.
+             *
+             *  @ingroup recorder
+             *
+             */
+            class Deferred :
+                public Base
+            {
+            public:
+                /**
+                 *  @brief
+                 *    Overflow policies.
+                 *
+                 *    Overflow policies which determine how the
+                 *    recorder behaves when a message is recorded
+                 *    while the queue is full.
+                 */
+                enum class Overflow : uint8_t {
+                    kDrop  = 0, //!< Discard the message and count it as dropped.
+                    kBlock = 1  //!< Wait for the backend thread to make room for the message.
+                };
+
+                static const size_t kCapacityDefault = 1024;
+
+            public:
+                Deferred(void);
+                Deferred(size_t inCapacity);
+                Deferred(size_t inCapacity, Overflow inOverflow);
+                virtual ~Deferred(void);
+
+                virtual bool Record(Logger &     inLogger,
+                                    Indent       inIndent,
+                                    Level        inLevel,
+                                    const char * inFormat,
+                                    std::va_list inArguments) _LOG_CHECK_FORMAT(5, 0);
+                virtual bool Record(Logger &       inLogger,
+                                    Indent         inIndent,
+                                    Level          inLevel,
+                                    const char *   inFormat,
+                                    const Values & inValues);
+
+                void Flush(void);
+                void Stop(void);
+
+                // Counters
+
+                size_t GetCapacity(void) const;
+                size_t GetDepth(void) const;
+                uint64_t GetWritten(void) const;
+                uint64_t GetDropped(void) const;
+
+            private:
+                Deferred(const Deferred & inRecorder) = delete;
+                Deferred & operator =(const Deferred & inRecorder) = delete;
+
+                struct Implementation;
+
+                /**
+                 *  A shared, reference-counted pointer to the recorder
+                 *  implementation.
+                 */
+                boost::shared_ptr<Implementation> mImplementation;
+            };
+
+        }; // namespace Recorder
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGRECORDERDEFERRED_HPP */
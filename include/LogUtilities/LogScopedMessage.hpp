@@ -0,0 +1,130 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities object for
+ *      claiming the per-thread message buffer loggers filter,
+ *      format, indent, and write messages in.
+ */
+
+#ifndef LOGUTILITIES_LOGSCOPEDMESSAGE_HPP
+#define LOGUTILITIES_LOGSCOPEDMESSAGE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        /**
+         *  @brief
+         *    Scoped claim on the per-thread message buffer.
+         *
+         *  Because the buffer persists across messages, its capacity
+         *  settles at the largest message logged on the thread and,
+         *  from then on, logging a message requires no heap
+         *  allocation. The buffer is shared by every logger, whether
+         *  Logger or StaticLogger, on the thread.
+         *
+         *  Should a write re-enter a logger on the same thread (for
+         *  example, from a writer that itself logs), the nested
+         *  claim falls back to a local, non-shared buffer rather than
+         *  clobbering the message still in flight.
+         *
+         */
+        class ScopedMessage
+        {
+        public:
+            ScopedMessage(void);
+            ~ScopedMessage(void);
+
+            std::string & Get(void);
+
+        private:
+            ScopedMessage(const ScopedMessage &inScopedMessage) = delete;
+            ScopedMessage & operator =(const ScopedMessage &inScopedMessage) = delete;
+
+        private:
+            struct Storage
+            {
+                std::string mMessage; //!< The reusable message buffer.
+                bool        mInUse;   //!< Whether a claim on this thread
+                                      //!< currently owns @a mMessage.
+            };
+
+            static thread_local Storage sStorage;
+
+            Storage *   mStorage; //!< The claimed per-thread storage or
+                                  //!< null if it was already in use.
+            std::string mLocal;   //!< The fallback buffer for a nested
+                                  //!< claim.
+        };
+
+        /**
+         *  @brief
+         *    This is the class constructor, claiming the per-thread
+         *    message buffer if it is not already in use.
+         *
+         */
+        inline
+        ScopedMessage::ScopedMessage(void) :
+            mStorage(sStorage.mInUse ? NULL : &sStorage),
+            mLocal()
+        {
+            if (mStorage != NULL) {
+                mStorage->mInUse = true;
+            }
+        }
+
+        /**
+         *  @brief
+         *    This is the class destructor, releasing any claim on the
+         *    per-thread message buffer.
+         *
+         */
+        inline
+        ScopedMessage::~ScopedMessage(void)
+        {
+            if (mStorage != NULL) {
+                mStorage->mInUse = false;
+            }
+        }
+
+        /**
+         *  @brief
+         *    Return the claimed message buffer.
+         *
+         *  @returns
+         *    A reference to the per-thread message buffer or, if that
+         *    was already in use, to a local one.
+         *
+         */
+        inline std::string &
+        ScopedMessage::Get(void)
+        {
+            return ((mStorage != NULL) ? mStorage->mMessage : mLocal);
+        }
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGSCOPEDMESSAGE_HPP */
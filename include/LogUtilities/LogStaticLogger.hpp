@@ -0,0 +1,772 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities template logger
+ *      object whose filter, indenter, formatter, and writer are
+ *      composed at compile time.
+ */
+
+#ifndef LOGUTILITIES_LOGSTATICLOGGER_HPP
+#define LOGUTILITIES_LOGSTATICLOGGER_HPP
+
+#include <cstdarg>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <stdint.h>
+
+#include "LogFilterBase.hpp"
+#include "LogFilterGate.hpp"
+#include "LogFormatterBase.hpp"
+#include "LogIndenterBase.hpp"
+#include "LogLogger.hpp"
+#include "LogScopedMessage.hpp"
+#include "LogTypes.hpp"
+#include "LogValues.hpp"
+#include "LogWriterBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        /**
+         *  @brief
+         *    Logger object whose filter, indenter, formatter, and
+         *    writer types are fixed at compile time.
+         *
+         *    A static logger pipelines messages exactly as Logger
+         *    does, but holds each stage by value and invokes it
+         *    directly rather than through its virtual interface. The
+         *    compiler may therefore inline each stage into the
+         *    logger: with Indenter::None, indenting costs nothing;
+         *    with Filter::Level or Filter::Quiet, filtering is a
+         *    load and a compare; and with Filter::Always or
+         *    Filter::Never, the filtering branches, or the entire
+         *    write, fold away.
+         *
+         *    Chains of filters or writers may likewise be composed
+         *    at compile time with Filter::StaticChain and
+         *    Writer::StaticChain.
+         *
+         *    Each static logger also carries a runtime Logger view,
+         *    bound to the same stages, for interoperating with
+         *    interfaces that take a Logger, such as recorders. Any
+         *    stage type may also be a runtime one (for example,
+         *    Filter::Chain), in which case only that stage is
+         *    dispatched virtually, through its own links.
+         *
+         *  @tparam  FilterT     The concrete filter type.
+         *  @tparam  IndenterT   The concrete indenter type.
+         *  @tparam  FormatterT  The concrete formatter type.
+         *  @tparam  WriterT     The concrete writer type.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        class StaticLogger
+        {
+            static_assert(std::is_base_of<Filter::Base, FilterT>::value, "FilterT must be a filter");
+            static_assert(std::is_base_of<Indenter::Base, IndenterT>::value, "IndenterT must be an indenter");
+            static_assert(std::is_base_of<Formatter::Base, FormatterT>::value, "FormatterT must be a formatter");
+            static_assert(std::is_base_of<Writer::Base, WriterT>::value, "WriterT must be a writer");
+
+        private:
+            // The format of the variadic template interfaces is
+            // deduced, rather than declared, such that an integer
+            // indent or level is never taken for a null format.
+
+            template <typename Format>
+            using EnableIfFormat = typename std::enable_if<std::is_convertible<Format, const char *>::value &&
+                                                           !std::is_arithmetic<Format>::value, int>::type;
+
+        public:
+            typedef FilterT    filter_type;
+            typedef IndenterT  indenter_type;
+            typedef FormatterT formatter_type;
+            typedef WriterT    writer_type;
+
+        public:
+            StaticLogger(void);
+            template <typename FilterArg, typename IndenterArg, typename FormatterArg, typename WriterArg>
+            StaticLogger(FilterArg &&    inFilter,
+                         IndenterArg &&  inIndenter,
+                         FormatterArg && inFormatter,
+                         WriterArg &&    inWriter);
+            ~StaticLogger(void);
+
+            FilterT &       GetFilter(void);
+            const FilterT & GetFilter(void) const;
+
+            IndenterT &       GetIndenter(void);
+            const IndenterT & GetIndenter(void) const;
+
+            FormatterT &       GetFormatter(void);
+            const FormatterT & GetFormatter(void) const;
+
+            WriterT &       GetWriter(void);
+            const WriterT & GetWriter(void) const;
+
+            Logger &       GetLogger(void);
+            const Logger & GetLogger(void) const;
+
+            bool IsEnabled(Log::Level inLevel) const;
+
+            // Write with indent and level specified.
+
+            void Write(Log::Indent  inIndent,
+                       Log::Level   inLevel,
+                       const char * inFormat,
+                       ...) _LOG_CHECK_FORMAT(4, 5);
+            void Write(Log::Indent  inIndent,
+                       Log::Level   inLevel,
+                       const char * inFormat,
+                       std::va_list inArguments) _LOG_CHECK_FORMAT(4, 0);
+            void Write(Log::Indent       inIndent,
+                       Log::Level        inLevel,
+                       const char *      inFormat,
+                       const Values &    inValues);
+
+            // Write with no indent and level specified.
+
+            void Write(Log::Level   inLevel,
+                       const char * inFormat,
+                       ...) _LOG_CHECK_FORMAT(3, 4);
+            void Write(Log::Level   inLevel,
+                       const char * inFormat,
+                       std::va_list inArguments) _LOG_CHECK_FORMAT(3, 0);
+
+            // Write with no ident at level zero (0).
+
+            void Write(const char * inFormat,
+                       ...) _LOG_CHECK_FORMAT(2, 3);
+            void Write(const char * inFormat,
+                       std::va_list inArguments) _LOG_CHECK_FORMAT(2, 0);
+
+            // Write with typed arguments, with indent and level
+            // specified, with no indent and level specified, or with
+            // no indent at level zero (0).
+
+            template <typename... Args>
+            void WriteTyped(Log::Indent     inIndent,
+                            Log::Level      inLevel,
+                            const char *    inFormat,
+                            const Args &... inArguments);
+            template <typename Format, typename... Args, EnableIfFormat<Format> = 0>
+            void WriteTyped(Log::Level      inLevel,
+                            const Format &  inFormat,
+                            const Args &... inArguments);
+            template <typename Format, typename... Args, EnableIfFormat<Format> = 0>
+            void WriteTyped(const Format &  inFormat,
+                            const Args &... inArguments);
+
+        private:
+            StaticLogger(const StaticLogger &inStaticLogger) = delete;
+            StaticLogger & operator =(const StaticLogger &inStaticLogger) = delete;
+
+            bool Allow(Log::Level inLevel, const char * inFormat);
+
+            template <typename Source>
+            void WriteAllowed(Log::Indent  inIndent,
+                              Log::Level   inLevel,
+                              const char * inFormat,
+                              Source &&    inSource);
+
+        private:
+            FilterT    mFilter;    //!< The filter.
+            IndenterT  mIndenter;  //!< The indenter.
+            FormatterT mFormatter; //!< The formatter.
+            WriterT    mWriter;    //!< The writer.
+            Logger     mLogger;    //!< The runtime view of the stages.
+        };
+
+        /**
+         *  @brief
+         *    This is the class default constructor, default
+         *    constructing each stage.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::StaticLogger(void) :
+            mFilter(),
+            mIndenter(),
+            mFormatter(),
+            mWriter(),
+            mLogger(mFilter, mIndenter, mFormatter, mWriter)
+        {
+            return;
+        }
+
+        /**
+         *  @brief
+         *    This is a class constructor, constructing each stage from
+         *    its peer argument.
+         *
+         *  Each argument may be anything its stage is constructible
+         *  from: for example, a level for Filter::Level, a
+         *  descriptor for Writer::Descriptor, or a stage of the same
+         *  type to copy.
+         *
+         *  @param[in]  inFilter     The argument to construct the
+         *                           filter from.
+         *  @param[in]  inIndenter   The argument to construct the
+         *                           indenter from.
+         *  @param[in]  inFormatter  The argument to construct the
+         *                           formatter from.
+         *  @param[in]  inWriter     The argument to construct the
+         *                           writer from.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        template <typename FilterArg, typename IndenterArg, typename FormatterArg, typename WriterArg>
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::StaticLogger(FilterArg &&    inFilter,
+                                                                            IndenterArg &&  inIndenter,
+                                                                            FormatterArg && inFormatter,
+                                                                            WriterArg &&    inWriter) :
+            mFilter(std::forward<FilterArg>(inFilter)),
+            mIndenter(std::forward<IndenterArg>(inIndenter)),
+            mFormatter(std::forward<FormatterArg>(inFormatter)),
+            mWriter(std::forward<WriterArg>(inWriter)),
+            mLogger(mFilter, mIndenter, mFormatter, mWriter)
+        {
+            return;
+        }
+
+        /**
+         *  @brief
+         *    This is the class destructor.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::~StaticLogger(void)
+        {
+            return;
+        }
+
+        /**
+         *  @brief
+         *    Return a reference to the filter of the logger.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        FilterT &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetFilter(void)
+        {
+            return (mFilter);
+        }
+
+        /**
+         *  @brief
+         *    Return an immutable reference to the filter of the
+         *    logger.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        const FilterT &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetFilter(void) const
+        {
+            return (mFilter);
+        }
+
+        /**
+         *  @brief
+         *    Return a reference to the indenter of the logger.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        IndenterT &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetIndenter(void)
+        {
+            return (mIndenter);
+        }
+
+        /**
+         *  @brief
+         *    Return an immutable reference to the indenter of the
+         *    logger.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        const IndenterT &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetIndenter(void) const
+        {
+            return (mIndenter);
+        }
+
+        /**
+         *  @brief
+         *    Return a reference to the formatter of the logger.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        FormatterT &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetFormatter(void)
+        {
+            return (mFormatter);
+        }
+
+        /**
+         *  @brief
+         *    Return an immutable reference to the formatter of the
+         *    logger.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        const FormatterT &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetFormatter(void) const
+        {
+            return (mFormatter);
+        }
+
+        /**
+         *  @brief
+         *    Return a reference to the writer of the logger.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        WriterT &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetWriter(void)
+        {
+            return (mWriter);
+        }
+
+        /**
+         *  @brief
+         *    Return an immutable reference to the writer of the
+         *    logger.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        const WriterT &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetWriter(void) const
+        {
+            return (mWriter);
+        }
+
+        /**
+         *  @brief
+         *    Return a reference to the runtime view of the logger.
+         *
+         *  The runtime view filters, indents, formats, and writes
+         *  with the same stages as the static logger, through their
+         *  virtual interfaces, and may be passed to any interface
+         *  taking a Logger. A recorder, if desired, may be set on it
+         *  (see Logger::SetRecorder); messages written through the
+         *  static logger itself are never recorded.
+         *
+         *  @note
+         *    The stages of the runtime view must not be replaced
+         *    with Logger::SetFilter and friends.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        Logger &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetLogger(void)
+        {
+            return (mLogger);
+        }
+
+        /**
+         *  @brief
+         *    Return an immutable reference to the runtime view of the
+         *    logger.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        const Logger &
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::GetLogger(void) const
+        {
+            return (mLogger);
+        }
+
+        /**
+         *  @brief
+         *    Test whether a message at the specified level might be
+         *    written by the logger.
+         *
+         *  As for Logger::IsEnabled, this is a cheap, conservative
+         *  test against the level limit of the filter and the levels
+         *  the writer writes at (see Writer::Base::GetLevels), which
+         *  are consulted directly rather than cached. Since messages
+         *  written through the static logger are never recorded, the
+         *  writer's levels always apply.
+         *
+         *  @param[in]  inLevel  The level the message would be logged
+         *                       at.
+         *
+         *  @returns
+         *    False if the message would certainly be rejected;
+         *    otherwise, true.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        inline bool
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::IsEnabled(Log::Level inLevel) const
+        {
+            const Log::Level theBit = (inLevel < Filter::Gate::kLevels) ? inLevel : (Filter::Gate::kLevels - 1);
+
+            return ((inLevel < mFilter.FilterT::GetLevelLimit()) &&
+                    (((mWriter.WriterT::GetLevels() >> theBit) & 1) != 0));
+        }
+
+        /**
+         *  @brief
+         *    Write a log message at the specified indent and level.
+         *
+         *  @param[in]  inIndent  The level of indendation desired for
+         *                        the provided log message.
+         *  @param[in]  inLevel   The level the current message is to
+         *                        be logged at.
+         *  @param[in]  inFormat  The log message, consisting of a
+         *                        printf-style format string composed
+         *                        of zero or more output conversion
+         *                        directives.
+         *  @param[in]  ...       A variadic argument list, where each
+         *                        argument corresponds with its peer
+         *                        output conversion directive in @a
+         *                        inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::Write(Log::Indent  inIndent,
+                                                                     Log::Level   inLevel,
+                                                                     const char * inFormat,
+                                                                     ...)
+        {
+            va_list theArguments;
+
+            va_start(theArguments, inFormat);
+
+            Write(inIndent, inLevel, inFormat, theArguments);
+
+            va_end(theArguments);
+        }
+
+        /**
+         *  @brief
+         *    Write a log message at the specified indent and level.
+         *
+         *  @param[in]  inIndent     The level of indendation desired
+         *                           for the provided log message.
+         *  @param[in]  inLevel      The level the current message is
+         *                           to be logged at.
+         *  @param[in]  inFormat     The log message, consisting of a
+         *                           printf-style format string
+         *                           composed of zero or more output
+         *                           conversion directives.
+         *  @param[in]  inArguments  A variable argument list, where
+         *                           each argument corresponds with its
+         *                           peer output conversion directive
+         *                           in @a inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::Write(Log::Indent  inIndent,
+                                                                     Log::Level   inLevel,
+                                                                     const char * inFormat,
+                                                                     std::va_list inArguments)
+        {
+            if (!Allow(inLevel, inFormat)) {
+                return;
+            }
+
+            WriteAllowed(inIndent, inLevel, inFormat, inArguments);
+        }
+
+        /**
+         *  @brief
+         *    Write a log message, with typed arguments, at the
+         *    specified indent and level.
+         *
+         *  @param[in]  inIndent  The level of indendation desired for
+         *                        the provided log message.
+         *  @param[in]  inLevel   The level the current message is to
+         *                        be logged at.
+         *  @param[in]  inFormat  The log message, consisting of a
+         *                        printf-style format string composed
+         *                        of zero or more output conversion
+         *                        directives.
+         *  @param[in]  inValues  The typed arguments, each
+         *                        corresponding with its peer output
+         *                        conversion directive in @a inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::Write(Log::Indent    inIndent,
+                                                                     Log::Level     inLevel,
+                                                                     const char *   inFormat,
+                                                                     const Values & inValues)
+        {
+            if (!Allow(inLevel, inFormat)) {
+                return;
+            }
+
+            WriteAllowed(inIndent, inLevel, inFormat, inValues);
+        }
+
+        /**
+         *  @brief
+         *    Write a log message, with typed arguments, at the
+         *    specified indent and level.
+         *
+         *  The level-only and format filters are consulted before
+         *  the arguments are captured, such that a rejected message
+         *  costs no more than the filter itself.
+         *
+         *  @param[in]  inIndent     The level of indendation desired
+         *                           for the provided log message.
+         *  @param[in]  inLevel      The level the current message is
+         *                           to be logged at.
+         *  @param[in]  inFormat     The log message, consisting of a
+         *                           printf-style format string
+         *                           composed of zero or more output
+         *                           conversion directives.
+         *  @param[in]  inArguments  The arguments, each corresponding
+         *                           with its peer output conversion
+         *                           directive in @a inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        template <typename... Args>
+        inline void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::WriteTyped(Log::Indent     inIndent,
+                                                                          Log::Level      inLevel,
+                                                                          const char *    inFormat,
+                                                                          const Args &... inArguments)
+        {
+            if (!Allow(inLevel, inFormat)) {
+                return;
+            }
+
+            // The trailing element keeps the array from being empty.
+
+            const Value theValues[sizeof...(Args) + 1] = { Value(inArguments)..., Value(nullptr) };
+
+            WriteAllowed(inIndent, inLevel, inFormat, Values(theValues, sizeof...(Args)));
+        }
+
+        /**
+         *  @brief
+         *    Write a log message with no indent and at the provided
+         *    level.
+         *
+         *  @param[in]  inLevel   The level the current message is to
+         *                        be logged at.
+         *  @param[in]  inFormat  The log message, consisting of a
+         *                        printf-style format string composed
+         *                        of zero or more output conversion
+         *                        directives.
+         *  @param[in]  ...       A variadic argument list, where each
+         *                        argument corresponds with its peer
+         *                        output conversion directive in @a
+         *                        inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::Write(Log::Level inLevel, const char * inFormat, ...)
+        {
+            va_list theArguments;
+
+            va_start(theArguments, inFormat);
+
+            Write(inLevel, inFormat, theArguments);
+
+            va_end(theArguments);
+        }
+
+        /**
+         *  @brief
+         *    Write a log message with no indent and at the provided
+         *    level.
+         *
+         *  @param[in]  inLevel      The level the current message is
+         *                           to be logged at.
+         *  @param[in]  inFormat     The log message, consisting of a
+         *                           printf-style format string
+         *                           composed of zero or more output
+         *                           conversion directives.
+         *  @param[in]  inArguments  A variable argument list, where
+         *                           each argument corresponds with its
+         *                           peer output conversion directive
+         *                           in @a inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::Write(Log::Level   inLevel,
+                                                                     const char * inFormat,
+                                                                     std::va_list inArguments)
+        {
+            static const Log::Indent kIndent = 0;
+
+            Write(kIndent, inLevel, inFormat, inArguments);
+        }
+
+        /**
+         *  @brief
+         *    Write a log message, with typed arguments, with no
+         *    indent and at the provided level.
+         *
+         *  @param[in]  inLevel      The level the current message is
+         *                           to be logged at.
+         *  @param[in]  inFormat     The log message, consisting of a
+         *                           printf-style format string
+         *                           composed of zero or more output
+         *                           conversion directives.
+         *  @param[in]  inArguments  The arguments, each corresponding
+         *                           with its peer output conversion
+         *                           directive in @a inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        template <typename Format, typename... Args, typename std::enable_if<std::is_convertible<Format, const char *>::value &&
+                                                                     !std::is_arithmetic<Format>::value, int>::type>
+        inline void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::WriteTyped(Log::Level      inLevel,
+                                                                          const Format &  inFormat,
+                                                                          const Args &... inArguments)
+        {
+            static const Log::Indent kIndent = 0;
+
+            WriteTyped(kIndent, inLevel, static_cast<const char *>(inFormat), inArguments...);
+        }
+
+        /**
+         *  @brief
+         *    Write a log message with no indent and at level zero (0).
+         *
+         *  @param[in]  inFormat  The log message, consisting of a
+         *                        printf-style format string composed
+         *                        of zero or more output conversion
+         *                        directives.
+         *  @param[in]  ...       A variadic argument list, where each
+         *                        argument corresponds with its peer
+         *                        output conversion directive in @a
+         *                        inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::Write(const char * inFormat, ...)
+        {
+            va_list theArguments;
+
+            va_start(theArguments, inFormat);
+
+            Write(inFormat, theArguments);
+
+            va_end(theArguments);
+        }
+
+        /**
+         *  @brief
+         *    Write a log message with no indent and at level zero (0).
+         *
+         *  @param[in]  inFormat     The log message, consisting of a
+         *                           printf-style format string
+         *                           composed of zero or more output
+         *                           conversion directives.
+         *  @param[in]  inArguments  A variable argument list, where
+         *                           each argument corresponds with its
+         *                           peer output conversion directive
+         *                           in @a inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::Write(const char * inFormat, std::va_list inArguments)
+        {
+            static const Log::Indent kIndent = 0;
+            static const Log::Level  kLevel  = 0;
+
+            Write(kIndent, kLevel, inFormat, inArguments);
+        }
+
+        /**
+         *  @brief
+         *    Write a log message, with typed arguments, with no
+         *    indent and at level zero (0).
+         *
+         *  @param[in]  inFormat     The log message, consisting of a
+         *                           printf-style format string
+         *                           composed of zero or more output
+         *                           conversion directives.
+         *  @param[in]  inArguments  The arguments, each corresponding
+         *                           with its peer output conversion
+         *                           directive in @a inFormat.
+         *
+         */
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        template <typename Format, typename... Args, typename std::enable_if<std::is_convertible<Format, const char *>::value &&
+                                                                     !std::is_arithmetic<Format>::value, int>::type>
+        inline void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::WriteTyped(const Format &  inFormat,
+                                                                          const Args &... inArguments)
+        {
+            static const Log::Indent kIndent = 0;
+            static const Log::Level  kLevel  = 0;
+
+            WriteTyped(kIndent, kLevel, static_cast<const char *>(inFormat), inArguments...);
+        }
+
+        // Each stage is invoked with a qualified call to its own
+        // type's implementation, which bypasses virtual dispatch; the
+        // stage, being held by value, is known to be of exactly that
+        // type.
+
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        inline bool
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::Allow(Log::Level inLevel, const char * inFormat)
+        {
+            return (mFilter.FilterT::Allow(inLevel) &&
+                    (!mFilter.FilterT::NeedsFormat() ||
+                     mFilter.FilterT::AllowFormat(inLevel, inFormat)));
+        }
+
+        template <typename FilterT, typename IndenterT, typename FormatterT, typename WriterT>
+        template <typename Source>
+        void
+        StaticLogger<FilterT, IndenterT, FormatterT, WriterT>::WriteAllowed(Log::Indent  inIndent,
+                                                                            Log::Level   inLevel,
+                                                                            const char * inFormat,
+                                                                            Source &&    inSource)
+        {
+            ScopedMessage theScope;
+            std::string & theMessage = theScope.Get();
+
+            mFormatter.FormatterT::Format(theMessage, inLevel, inFormat, std::forward<Source>(inSource));
+
+            mIndenter.IndenterT::Indent(inIndent, theMessage);
+
+            if (!mFilter.FilterT::NeedsMessage() ||
+                mFilter.FilterT::AllowMessage(inLevel, theMessage.c_str())) {
+                mWriter.WriterT::Write(inLevel, theMessage.c_str());
+            }
+        }
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGSTATICLOGGER_HPP */
@@ -23,7 +23,12 @@
 #ifndef LOGUTILITIES_LOGUTILITIES_HPP
 #define LOGUTILITIES_LOGUTILITIES_HPP
 
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogCallSite.hpp>
+#include <LogUtilities/LogClock.hpp>
+#include <LogUtilities/LogDecoder.hpp>
 #include <LogUtilities/LogFilter.hpp>
+#include <LogUtilities/LogFormatString.hpp>
 #include <LogUtilities/LogFormatter.hpp>
 #include <LogUtilities/LogFunctionUtilities.hpp>
 #include <LogUtilities/LogGlobals.hpp>
@@ -31,7 +36,11 @@
 #include <LogUtilities/LogLogger.hpp>
 #include <LogUtilities/LogMacros.hpp>
 #include <LogUtilities/LogMemoryUtilities.hpp>
+#include <LogUtilities/LogRecorder.hpp>
+#include <LogUtilities/LogScopedMessage.hpp>
+#include <LogUtilities/LogStaticLogger.hpp>
 #include <LogUtilities/LogTypes.hpp>
+#include <LogUtilities/LogValues.hpp>
 #include <LogUtilities/LogWriter.hpp>
 
 #endif /* LOGUTILITIES_LOGUTILITIES_HPP */
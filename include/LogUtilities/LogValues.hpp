@@ -0,0 +1,240 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines Nuovations Log Utilities objects for the
+ *      typed arguments to a printf-style format string and for
+ *      performing output conversion against them directly.
+ */
+
+#ifndef LOGUTILITIES_LOGVALUES_HPP
+#define LOGUTILITIES_LOGVALUES_HPP
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+#include <stdint.h>
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        /**
+         *  @brief
+         *    A single argument to a printf-style format string,
+         *    along with its type as known at compile time.
+         *
+         *  Values are implicitly constructible from any integer,
+         *  enumeration, floating point, string, or pointer argument
+         *  and are trivially copyable, such that an array of them
+         *  may be built on the stack from a variadic template
+         *  argument pack.
+         *
+         */
+        class Value
+        {
+        public:
+            /**
+             *  The type of the argument.
+             */
+            enum class Type : uint8_t
+            {
+                kSigned,      //!< A signed integer.
+                kUnsigned,    //!< An unsigned integer.
+                kDouble,      //!< A float or a double.
+                kLongDouble,  //!< A long double.
+                kPointer,     //!< An object pointer.
+                kString,      //!< A narrow string.
+                kWideString   //!< A wide string.
+            };
+
+        public:
+            template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, int>::type = 0>
+            Value(T inValue) :
+                mType(Type::kSigned)
+            {
+                mValue.mSigned = inValue;
+            }
+
+            template <typename T, typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, int>::type = 0>
+            Value(T inValue) :
+                mType(Type::kUnsigned)
+            {
+                mValue.mUnsigned = inValue;
+            }
+
+            template <typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+            Value(T inValue) :
+                Value(static_cast<typename std::underlying_type<T>::type>(inValue))
+            {
+                return;
+            }
+
+            template <typename T>
+            Value(const T * inValue) :
+                mType(Type::kPointer)
+            {
+                mValue.mPointer = inValue;
+            }
+
+            Value(double inValue) :
+                mType(Type::kDouble)
+            {
+                mValue.mDouble = inValue;
+            }
+
+            Value(long double inValue) :
+                mType(Type::kLongDouble)
+            {
+                mValue.mLongDouble = inValue;
+            }
+
+            Value(const char * inValue) :
+                mType(Type::kString)
+            {
+                mValue.mString = inValue;
+            }
+
+            Value(const wchar_t * inValue) :
+                mType(Type::kWideString)
+            {
+                mValue.mWideString = inValue;
+            }
+
+            Value(std::nullptr_t inValue) :
+                mType(Type::kPointer)
+            {
+                mValue.mPointer = inValue;
+            }
+
+            Type GetType(void) const;
+
+            bool GetInteger(intmax_t & outValue) const;
+            bool GetFloat(long double & outValue) const;
+            bool GetPointer(const void *& outValue) const;
+            bool GetString(const char *& outValue) const;
+            bool GetWideString(const wchar_t *& outValue) const;
+
+        private:
+            Type mType;            //!< The type of the argument.
+
+            union
+            {
+                intmax_t        mSigned;
+                uintmax_t       mUnsigned;
+                double          mDouble;
+                long double     mLongDouble;
+                const void *    mPointer;
+                const char *    mString;
+                const wchar_t * mWideString;
+            }    mValue;           //!< The argument.
+        };
+
+        /**
+         *  @brief
+         *    An immutable view of the typed arguments to a
+         *    printf-style format string.
+         *
+         *  Output conversion against the arguments converts integers,
+         *  pointers, and strings directly, without the printf
+         *  engine. Because the type of each argument is known, a
+         *  directive that does not match its argument, or that has
+         *  no argument, is reproduced verbatim rather than invoking
+         *  undefined behavior.
+         *
+         *  The view does not own the arguments, which are expected
+         *  to be on the caller's stack.
+         *
+         *  A default-constructed view is a literal one: it has no
+         *  arguments and its format string is known, typically at
+         *  compile time, to contain no directives at all, such that
+         *  it is rendered as is, without even scanning it.
+         *
+         */
+        class Values
+        {
+        public:
+            Values(void);
+            Values(const Value * inValues, size_t inCount);
+
+            bool          IsLiteral(void) const;
+            size_t        Size(void) const;
+            const Value & operator [](size_t inIndex) const;
+
+            int  GetError(void) const;
+
+            void Render(std::string & inMessage, const char * inFormat) const;
+
+        private:
+            const Value * mValues;  //!< The arguments.
+            size_t        mCount;   //!< The number of arguments.
+            int           mError;   //!< The value of errno when the view
+                                    //!< was made, for %m.
+            bool          mLiteral; //!< Whether the format string has
+                                    //!< no directives.
+        };
+
+        /**
+         *  @brief
+         *    This is the class default constructor.
+         *
+         *  This constructs a literal view, for a format string with
+         *  no directives.
+         *
+         */
+        inline
+        Values::Values(void) :
+            mValues(NULL),
+            mCount(0),
+            mError(0),
+            mLiteral(true)
+        {
+            return;
+        }
+
+        /**
+         *  @brief
+         *    This is a class constructor.
+         *
+         *  The current value of errno is recorded for the %m
+         *  directive.
+         *
+         *  @param[in]  inValues  A pointer to the first of the
+         *                        arguments.
+         *  @param[in]  inCount   The number of arguments.
+         *
+         */
+        inline
+        Values::Values(const Value * inValues, size_t inCount) :
+            mValues(inValues),
+            mCount(inCount),
+            mError(errno),
+            mLiteral(false)
+        {
+            return;
+        }
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGVALUES_HPP */
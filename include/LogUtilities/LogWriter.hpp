@@ -25,10 +25,12 @@
 #define LOGUTILITIES_LOGWRITER_HPP
 
 #include <LogUtilities/LogWriterASL.hpp>
+#include <LogUtilities/LogWriterAsynchronous.hpp>
 #include <LogUtilities/LogWriterBase.hpp>
 #include <LogUtilities/LogWriterChain.hpp>
 #include <LogUtilities/LogWriterDescriptor.hpp>
 #include <LogUtilities/LogWriterPath.hpp>
+#include <LogUtilities/LogWriterStaticChain.hpp>
 #include <LogUtilities/LogWriterStderr.hpp>
 #include <LogUtilities/LogWriterStdio.hpp>
 #include <LogUtilities/LogWriterStdout.hpp>
@@ -0,0 +1,141 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities concrete writer
+ *      implementation that queues messages from the writing thread
+ *      and writes them to another writer from a dedicated backend
+ *      thread.
+ */
+
+#ifndef LOGUTILITIES_LOGWRITERASYNCHRONOUS_HPP
+#define LOGUTILITIES_LOGWRITERASYNCHRONOUS_HPP
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
+#include "LogWriterBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Writer
+        {
+
+            /**
+             *  @brief
+             *    Log writer object that queues messages from the
+             *    writing thread and writes them to another writer
+             *    from a dedicated backend thread.
+             *
+             *  Messages are copied into a bounded, lock-free ring
+             *  shared by all writing threads, such that a slow
+             *  destination (for example, a blocked pipe or a
+             *  backed-up syslog daemon) does not stall the threads
+             *  doing the logging. A single backend thread drains the
+             *  ring, in order, into the target writer, which is
+             *  typically a Log::Writer::Chain.
+             *
+             *  Since only the backend thread writes to the target
+             *  writer, it need not itself be thread-safe.
+             *
+             *  Under the blocking overflow policy, a stall timeout
+             *  bounds how long a writing thread waits for room: once
+             *  it has waited that long, or the backend thread has
+             *  been inside a single write to the target for that long
+             *  (that is, the destination has stalled), the message is
+             *  discarded instead, such that a hung destination costs
+             *  only its own messages.
+             *
+             *  @ingroup writer
+             *
+             */
+            class Asynchronous :
+                public Base
+            {
+            public:
+                /**
+                 *  @brief
+                 *    Overflow policies.
+                 *
+                 *    Overflow policies which determine how the writer
+                 *    behaves when a message is written while the
+                 *    queue is full.
+                 */
+                enum class Overflow : uint8_t {
+                    kDrop  = 0, //!< Discard the message and count it as dropped.
+                    kBlock = 1  //!< Wait for the backend thread to make room for the message.
+                };
+
+                static const size_t kCapacityDefault = 1024;
+
+            public:
+                Asynchronous(Base & inWriter);
+                Asynchronous(Base & inWriter, size_t inCapacity);
+                Asynchronous(Base & inWriter, size_t inCapacity, Overflow inOverflow);
+                Asynchronous(Base & inWriter, size_t inCapacity, Overflow inOverflow, uint32_t inStallTimeout);
+                virtual ~Asynchronous(void);
+
+                // Write at the specified level.
+
+                virtual void Write(Level inLevel, const char * inMessage);
+
+                // Write with no ident at level zero (0).
+
+                virtual void Write(const char * inMessage);
+
+                virtual uint64_t GetLevels(void) const;
+
+                void Flush(void);
+                void Stop(void);
+
+                // Counters
+
+                size_t GetCapacity(void) const;
+                size_t GetDepth(void) const;
+                uint64_t GetWritten(void) const;
+                uint64_t GetDropped(void) const;
+                uint64_t GetMeanLatency(void) const;
+                uint64_t GetMaxLatency(void) const;
+                bool IsStalled(void) const;
+
+            private:
+                Asynchronous(const Asynchronous & inWriter) = delete;
+                Asynchronous & operator =(const Asynchronous & inWriter) = delete;
+
+                struct Implementation;
+
+                /**
+                 *  A shared, reference-counted pointer to the writer
+                 *  implementation.
+                 */
+                boost::shared_ptr<Implementation> mImplementation;
+            };
+
+        }; // namespace Writer
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGWRITERASYNCHRONOUS_HPP */
@@ -25,6 +25,9 @@
 #ifndef LOGUTILITIES_LOGWRITERBASE_HPP
 #define LOGUTILITIES_LOGWRITERBASE_HPP
 
+#include <stdint.h>
+
+#include "LogOwned.hpp"
 #include "LogTypes.hpp"
 
 namespace Nuovations
@@ -46,11 +49,14 @@ namespace Nuovations
              *  @ingroup writer
              *
              */
-            class Base
+            class Base :
+                protected Owned
             {
             public:
                 virtual ~Base(void);
 
+                virtual uint64_t GetLevels(void) const;
+
                 /**
                  *  @brief
                  *    Write a log message at the specified level.
@@ -73,6 +79,9 @@ namespace Nuovations
 
             protected:
                 Base(void);
+
+            private:
+                virtual void RefreshGates(void) const;
             };
 
         }; // namespace Writer
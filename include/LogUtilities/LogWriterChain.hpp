@@ -25,7 +25,15 @@
 #ifndef LOGUTILITIES_LOGWRITERCHAIN_HPP
 #define LOGUTILITIES_LOGWRITERCHAIN_HPP
 
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <boost/shared_ptr.hpp>
+
 #include "LogChain.hpp"
+#include "LogWriterAsynchronous.hpp"
 #include "LogWriterBase.hpp"
 
 namespace Nuovations
@@ -42,6 +50,29 @@ namespace Nuovations
              *    Log writer object that performs sequential writes to each
              *    link in a chain of writers on a single write to the chain.
              *
+             *  By default, each link is written to on the writing
+             *  thread, in turn, such that one slow link delays those
+             *  after it and the writing thread itself. A link may
+             *  instead be pushed with a queue of its own (fanned out),
+             *  in which case a write to the chain only queues the
+             *  message for that link, and a dedicated thread for the
+             *  link writes it out. Each such link has its own
+             *  capacity, overflow policy, and stall timeout, as well
+             *  as drop and latency counters (see Writer::Asynchronous),
+             *  such that a slow or hung destination degrades only
+             *  itself.
+             *
+             *  Queued links are written to on their own threads, so
+             *  messages to different links are no longer ordered with
+             *  respect to one another, but messages to any one link
+             *  remain in order.
+             *
+             *  Each link may also be limited to a range of levels,
+             *  outside which it is not written to. The chain reports
+             *  the union of those ranges as the levels it may write
+             *  at (see #GetLevels), such that a logger rejects
+             *  messages no link would write before formatting them.
+             *
              *  @ingroup writer
              *
              */
@@ -51,8 +82,106 @@ namespace Nuovations
             {
             public:
                 Chain(void);
+                Chain(const Chain & inChain);
                 virtual ~Chain(void);
 
+                Chain & operator =(const Chain & inChain);
+
+                /**
+                 *  @brief
+                 *    Push a copy of the specified writer onto the
+                 *    trailing link of the chain, to be written to on
+                 *    the writing thread.
+                 *
+                 *  @tparam     Derived  The derived type for the
+                 *                       writer to be pushed/added.
+                 *  @param[in]  inLink   An immutable reference to the
+                 *                       writer to be added to the
+                 *                       chain.
+                 *
+                 */
+                template <typename Derived>
+                void Push(const Derived & inLink)
+                {
+                    Log::Chain<Base>::Push(inLink);
+
+                    AddRoute(0, kLevelMaximum);
+                }
+
+                /**
+                 *  @brief
+                 *    Push a copy of the specified writer onto the
+                 *    trailing link of the chain, to be written to on
+                 *    the writing thread at the specified levels only.
+                 *
+                 *  @tparam     Derived    The derived type for the
+                 *                         writer to be pushed/added.
+                 *  @param[in]  inLink     An immutable reference to
+                 *                         the writer to be added to
+                 *                         the chain.
+                 *  @param[in]  inMinimum  The lowest level the link
+                 *                         is written to at.
+                 *  @param[in]  inMaximum  The highest level the link
+                 *                         is written to at.
+                 *
+                 */
+                template <typename Derived>
+                void Push(const Derived & inLink, Level inMinimum, Level inMaximum)
+                {
+                    Log::Chain<Base>::Push(inLink);
+
+                    AddRoute(inMinimum, inMaximum);
+                }
+
+                /**
+                 *  @brief
+                 *    Push a copy of the specified writer onto the
+                 *    trailing link of the chain, to be written to
+                 *    from a queue and thread of its own.
+                 *
+                 *  @tparam     Derived         The derived type for
+                 *                              the writer to be
+                 *                              pushed/added.
+                 *  @param[in]  inLink          An immutable reference
+                 *                              to the writer to be
+                 *                              added to the chain.
+                 *  @param[in]  inCapacity      The minimum number of
+                 *                              messages that may be
+                 *                              queued for the link.
+                 *  @param[in]  inOverflow      The policy to apply
+                 *                              when a message is
+                 *                              written while the
+                 *                              link's queue is full.
+                 *  @param[in]  inStallTimeout  The longest, in
+                 *                              milliseconds, a write
+                 *                              may wait for room, and
+                 *                              after which the link is
+                 *                              considered stalled, or
+                 *                              zero (0) for no limit.
+                 *
+                 */
+                template <typename Derived>
+                void Push(const Derived &        inLink,
+                          size_t                 inCapacity,
+                          Asynchronous::Overflow inOverflow,
+                          uint32_t               inStallTimeout)
+                {
+                    Log::Chain<Base>::Push(inLink);
+
+                    AddRoute(inCapacity, inOverflow, inStallTimeout);
+                }
+
+                void Pop(void);
+                void Reset(void);
+
+                Asynchronous * GetQueue(size_t inIndex) const;
+
+                void SetLevels(size_t inIndex, Level inMinimum, Level inMaximum);
+
+                virtual uint64_t GetLevels(void) const;
+
+                void Flush(void);
+
                 // Write at the specified level.
 
                 virtual void Write(Level inLevel, const char * inMessage);
@@ -60,6 +189,50 @@ namespace Nuovations
                 // Write with no ident at level zero (0).
 
                 virtual void Write(const char * inMessage);
+
+            private:
+                static const Level kLevelMaximum = static_cast<Level>(-1);
+
+                typedef boost::shared_ptr<Asynchronous> queue_pointer;
+
+                // How messages reach a link: the levels at which it
+                // is written to and, if it has one, through its queue.
+
+                struct Route
+                {
+                    queue_pointer mQueue;   //!< The queue of the link,
+                                            //!< if any.
+                    Level         mMinimum; //!< The lowest level the
+                                            //!< link is written to at.
+                    Level         mMaximum; //!< The highest level the
+                                            //!< link is written to at.
+                };
+
+                typedef std::vector<Route>   routes_type;
+                typedef std::vector<Chain *> copies_type;
+
+                void AddRoute(Level inMinimum, Level inMaximum);
+                void AddRoute(size_t inCapacity, Asynchronous::Overflow inOverflow, uint32_t inStallTimeout);
+                void AppendRoute(Route & inRoute);
+
+                void AdoptLinks(void);
+                void DisownLinks(void);
+                void AdoptTrailingLink(void);
+                void DisownTrailingLink(void);
+                void DisownSharedLinks(void);
+                void InvalidateCopies(void);
+
+            private:
+                boost::shared_ptr<routes_type> mRoutes; //!< The route to each
+                                                        //!< link, shared, as
+                                                        //!< are the links
+                                                        //!< themselves, among
+                                                        //!< copies of the
+                                                        //!< chain.
+                boost::shared_ptr<copies_type> mCopies; //!< The copies of the
+                                                        //!< chain, this one
+                                                        //!< among them,
+                                                        //!< sharing its links.
             };
 
         }; // namespace Writer
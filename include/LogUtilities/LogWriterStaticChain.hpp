@@ -0,0 +1,264 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file defines a Nuovations Log Utilities template writer
+ *      that composes a fixed chain of writers at compile time.
+ */
+
+#ifndef LOGUTILITIES_LOGWRITERSTATICCHAIN_HPP
+#define LOGUTILITIES_LOGWRITERSTATICCHAIN_HPP
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "LogWriterBase.hpp"
+
+namespace Nuovations
+{
+
+    namespace Log
+    {
+
+        namespace Writer
+        {
+
+            /**
+             *  @brief
+             *    Log writer object that writes each message to every
+             *    link in a chain of writers fixed at compile time.
+             *
+             *  Unlike Chain, the links are held by value, in order,
+             *  and each is invoked directly rather than through its
+             *  virtual interface, such that the writes may be
+             *  inlined into the chain.
+             *
+             *  The chain is itself a writer and may be used anywhere
+             *  one is, including by Logger.
+             *
+             *  @tparam  Writers  The concrete type of each link, in the
+             *                    order the links are written to.
+             *
+             *  @ingroup writer
+             *
+             */
+            template <typename... Writers>
+            class StaticChain :
+                public Base
+            {
+                static_assert(sizeof...(Writers) > 0, "a static writer chain must have at least one link");
+
+            public:
+                typedef std::tuple<Writers...> container_type;
+
+                template <size_t N>
+                using link_type = typename std::tuple_element<N, container_type>::type;
+
+            public:
+                StaticChain(void);
+                template <typename... Args>
+                explicit StaticChain(Args &&... inArguments);
+                virtual ~StaticChain(void);
+
+                template <size_t N>
+                link_type<N> &       Link(void);
+                template <size_t N>
+                const link_type<N> & Link(void) const;
+
+                static constexpr size_t Size(void);
+
+                // Write at the specified level.
+
+                virtual void Write(Level inLevel, const char * inMessage);
+
+                // Write with no ident at level zero (0).
+
+                virtual void Write(const char * inMessage);
+
+            private:
+                template <size_t N>
+                using Index = std::integral_constant<size_t, N>;
+
+                typedef Index<sizeof...(Writers)> End;
+
+                void Write(Level inLevel, const char * inMessage, End);
+                template <size_t N>
+                void Write(Level inLevel, const char * inMessage, Index<N>);
+
+            private:
+                container_type mLinks; //!< The links of the chain.
+            };
+
+            /**
+             *  @brief
+             *    This is the class default constructor, default
+             *    constructing each link.
+             *
+             */
+            template <typename... Writers>
+            StaticChain<Writers...>::StaticChain(void) :
+                Base(),
+                mLinks()
+            {
+                return;
+            }
+
+            /**
+             *  @brief
+             *    This is a class constructor, constructing each link
+             *    from its peer argument.
+             *
+             *  Since writers often own an output destination and
+             *  cannot be copied, each link is constructed in place,
+             *  from whatever its peer argument is (for example, a
+             *  descriptor or path), rather than copied.
+             *
+             *  @param[in]  inArguments  The argument to construct each
+             *                           link from, in link order.
+             *
+             */
+            template <typename... Writers>
+            template <typename... Args>
+            StaticChain<Writers...>::StaticChain(Args &&... inArguments) :
+                Base(),
+                mLinks(std::forward<Args>(inArguments)...)
+            {
+                return;
+            }
+
+            /**
+             *  @brief
+             *    This is the class destructor.
+             *
+             */
+            template <typename... Writers>
+            StaticChain<Writers...>::~StaticChain(void)
+            {
+                return;
+            }
+
+            /**
+             *  @brief
+             *    Return a reference to the link at the specified
+             *    position in the chain.
+             *
+             *  @tparam  N  The zero-based position of the link.
+             *
+             */
+            template <typename... Writers>
+            template <size_t N>
+            typename StaticChain<Writers...>::template link_type<N> &
+            StaticChain<Writers...>::Link(void)
+            {
+                return (std::get<N>(mLinks));
+            }
+
+            /**
+             *  @brief
+             *    Return an immutable reference to the link at the
+             *    specified position in the chain.
+             *
+             *  @tparam  N  The zero-based position of the link.
+             *
+             */
+            template <typename... Writers>
+            template <size_t N>
+            const typename StaticChain<Writers...>::template link_type<N> &
+            StaticChain<Writers...>::Link(void) const
+            {
+                return (std::get<N>(mLinks));
+            }
+
+            /**
+             *  @brief
+             *    Return the number of links in the chain.
+             *
+             */
+            template <typename... Writers>
+            constexpr size_t
+            StaticChain<Writers...>::Size(void)
+            {
+                return (sizeof...(Writers));
+            }
+
+            /**
+             *  @brief
+             *    Write a log message, at the specified level, to each
+             *    link in the chain, in order.
+             *
+             *  @param[in]  inLevel    The level the current message
+             *                         is to be logged at.
+             *  @param[in]  inMessage  The log message to write.
+             *
+             */
+            template <typename... Writers>
+            void
+            StaticChain<Writers...>::Write(Level inLevel, const char * inMessage)
+            {
+                Write(inLevel, inMessage, Index<0>());
+            }
+
+            /**
+             *  @brief
+             *    Write a log message, at the default level, to each
+             *    link in the chain, in order.
+             *
+             *  @param[in]  inMessage  The log message to write.
+             *
+             */
+            template <typename... Writers>
+            void
+            StaticChain<Writers...>::Write(const char * inMessage)
+            {
+                Write(0, inMessage, Index<0>());
+            }
+
+            // Each link is invoked with a qualified call to its own
+            // type's implementation, which bypasses virtual dispatch;
+            // the link, being held by value, is known to be of
+            // exactly that type.
+
+            template <typename... Writers>
+            void
+            StaticChain<Writers...>::Write(Level inLevel, const char * inMessage, End)
+            {
+                (void)inLevel;
+                (void)inMessage;
+            }
+
+            template <typename... Writers>
+            template <size_t N>
+            void
+            StaticChain<Writers...>::Write(Level inLevel, const char * inMessage, Index<N>)
+            {
+                typedef link_type<N> Current;
+
+                std::get<N>(mLinks).Current::Write(inLevel, inMessage);
+
+                Write(inLevel, inMessage, Index<N + 1>());
+            }
+
+        }; // namespace Writer
+
+    }; // namespace Log
+
+}; // namespace Nuovations
+
+#endif /* LOGUTILITIES_LOGWRITERSTATICCHAIN_HPP */
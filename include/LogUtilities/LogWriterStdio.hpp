@@ -62,6 +62,12 @@ namespace Nuovations
 
                 virtual void Write(const char * inMessage);
 
+                // Write raw, binary data.
+
+                void WriteData(const void * inData, size_t inSize);
+
+                void Flush(void);
+
             protected:
                 Stdio(void);
 
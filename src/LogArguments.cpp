@@ -0,0 +1,984 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities object for
+ *      capturing the arguments to a printf-style format string such
+ *      that the output conversion may be performed later.
+ */
+
+#include <cerrno>
+#include <cstdarg>
+#include <cstring>
+#include <cwchar>
+#include <string>
+#include <type_traits>
+
+using namespace std;
+
+#include <stddef.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogFormatString.hpp>
+#include <LogUtilities/LogValues.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+/**
+ *  The longest conversion directive, including the leading '%',
+ *  that may be captured.
+ */
+static const size_t kDirectiveMax = 64;
+
+/**
+ *  The length recorded for a null string argument.
+ */
+static const size_t kNullString   = SIZE_MAX;
+
+/**
+ *  The number of nanoseconds in a second.
+ */
+static const Clock::Ticks kNanosecondsPerSecond = 1000000000;
+
+using FormatString::Directive;
+using FormatString::Kind;
+
+namespace
+{
+
+/**
+ *  A source of arguments drawn from a variable argument list.
+ *
+ *  @private
+ */
+class ListSource
+{
+public:
+    ListSource(std::va_list inList)
+    {
+        va_copy(mList, inList);
+    }
+
+    ~ListSource(void)
+    {
+        va_end(mList);
+    }
+
+    template <typename T>
+    bool Take(T & outValue)
+    {
+        outValue = va_arg(mList, T);
+
+        return (true);
+    }
+
+private:
+    va_list mList;
+};
+
+/**
+ *  A source of arguments drawn from typed values, each of which is
+ *  converted to the type its directive calls for, as printf itself
+ *  would, provided that it is of a compatible kind.
+ *
+ *  @private
+ */
+class ValuesSource
+{
+public:
+    ValuesSource(const Values & inValues) :
+        mValues(inValues),
+        mNext(0)
+    {
+        return;
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_integral<T>::value, bool>::type
+    Take(T & outValue)
+    {
+        intmax_t theValue;
+
+        if ((mNext >= mValues.Size()) || !mValues[mNext++].GetInteger(theValue)) {
+            return (false);
+        }
+
+        outValue = static_cast<T>(theValue);
+
+        return (true);
+    }
+
+    template <typename T>
+    typename std::enable_if<std::is_floating_point<T>::value, bool>::type
+    Take(T & outValue)
+    {
+        long double theValue;
+
+        if ((mNext >= mValues.Size()) || !mValues[mNext++].GetFloat(theValue)) {
+            return (false);
+        }
+
+        outValue = static_cast<T>(theValue);
+
+        return (true);
+    }
+
+    bool Take(void *& outValue)
+    {
+        const void * theValue;
+
+        if ((mNext >= mValues.Size()) || !mValues[mNext++].GetPointer(theValue)) {
+            return (false);
+        }
+
+        outValue = const_cast<void *>(theValue);
+
+        return (true);
+    }
+
+    bool Take(const char *& outValue)
+    {
+        return ((mNext < mValues.Size()) && mValues[mNext++].GetString(outValue));
+    }
+
+    bool Take(const wchar_t *& outValue)
+    {
+        return ((mNext < mValues.Size()) && mValues[mNext++].GetWideString(outValue));
+    }
+
+private:
+    const Values & mValues;
+    size_t         mNext;
+};
+
+}; // namespace
+
+/**
+ *  Parse the conversion directive at @a inFormat, which must point
+ *  to a '%'.
+ *
+ *  @returns
+ *    True if the directive was parsed and may be captured; otherwise,
+ *    false, for unknown conversions, positional arguments, and
+ *    directives too long to regenerate.
+ *
+ */
+static bool
+ParseCapturable(const char * inFormat, Directive & outDirective)
+{
+    return (FormatString::Parse(inFormat, outDirective) &&
+            (outDirective.mKind != Kind::kInvalid)      &&
+            (outDirective.mPosition < 0)                &&
+            (outDirective.mWidthPosition < 0)           &&
+            (outDirective.mPrecisionPosition < 0)       &&
+            (outDirective.mSize < kDirectiveMax));
+}
+
+template <typename T>
+static inline void
+Put(string & inData, const T & inValue)
+{
+    inData.append(reinterpret_cast<const char *>(&inValue), sizeof (T));
+}
+
+template <typename T, typename Source>
+static inline bool
+PutNext(string & inData, Source & inSource)
+{
+    T theValue;
+
+    if (!inSource.Take(theValue)) {
+        return (false);
+    }
+
+    Put(inData, theValue);
+
+    return (true);
+}
+
+template <typename T>
+static inline T
+Get(const string & inData, size_t & inOffset)
+{
+    T theValue;
+
+    memcpy(&theValue, inData.data() + inOffset, sizeof (T));
+
+    inOffset += sizeof (T);
+
+    return (theValue);
+}
+
+static void
+PutString(string & inData, const char * inString, int inPrecision)
+{
+    size_t theLength;
+
+    if (inString == NULL) {
+        Put(inData, kNullString);
+        return;
+    }
+
+    // Honor any precision such that the argument need not be null
+    // terminated, as printf itself allows.
+
+    if (inPrecision >= 0) {
+        theLength = strnlen(inString, static_cast<size_t>(inPrecision));
+    } else {
+        theLength = strlen(inString);
+    }
+
+    Put(inData, theLength);
+
+    inData.append(inString, theLength);
+    inData.push_back('\0');
+}
+
+static void
+PutWideString(string & inData, const wchar_t * inString, int inPrecision)
+{
+    size_t theLength;
+
+    if (inString == NULL) {
+        Put(inData, kNullString);
+        return;
+    }
+
+    // Every wide character converts to at least one byte, so no more
+    // than the precision's worth of them can be needed.
+
+    if (inPrecision >= 0) {
+        theLength = wcsnlen(inString, static_cast<size_t>(inPrecision));
+    } else {
+        theLength = wcslen(inString);
+    }
+
+    Put(inData, theLength);
+
+    inData.append(reinterpret_cast<const char *>(inString), theLength * sizeof (wchar_t));
+}
+
+// Adapt to whichever of the GNU or XSI strerror_r the platform has.
+
+static inline const char *
+ErrorString(int inStatus, const char * inBuffer)
+{
+    return ((inStatus == 0) ? inBuffer : "Unknown error");
+}
+
+static inline const char *
+ErrorString(const char * inResult, const char * inBuffer)
+{
+    (void)inBuffer;
+
+    return (inResult);
+}
+
+template <typename T>
+static void
+AppendValue(string &          inMessage,
+            const char *      inDirective,
+            const Directive & inParsed,
+            int               inWidth,
+            int               inPrecision,
+            T                 inValue)
+{
+    if (inParsed.mWidthStar && inParsed.mPrecisionStar) {
+        FormatString::Append(inMessage, inDirective, inWidth, inPrecision, inValue);
+
+    } else if (inParsed.mWidthStar) {
+        FormatString::Append(inMessage, inDirective, inWidth, inValue);
+
+    } else if (inParsed.mPrecisionStar) {
+        FormatString::Append(inMessage, inDirective, inPrecision, inValue);
+
+    } else {
+        FormatString::Append(inMessage, inDirective, inValue);
+
+    }
+}
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+Arguments::Arguments(void) :
+    mData(),
+    mPreformatted(false),
+    mTicks(0),
+    mClock(NULL),
+    mProcess(0),
+    mThread()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Arguments::~Arguments(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Capture the arguments to the specified printf-style format
+ *    string, replacing any previously captured.
+ *
+ *  @param[in]  inFormat  A printf-style format string composed of
+ *                        zero or more output conversion directives.
+ *  @param[in]  inList    A variable argument list, where each
+ *                        argument corresponds with its peer output
+ *                        conversion directive in @a inFormat.
+ *
+ */
+void
+Arguments::Capture(const char * inFormat, std::va_list inList)
+{
+    const int theError = errno;
+    bool      theCaptured;
+
+    Begin();
+
+    if (inFormat == NULL) {
+        return;
+    }
+
+    {
+        ListSource theSource(inList);
+
+        theCaptured = CaptureDirectives(inFormat, theSource, theError);
+    }
+
+    // Fall back to rendering now what cannot be rendered later.
+
+    if (!theCaptured) {
+        mData.clear();
+
+        mPreformatted = true;
+
+        errno = theError;
+
+        FormatString::Append(mData, inFormat, inList);
+    }
+}
+
+/**
+ *  @brief
+ *    Capture the typed arguments to the specified printf-style
+ *    format string, replacing any previously captured.
+ *
+ *  @param[in]  inFormat  A printf-style format string composed of
+ *                        zero or more output conversion directives.
+ *  @param[in]  inValues  The typed arguments, each corresponding
+ *                        with its peer output conversion directive
+ *                        in @a inFormat.
+ *
+ */
+void
+Arguments::Capture(const char * inFormat, const Values & inValues)
+{
+    ValuesSource theSource(inValues);
+
+    Begin();
+
+    // A literal format has nothing to capture and renders as is.
+
+    if ((inFormat == NULL) || inValues.IsLiteral()) {
+        return;
+    }
+
+    // Fall back to rendering now what cannot be rendered later,
+    // including directives that do not match their arguments.
+
+    if (!CaptureDirectives(inFormat, theSource, inValues.GetError())) {
+        mData.clear();
+
+        mPreformatted = true;
+
+        inValues.Render(mData, inFormat);
+    }
+}
+
+void
+Arguments::Begin(void)
+{
+    mData.clear();
+
+    mPreformatted = false;
+    mClock        = &Clock::GetDefault();
+    mTicks        = mClock->Now();
+    mProcess      = getpid();
+    mThread       = pthread_self();
+}
+
+template <typename Source>
+bool
+Arguments::CaptureDirectives(const char * inFormat, Source & inSource, int inError)
+{
+    const char * theCursor = inFormat;
+    Directive    theDirective;
+    int          thePrecision;
+    bool         theCaptured = true;
+
+    while (theCaptured && ((theCursor = strchr(theCursor, '%')) != NULL)) {
+        if (!ParseCapturable(theCursor, theDirective)) {
+            return (false);
+        }
+
+        theCursor += theDirective.mSize;
+
+        thePrecision = theDirective.mPrecision;
+
+        if (theDirective.mWidthStar) {
+            theCaptured = PutNext<int>(mData, inSource);
+        }
+
+        if (theCaptured && theDirective.mPrecisionStar) {
+            theCaptured = inSource.Take(thePrecision);
+
+            Put(mData, thePrecision);
+        }
+
+        if (!theCaptured) {
+            break;
+        }
+
+        switch (theDirective.mKind) {
+
+        case Kind::kInvalid:
+        case Kind::kPercent:
+            break;
+
+        case Kind::kInt:
+            theCaptured = PutNext<int>(mData, inSource);
+            break;
+
+        case Kind::kLong:
+            theCaptured = PutNext<long>(mData, inSource);
+            break;
+
+        case Kind::kLongLong:
+            theCaptured = PutNext<long long>(mData, inSource);
+            break;
+
+        case Kind::kIntMax:
+            theCaptured = PutNext<intmax_t>(mData, inSource);
+            break;
+
+        case Kind::kSize:
+            theCaptured = PutNext<size_t>(mData, inSource);
+            break;
+
+        case Kind::kPtrDiff:
+            theCaptured = PutNext<ptrdiff_t>(mData, inSource);
+            break;
+
+        case Kind::kDouble:
+            theCaptured = PutNext<double>(mData, inSource);
+            break;
+
+        case Kind::kLongDouble:
+            theCaptured = PutNext<long double>(mData, inSource);
+            break;
+
+        case Kind::kPointer:
+            theCaptured = PutNext<void *>(mData, inSource);
+            break;
+
+        case Kind::kWideInt:
+            theCaptured = PutNext<wint_t>(mData, inSource);
+            break;
+
+        case Kind::kString:
+            {
+                const char * theString;
+
+                theCaptured = inSource.Take(theString);
+
+                if (theCaptured) {
+                    PutString(mData, theString, thePrecision);
+                }
+            }
+            break;
+
+        case Kind::kWideString:
+            {
+                const wchar_t * theString;
+
+                theCaptured = inSource.Take(theString);
+
+                if (theCaptured) {
+                    PutWideString(mData, theString, thePrecision);
+                }
+            }
+            break;
+
+        case Kind::kCount:
+            {
+                void * thePointer;
+
+                theCaptured = inSource.Take(thePointer);
+            }
+            break;
+
+        case Kind::kError:
+            {
+                char theBuffer[128];
+
+                PutString(mData,
+                          ErrorString(strerror_r(inError, theBuffer, sizeof (theBuffer)), theBuffer),
+                          thePrecision);
+            }
+            break;
+
+        }
+    }
+
+    return (theCaptured);
+}
+
+/**
+ *  @brief
+ *    Perform output format conversion of the specified printf-style
+ *    format string against the captured arguments, appending the
+ *    result to the provided message.
+ *
+ *  @param[in,out]  inMessage  A reference to the message to append
+ *                             the formatted output to.
+ *  @param[in]      inFormat   The same format string the arguments
+ *                             were captured with.
+ *
+ */
+void
+Arguments::Render(std::string & inMessage, const char * inFormat) const
+{
+    const char * theCursor = inFormat;
+    const char * theStart;
+    size_t       theOffset = 0;
+    Directive    theDirective;
+    char         theText[kDirectiveMax];
+    int          theWidth;
+    int          thePrecision;
+
+    if (mPreformatted) {
+        inMessage.append(mData);
+        return;
+    }
+
+    if (inFormat == NULL) {
+        return;
+    }
+
+    while ((theStart = strchr(theCursor, '%')) != NULL) {
+        inMessage.append(theCursor, static_cast<size_t>(theStart - theCursor));
+
+        if (!ParseCapturable(theStart, theDirective)) {
+            theCursor = theStart;
+            break;
+        }
+
+        theCursor = theStart + theDirective.mSize;
+
+        memcpy(theText, theStart, theDirective.mSize);
+        theText[theDirective.mSize] = '\0';
+
+        theWidth     = (theDirective.mWidthStar     ? Get<int>(mData, theOffset) : 0);
+        thePrecision = (theDirective.mPrecisionStar ? Get<int>(mData, theOffset) : 0);
+
+        switch (theDirective.mKind) {
+
+        case Kind::kPercent:
+            inMessage.push_back('%');
+            break;
+
+        case Kind::kInt:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<int>(mData, theOffset));
+            break;
+
+        case Kind::kLong:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<long>(mData, theOffset));
+            break;
+
+        case Kind::kLongLong:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<long long>(mData, theOffset));
+            break;
+
+        case Kind::kIntMax:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<intmax_t>(mData, theOffset));
+            break;
+
+        case Kind::kSize:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<size_t>(mData, theOffset));
+            break;
+
+        case Kind::kPtrDiff:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<ptrdiff_t>(mData, theOffset));
+            break;
+
+        case Kind::kDouble:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<double>(mData, theOffset));
+            break;
+
+        case Kind::kLongDouble:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<long double>(mData, theOffset));
+            break;
+
+        case Kind::kPointer:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<void *>(mData, theOffset));
+            break;
+
+        case Kind::kWideInt:
+            AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, Get<wint_t>(mData, theOffset));
+            break;
+
+        case Kind::kInvalid:
+        case Kind::kCount:
+            break;
+
+        case Kind::kError:
+        case Kind::kString:
+            {
+                const size_t theLength = Get<size_t>(mData, theOffset);
+                const char * theString = NULL;
+
+                if (theLength != kNullString) {
+                    theString  = mData.data() + theOffset;
+                    theOffset += theLength + 1;
+                }
+
+                // The error description was resolved at capture time,
+                // so render it as the string it now is.
+
+                theText[theDirective.mSize - 1] = 's';
+
+                AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, theString);
+            }
+            break;
+
+        case Kind::kWideString:
+            {
+                const size_t theLength = Get<size_t>(mData, theOffset);
+
+                if (theLength == kNullString) {
+                    AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, static_cast<const wchar_t *>(NULL));
+
+                } else {
+                    // Copy the string back out to suitably-aligned
+                    // storage.
+
+                    std::wstring theString(theLength, L'\0');
+
+                    memcpy(&theString[0], mData.data() + theOffset, theLength * sizeof (wchar_t));
+                    theOffset += theLength * sizeof (wchar_t);
+
+                    AppendValue(inMessage, theText, theDirective, theWidth, thePrecision, theString.c_str());
+
+                }
+            }
+            break;
+
+        }
+    }
+
+    inMessage.append(theCursor);
+}
+
+/**
+ *  @brief
+ *    Restore previously-captured arguments, replacing any captured.
+ *
+ *  This is the inverse of capturing arguments and then retrieving
+ *  them with GetData, IsPreformatted, GetTimestamp, GetProcess, and
+ *  GetThread, typically after the arguments have been persisted.
+ *  Since the data may have come from anywhere, it is checked against
+ *  the format string before it is accepted.
+ *
+ *  @param[in]  inFormat        The same format string the arguments
+ *                              were captured with.
+ *  @param[in]  inData          A pointer to the captured arguments.
+ *  @param[in]  inSize          The size, in bytes, of @a inData.
+ *  @param[in]  inPreformatted  Whether @a inData holds the rendered
+ *                              message rather than the captured
+ *                              arguments.
+ *  @param[in]  inTime          The wall-clock time of the capture.
+ *  @param[in]  inProcess       The process that captured the
+ *                              arguments.
+ *  @param[in]  inThread        The thread that captured the
+ *                              arguments.
+ *
+ *  @returns
+ *    True if the data is consistent with @a inFormat; otherwise,
+ *    false, in which case nothing has been captured.
+ *
+ */
+bool
+Arguments::Restore(const char *            inFormat,
+                   const void *            inData,
+                   size_t                  inSize,
+                   bool                    inPreformatted,
+                   const struct timespec & inTime,
+                   pid_t                   inProcess,
+                   pthread_t               inThread)
+{
+    mData.assign(static_cast<const char *>(inData), inSize);
+
+    mPreformatted = inPreformatted;
+    mTicks        = (static_cast<Clock::Ticks>(inTime.tv_sec) * kNanosecondsPerSecond) + inTime.tv_nsec;
+    mClock        = NULL;
+    mProcess      = inProcess;
+    mThread       = inThread;
+
+    if (!Validate(inFormat)) {
+        mData.clear();
+
+        mPreformatted = false;
+
+        return (false);
+    }
+
+    return (true);
+}
+
+// Walk the format string as Render would, checking that the captured
+// data holds exactly the arguments it will consume.
+
+bool
+Arguments::Validate(const char * inFormat) const
+{
+    const char * theCursor = inFormat;
+    size_t       theOffset = 0;
+    size_t       theSize;
+    Directive    theDirective;
+
+    if (mPreformatted) {
+        return (true);
+    }
+
+    if (inFormat == NULL) {
+        return (mData.empty());
+    }
+
+    while ((theCursor = strchr(theCursor, '%')) != NULL) {
+        if (!ParseCapturable(theCursor, theDirective)) {
+            break;
+        }
+
+        theCursor += theDirective.mSize;
+
+        theSize = ((theDirective.mWidthStar     ? sizeof (int) : 0) +
+                   (theDirective.mPrecisionStar ? sizeof (int) : 0));
+
+        switch (theDirective.mKind) {
+
+        case Kind::kInvalid:
+        case Kind::kPercent:
+        case Kind::kCount:
+            break;
+
+        case Kind::kInt:
+            theSize += sizeof (int);
+            break;
+
+        case Kind::kLong:
+            theSize += sizeof (long);
+            break;
+
+        case Kind::kLongLong:
+            theSize += sizeof (long long);
+            break;
+
+        case Kind::kIntMax:
+            theSize += sizeof (intmax_t);
+            break;
+
+        case Kind::kSize:
+            theSize += sizeof (size_t);
+            break;
+
+        case Kind::kPtrDiff:
+            theSize += sizeof (ptrdiff_t);
+            break;
+
+        case Kind::kDouble:
+            theSize += sizeof (double);
+            break;
+
+        case Kind::kLongDouble:
+            theSize += sizeof (long double);
+            break;
+
+        case Kind::kPointer:
+            theSize += sizeof (void *);
+            break;
+
+        case Kind::kWideInt:
+            theSize += sizeof (wint_t);
+            break;
+
+        case Kind::kError:
+        case Kind::kString:
+        case Kind::kWideString:
+            theSize += sizeof (size_t);
+            break;
+
+        }
+
+        if ((mData.size() - theOffset) < theSize) {
+            return (false);
+        }
+
+        theOffset += theSize;
+
+        // Strings are followed by their contents, if not null.
+
+        if ((theDirective.mKind == Kind::kError)  ||
+            (theDirective.mKind == Kind::kString) ||
+            (theDirective.mKind == Kind::kWideString)) {
+            size_t       theLengthOffset = theOffset - sizeof (size_t);
+            const size_t theLength       = Get<size_t>(mData, theLengthOffset);
+
+            if (theLength == kNullString) {
+                continue;
+            }
+
+            if (theDirective.mKind == Kind::kWideString) {
+                if (theLength > ((mData.size() - theOffset) / sizeof (wchar_t))) {
+                    return (false);
+                }
+
+                theOffset += theLength * sizeof (wchar_t);
+
+            } else {
+                if ((theLength >= (mData.size() - theOffset)) ||
+                    (mData[theOffset + theLength] != '\0')) {
+                    return (false);
+                }
+
+                theOffset += theLength + 1;
+
+            }
+        }
+    }
+
+    return (theOffset == mData.size());
+}
+
+/**
+ *  @brief
+ *    Return the captured arguments or, if preformatted, the rendered
+ *    message.
+ *
+ */
+const std::string &
+Arguments::GetData(void) const
+{
+    return (mData);
+}
+
+/**
+ *  @brief
+ *    Return whether the format string could not be captured
+ *    argument-by-argument and was, instead, rendered at capture
+ *    time.
+ *
+ */
+bool
+Arguments::IsPreformatted(void) const
+{
+    return (mPreformatted);
+}
+
+/**
+ *  @brief
+ *    Return the time, in seconds since the Epoch, at which the
+ *    arguments were captured.
+ *
+ */
+time_t
+Arguments::GetTime(void) const
+{
+    struct timespec theTime;
+
+    GetTimestamp(theTime);
+
+    return (theTime.tv_sec);
+}
+
+/**
+ *  @brief
+ *    Return the wall-clock time at which the arguments were
+ *    captured.
+ *
+ *  Where the arguments were captured against a clock whose readings
+ *  are not wall-clock time, the reading is converted here.
+ *
+ *  @param[out]  outTime  A reference to storage for the time, in
+ *                        seconds and nanoseconds since the Epoch.
+ *
+ */
+void
+Arguments::GetTimestamp(struct timespec & outTime) const
+{
+    if (mClock != NULL) {
+        mClock->Convert(mTicks, outTime);
+
+    } else {
+        outTime.tv_sec  = static_cast<time_t>(mTicks / kNanosecondsPerSecond);
+        outTime.tv_nsec = static_cast<long>(mTicks % kNanosecondsPerSecond);
+
+    }
+}
+
+/**
+ *  @brief
+ *    Return the identifier of the process that captured the
+ *    arguments.
+ *
+ */
+pid_t
+Arguments::GetProcess(void) const
+{
+    return (mProcess);
+}
+
+/**
+ *  @brief
+ *    Return the identifier of the thread that captured the
+ *    arguments.
+ *
+ */
+pthread_t
+Arguments::GetThread(void) const
+{
+    return (mThread);
+}
+
+}; // namespace Log
+
+}; // namespace Nuovations
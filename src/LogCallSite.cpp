@@ -0,0 +1,270 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities object for a
+ *      registered log statement call site that may be enabled and
+ *      disabled at runtime.
+ */
+
+#include <LogUtilities/LogCallSite.hpp>
+
+#include <mutex>
+#include <string>
+
+#include <fnmatch.h>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+// A setting recorded for call sites, whether registered at the time
+// or later, matching its file and function patterns. A null pattern
+// matches anything.
+
+struct CallSiteRule
+{
+    bool        mHasFile;
+    std::string mFile;
+    bool        mHasFunction;
+    std::string mFunction;
+    bool        mEnabled;
+};
+
+// The registered call sites, the rules recorded against them, and the
+// lock guarding both. The lock and the list head are
+// constant-initialized, such that call sites may register during
+// static initialization; the rules are allocated on first use.
+
+static std::mutex                  sCallSitesMutex;
+static CallSite *                  sCallSites = nullptr;
+static std::vector<CallSiteRule> * sCallSiteRules = nullptr;
+
+static bool
+Matches(const char * inPattern, const char * inString)
+{
+    return ((inPattern == nullptr) ||
+            (fnmatch(inPattern, (inString != nullptr) ? inString : "", 0) == 0));
+}
+
+thread_local const CallSite * CallSite::sCurrent = nullptr;
+
+static const char *
+Pattern(bool inHas, const std::string & inPattern)
+{
+    return (inHas ? inPattern.c_str() : nullptr);
+}
+
+/**
+ *  @brief
+ *    Enable or disable the call site.
+ *
+ *  This does not record a rule; it affects only this call site.
+ *
+ *  @param[in]  inEnabled  Whether the call site is to be enabled.
+ *
+ */
+void
+CallSite::SetEnabled(bool inEnabled)
+{
+    std::lock_guard<std::mutex> theLock(sCallSitesMutex);
+
+    if (mState.load(std::memory_order_relaxed) == kUnregistered) {
+        mNext      = sCallSites;
+        sCallSites = this;
+    }
+
+    mState.store(inEnabled ? kEnabled : kDisabled, std::memory_order_relaxed);
+}
+
+/**
+ *  @brief
+ *    Find the registered call sites matching the specified file and
+ *    function patterns.
+ *
+ *  @param[in]   inFilePattern      A shell glob pattern matched
+ *                                  against the source file of each
+ *                                  call site or null to match any.
+ *  @param[in]   inFunctionPattern  A shell glob pattern matched
+ *                                  against the enclosing function of
+ *                                  each call site or null to match
+ *                                  any.
+ *  @param[out]  outCallSites       The matching call sites, which are
+ *                                  appended.
+ *
+ *  @returns
+ *    The number of matching call sites.
+ *
+ */
+size_t
+CallSite::Find(const char *                    inFilePattern,
+               const char *                    inFunctionPattern,
+               std::vector<const CallSite *> & outCallSites)
+{
+    std::lock_guard<std::mutex> theLock(sCallSitesMutex);
+    size_t                      theMatches = 0;
+
+    for (CallSite * theSite = sCallSites; theSite != nullptr; theSite = theSite->mNext) {
+        if (theSite->Matches(inFilePattern, inFunctionPattern)) {
+            outCallSites.push_back(theSite);
+            theMatches++;
+        }
+    }
+
+    return (theMatches);
+}
+
+/**
+ *  @brief
+ *    Enable or disable every call site matching the specified file
+ *    and function patterns.
+ *
+ *  The setting is recorded as a rule, such that call sites
+ *  registered later that match the patterns take it, too. Rules with
+ *  the same patterns replace one another and a rule matching
+ *  anything replaces every rule before it.
+ *
+ *  @param[in]  inFilePattern      A shell glob pattern matched
+ *                                 against the source file of each
+ *                                 call site or null to match any.
+ *  @param[in]  inFunctionPattern  A shell glob pattern matched
+ *                                 against the enclosing function of
+ *                                 each call site or null to match
+ *                                 any.
+ *  @param[in]  inEnabled          Whether matching call sites are to
+ *                                 be enabled.
+ *
+ *  @returns
+ *    The number of registered call sites matched.
+ *
+ */
+size_t
+CallSite::SetEnabled(const char * inFilePattern,
+                     const char * inFunctionPattern,
+                     bool         inEnabled)
+{
+    std::lock_guard<std::mutex> theLock(sCallSitesMutex);
+    const CallSiteRule          theRule = {
+        (inFilePattern != nullptr),     (inFilePattern != nullptr) ? inFilePattern : "",
+        (inFunctionPattern != nullptr), (inFunctionPattern != nullptr) ? inFunctionPattern : "",
+        inEnabled
+    };
+    size_t                      theMatches = 0;
+
+    if (sCallSiteRules == nullptr) {
+        sCallSiteRules = new std::vector<CallSiteRule>();
+    }
+
+    if (!theRule.mHasFile && !theRule.mHasFunction) {
+        sCallSiteRules->clear();
+    }
+
+    for (std::vector<CallSiteRule>::iterator current = sCallSiteRules->begin();
+         current != sCallSiteRules->end();
+         ++current) {
+        if ((current->mHasFile == theRule.mHasFile) &&
+            (current->mFile == theRule.mFile) &&
+            (current->mHasFunction == theRule.mHasFunction) &&
+            (current->mFunction == theRule.mFunction)) {
+            sCallSiteRules->erase(current);
+            break;
+        }
+    }
+
+    sCallSiteRules->push_back(theRule);
+
+    for (CallSite * theSite = sCallSites; theSite != nullptr; theSite = theSite->mNext) {
+        if (theSite->Matches(inFilePattern, inFunctionPattern)) {
+            theSite->mState.store(inEnabled ? kEnabled : kDisabled, std::memory_order_relaxed);
+            theMatches++;
+        }
+    }
+
+    return (theMatches);
+}
+
+/**
+ *  @brief
+ *    Discard every recorded rule and enable every registered call
+ *    site.
+ *
+ */
+void
+CallSite::Reset(void)
+{
+    std::lock_guard<std::mutex> theLock(sCallSitesMutex);
+
+    if (sCallSiteRules != nullptr) {
+        sCallSiteRules->clear();
+    }
+
+    for (CallSite * theSite = sCallSites; theSite != nullptr; theSite = theSite->mNext) {
+        theSite->mState.store(kEnabled, std::memory_order_relaxed);
+    }
+}
+
+// Register the call site, the first time it is tested, applying the
+// last rule it matches, if any.
+
+bool
+CallSite::Register(void)
+{
+    std::lock_guard<std::mutex> theLock(sCallSitesMutex);
+    uint8_t                     theState = mState.load(std::memory_order_relaxed);
+
+    // Another thread may have registered the call site while this one
+    // waited for the lock.
+
+    if (theState == kUnregistered) {
+        theState = kEnabled;
+
+        if (sCallSiteRules != nullptr) {
+            for (std::vector<CallSiteRule>::const_iterator current = sCallSiteRules->begin();
+                 current != sCallSiteRules->end();
+                 ++current) {
+                if (Matches(Pattern(current->mHasFile, current->mFile),
+                            Pattern(current->mHasFunction, current->mFunction))) {
+                    theState = current->mEnabled ? kEnabled : kDisabled;
+                }
+            }
+        }
+
+        mNext      = sCallSites;
+        sCallSites = this;
+
+        mState.store(theState, std::memory_order_relaxed);
+    }
+
+    return (theState == kEnabled);
+}
+
+// Test whether the call site matches the specified file and function
+// patterns.
+
+bool
+CallSite::Matches(const char * inFilePattern, const char * inFunctionPattern) const
+{
+    return (Log::Matches(inFilePattern, mFile) &&
+            Log::Matches(inFunctionPattern, mFunction));
+}
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -0,0 +1,114 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities abstract clock
+ *      object and the default clock.
+ */
+
+#include <atomic>
+
+using namespace std;
+
+#include <LogUtilities/LogClockBase.hpp>
+#include <LogUtilities/LogClockRealtime.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Clock
+{
+
+/**
+ *  The clock set as the default, if any.
+ */
+static std::atomic<Base *> sDefault(nullptr);
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+Base::Base(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Base::~Base(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This routine returns the default clock.
+ *
+ *  The default clock is the one message arguments are stamped with
+ *  when captured for later formatting (see Log::Arguments) and the
+ *  one formatters use when no other is specified. Unless set
+ *  otherwise, it is a Clock::Realtime instance.
+ *
+ *  @returns
+ *    A reference to the default clock.
+ *
+ *  @sa SetDefault
+ *
+ */
+Base &
+GetDefault(void)
+{
+    static Realtime sRealtime;
+    Base *          theClock = sDefault.load(std::memory_order_acquire);
+
+    return ((theClock != nullptr) ? *theClock : sRealtime);
+}
+
+/**
+ *  @brief
+ *    This routine sets the default clock.
+ *
+ *  @note
+ *    The specified clock must remain in scope for as long as it, or
+ *    any reading taken by it, may be used. Typically, it is set once,
+ *    at startup, to a clock of static storage duration.
+ *
+ *  @param[in]  inClock  A reference to the clock to set as the
+ *                       default.
+ *
+ *  @sa GetDefault
+ *
+ */
+void
+SetDefault(Base & inClock)
+{
+    sDefault.store(&inClock, std::memory_order_release);
+}
+
+}; // namespace Clock
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -0,0 +1,125 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete clock
+ *      object for the system monotonic clock.
+ */
+
+#include <ctime>
+
+using namespace std;
+
+#include <LogUtilities/LogClockMonotonic.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Clock
+{
+
+static const Ticks kNanosecondsPerSecond = 1000000000;
+
+static inline Ticks
+Read(clockid_t inClock)
+{
+    struct timespec theTime;
+
+    clock_gettime(inClock, &theTime);
+
+    return ((static_cast<Ticks>(theTime.tv_sec) * kNanosecondsPerSecond) + theTime.tv_nsec);
+}
+
+// Return the offset of the real-time clock from the monotonic clock,
+// bracketing the real-time clock reading with monotonic ones and
+// taking the midpoint.
+
+static Ticks
+Offset(void)
+{
+    const Ticks theBefore   = Read(CLOCK_MONOTONIC);
+    const Ticks theRealtime = Read(CLOCK_REALTIME);
+    const Ticks theAfter    = Read(CLOCK_MONOTONIC);
+
+    return (theRealtime - (theBefore + ((theAfter - theBefore) / 2)));
+}
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ *    This constructor instantiates the clock, sampling the offset of
+ *    the system real-time clock from the monotonic clock.
+ *
+ */
+Monotonic::Monotonic(void) :
+    Base(),
+    mOffset(Offset())
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Monotonic::~Monotonic(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Return the current clock reading, in nanoseconds since an
+ *    arbitrary, fixed point in the past.
+ *
+ */
+Ticks
+Monotonic::Now(void) const
+{
+    return (Read(CLOCK_MONOTONIC));
+}
+
+/**
+ *  @brief
+ *    Convert a reading taken by this clock to wall-clock time.
+ *
+ *  @param[in]   inTicks  The reading to convert.
+ *  @param[out]  outTime  A reference to storage for the wall-clock
+ *                        time, in seconds and nanoseconds since the
+ *                        Epoch.
+ *
+ */
+void
+Monotonic::Convert(Ticks inTicks, struct timespec & outTime) const
+{
+    const Ticks theTime = inTicks + mOffset;
+
+    outTime.tv_sec  = static_cast<time_t>(theTime / kNanosecondsPerSecond);
+    outTime.tv_nsec = static_cast<long>(theTime % kNanosecondsPerSecond);
+}
+
+}; // namespace Clock
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -0,0 +1,117 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete clock
+ *      object for the system real-time clock.
+ */
+
+#include <ctime>
+
+using namespace std;
+
+#include <LogUtilities/LogClockRealtime.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Clock
+{
+
+static const Ticks kNanosecondsPerSecond = 1000000000;
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+Realtime::Realtime(void) :
+    Base(),
+    mClock(CLOCK_REALTIME)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the clock for the specified
+ *    POSIX clock, which must measure time since the Epoch.
+ *
+ *  @param[in]  inClock  The POSIX clock to read.
+ *
+ */
+Realtime::Realtime(clockid_t inClock) :
+    Base(),
+    mClock(inClock)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Realtime::~Realtime(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Return the current clock reading, in nanoseconds since the
+ *    Epoch.
+ *
+ */
+Ticks
+Realtime::Now(void) const
+{
+    struct timespec theTime;
+
+    clock_gettime(mClock, &theTime);
+
+    return ((static_cast<Ticks>(theTime.tv_sec) * kNanosecondsPerSecond) + theTime.tv_nsec);
+}
+
+/**
+ *  @brief
+ *    Convert a reading taken by this clock to wall-clock time.
+ *
+ *  @param[in]   inTicks  The reading to convert.
+ *  @param[out]  outTime  A reference to storage for the wall-clock
+ *                        time, in seconds and nanoseconds since the
+ *                        Epoch.
+ *
+ */
+void
+Realtime::Convert(Ticks inTicks, struct timespec & outTime) const
+{
+    outTime.tv_sec  = static_cast<time_t>(inTicks / kNanosecondsPerSecond);
+    outTime.tv_nsec = static_cast<long>(inTicks % kNanosecondsPerSecond);
+}
+
+}; // namespace Clock
+
+}; // namespace Log
+
+}; // namespace Nuovations
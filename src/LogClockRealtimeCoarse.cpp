@@ -0,0 +1,72 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete clock
+ *      object for the coarse system real-time clock.
+ */
+
+#include <ctime>
+
+using namespace std;
+
+#include <LogUtilities/LogClockRealtimeCoarse.hpp>
+
+// Preprocessor Definitions
+
+#if defined(CLOCK_REALTIME_COARSE)
+#define kRealtimeCoarse CLOCK_REALTIME_COARSE
+#else
+#define kRealtimeCoarse CLOCK_REALTIME
+#endif // defined(CLOCK_REALTIME_COARSE)
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Clock
+{
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+RealtimeCoarse::RealtimeCoarse(void) :
+    Realtime(kRealtimeCoarse)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+RealtimeCoarse::~RealtimeCoarse(void)
+{
+    return;
+}
+
+}; // namespace Clock
+
+}; // namespace Log
+
+}; // namespace Nuovations
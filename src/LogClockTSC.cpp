@@ -0,0 +1,269 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete clock
+ *      object for the processor time stamp counter.
+ */
+
+#include <chrono>
+#include <ctime>
+#include <thread>
+
+using namespace std;
+
+#include <LogUtilities/LogClockTSC.hpp>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+
+#define LOGUTILITIES_HAVE_TSC 1
+#endif // defined(__x86_64__) || defined(__i386__)
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Clock
+{
+
+const unsigned int TSC::kCalibrationDefault;
+
+static const Ticks kNanosecondsPerSecond = 1000000000;
+
+static inline Ticks
+Read(clockid_t inClock)
+{
+    struct timespec theTime;
+
+    clock_gettime(inClock, &theTime);
+
+    return ((static_cast<Ticks>(theTime.tv_sec) * kNanosecondsPerSecond) + theTime.tv_nsec);
+}
+
+// Return whether the processor advertises an invariant time stamp
+// counter.
+
+static bool
+IsInvariant(void)
+{
+#if LOGUTILITIES_HAVE_TSC
+    static const unsigned int kInvariantLeaf = 0x80000007;
+    static const unsigned int kInvariantBit  = (1U << 8);
+    unsigned int              theA, theB, theC, theD;
+
+    if ((__get_cpuid(0x80000000, &theA, &theB, &theC, &theD) == 0) || (theA < kInvariantLeaf)) {
+        return (false);
+    }
+
+    __get_cpuid(kInvariantLeaf, &theA, &theB, &theC, &theD);
+
+    return ((theD & kInvariantBit) != 0);
+#else
+    return (false);
+#endif // LOGUTILITIES_HAVE_TSC
+}
+
+static inline Ticks
+ReadCounter(void)
+{
+#if LOGUTILITIES_HAVE_TSC
+    return (static_cast<Ticks>(__rdtsc()));
+#else
+    return (Read(CLOCK_MONOTONIC));
+#endif // LOGUTILITIES_HAVE_TSC
+}
+
+// Take a counter reading and a reading of the specified clock at
+// the same instant, bracketing the latter with counter readings and
+// taking their midpoint.
+
+static void
+Sample(clockid_t inClock, Ticks & outTicks, Ticks & outTime)
+{
+    const Ticks theBefore = ReadCounter();
+
+    outTime = Read(inClock);
+
+    outTicks = theBefore + ((ReadCounter() - theBefore) / 2);
+}
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ *    This constructor instantiates the clock, calibrating the
+ *    counter, if available, for the default period.
+ *
+ */
+TSC::TSC(void) :
+    Base(),
+    mAvailable(false),
+    mTicks(0),
+    mTime(0),
+    mScale(1.0)
+{
+    Calibrate(kCalibrationDefault);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the clock, calibrating the
+ *    counter, if available, for the specified period. Longer periods
+ *    yield more accurate conversion to wall-clock time.
+ *
+ *  @param[in]  inCalibrationMilliseconds  The period, in
+ *                                         milliseconds, to calibrate
+ *                                         the counter frequency over.
+ *
+ */
+TSC::TSC(unsigned int inCalibrationMilliseconds) :
+    Base(),
+    mAvailable(false),
+    mTicks(0),
+    mTime(0),
+    mScale(1.0)
+{
+    Calibrate(inCalibrationMilliseconds);
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+TSC::~TSC(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Return the current clock reading, in counter ticks or, if the
+ *    counter is unavailable, monotonic clock nanoseconds.
+ *
+ */
+Ticks
+TSC::Now(void) const
+{
+#if LOGUTILITIES_HAVE_TSC
+    if (mAvailable) {
+        return (static_cast<Ticks>(__rdtsc()));
+    }
+#endif // LOGUTILITIES_HAVE_TSC
+
+    return (Read(CLOCK_MONOTONIC));
+}
+
+/**
+ *  @brief
+ *    Convert a reading taken by this clock to wall-clock time.
+ *
+ *  @param[in]   inTicks  The reading to convert.
+ *  @param[out]  outTime  A reference to storage for the wall-clock
+ *                        time, in seconds and nanoseconds since the
+ *                        Epoch.
+ *
+ */
+void
+TSC::Convert(Ticks inTicks, struct timespec & outTime) const
+{
+    const Ticks theTime = mTime + static_cast<Ticks>(static_cast<double>(inTicks - mTicks) * mScale);
+
+    outTime.tv_sec  = static_cast<time_t>(theTime / kNanosecondsPerSecond);
+    outTime.tv_nsec = static_cast<long>(theTime % kNanosecondsPerSecond);
+}
+
+/**
+ *  @brief
+ *    Return whether the counter is available and invariant and, so,
+ *    is read by the clock.
+ *
+ */
+bool
+TSC::IsAvailable(void) const
+{
+    return (mAvailable);
+}
+
+/**
+ *  @brief
+ *    Return the calibrated frequency, in ticks per second, of the
+ *    readings taken by the clock.
+ *
+ */
+double
+TSC::GetFrequency(void) const
+{
+    return (1.0e9 / mScale);
+}
+
+void
+TSC::Calibrate(unsigned int inCalibrationMilliseconds)
+{
+    Ticks theStartTicks;
+    Ticks theStartTime;
+    Ticks theEndTicks;
+    Ticks theEndTime;
+
+    mAvailable = IsInvariant();
+
+    if (mAvailable) {
+        // Measure the counter frequency against the monotonic clock,
+        // which is not subject to steps in the real-time clock.
+
+        Sample(CLOCK_MONOTONIC, theStartTicks, theStartTime);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(inCalibrationMilliseconds));
+
+        Sample(CLOCK_MONOTONIC, theEndTicks, theEndTime);
+
+        mAvailable = ((theEndTicks > theStartTicks) && (theEndTime > theStartTime));
+    }
+
+    if (mAvailable) {
+        mScale = (static_cast<double>(theEndTime - theStartTime) /
+                  static_cast<double>(theEndTicks - theStartTicks));
+
+        // Anchor the counter to the real-time clock.
+
+        Sample(CLOCK_REALTIME, mTicks, mTime);
+
+    } else {
+        // Fall back to monotonic clock nanoseconds, anchored to the
+        // real-time clock.
+
+        const Ticks theBefore = Read(CLOCK_MONOTONIC);
+
+        mTime  = Read(CLOCK_REALTIME);
+        mTicks = theBefore + ((Read(CLOCK_MONOTONIC) - theBefore) / 2);
+        mScale = 1.0;
+
+    }
+}
+
+}; // namespace Clock
+
+}; // namespace Log
+
+}; // namespace Nuovations
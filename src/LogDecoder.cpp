@@ -0,0 +1,392 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities object for
+ *      decoding the binary records written by
+ *      Log::Recorder::Binary back into text.
+ */
+
+#include <cstring>
+#include <cwchar>
+#include <string>
+
+using namespace std;
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogDecoder.hpp>
+#include <LogUtilities/LogFormatterBase.hpp>
+#include <LogUtilities/LogIndenterBase.hpp>
+#include <LogUtilities/LogRecorderBinary.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace
+{
+
+/**
+ *  The size of the record size field preceding each record.
+ *
+ *  @private
+ */
+static const size_t kSizeSize    = sizeof (uint32_t);
+
+/**
+ *  The size of the fixed portion of a message payload: its format
+ *  identifier, level, indent, time, process, thread, and whether its
+ *  arguments are preformatted.
+ *
+ *  @private
+ */
+static const size_t kMessageSize = ((sizeof (uint32_t) * 4) +
+                                    (sizeof (int64_t) * 2) +
+                                    sizeof (pthread_t) +
+                                    sizeof (uint8_t));
+
+/**
+ *  Per-thread storage for the arguments of the message being
+ *  decoded.
+ *
+ *  @private
+ */
+static thread_local Arguments sArguments;
+
+template <typename T>
+static inline T
+Get(const uint8_t * inData, size_t & inOffset)
+{
+    T theValue;
+
+    memcpy(&theValue, inData + inOffset, sizeof (T));
+
+    inOffset += sizeof (T);
+
+    return (theValue);
+}
+
+}; // namespace
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+Decoder::Decoder(void) :
+    mData(NULL),
+    mLoaded(0),
+    mSessions(),
+    mMessages()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Decoder::~Decoder(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Index the messages in the specified records, replacing any
+ *    previously loaded.
+ *
+ *  Loading stops at the first record that is truncated, malformed,
+ *  or was written on an incompatible platform. The messages preceding
+ *  it may still be decoded, which allows the intact portion of, for
+ *  example, a log whose writer was interrupted to be recovered.
+ *
+ *  @note
+ *    The records must remain valid, and unchanged, for as long as
+ *    messages are decoded from them.
+ *
+ *  @param[in]  inData  A pointer to the records.
+ *  @param[in]  inSize  The size, in bytes, of @a inData.
+ *
+ *  @returns
+ *    True if all of the records were loaded; otherwise, false.
+ *
+ *  @sa GetLoaded
+ *
+ */
+bool
+Decoder::Load(const void * inData, size_t inSize)
+{
+    size_t theOffset = 0;
+    bool   theStatus = true;
+
+    mData   = static_cast<const uint8_t *>(inData);
+    mLoaded = 0;
+
+    mSessions.clear();
+    mMessages.clear();
+
+    while (theStatus && (theOffset < inSize)) {
+        uint32_t theSize;
+        uint8_t  theType;
+
+        if ((inSize - theOffset) <= kSizeSize) {
+            theStatus = false;
+            break;
+        }
+
+        theSize = Get<uint32_t>(mData, theOffset);
+
+        if ((theSize < sizeof (uint8_t)) || (theSize > (inSize - theOffset))) {
+            theStatus = false;
+            break;
+        }
+
+        theType = mData[theOffset];
+
+        switch (static_cast<Recorder::Binary::Type>(theType)) {
+
+        case Recorder::Binary::Type::kHeader:
+            theStatus = LoadHeader(theOffset + 1, theSize - 1);
+            break;
+
+        case Recorder::Binary::Type::kFormat:
+            theStatus = LoadFormat(theOffset + 1, theSize - 1);
+            break;
+
+        case Recorder::Binary::Type::kMessage:
+            theStatus = LoadMessage(theOffset + 1, theSize - 1);
+            break;
+
+        default:
+            // Skip record types from later versions.
+            break;
+
+        }
+
+        if (theStatus) {
+            theOffset += theSize;
+
+            mLoaded = theOffset;
+        }
+    }
+
+    return (theStatus);
+}
+
+/**
+ *  @brief
+ *    Return the size, in bytes, of the leading records loaded.
+ *
+ */
+size_t
+Decoder::GetLoaded(void) const
+{
+    return (mLoaded);
+}
+
+/**
+ *  @brief
+ *    Return the number of messages loaded.
+ *
+ */
+size_t
+Decoder::GetMessages(void) const
+{
+    return (mMessages.size());
+}
+
+/**
+ *  @brief
+ *    Decode the specified message into text.
+ *
+ *  @param[in]   inMessage    The index of the message to decode, in
+ *                            the order recorded.
+ *  @param[in]   inFormatter  A reference to the formatter to format
+ *                            the message with.
+ *  @param[in]   inIndenter   A reference to the indenter to indent
+ *                            the message with.
+ *  @param[out]  outMessage   A reference to the buffer to replace
+ *                            with the decoded message.
+ *
+ *  @returns
+ *    True if the message was decoded; otherwise, false if the index
+ *    is out of range or the message arguments are inconsistent with
+ *    its format string.
+ *
+ */
+bool
+Decoder::Decode(size_t            inMessage,
+                Formatter::Base & inFormatter,
+                Indenter::Base &  inIndenter,
+                std::string &     outMessage) const
+{
+    size_t          theOffset;
+    uint32_t        theIdentifier;
+    Level           theLevel;
+    Indent          theIndent;
+    struct timespec theTime;
+    pid_t           theProcess;
+    pthread_t       theThread;
+    bool            thePreformatted;
+    const char *    theFormat;
+
+    outMessage.clear();
+
+    if (inMessage >= mMessages.size()) {
+        return (false);
+    }
+
+    const Message & theMessage = mMessages[inMessage];
+
+    theOffset       = theMessage.mOffset;
+    theIdentifier   = Get<uint32_t>(mData, theOffset);
+    theLevel        = static_cast<Level>(Get<uint32_t>(mData, theOffset));
+    theIndent       = static_cast<Indent>(Get<uint32_t>(mData, theOffset));
+    theTime.tv_sec  = static_cast<time_t>(Get<int64_t>(mData, theOffset));
+    theTime.tv_nsec = static_cast<long>(Get<uint32_t>(mData, theOffset));
+    theProcess      = static_cast<pid_t>(Get<int64_t>(mData, theOffset));
+    theThread       = Get<pthread_t>(mData, theOffset);
+    thePreformatted = (Get<uint8_t>(mData, theOffset) != 0);
+    theFormat       = mSessions[theMessage.mSession][theIdentifier].c_str();
+
+    if (!sArguments.Restore(theFormat,
+                            mData + theOffset,
+                            theMessage.mSize - kMessageSize,
+                            thePreformatted,
+                            theTime,
+                            theProcess,
+                            theThread)) {
+        return (false);
+    }
+
+    inFormatter.Format(outMessage, theLevel, theFormat, sArguments);
+
+    inIndenter.Indent(theIndent, outMessage);
+
+    return (true);
+}
+
+bool
+Decoder::LoadHeader(size_t inOffset, size_t inSize)
+{
+    static const uint8_t kSizes[] = {
+        sizeof (int),
+        sizeof (long),
+        sizeof (long long),
+        sizeof (intmax_t),
+        sizeof (size_t),
+        sizeof (ptrdiff_t),
+        sizeof (double),
+        sizeof (long double),
+        sizeof (void *),
+        sizeof (wint_t),
+        sizeof (wchar_t),
+        sizeof (pthread_t)
+    };
+    const uint8_t * theData = mData + inOffset;
+    size_t          theOffset = 0;
+
+    if (inSize < (sizeof (Recorder::Binary::kMagic) + sizeof (uint8_t) + sizeof (uint32_t) + sizeof (kSizes))) {
+        return (false);
+    }
+
+    if (memcmp(theData, Recorder::Binary::kMagic, sizeof (Recorder::Binary::kMagic)) != 0) {
+        return (false);
+    }
+
+    theOffset += sizeof (Recorder::Binary::kMagic);
+
+    if (Get<uint8_t>(theData, theOffset) != Recorder::Binary::kVersion) {
+        return (false);
+    }
+
+    // Arguments are recorded in the native byte order and type sizes
+    // and, so, can only be decoded on a like platform.
+
+    if (Get<uint32_t>(theData, theOffset) != Recorder::Binary::kByteOrder) {
+        return (false);
+    }
+
+    if (memcmp(theData + theOffset, kSizes, sizeof (kSizes)) != 0) {
+        return (false);
+    }
+
+    mSessions.push_back(Formats());
+
+    return (true);
+}
+
+bool
+Decoder::LoadFormat(size_t inOffset, size_t inSize)
+{
+    size_t theOffset = inOffset;
+
+    if (mSessions.empty() || (inSize < sizeof (uint32_t))) {
+        return (false);
+    }
+
+    Formats & theFormats = mSessions.back();
+
+    // The recorder assigns identifiers in order.
+
+    if (Get<uint32_t>(mData, theOffset) != theFormats.size()) {
+        return (false);
+    }
+
+    theFormats.push_back(string(reinterpret_cast<const char *>(mData + theOffset),
+                                inSize - sizeof (uint32_t)));
+
+    // A format string cannot itself contain a null character.
+
+    return (strlen(theFormats.back().c_str()) == theFormats.back().size());
+}
+
+bool
+Decoder::LoadMessage(size_t inOffset, size_t inSize)
+{
+    size_t  theOffset = inOffset;
+    Message theMessage;
+
+    if (mSessions.empty() || (inSize < kMessageSize)) {
+        return (false);
+    }
+
+    if (Get<uint32_t>(mData, theOffset) >= mSessions.back().size()) {
+        return (false);
+    }
+
+    theMessage.mOffset  = inOffset;
+    theMessage.mSize    = inSize;
+    theMessage.mSession = static_cast<uint32_t>(mSessions.size() - 1);
+
+    mMessages.push_back(theMessage);
+
+    return (true);
+}
+
+}; // namespace Log
+
+}; // namespace Nuovations
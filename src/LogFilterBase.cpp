@@ -23,6 +23,8 @@
 
 #include <LogUtilities/LogFilterBase.hpp>
 
+#include <LogUtilities/LogFilterGate.hpp>
+
 namespace Nuovations
 {
 
@@ -32,7 +34,11 @@ namespace Log
 namespace Filter
 {
 
-Base::Base(void)
+const uint64_t Base::kLevelLimitNone;
+const uint64_t Base::kLevelLimitAll;
+
+Base::Base(void) :
+    Owned()
 {
     return;
 }
@@ -42,6 +48,161 @@ Base::~Base(void)
     return;
 }
 
+/**
+ *  @brief
+ *    Return the level limit of the filter.
+ *
+ *  Messages at levels below the limit may be passed by the filter;
+ *  those at or above it are always rejected by #Allow, regardless of
+ *  their content. This allows a logger to reject a message on level
+ *  alone, before any of its arguments are evaluated.
+ *
+ *  Filters that override this must call #Invalidate whenever their
+ *  level limit may have changed. This may be called, from any thread,
+ *  while messages are being written and so must be safe to call
+ *  concurrently with #Allow.
+ *
+ *  @returns
+ *    The level limit of the filter, which, by default, is
+ *    #kLevelLimitAll.
+ *
+ */
+uint64_t
+Base::GetLevelLimit(void) const
+{
+    return (kLevelLimitAll);
+}
+
+/**
+ *  @brief
+ *    Return whether the filter needs the format string of a message
+ *    to pass or reject it.
+ *
+ *  Filters that can decide on the format string alone, before any
+ *  formatting is paid for, should override this to return true,
+ *  along with #AllowFormat. The answer must not change over the
+ *  lifetime of the filter.
+ *
+ *  @returns
+ *    True if the filter needs the format string; otherwise, false,
+ *    which is the default.
+ *
+ */
+bool
+Base::NeedsFormat(void) const
+{
+    return (false);
+}
+
+/**
+ *  @brief
+ *    Return whether the filter must be consulted on the format string
+ *    of a message after every other filter it is chained with.
+ *
+ *  Filters whose state changes with each message they pass, such
+ *  as a rate limit spending a token, should override this to return
+ *  true, such that a chain (see Chain and StaticChain) passes them
+ *  only messages that every other link has passed on level and
+ *  format string. The answer must not change over the lifetime of
+ *  the filter.
+ *
+ *  @returns
+ *    True if the filter must be consulted last; otherwise, false,
+ *    which is the default.
+ *
+ */
+bool
+Base::NeedsLast(void) const
+{
+    return (false);
+}
+
+/**
+ *  @brief
+ *    Pass or reject a message, before it is formatted, based on its
+ *    format string.
+ *
+ *  This is the pre-format phase of filtering: a logger calls it only
+ *  after #Allow(Level) has passed the message and only if
+ *  #NeedsFormat returns true. Format strings are usually string
+ *  literals, so their pointers identify their call sites and may be
+ *  used as keys.
+ *
+ *  @param[in]  inLevel   The level the current message is to be
+ *                        logged at.
+ *  @param[in]  inFormat  The printf-style format string of the
+ *                        message to be filtered.
+ *
+ *  @returns
+ *    True if the log message should be passed, which is the default;
+ *    otherwise, false.
+ *
+ */
+bool
+Base::AllowFormat(Level inLevel, const char * inFormat)
+{
+    (void)inLevel;
+    (void)inFormat;
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Return whether the filter needs the content of a message to
+ *    pass or reject it.
+ *
+ *  Filters that decide on level alone should override this to return
+ *  false, allowing a logger to skip the post-format phase (see
+ *  #AllowMessage) for them entirely. The answer must not change over
+ *  the lifetime of the filter.
+ *
+ *  @returns
+ *    True if the filter needs message content, which, by default,
+ *    it does; otherwise, false.
+ *
+ */
+bool
+Base::NeedsMessage(void) const
+{
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Pass or reject a formatted message that has already been passed
+ *    on its level.
+ *
+ *  This is the post-format phase of filtering: a logger calls it only
+ *  after #Allow(Level) has passed the message and only if
+ *  #NeedsMessage returns true. Filters that can separate their level
+ *  and content checks should override this to perform the latter
+ *  alone.
+ *
+ *  @param[in]  inLevel    The level the current message is to be
+ *                         logged at.
+ *  @param[in]  inMessage  The log message to be filtered.
+ *
+ *  @returns
+ *    True if the log message should be passed; otherwise, false. By
+ *    default, this returns the result of #Allow(Level, const char *).
+ *
+ */
+bool
+Base::AllowMessage(Level inLevel, const char * inMessage)
+{
+    return (Allow(inLevel, inMessage));
+}
+
+// Refresh the gates of the filter, whose level limit may have
+// changed (see Owned::Invalidate).
+
+void
+Base::RefreshGates(void) const
+{
+    Gate::Refresh(*this);
+}
+
 }; // namespace Filter
 
 }; // namespace Log
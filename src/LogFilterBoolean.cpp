@@ -64,6 +64,21 @@ Boolean::~Boolean(void)
     return;
 }
 
+/**
+ *  @brief
+ *    Return the level limit of the filter.
+ *
+ *  @returns
+ *    #kLevelLimitAll if the filter passes messages; otherwise,
+ *    #kLevelLimitNone.
+ *
+ */
+uint64_t
+Boolean::GetLevelLimit(void) const
+{
+    return (mAllow ? kLevelLimitAll : kLevelLimitNone);
+}
+
 /**
  *  @brief
  *    Pass or reject a message based on the specified level (unused)
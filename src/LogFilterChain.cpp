@@ -25,6 +25,16 @@
 
 #include <LogUtilities/LogFilterChain.hpp>
 
+#include <LogUtilities/LogClockMonotonic.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterQuiet.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <memory>
+#include <vector>
+
 namespace Nuovations
 {
 
@@ -34,23 +44,554 @@ namespace Log
 namespace Filter
 {
 
-Chain::Chain(void)
+// The number of walks of a phase, per thread, out of which one is
+// sampled in adaptive mode.
+
+static const uint32_t kSamplePeriod  = 64;
+
+// The number of sampled walks of a chain between reorderings.
+
+static const uint32_t kReorderPeriod = 256;
+
+// The most links a phase may have and still be reordered.
+
+static const size_t   kAdaptiveLinks = 32;
+
+// The walks left, on this thread, until one is sampled.
+
+static thread_local uint32_t sCountdown = 0;
+
+// Return the clock adaptive chains time their links by.
+
+static const Clock::Base &
+GetSampleClock(void)
+{
+    static const Clock::Monotonic sClock;
+
+    return (sClock);
+}
+
+/**
+ *  @brief
+ *    The samples taken of one link in adaptive mode.
+ *
+ *  Counters are updated only on sampled walks, which keeps
+ *  contention among threads consulting the same link low, and are
+ *  halved on each reordering such that older samples fade.
+ *
+ *  @private
+ *
+ */
+struct Statistics
+{
+    Statistics(void) :
+        mCalls(0),
+        mRejects(0),
+        mTicks(0)
+    {
+        return;
+    }
+
+    std::atomic<uint64_t> mCalls;   //!< The sampled consultations.
+    std::atomic<uint64_t> mRejects; //!< The sampled rejections.
+    std::atomic<uint64_t> mTicks;   //!< The sampled time spent, in
+                                    //!< clock ticks.
+};
+
+/**
+ *  @brief
+ *    The phases of an adaptive chain.
+ *
+ *  @private
+ *
+ */
+struct Chain::Adaptation
+{
+    /**
+     *  @brief
+     *    The samples and current order of the links of one phase.
+     *
+     *  The order is a permutation of the links, as pushed, published
+     *  under a sequence count such that walking threads always take
+     *  a whole permutation, never one partly reordered, without
+     *  locking.
+     *
+     */
+    struct Phase
+    {
+        Phase(void);
+
+        void Assign(const links_type & inLinks, const std::vector<bool> & inDependent);
+
+        template <typename Consult>
+        bool Walk(Adaptation & inAdaptation, Consult inConsult);
+
+        template <typename Consult>
+        bool Sample(Adaptation & inAdaptation, const uint8_t * inOrder, Consult inConsult);
+
+        void Load(uint8_t * outOrder) const;
+        void Reorder(void);
+
+        links_type                     mLinks;     //!< The links, as
+                                                   //!< pushed.
+        std::vector<bool>              mDependent; //!< Whether each link
+                                                   //!< stays as pushed.
+        std::unique_ptr<Statistics []> mSamples;   //!< The samples of
+                                                   //!< each link.
+        bool                           mFixed;     //!< Whether the phase
+                                                   //!< has too many links
+                                                   //!< to be reordered.
+        std::atomic<uint32_t>          mSequence;  //!< Odd while the
+                                                   //!< order is being
+                                                   //!< published.
+        std::atomic<uint8_t>           mOrder[kAdaptiveLinks];
+                                                   //!< The index of the
+                                                   //!< link consulted at
+                                                   //!< each position.
+    };
+
+    explicit Adaptation(const Clock::Base & inClock) :
+        mLevelPhase(),
+        mFormatPhase(),
+        mMessagePhase(),
+        mClock(inClock),
+        mSampled(0),
+        mReordering(false)
+    {
+        return;
+    }
+
+    void Reorder(void);
+
+    Phase                 mLevelPhase;   //!< The level phase.
+    Phase                 mFormatPhase;  //!< The pre-format phase.
+    Phase                 mMessagePhase; //!< The post-format phase.
+    const Clock::Base &   mClock;        //!< The clock sampled links
+                                         //!< are timed by.
+    std::atomic<uint32_t> mSampled;      //!< The sampled walks since
+                                         //!< the last reordering.
+    std::atomic<bool>     mReordering;   //!< Whether a thread is
+                                         //!< reordering the phases.
+};
+
+Chain::Adaptation::Phase::Phase(void) :
+    mLinks(),
+    mDependent(),
+    mSamples(),
+    mFixed(false),
+    mSequence(0)
 {
     return;
 }
 
+// Take the specified links, in push order, and whether each is
+// order-dependent.
+
+void
+Chain::Adaptation::Phase::Assign(const links_type & inLinks, const std::vector<bool> & inDependent)
+{
+    mLinks     = inLinks;
+    mDependent = inDependent;
+    mSamples.reset(new Statistics[inLinks.size()]);
+    mFixed     = (inLinks.size() > kAdaptiveLinks);
+
+    for (size_t theIndex = 0; !mFixed && (theIndex < inLinks.size()); theIndex++) {
+        mOrder[theIndex].store(static_cast<uint8_t>(theIndex), std::memory_order_relaxed);
+    }
+}
+
+// Consult the links in the current order until one rejects,
+// sampling one walk in every kSamplePeriod on this thread.
+
+template <typename Consult>
+bool
+Chain::Adaptation::Phase::Walk(Adaptation & inAdaptation, Consult inConsult)
+{
+    const size_t theSize = mLinks.size();
+    uint8_t      theOrder[kAdaptiveLinks];
+
+    if (mFixed) {
+        for (size_t thePosition = 0; thePosition < theSize; thePosition++) {
+            if (!inConsult(mLinks[thePosition])) {
+                return (false);
+            }
+        }
+
+        return (true);
+    }
+
+    Load(theOrder);
+
+    if (sCountdown-- == 0) {
+        sCountdown = kSamplePeriod - 1;
+
+        return (Sample(inAdaptation, theOrder, inConsult));
+    }
+
+    for (size_t thePosition = 0; thePosition < theSize; thePosition++) {
+        if (!inConsult(mLinks[theOrder[thePosition]])) {
+            return (false);
+        }
+    }
+
+    return (true);
+}
+
+// Consult the links in the specified order until one rejects,
+// recording the time each takes and whether it rejects, and reorder
+// the phases every kReorderPeriod sampled walks.
+
+template <typename Consult>
+bool
+Chain::Adaptation::Phase::Sample(Adaptation & inAdaptation, const uint8_t * inOrder, Consult inConsult)
+{
+    const Clock::Base & theClock  = inAdaptation.mClock;
+    const size_t        theSize   = mLinks.size();
+    Clock::Ticks        theStart  = theClock.Now();
+    bool                willAllow = true;
+
+    for (size_t thePosition = 0; willAllow && (thePosition < theSize); thePosition++) {
+        const uint8_t theIndex   = inOrder[thePosition];
+        Statistics &  theSamples = mSamples[theIndex];
+        Clock::Ticks  theEnd;
+
+        willAllow = inConsult(mLinks[theIndex]);
+        theEnd    = theClock.Now();
+
+        theSamples.mCalls.fetch_add(1, std::memory_order_relaxed);
+        theSamples.mTicks.fetch_add(static_cast<uint64_t>(std::max<Clock::Ticks>(theEnd - theStart, 0)),
+                                    std::memory_order_relaxed);
+
+        if (!willAllow) {
+            theSamples.mRejects.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        theStart = theEnd;
+    }
+
+    if ((inAdaptation.mSampled.fetch_add(1, std::memory_order_relaxed) + 1) >= kReorderPeriod) {
+        inAdaptation.Reorder();
+    }
+
+    return (willAllow);
+}
+
+// Copy the current order, retrying should it be published meanwhile.
+
+void
+Chain::Adaptation::Phase::Load(uint8_t * outOrder) const
+{
+    const size_t theSize = mLinks.size();
+    uint32_t     theSequence;
+
+    do {
+        theSequence = mSequence.load(std::memory_order_acquire);
+
+        for (size_t thePosition = 0; thePosition < theSize; thePosition++) {
+            outOrder[thePosition] = mOrder[thePosition].load(std::memory_order_relaxed);
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+    } while (((theSequence & 1) != 0) ||
+             (theSequence != mSequence.load(std::memory_order_relaxed)));
+}
+
+// Sort each run of independent links by expected cost per rejection,
+// the order in which, for independent links, a rejection is expected
+// soonest, and publish the result. The rejection rate is smoothed
+// such that a link never seen to reject sorts after those that have
+// and one never sampled, with no cost to go on, is tried early and
+// so measured.
+
+void
+Chain::Adaptation::Phase::Reorder(void)
+{
+    const size_t theSize = mLinks.size();
+    uint8_t      theOrder[kAdaptiveLinks];
+    double       theRanks[kAdaptiveLinks];
+    size_t       theFirst = 0;
+    size_t       theLast;
+
+    if (mFixed) {
+        return;
+    }
+
+    Load(theOrder);
+
+    for (size_t theIndex = 0; theIndex < theSize; theIndex++) {
+        Statistics &   theSamples = mSamples[theIndex];
+        const uint64_t theCalls   = theSamples.mCalls.load(std::memory_order_relaxed);
+        const uint64_t theRejects = std::min(theSamples.mRejects.load(std::memory_order_relaxed), theCalls);
+        const uint64_t theTicks   = theSamples.mTicks.load(std::memory_order_relaxed);
+        const double   theCost    = (theCalls == 0) ? 0.0 : (static_cast<double>(theTicks) / static_cast<double>(theCalls));
+
+        theRanks[theIndex] = ((theCost + 1.0) * static_cast<double>(theCalls + 2)) / static_cast<double>(theRejects + 1);
+
+        theSamples.mCalls.fetch_sub(theCalls / 2, std::memory_order_relaxed);
+        theSamples.mRejects.fetch_sub(theRejects / 2, std::memory_order_relaxed);
+        theSamples.mTicks.fetch_sub(theTicks / 2, std::memory_order_relaxed);
+    }
+
+    while (theFirst < theSize) {
+        if (mDependent[theFirst]) {
+            theFirst++;
+            continue;
+        }
+
+        for (theLast = theFirst; (theLast < theSize) && !mDependent[theLast]; theLast++)
+            continue;
+
+        std::stable_sort(theOrder + theFirst,
+                         theOrder + theLast,
+                         [&theRanks](uint8_t inFirst, uint8_t inSecond) {
+                             return (theRanks[inFirst] < theRanks[inSecond]);
+                         });
+
+        theFirst = theLast;
+    }
+
+    mSequence.fetch_add(1, std::memory_order_relaxed);
+
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (size_t thePosition = 0; thePosition < theSize; thePosition++) {
+        mOrder[thePosition].store(theOrder[thePosition], std::memory_order_relaxed);
+    }
+
+    mSequence.fetch_add(1, std::memory_order_release);
+}
+
+// Reorder every phase, unless another thread is doing so already.
+
+void
+Chain::Adaptation::Reorder(void)
+{
+    if (mReordering.exchange(true, std::memory_order_acquire)) {
+        return;
+    }
+
+    mSampled.store(0, std::memory_order_relaxed);
+
+    mLevelPhase.Reorder();
+    mFormatPhase.Reorder();
+    mMessagePhase.Reorder();
+
+    mReordering.store(false, std::memory_order_release);
+}
+
+Chain::Chain(void) :
+    mIndex(new Index())
+{
+    mIndex->mClock = &GetSampleClock();
+
+    mIndex->mCopies.push_back(this);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *  This constructor instantiates an empty chain whose links are timed
+ *  by the specified clock in adaptive mode.
+ *
+ *  @param[in]  inClock  A reference to the clock sampled links are
+ *                       timed by. It must outlive the chain.
+ *
+ */
+Chain::Chain(const Clock::Base & inClock) :
+    mIndex(new Index())
+{
+    mIndex->mClock = &inClock;
+
+    mIndex->mCopies.push_back(this);
+}
+
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *  The copy shares the links, and their index, of the chain copied.
+ *
+ *  @param[in]  inChain  An immutable reference to the chain to copy.
+ *
+ */
+Chain::Chain(const Chain & inChain) :
+    Log::Chain<Base>(inChain),
+    Base(inChain),
+    mIndex(inChain.mIndex)
+{
+    mIndex->mCopies.push_back(this);
+
+    AdoptLinks();
+}
+
 Chain::~Chain(void)
 {
-    return;
+    DisownLinks();
+
+    mIndex->mCopies.erase(std::find(mIndex->mCopies.begin(), mIndex->mCopies.end(), this));
+}
+
+/**
+ *  @brief
+ *    This is the class assignment operator.
+ *
+ *  The chain shares the links, and their index, of the chain assigned
+ *  from, in place of its own.
+ *
+ *  @param[in]  inChain  An immutable reference to the chain to
+ *                       assign from.
+ *
+ *  @returns
+ *    A reference to the chain.
+ *
+ */
+Chain &
+Chain::operator =(const Chain & inChain)
+{
+    if (this != &inChain) {
+        DisownLinks();
+
+        mIndex->mCopies.erase(std::find(mIndex->mCopies.begin(), mIndex->mCopies.end(), this));
+
+        Log::Chain<Base>::operator =(inChain);
+        Base::operator =(inChain);
+
+        mIndex = inChain.mIndex;
+
+        mIndex->mCopies.push_back(this);
+
+        AdoptLinks();
+
+        InvalidateCopies();
+    }
+
+    return (*this);
+}
+
+/**
+ *  @brief
+ *   Remove the trailing link of the chain.
+ *
+ */
+void
+Chain::Pop(void)
+{
+    DisownTrailingLink();
+
+    Log::Chain<Base>::Pop();
+
+    mIndex->mOrders.pop_back();
+
+    Split();
+
+    InvalidateCopies();
+}
+
+/**
+ *  @brief
+ *    Removes all links from the chain (which are destroyed), leaving
+ *    the chain with a size of zero (0).
+ *
+ */
+void
+Chain::Reset(void)
+{
+    DisownSharedLinks();
+
+    Log::Chain<Base>::Reset();
+
+    mIndex->mOrders.clear();
+
+    Split();
+
+    InvalidateCopies();
+}
+
+/**
+ *  @brief
+ *    Enable or disable adaptive reordering of the links.
+ *
+ *  Enabling starts sampling afresh, from the order in which the
+ *  links were pushed. As with pushing and popping links, this must
+ *  not race with filtering through the chain or its copies.
+ *
+ *  @param[in]  inAdaptive  Whether the links should be reordered.
+ *
+ */
+void
+Chain::SetAdaptive(bool inAdaptive)
+{
+    mIndex->mAdaptive = inAdaptive;
+
+    Split();
+}
+
+/**
+ *  @brief
+ *    Return whether the links are adaptively reordered.
+ *
+ *  @returns
+ *    True if the chain is in adaptive mode; otherwise, false.
+ *
+ */
+bool
+Chain::IsAdaptive(void) const
+{
+    return (mIndex->mAdaptive);
+}
+
+/**
+ *  @brief
+ *    Return the level limit of the chain.
+ *
+ *  Because a message must be passed by every link, this is the
+ *  lowest level limit among the links. An empty chain passes no
+ *  messages.
+ *
+ *  @returns
+ *    The level limit of the chain.
+ *
+ */
+uint64_t
+Chain::GetLevelLimit(void) const
+{
+    container_type::const_iterator current  = Container().begin();
+    container_type::const_iterator end      = Container().end();
+    uint64_t                       theLimit = (current == end) ? kLevelLimitNone : kLevelLimitAll;
+
+    while (current != end) {
+        theLimit = std::min(theLimit, (*current)->GetLevelLimit());
+
+        std::advance(current, 1);
+    }
+
+    return (theLimit);
 }
 
 bool
-Chain::Allow(Level inLevel)
+Chain::Allow(Log::Level inLevel)
 {
     container_type::iterator current   = Container().begin();
     container_type::iterator end       = Container().end();
     bool                     willAllow = false;
 
+    if (mIndex->mAdaptation) {
+        Adaptation & theAdaptation = *mIndex->mAdaptation;
+
+        if (current == end) {
+            return (false);
+        }
+
+        willAllow = theAdaptation.mLevelPhase.Walk(theAdaptation,
+                                                   [inLevel](Base * inLink) {
+                                                       return (inLink->Allow(inLevel));
+                                                   });
+
+        return (willAllow);
+    }
+
     while (current != end) {
         willAllow = (*current)->Allow(inLevel);
 
@@ -65,7 +606,7 @@ Chain::Allow(Level inLevel)
 }
 
 bool
-Chain::Allow(Level inLevel, const char * inMessage)
+Chain::Allow(Log::Level inLevel, const char * inMessage)
 {
     container_type::iterator current   = Container().begin();
     container_type::iterator end       = Container().end();
@@ -84,6 +625,341 @@ Chain::Allow(Level inLevel, const char * inMessage)
     return (willAllow);
 }
 
+/**
+ *  @brief
+ *    Return the leading level link of the chain, if any.
+ *
+ *  @returns
+ *    A pointer to the leading level filter in the chain, if there is
+ *    one; otherwise, null.
+ *
+ */
+Level *
+Chain::GetLevelLink(void) const
+{
+    return (mIndex->mLevelLink);
+}
+
+/**
+ *  @brief
+ *    Return the leading quiet link of the chain, if any.
+ *
+ *  @returns
+ *    A pointer to the leading quiet filter in the chain, if there is
+ *    one; otherwise, null.
+ *
+ */
+Quiet *
+Chain::GetQuietLink(void) const
+{
+    return (mIndex->mQuietLink);
+}
+
+/**
+ *  @brief
+ *    Return whether any link in the chain needs the format string of
+ *    a message to pass or reject it.
+ *
+ *  @returns
+ *    True if any link needs the format string; otherwise, false.
+ *
+ */
+bool
+Chain::NeedsFormat(void) const
+{
+    return (!mIndex->mFormatLinks.empty());
+}
+
+/**
+ *  @brief
+ *    Return whether any link in the chain must be consulted on the
+ *    format string of a message after every other filter.
+ *
+ *  @returns
+ *    True if any link must be consulted last; otherwise, false.
+ *
+ */
+bool
+Chain::NeedsLast(void) const
+{
+    return (mIndex->mLast);
+}
+
+/**
+ *  @brief
+ *    Pass or reject a message, before it is formatted and after it
+ *    has been passed by every link on its level, based on its format
+ *    string.
+ *
+ *  Only those links that need the format string are consulted, those
+ *  that must be consulted last (see Base::NeedsLast) after the rest.
+ *
+ *  @param[in]  inLevel   The level the current message is to be
+ *                        logged at.
+ *  @param[in]  inFormat  The printf-style format string of the
+ *                        message to be filtered.
+ *
+ *  @returns
+ *    True if every link that needs the format string passes the
+ *    message; otherwise, false.
+ *
+ */
+bool
+Chain::AllowFormat(Log::Level inLevel, const char * inFormat)
+{
+    links_type::const_iterator current = mIndex->mFormatLinks.begin();
+    links_type::const_iterator end     = mIndex->mFormatLinks.end();
+
+    if (mIndex->mAdaptation) {
+        Adaptation & theAdaptation = *mIndex->mAdaptation;
+        const bool   willAllow     = theAdaptation.mFormatPhase.Walk(theAdaptation,
+                                                                     [inLevel, inFormat](Base * inLink) {
+                                                                         return (inLink->AllowFormat(inLevel, inFormat));
+                                                                     });
+
+        return (willAllow);
+    }
+
+    while (current != end) {
+        if (!(*current)->AllowFormat(inLevel, inFormat)) {
+            return (false);
+        }
+
+        std::advance(current, 1);
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Return whether any link in the chain needs the content of a
+ *    message to pass or reject it.
+ *
+ *  @returns
+ *    True if any link needs message content; otherwise, false, in
+ *    which case the chain decides on level alone.
+ *
+ */
+bool
+Chain::NeedsMessage(void) const
+{
+    return (!mIndex->mMessageLinks.empty());
+}
+
+/**
+ *  @brief
+ *    Pass or reject a formatted message that has already been passed
+ *    by every link on its level.
+ *
+ *  Only those links that need message content are consulted.
+ *
+ *  @param[in]  inLevel    The level the current message is to be
+ *                         logged at.
+ *  @param[in]  inMessage  The log message to be filtered.
+ *
+ *  @returns
+ *    True if every link that needs message content passes the
+ *    message; otherwise, false.
+ *
+ */
+bool
+Chain::AllowMessage(Log::Level inLevel, const char * inMessage)
+{
+    links_type::const_iterator current = mIndex->mMessageLinks.begin();
+    links_type::const_iterator end     = mIndex->mMessageLinks.end();
+
+    if (mIndex->mAdaptation) {
+        Adaptation & theAdaptation = *mIndex->mAdaptation;
+        const bool   willAllow     = theAdaptation.mMessagePhase.Walk(theAdaptation,
+                                                                      [inLevel, inMessage](Base * inLink) {
+                                                                          return (inLink->AllowMessage(inLevel, inMessage));
+                                                                      });
+
+        return (willAllow);
+    }
+
+    while (current != end) {
+        if (!(*current)->AllowMessage(inLevel, inMessage)) {
+            return (false);
+        }
+
+        std::advance(current, 1);
+    }
+
+    return (true);
+}
+
+// Rebuild the index of the links: the pre-format and post-format
+// lists, from the links that need the format string and message
+// content, respectively, the leading level and quiet links and, in
+// adaptive mode, the phases to be reordered. Links that must be
+// consulted last on the format string close the pre-format list, as
+// dependent links, such that reordering leaves them there.
+
+void
+Chain::Split(void)
+{
+    container_type::const_iterator current  = Container().begin();
+    container_type::const_iterator end      = Container().end();
+    Index &                        theIndex = *mIndex;
+    orders_type::const_iterator    theOrder = theIndex.mOrders.begin();
+    std::vector<bool>              theLevelDependent;
+    std::vector<bool>              theFormatDependent;
+    std::vector<bool>              theMessageDependent;
+    links_type                     theLastLinks;
+
+    theIndex.mFormatLinks.clear();
+    theIndex.mMessageLinks.clear();
+    theIndex.mLevelLink = NULL;
+    theIndex.mQuietLink = NULL;
+    theIndex.mLast      = false;
+
+    while (current != end) {
+        const bool isDependent = (*theOrder == Order::kDependent);
+
+        theLevelDependent.push_back(isDependent);
+
+        if ((*current)->NeedsFormat() && (*current)->NeedsLast()) {
+            theLastLinks.push_back(*current);
+        } else if ((*current)->NeedsFormat()) {
+            theIndex.mFormatLinks.push_back(*current);
+            theFormatDependent.push_back(isDependent);
+        }
+
+        if ((*current)->NeedsMessage()) {
+            theIndex.mMessageLinks.push_back(*current);
+            theMessageDependent.push_back(isDependent);
+        }
+
+        if (theIndex.mLevelLink == NULL) {
+            theIndex.mLevelLink = dynamic_cast<Level *>(*current);
+        }
+
+        if (theIndex.mQuietLink == NULL) {
+            theIndex.mQuietLink = dynamic_cast<Quiet *>(*current);
+        }
+
+        std::advance(current, 1);
+        std::advance(theOrder, 1);
+    }
+
+    theIndex.mLast = !theLastLinks.empty();
+
+    theIndex.mFormatLinks.insert(theIndex.mFormatLinks.end(), theLastLinks.begin(), theLastLinks.end());
+    theFormatDependent.insert(theFormatDependent.end(), theLastLinks.size(), true);
+
+    if (theIndex.mAdaptive) {
+        Adaptation * const theAdaptation = new Adaptation(*theIndex.mClock);
+
+        theAdaptation->mLevelPhase.Assign(links_type(Container().begin(), Container().end()), theLevelDependent);
+        theAdaptation->mFormatPhase.Assign(theIndex.mFormatLinks, theFormatDependent);
+        theAdaptation->mMessagePhase.Assign(theIndex.mMessageLinks, theMessageDependent);
+
+        theIndex.mAdaptation.reset(theAdaptation);
+
+    } else {
+        theIndex.mAdaptation.reset();
+
+    }
+}
+
+// Record that the chain holds each of its links (see
+// Owned::Adopt).
+
+void
+Chain::AdoptLinks(void)
+{
+    container_type::iterator current = Container().begin();
+    container_type::iterator end     = Container().end();
+
+    while (current != end) {
+        Base::Adopt(**current);
+
+        std::advance(current, 1);
+    }
+}
+
+// Record that the chain no longer holds its links (see
+// Owned::Disown), which may outlive it in copies of it.
+
+void
+Chain::DisownLinks(void)
+{
+    container_type::iterator current = Container().begin();
+    container_type::iterator end     = Container().end();
+
+    while (current != end) {
+        Base::Disown(**current);
+
+        std::advance(current, 1);
+    }
+}
+
+// Record that every copy of the chain, each sharing its links, holds
+// the link just pushed.
+
+void
+Chain::AdoptTrailingLink(void)
+{
+    copies_type::const_iterator current = mIndex->mCopies.begin();
+    copies_type::const_iterator end     = mIndex->mCopies.end();
+
+    while (current != end) {
+        (*current)->Base::Adopt(*Container().back());
+
+        std::advance(current, 1);
+    }
+}
+
+// Record that no copy of the chain, each sharing its links, holds
+// the link about to be popped.
+
+void
+Chain::DisownTrailingLink(void)
+{
+    copies_type::const_iterator current = mIndex->mCopies.begin();
+    copies_type::const_iterator end     = mIndex->mCopies.end();
+
+    while (current != end) {
+        (*current)->Base::Disown(*Container().back());
+
+        std::advance(current, 1);
+    }
+}
+
+// Record that no copy of the chain holds any of the links about to be
+// removed.
+
+void
+Chain::DisownSharedLinks(void)
+{
+    copies_type::const_iterator current = mIndex->mCopies.begin();
+    copies_type::const_iterator end     = mIndex->mCopies.end();
+
+    while (current != end) {
+        (*current)->DisownLinks();
+
+        std::advance(current, 1);
+    }
+}
+
+// Invalidate every copy of the chain, since the links, and so the
+// level limit, each shares with it have changed.
+
+void
+Chain::InvalidateCopies(void)
+{
+    copies_type::const_iterator current = mIndex->mCopies.begin();
+    copies_type::const_iterator end     = mIndex->mCopies.end();
+
+    while (current != end) {
+        (*current)->Invalidate();
+
+        std::advance(current, 1);
+    }
+}
+
 }; // namespace Filter
 
 }; // namespace Log
@@ -0,0 +1,477 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete filter
+ *      implementation that suppresses repeats of recent logged
+ *      messages.
+ */
+
+#include <algorithm>
+#include <atomic>
+
+#include <stdio.h>
+
+#include <LogUtilities/LogClockMonotonic.hpp>
+#include <LogUtilities/LogFilterDedupe.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Filter
+{
+
+const size_t Dedupe::kSlots;
+
+static const Clock::Ticks kNanosecondsPerMillisecond = 1000000;
+
+/**
+ * Implementation of the @a Log::Filter::Dedupe object.
+ *
+ * @private
+ */
+struct Dedupe::Implementation
+{
+    /**
+     * A recent message.
+     */
+    struct Slot
+    {
+        Slot(void);
+
+        std::atomic<uint64_t>     mHash;    //!< The hash of the message
+                                            //!< or zero if the slot is
+                                            //!< unused.
+        std::atomic<Clock::Ticks> mPassed;  //!< The time the message
+                                            //!< was last passed.
+        std::atomic<uint64_t>     mRepeats; //!< The number of repeats
+                                            //!< of the message
+                                            //!< suppressed since it was
+                                            //!< last passed.
+        std::atomic<Log::Level>   mLevel;   //!< The level the message
+                                            //!< was last passed at.
+    };
+
+    Implementation(Clock::Ticks        inWindow,
+                   Writer::Base *      inSummaryWriter,
+                   const Clock::Base & inClock);
+
+    bool Allow(Log::Level inLevel, const char * inMessage);
+    void Flush(void);
+
+    void Summarize(Log::Level inLevel, const char * inFormat, uint64_t inRepeats);
+
+    static uint64_t Hash(const char * inMessage);
+
+    const Clock::Ticks    mWindow;         //!< The clock ticks within
+                                           //!< which a message passed
+                                           //!< again is a repeat.
+    Writer::Base * const  mSummaryWriter;  //!< The writer summaries
+                                           //!< are written to, if any.
+    const Clock::Base &   mClock;          //!< The clock the window
+                                           //!< is timed by.
+    std::atomic<uint64_t> mSuppressed;     //!< The number of repeats
+                                           //!< suppressed in total.
+    Slot                  mSlots[kSlots];  //!< The recent messages,
+                                           //!< indexed by hash.
+};
+
+static const char * const kRepeatedLast    = "last message repeated %llu times\n";
+static const char * const kRepeatedEarlier = "earlier message repeated %llu times\n";
+
+// Return the clock filters with a window in milliseconds are timed
+// by, whose ticks are nanoseconds.
+
+static const Clock::Base &
+GetMillisecondsClock(void)
+{
+    static const Clock::Monotonic sClock;
+
+    return (sClock);
+}
+
+Dedupe::
+Implementation::Slot::Slot(void) :
+    mHash(0),
+    mPassed(0),
+    mRepeats(0),
+    mLevel(0)
+{
+    return;
+}
+
+Dedupe::
+Implementation::Implementation(Clock::Ticks        inWindow,
+                               Writer::Base *      inSummaryWriter,
+                               const Clock::Base & inClock) :
+    mWindow(std::max<Clock::Ticks>(inWindow, 0)),
+    mSummaryWriter(inSummaryWriter),
+    mClock(inClock),
+    mSuppressed(0),
+    mSlots()
+{
+    return;
+}
+
+// Pass the specified message unless it repeats one passed within the
+// window, in which case count it instead.
+
+bool
+Dedupe::
+Implementation::Allow(Log::Level inLevel, const char * inMessage)
+{
+    const uint64_t     theHash     = Hash(inMessage);
+    Slot &             theSlot     = mSlots[theHash % kSlots];
+    const Clock::Ticks theNow      = mClock.Now();
+    uint64_t           theSlotHash = theSlot.mHash.load(std::memory_order_relaxed);
+    Clock::Ticks       thePassed;
+    uint64_t           theRepeats;
+
+    if (theSlotHash == theHash) {
+        thePassed = theSlot.mPassed.load(std::memory_order_relaxed);
+
+        // Once the window has elapsed, only the thread that claims
+        // the slot passes the message; any other is a repeat.
+
+        if (((theNow - thePassed) < mWindow) ||
+            !theSlot.mPassed.compare_exchange_strong(thePassed,
+                                                     theNow,
+                                                     std::memory_order_relaxed)) {
+            theSlot.mRepeats.fetch_add(1, std::memory_order_relaxed);
+            mSuppressed.fetch_add(1, std::memory_order_relaxed);
+
+            return (false);
+        }
+
+        theRepeats = theSlot.mRepeats.exchange(0, std::memory_order_relaxed);
+
+        if (theRepeats != 0) {
+            Summarize(inLevel, kRepeatedLast, theRepeats);
+        }
+
+    } else if (theSlot.mHash.compare_exchange_strong(theSlotHash,
+                                                     theHash,
+                                                     std::memory_order_relaxed)) {
+        theSlot.mPassed.store(theNow, std::memory_order_relaxed);
+
+        theRepeats = theSlot.mRepeats.exchange(0, std::memory_order_relaxed);
+
+        if (theRepeats != 0) {
+            Summarize(theSlot.mLevel.load(std::memory_order_relaxed),
+                      kRepeatedEarlier,
+                      theRepeats);
+        }
+
+        theSlot.mLevel.store(inLevel, std::memory_order_relaxed);
+    }
+
+    // A message that loses the race to take over its slot is passed
+    // without being remembered.
+
+    return (true);
+}
+
+// Summarize the repeats of every message pending summary.
+
+void
+Dedupe::
+Implementation::Flush(void)
+{
+    uint64_t theRepeats;
+
+    for (Slot & theSlot : mSlots) {
+        if (theSlot.mRepeats.load(std::memory_order_relaxed) == 0) {
+            continue;
+        }
+
+        theRepeats = theSlot.mRepeats.exchange(0, std::memory_order_relaxed);
+
+        if (theRepeats != 0) {
+            Summarize(theSlot.mLevel.load(std::memory_order_relaxed),
+                      kRepeatedEarlier,
+                      theRepeats);
+        }
+    }
+}
+
+// Write a summary of the specified number of repeats at the specified
+// level.
+
+void
+Dedupe::
+Implementation::Summarize(Log::Level inLevel, const char * inFormat, uint64_t inRepeats)
+{
+    char theSummary[64];
+
+    if (mSummaryWriter == nullptr) {
+        return;
+    }
+
+    snprintf(theSummary, sizeof (theSummary),
+             inFormat,
+             static_cast<unsigned long long>(inRepeats));
+
+    mSummaryWriter->Write(inLevel, theSummary);
+}
+
+// Return the 64-bit FNV-1a hash of the specified message, which is
+// never zero, since that marks an unused slot.
+
+uint64_t
+Dedupe::
+Implementation::Hash(const char * inMessage)
+{
+    uint64_t theHash = 0xCBF29CE484222325ULL;
+
+    while (*inMessage != '\0') {
+        theHash ^= static_cast<unsigned char>(*inMessage++);
+        theHash *= 0x100000001B3ULL;
+    }
+
+    return ((theHash == 0) ? 1 : theHash);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates a dedupe filter, without a
+ *    summary writer, that suppresses repeats within the specified
+ *    window.
+ *
+ *  @param[in]  inWindow  The milliseconds within which a message
+ *                        passed again is a repeat.
+ *
+ */
+Dedupe::Dedupe(uint32_t inWindow) :
+    Base(),
+    mImplementation(new Implementation(inWindow * kNanosecondsPerMillisecond,
+                                       nullptr,
+                                       GetMillisecondsClock()))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates a dedupe filter that suppresses
+ *    repeats within the specified window, summarizing them to the
+ *    specified writer.
+ *
+ *  @param[in]  inWindow         The milliseconds within which a
+ *                               message passed again is a repeat.
+ *  @param[in]  inSummaryWriter  A reference to the writer that
+ *                               summaries of repeats are written to.
+ *                               It must outlive the filter.
+ *
+ */
+Dedupe::Dedupe(uint32_t inWindow, Writer::Base & inSummaryWriter) :
+    Base(),
+    mImplementation(new Implementation(inWindow * kNanosecondsPerMillisecond,
+                                       &inSummaryWriter,
+                                       GetMillisecondsClock()))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates a dedupe filter, timed by the
+ *    specified clock, that suppresses repeats within the specified
+ *    window.
+ *
+ *  @param[in]  inWindow         The clock ticks within which a
+ *                               message passed again is a repeat.
+ *  @param[in]  inSummaryWriter  A pointer to the writer that summaries
+ *                               of repeats are written to or null for
+ *                               none. It must outlive the filter.
+ *  @param[in]  inClock          A reference to the clock the window
+ *                               is timed by. It must outlive the
+ *                               filter.
+ *
+ */
+Dedupe::Dedupe(Clock::Ticks        inWindow,
+               Writer::Base *      inSummaryWriter,
+               const Clock::Base & inClock) :
+    Base(),
+    mImplementation(new Implementation(inWindow, inSummaryWriter, inClock))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *    The copy shares the table and counters of the original.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        copy.
+ *
+ */
+Dedupe::Dedupe(const Dedupe & inFilter) :
+    Base(),
+    mImplementation(inFilter.mImplementation)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Dedupe::~Dedupe(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class assignment operator.
+ *
+ *    The filter shares the table and counters of the assigned filter
+ *    thereafter.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        assign.
+ *
+ *  @returns
+ *    A reference to this filter.
+ *
+ */
+Dedupe &
+Dedupe::operator =(const Dedupe & inFilter)
+{
+    mImplementation = inFilter.mImplementation;
+
+    return (*this);
+}
+
+/**
+ *  @brief
+ *    Return the clock ticks within which a message passed again is
+ *    a repeat.
+ *
+ */
+Clock::Ticks
+Dedupe::GetWindow(void) const
+{
+    return (mImplementation->mWindow);
+}
+
+/**
+ *  @brief
+ *    Summarize the repeats suppressed since their message was last
+ *    passed, for every message.
+ *
+ *  Since the repeats of a message are otherwise only summarized when
+ *  it, or another message in its slot, is next passed, this should
+ *  be called periodically, or before exiting, by those wanting every
+ *  repeat accounted for.
+ *
+ */
+void
+Dedupe::Flush(void)
+{
+    mImplementation->Flush();
+}
+
+/**
+ *  @brief
+ *    Return the number of repeats suppressed since the filter was
+ *    instantiated.
+ *
+ */
+uint64_t
+Dedupe::GetSuppressed(void) const
+{
+    return (mImplementation->mSuppressed.load(std::memory_order_relaxed));
+}
+
+/**
+ *  @brief
+ *    Pass a message based on the specified level alone.
+ *
+ *  @param[in]  inLevel  The level of the message, which is ignored.
+ *
+ *  @returns
+ *    True, since repeats are only known from the message content.
+ *
+ */
+bool
+Dedupe::Allow(Log::Level inLevel)
+{
+    (void)inLevel;
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Pass or reject a message based on whether it repeats a recent
+ *    one.
+ *
+ *  @param[in]  inLevel    The level the current message is to be
+ *                         logged at.
+ *  @param[in]  inMessage  The log message to be filtered.
+ *
+ *  @returns
+ *    True if the message was not passed within the window;
+ *    otherwise, false.
+ *
+ */
+bool
+Dedupe::Allow(Log::Level inLevel, const char * inMessage)
+{
+    return (AllowMessage(inLevel, inMessage));
+}
+
+/**
+ *  @brief
+ *    Pass or reject a message based on whether it repeats a recent
+ *    one.
+ *
+ *  @param[in]  inLevel    The level the current message is to be
+ *                         logged at.
+ *  @param[in]  inMessage  The log message to be filtered.
+ *
+ *  @returns
+ *    True if the message was not passed within the window;
+ *    otherwise, false.
+ *
+ */
+bool
+Dedupe::AllowMessage(Log::Level inLevel, const char * inMessage)
+{
+    return (mImplementation->Allow(inLevel, inMessage));
+}
+
+}; // namespace Filter
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -0,0 +1,400 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete filter
+ *      implementation that passes or rejects logged messages, before
+ *      they are formatted, based on a list of format strings.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <utility>
+
+#include <string.h>
+
+#include <LogUtilities/LogFilterFormatList.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Filter
+{
+
+const size_t FormatList::kCacheSlots;
+
+/**
+ * Implementation of the @a Log::Filter::FormatList object.
+ *
+ * @private
+ */
+struct FormatList::Implementation
+{
+    /**
+     * A cached result for a format pointer.
+     *
+     * The result is only trusted if the format reads the same before
+     * and after it, since the format is cleared before a result for
+     * another format is stored.
+     */
+    struct Slot
+    {
+        Slot(void);
+
+        std::atomic<const char *> mFormat;   //!< The format pointer
+                                             //!< or null if the slot
+                                             //!< is unused.
+        std::atomic<bool>         mContains; //!< Whether the format
+                                             //!< is listed.
+    };
+
+    typedef std::pair<uint64_t, std::string> entry_type;
+
+    Implementation(Action inAction, Key inKey, const std::vector<const char *> & inFormats);
+
+    bool Contains(const char * inFormat);
+    bool Search(const char * inFormat) const;
+
+    static uint64_t Hash(const char * inFormat);
+    static size_t   Index(const char * inFormat);
+
+    const Action               mAction;   //!< What becomes of messages
+                                          //!< whose format is listed.
+    const Key                  mKey;      //!< When a format matches a
+                                          //!< listed one.
+    const size_t               mFormats;  //!< The number of formats
+                                          //!< listed.
+    std::vector<const char *>  mPointers; //!< The listed format
+                                          //!< pointers, sorted, when
+                                          //!< keyed by pointer.
+    std::vector<entry_type>    mEntries;  //!< The listed formats and
+                                          //!< their hashes, sorted by
+                                          //!< hash, when keyed by
+                                          //!< hash.
+    Slot                       mCache[kCacheSlots]; //!< The cached
+                                                    //!< results, indexed
+                                                    //!< by format pointer.
+};
+
+FormatList::
+Implementation::Slot::Slot(void) :
+    mFormat(nullptr),
+    mContains(false)
+{
+    return;
+}
+
+FormatList::
+Implementation::Implementation(Action inAction, Key inKey, const std::vector<const char *> & inFormats) :
+    mAction(inAction),
+    mKey(inKey),
+    mFormats(inFormats.size()),
+    mPointers(),
+    mEntries(),
+    mCache()
+{
+    for (const char * theFormat : inFormats) {
+        if (theFormat == nullptr) {
+            continue;
+        }
+
+        if (mKey == Key::kPointer) {
+            mPointers.push_back(theFormat);
+        } else {
+            mEntries.push_back(entry_type(Hash(theFormat), theFormat));
+        }
+    }
+
+    std::sort(mPointers.begin(), mPointers.end());
+    std::sort(mEntries.begin(), mEntries.end());
+}
+
+// Return whether the specified format is listed, consulting the cache
+// first and filling it on a miss.
+
+bool
+FormatList::
+Implementation::Contains(const char * inFormat)
+{
+    Slot &       theSlot = mCache[Index(inFormat)];
+    const char * theFormat;
+    bool         theContains;
+
+    theFormat   = theSlot.mFormat.load(std::memory_order_acquire);
+    theContains = theSlot.mContains.load(std::memory_order_acquire);
+
+    if ((theFormat == inFormat) &&
+        (theSlot.mFormat.load(std::memory_order_relaxed) == inFormat)) {
+        return (theContains);
+    }
+
+    theContains = Search(inFormat);
+
+    theSlot.mFormat.store(nullptr, std::memory_order_relaxed);
+    theSlot.mContains.store(theContains, std::memory_order_release);
+    theSlot.mFormat.store(inFormat, std::memory_order_release);
+
+    return (theContains);
+}
+
+// Return whether the specified format is listed, without the cache.
+
+bool
+FormatList::
+Implementation::Search(const char * inFormat) const
+{
+    std::vector<entry_type>::const_iterator theEntry;
+    uint64_t                                theHash;
+
+    if (mKey == Key::kPointer) {
+        return (std::binary_search(mPointers.begin(), mPointers.end(), inFormat));
+    }
+
+    theHash  = Hash(inFormat);
+    theEntry = std::lower_bound(mEntries.begin(),
+                                mEntries.end(),
+                                entry_type(theHash, std::string()));
+
+    while ((theEntry != mEntries.end()) && (theEntry->first == theHash)) {
+        if (strcmp(theEntry->second.c_str(), inFormat) == 0) {
+            return (true);
+        }
+
+        theEntry++;
+    }
+
+    return (false);
+}
+
+// Return the 64-bit FNV-1a hash of the specified format.
+
+uint64_t
+FormatList::
+Implementation::Hash(const char * inFormat)
+{
+    uint64_t theHash = 0xCBF29CE484222325ULL;
+
+    while (*inFormat != '\0') {
+        theHash ^= static_cast<unsigned char>(*inFormat++);
+        theHash *= 0x100000001B3ULL;
+    }
+
+    return (theHash);
+}
+
+// Return the cache slot for the specified format pointer.
+
+size_t
+FormatList::
+Implementation::Index(const char * inFormat)
+{
+    static const uint64_t kMultiplier = 0x9E3779B97F4A7C15ULL;
+
+    return (((reinterpret_cast<uintptr_t>(inFormat) * kMultiplier) >> 32) % kCacheSlots);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *  @param[in]  inAction   What becomes of messages whose format is
+ *                         listed.
+ *  @param[in]  inKey      When a format matches a listed one.
+ *  @param[in]  inFormats  An immutable reference to the formats to
+ *                         list. When keyed by pointer, the formats
+ *                         must outlive the filter; otherwise, they
+ *                         are copied.
+ *
+ */
+FormatList::FormatList(Action inAction, Key inKey, const std::vector<const char *> & inFormats) :
+    Base(),
+    mImplementation(new Implementation(inAction, inKey, inFormats))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *    The copy shares the list and cache of the original.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        copy.
+ *
+ */
+FormatList::FormatList(const FormatList & inFilter) :
+    Base(),
+    mImplementation(inFilter.mImplementation)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+FormatList::~FormatList(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class assignment operator.
+ *
+ *    The filter shares the list and cache of the assigned filter
+ *    thereafter.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        assign.
+ *
+ *  @returns
+ *    A reference to this filter.
+ *
+ */
+FormatList &
+FormatList::operator =(const FormatList & inFilter)
+{
+    mImplementation = inFilter.mImplementation;
+
+    return (*this);
+}
+
+/**
+ *  @brief
+ *    Return what becomes of messages whose format is listed.
+ *
+ */
+FormatList::Action
+FormatList::GetAction(void) const
+{
+    return (mImplementation->mAction);
+}
+
+/**
+ *  @brief
+ *    Return when a format matches a listed one.
+ *
+ */
+FormatList::Key
+FormatList::GetKey(void) const
+{
+    return (mImplementation->mKey);
+}
+
+/**
+ *  @brief
+ *    Return the number of formats listed.
+ *
+ */
+size_t
+FormatList::GetFormats(void) const
+{
+    return (mImplementation->mFormats);
+}
+
+/**
+ *  @brief
+ *    Return whether the specified format matches a listed one.
+ *
+ *  @param[in]  inFormat  A pointer to the null-terminated format
+ *                        string to look up.
+ *
+ *  @returns
+ *    True if the format is listed; otherwise, false.
+ *
+ */
+bool
+FormatList::Contains(const char * inFormat) const
+{
+    return (mImplementation->Contains(inFormat));
+}
+
+/**
+ *  @brief
+ *    Pass a message based on the specified level alone.
+ *
+ *  @param[in]  inLevel  The level of the message, which is ignored.
+ *
+ *  @returns
+ *    True, since the filter decides on the format string alone.
+ *
+ */
+bool
+FormatList::Allow(Log::Level inLevel)
+{
+    (void)inLevel;
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Pass a message based on the specified level and the formatted
+ *    message.
+ *
+ *  @param[in]  inLevel    The level of the message, which is ignored.
+ *  @param[in]  inMessage  The log message, which is ignored.
+ *
+ *  @returns
+ *    True, since the filter decides on the format string alone.
+ *
+ */
+bool
+FormatList::Allow(Log::Level inLevel, const char * inMessage)
+{
+    (void)inMessage;
+
+    return (Allow(inLevel));
+}
+
+/**
+ *  @brief
+ *    Pass or reject a message, before it is formatted, based on
+ *    whether its format is listed.
+ *
+ *  @param[in]  inLevel   The level the current message is to be
+ *                        logged at, which is ignored.
+ *  @param[in]  inFormat  The printf-style format string of the
+ *                        message to be filtered.
+ *
+ *  @returns
+ *    True if the message should be passed; otherwise, false.
+ *
+ */
+bool
+FormatList::AllowFormat(Log::Level inLevel, const char * inFormat)
+{
+    const bool theContains = Contains(inFormat);
+
+    (void)inLevel;
+
+    return ((mImplementation->mAction == Action::kPass) ? theContains : !theContains);
+}
+
+}; // namespace Filter
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -0,0 +1,397 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities object for
+ *      testing, lock-free, whether a filter may pass messages at a
+ *      given level.
+ */
+
+#include <LogUtilities/LogFilterGate.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+#include <LogUtilities/LogFilterBase.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Filter
+{
+
+// The live gates, listed by the filter and by the writer each gates,
+// and the lock guarding both the lists and the recomputation of each
+// gate's bitmap. The list for a filter or writer is found by the
+// hash of its address, and so may be shared with others. All are
+// constant-initialized, such that gates may be constructed during
+// static initialization.
+
+static const size_t kBuckets = 64;
+
+static std::mutex sGatesMutex;
+static Gate *     sFilterGates[kBuckets];
+static Gate *     sWriterGates[kBuckets];
+
+const Log::Level Gate::kLevels;
+const size_t     Gate::kCacheLineSize;
+
+// Return the list holding the live gates of the specified filter or
+// writer.
+
+static Gate *&
+GetGates(Gate ** inGates, const void * inSubject)
+{
+    return (inGates[(reinterpret_cast<uintptr_t>(inSubject) >> 4) % kBuckets]);
+}
+
+/**
+ *  @brief
+ *    This is the class constructor.
+ *
+ *  @param[in]  inFilter  A reference to the filter to gate.
+ *
+ */
+Gate::Gate(Base & inFilter) :
+    mFilter(&inFilter),
+    mWriter(NULL),
+    mFilterLinks(),
+    mWriterLinks(),
+    mLevels(0)
+{
+    std::lock_guard<std::mutex> theLock(sGatesMutex);
+
+    Insert();
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *  @param[in]  inFilter  A reference to the filter to gate.
+ *  @param[in]  inWriter  A reference to the writer to gate.
+ *
+ */
+Gate::Gate(Base & inFilter, const Writer::Base & inWriter) :
+    mFilter(&inFilter),
+    mWriter(&inWriter),
+    mFilterLinks(),
+    mWriterLinks(),
+    mLevels(0)
+{
+    std::lock_guard<std::mutex> theLock(sGatesMutex);
+
+    Insert();
+}
+
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *  @param[in]  inGate  An immutable reference to the gate to copy,
+ *                      whose filter and writer, if any, are gated.
+ *
+ */
+Gate::Gate(const Gate & inGate) :
+    mFilter(inGate.mFilter),
+    mWriter(inGate.mWriter),
+    mFilterLinks(),
+    mWriterLinks(),
+    mLevels(0)
+{
+    std::lock_guard<std::mutex> theLock(sGatesMutex);
+
+    Insert();
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Gate::~Gate(void)
+{
+    std::lock_guard<std::mutex> theLock(sGatesMutex);
+
+    Remove();
+}
+
+/**
+ *  @brief
+ *    This is the class assignment operator.
+ *
+ *  The gate remains live and gates the filter and writer, if any, of
+ *  the specified gate instead, recomputing the enabled levels for
+ *  them.
+ *
+ *  @param[in]  inGate  An immutable reference to the gate to assign
+ *                      from.
+ *
+ *  @returns
+ *    A reference to the gate.
+ *
+ */
+Gate &
+Gate::operator =(const Gate & inGate)
+{
+    std::lock_guard<std::mutex> theLock(sGatesMutex);
+
+    if (this != &inGate) {
+        Remove();
+
+        mFilter = inGate.mFilter;
+        mWriter = inGate.mWriter;
+
+        Insert();
+    }
+
+    return (*this);
+}
+
+/**
+ *  @brief
+ *    Gate the specified filter instead, recomputing the enabled
+ *    levels for it.
+ *
+ *  @param[in]  inFilter  A reference to the filter to gate.
+ *
+ */
+void
+Gate::Bind(Base & inFilter)
+{
+    std::lock_guard<std::mutex> theLock(sGatesMutex);
+
+    Remove();
+
+    mFilter = &inFilter;
+
+    Insert();
+}
+
+/**
+ *  @brief
+ *    Gate the specified writer instead, if any, recomputing the
+ *    enabled levels for it.
+ *
+ *  @param[in]  inWriter  A pointer to the writer to gate or null to
+ *                        gate the filter alone.
+ *
+ */
+void
+Gate::Bind(const Writer::Base * inWriter)
+{
+    std::lock_guard<std::mutex> theLock(sGatesMutex);
+
+    Remove();
+
+    mWriter = inWriter;
+
+    Insert();
+}
+
+/**
+ *  @brief
+ *    Return the enabled levels for the specified level limit.
+ *
+ *  @param[in]  inLevelLimit  The level limit, such that messages at
+ *                            levels below it may be passed.
+ *
+ *  @returns
+ *    A bitmap with bit N set if messages at level N may be passed,
+ *    where the last bit is set if those at any level at or above it
+ *    may be.
+ *
+ */
+uint64_t
+Gate::GetLevels(uint64_t inLevelLimit)
+{
+    if (inLevelLimit >= kLevels) {
+        return (~static_cast<uint64_t>(0));
+    }
+
+    return ((static_cast<uint64_t>(1) << inLevelLimit) - 1);
+}
+
+/**
+ *  @brief
+ *    Return the enabled levels for the specified, inclusive range of
+ *    levels.
+ *
+ *  @param[in]  inMinimum  The lowest level enabled.
+ *  @param[in]  inMaximum  The highest level enabled.
+ *
+ *  @returns
+ *    A bitmap with bit N set if N is within the range, where the last
+ *    bit is set if any level at or above it is; or zero (0) if the
+ *    range is empty.
+ *
+ */
+uint64_t
+Gate::GetLevels(Log::Level inMinimum, Log::Level inMaximum)
+{
+    const Log::Level theMinimum = std::min<Log::Level>(inMinimum, kLevels - 1);
+    const Log::Level theMaximum = std::min<Log::Level>(inMaximum, kLevels - 1);
+
+    if (inMinimum > inMaximum) {
+        return (0);
+    }
+
+    return (GetLevels(static_cast<uint64_t>(theMaximum) + 1) & ~GetLevels(static_cast<uint64_t>(theMinimum)));
+}
+
+/**
+ *  @brief
+ *    Recompute the enabled levels of the live gates of the specified
+ *    filter.
+ *
+ *  This is invoked, by Owned::Invalidate, whenever the level limit of
+ *  the filter may have changed.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter whose
+ *                        gates to refresh.
+ *
+ */
+void
+Gate::Refresh(const Base & inFilter)
+{
+    std::lock_guard<std::mutex> theLock(sGatesMutex);
+
+    for (Gate * theGate = GetGates(sFilterGates, &inFilter); theGate != NULL; theGate = theGate->mFilterLinks.mNext) {
+        if (theGate->mFilter == &inFilter) {
+            theGate->Update();
+        }
+    }
+}
+
+/**
+ *  @brief
+ *    Recompute the enabled levels of the live gates of the specified
+ *    writer.
+ *
+ *  This is invoked, by Owned::Invalidate, whenever the levels
+ *  the writer may write at may have changed.
+ *
+ *  @param[in]  inWriter  An immutable reference to the writer whose
+ *                        gates to refresh.
+ *
+ */
+void
+Gate::Refresh(const Writer::Base & inWriter)
+{
+    std::lock_guard<std::mutex> theLock(sGatesMutex);
+
+    for (Gate * theGate = GetGates(sWriterGates, &inWriter); theGate != NULL; theGate = theGate->mWriterLinks.mNext) {
+        if (theGate->mWriter == &inWriter) {
+            theGate->Update();
+        }
+    }
+}
+
+// Add the gate to the live gates of its filter and writer, if any,
+// and compute its enabled levels. The gates lock must be held.
+
+void
+Gate::Insert(void)
+{
+    Insert(GetGates(sFilterGates, mFilter), &Gate::mFilterLinks);
+
+    if (mWriter != NULL) {
+        Insert(GetGates(sWriterGates, mWriter), &Gate::mWriterLinks);
+    }
+
+    Update();
+}
+
+// Remove the gate from the live gates of its filter and writer, if
+// any. The gates lock must be held.
+
+void
+Gate::Remove(void)
+{
+    Remove(GetGates(sFilterGates, mFilter), &Gate::mFilterLinks);
+
+    if (mWriter != NULL) {
+        Remove(GetGates(sWriterGates, mWriter), &Gate::mWriterLinks);
+    }
+}
+
+// Add the gate to the head of the specified list, through the
+// specified links.
+
+void
+Gate::Insert(Gate *& inGates, Links Gate::* inLinks)
+{
+    Links & theLinks = this->*inLinks;
+
+    theLinks.mPrevious = NULL;
+    theLinks.mNext     = inGates;
+
+    if (inGates != NULL) {
+        (inGates->*inLinks).mPrevious = this;
+    }
+
+    inGates = this;
+}
+
+// Remove the gate from the specified list, through the specified
+// links.
+
+void
+Gate::Remove(Gate *& inGates, Links Gate::* inLinks)
+{
+    Links & theLinks = this->*inLinks;
+
+    if (theLinks.mPrevious != NULL) {
+        (theLinks.mPrevious->*inLinks).mNext = theLinks.mNext;
+    } else {
+        inGates = theLinks.mNext;
+    }
+
+    if (theLinks.mNext != NULL) {
+        (theLinks.mNext->*inLinks).mPrevious = theLinks.mPrevious;
+    }
+
+    theLinks.mPrevious = NULL;
+    theLinks.mNext     = NULL;
+}
+
+// Recompute the enabled levels from the filter and writer. The gates
+// lock must be held, such that the last recomputation, whichever
+// thread makes it, reflects the last change.
+
+void
+Gate::Update(void)
+{
+    uint64_t theLevels = GetLevels(mFilter->GetLevelLimit());
+
+    if (mWriter != NULL) {
+        theLevels &= mWriter->GetLevels();
+    }
+
+    mLevels.store(theLevels, std::memory_order_relaxed);
+}
+
+}; // namespace Filter
+
+}; // namespace Log
+
+}; // namespace Nuovations
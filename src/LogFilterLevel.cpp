@@ -68,6 +68,21 @@ Level::Level(Log::Level inLevel) :
     return;
 }
 
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter whose
+ *                        level is to be copied.
+ *
+ */
+Level::Level(const Level & inFilter) :
+    Base(),
+    mLevel(inFilter.GetLevel())
+{
+    return;
+}
+
 /**
  *  @brief
  *    This is the class destructor.
@@ -89,7 +104,7 @@ Level::~Level(void)
 Log::Level
 Level::GetLevel(void) const
 {
-    return (mLevel);
+    return (mLevel.load(std::memory_order_relaxed));
 }
 
 /**
@@ -106,52 +121,28 @@ Level::GetLevel(void) const
 void
 Level::SetLevel(Log::Level inLevel)
 {
-    mLevel = inLevel;
-}
+    mLevel.store(inLevel, std::memory_order_relaxed);
 
-/**
- *  @brief
- *    Pass or reject a message based on the specified level and the
- *    current level of the filter.
- *
- *    Messages less than or equal to the current filter level are passed;
- *    those greater than are rejected.
- *
- *  @param[in]  inLevel  The level the current message is to be logged at.
- *
- *  @returns
- *    True if the log message should be passed; otherwise, false, if
- *    the message should be rejected based on the current level of the
- *    filter.
- */
-bool
-Level::Allow(Log::Level inLevel)
-{
-    return (inLevel <= mLevel);
+    Invalidate();
 }
 
 /**
  *  @brief
- *    Pass or reject a message based on the specified level, the
- *    message to be logged, and the current level of the filter.
+ *    This is the class assignment operator.
  *
- *    Messages less than or equal to the current filter level are passed;
- *    those greater than are rejected.
- *
- *  @param[in]  inLevel    The level the current message is to be logged at.
- *  @param[in]  inMessage  The log message to be filtered.
+ *  @param[in]  inFilter  An immutable reference to the filter whose
+ *                        level is to be assigned.
  *
  *  @returns
- *    True if the log message should be passed; otherwise, false, if
- *    the message should be rejected based on the current level of the
- *    filter.
+ *    A reference to this filter.
+ *
  */
-bool
-Level::Allow(Log::Level inLevel, const char * inMessage)
+Level &
+Level::operator =(const Level & inFilter)
 {
-    (void)inMessage;
+    SetLevel(inFilter.GetLevel());
 
-    return (Allow(inLevel));
+    return (*this);
 }
 
 }; // namespace Filter
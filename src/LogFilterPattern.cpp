@@ -0,0 +1,662 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete filter
+ *      implementation that passes or rejects logged messages based on
+ *      whether they contain any of a set of patterns.
+ */
+
+#include <deque>
+
+#include <fnmatch.h>
+#include <string.h>
+
+#include <LogUtilities/LogFilterPattern.hpp>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+
+#define LOGUTILITIES_HAVE_SSE2 1
+#endif // defined(__SSE2__)
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Filter
+{
+
+/**
+ * Implementation of the @a Log::Filter::Pattern object.
+ *
+ * @private
+ */
+struct Pattern::Implementation
+{
+    /**
+     * State flags.
+     */
+    enum : uint8_t {
+        kAccept  = 0x01, //!< A literal ends at the state.
+        kConfirm = 0x02  //!< The literal run of a glob ends at the
+                         //!< state.
+    };
+
+    Implementation(Action inAction, const std::vector<std::string> & inPatterns);
+
+    bool Match(const char * inMessage) const;
+
+    void         Add(const std::string & inAnchor, bool inLiteral, uint32_t inGlob);
+    void         Compile(void);
+    uint32_t     Grow(void);
+    bool         Confirm(uint32_t inGlob, const char * inMessage) const;
+    const char * Skip(const char * inCurrent, const char * inEnd) const;
+
+    static const uint32_t kRoot           = 0;
+    static const uint32_t kNone           = UINT32_MAX;
+    static const size_t   kPrefilterBytes = 8;
+
+    const Action                       mAction;      //!< What becomes of
+                                                     //!< messages that
+                                                     //!< match.
+    const size_t                       mPatterns;    //!< The number of
+                                                     //!< patterns.
+    bool                               mMatchesAll;  //!< Whether an empty
+                                                     //!< literal matches
+                                                     //!< every message.
+    uint8_t                            mClasses[256]; //!< The class of
+                                                      //!< each byte, where
+                                                      //!< those in no
+                                                      //!< pattern share
+                                                      //!< class zero.
+    size_t                             mClassCount;  //!< The number of
+                                                     //!< byte classes.
+    std::vector<uint32_t>              mTransitions; //!< The next state
+                                                     //!< for each state
+                                                     //!< and byte class.
+    std::vector<uint8_t>               mFlags;       //!< The flags of
+                                                     //!< each state.
+    std::vector<std::vector<uint32_t>> mStateGlobs;  //!< The globs whose
+                                                     //!< literal run ends
+                                                     //!< at each state,
+                                                     //!< while compiling.
+    std::vector<uint32_t>              mGlobsBegin;  //!< The offset into
+                                                     //!< @a mGlobsEnding
+                                                     //!< of the globs for
+                                                     //!< each state.
+    std::vector<uint32_t>              mGlobsEnding; //!< The globs whose
+                                                     //!< literal run ends
+                                                     //!< at each state.
+    std::vector<std::string>           mGlobs;       //!< The glob
+                                                     //!< patterns, wrapped
+                                                     //!< to match
+                                                     //!< anywhere.
+    std::vector<uint32_t>              mUnanchored;  //!< The globs without
+                                                     //!< a literal run.
+    bool                               mIsFirst[256]; //!< Whether each
+                                                      //!< byte may begin
+                                                      //!< a match.
+    std::vector<uint8_t>               mFirstBytes;  //!< The bytes that
+                                                     //!< may begin a
+                                                     //!< match, if few
+                                                     //!< enough to
+                                                     //!< compare at once.
+};
+
+const uint32_t Pattern::Implementation::kRoot;
+const uint32_t Pattern::Implementation::kNone;
+const size_t   Pattern::Implementation::kPrefilterBytes;
+
+// Return whether the specified pattern is a glob rather than a
+// literal.
+
+static bool
+IsGlob(const std::string & inPattern)
+{
+    return (inPattern.find_first_of("*?[\\") != std::string::npos);
+}
+
+// Return the longest run of literal bytes in the specified glob, which
+// any string it matches must contain.
+
+static std::string
+GetAnchor(const std::string & inGlob)
+{
+    std::string theAnchor;
+    size_t      theStart = 0;
+    size_t      theIndex = 0;
+
+    while (theIndex <= inGlob.size()) {
+        const char theByte = ((theIndex < inGlob.size()) ? inGlob[theIndex] : '\0');
+
+        if ((theByte != '\0') &&
+            (theByte != '*') && (theByte != '?') &&
+            (theByte != '[') && (theByte != '\\')) {
+            theIndex++;
+            continue;
+        }
+
+        if ((theIndex - theStart) > theAnchor.size()) {
+            theAnchor = inGlob.substr(theStart, theIndex - theStart);
+        }
+
+        // Skip the escaped byte or the bracket expression, either of
+        // which ends the run.
+
+        if ((theByte == '\\') && ((theIndex + 1) < inGlob.size())) {
+            theIndex++;
+
+        } else if (theByte == '[') {
+            theIndex++;
+
+            if ((theIndex < inGlob.size()) &&
+                ((inGlob[theIndex] == '!') || (inGlob[theIndex] == '^'))) {
+                theIndex++;
+            }
+
+            if ((theIndex < inGlob.size()) && (inGlob[theIndex] == ']')) {
+                theIndex++;
+            }
+
+            while ((theIndex < inGlob.size()) && (inGlob[theIndex] != ']')) {
+                theIndex++;
+            }
+        }
+
+        theIndex++;
+        theStart = theIndex;
+    }
+
+    return (theAnchor);
+}
+
+Pattern::
+Implementation::Implementation(Action inAction, const std::vector<std::string> & inPatterns) :
+    mAction(inAction),
+    mPatterns(inPatterns.size()),
+    mMatchesAll(false),
+    mClassCount(1),
+    mTransitions(),
+    mFlags(),
+    mStateGlobs(),
+    mGlobsBegin(),
+    mGlobsEnding(),
+    mGlobs(),
+    mUnanchored(),
+    mFirstBytes()
+{
+    std::vector<std::string> theAnchors;
+    std::vector<uint32_t>    theGlobs;
+
+    memset(mClasses, 0, sizeof (mClasses));
+    memset(mIsFirst, 0, sizeof (mIsFirst));
+
+    // Reduce each pattern to the literal the automaton is to find,
+    // noting which belong to globs to be confirmed.
+
+    for (const std::string & thePattern : inPatterns) {
+        if (!IsGlob(thePattern)) {
+            if (thePattern.empty()) {
+                mMatchesAll = true;
+            } else {
+                theAnchors.push_back(thePattern);
+                theGlobs.push_back(kNone);
+            }
+
+        } else {
+            const uint32_t    theGlob   = static_cast<uint32_t>(mGlobs.size());
+            const std::string theAnchor = GetAnchor(thePattern);
+
+            mGlobs.push_back("*" + thePattern + "*");
+
+            if (theAnchor.empty()) {
+                mUnanchored.push_back(theGlob);
+            } else {
+                theAnchors.push_back(theAnchor);
+                theGlobs.push_back(theGlob);
+            }
+        }
+    }
+
+    // Give each byte that appears in a literal its own class, such
+    // that the transition table is only as wide as the patterns need.
+
+    for (const std::string & theAnchor : theAnchors) {
+        for (const char theByte : theAnchor) {
+            uint8_t & theClass = mClasses[static_cast<unsigned char>(theByte)];
+
+            if (theClass == 0) {
+                theClass = static_cast<uint8_t>(mClassCount++);
+            }
+        }
+    }
+
+    Grow();
+
+    for (size_t theIndex = 0; theIndex < theAnchors.size(); theIndex++) {
+        Add(theAnchors[theIndex], (theGlobs[theIndex] == kNone), theGlobs[theIndex]);
+    }
+
+    Compile();
+}
+
+// Append a state with no transitions, returning it.
+
+uint32_t
+Pattern::
+Implementation::Grow(void)
+{
+    const uint32_t theState = static_cast<uint32_t>(mFlags.size());
+
+    mTransitions.resize(mTransitions.size() + mClassCount, kNone);
+    mFlags.push_back(0);
+    mStateGlobs.push_back(std::vector<uint32_t>());
+
+    return (theState);
+}
+
+// Add the specified literal to the trie, marking its final state as
+// accepting or, for a glob, as needing that glob confirmed.
+
+void
+Pattern::
+Implementation::Add(const std::string & inAnchor, bool inLiteral, uint32_t inGlob)
+{
+    uint32_t theState = kRoot;
+
+    for (const char theByte : inAnchor) {
+        const size_t theEdge = (theState * mClassCount) +
+                               mClasses[static_cast<unsigned char>(theByte)];
+
+        if (mTransitions[theEdge] == kNone) {
+            const uint32_t theNext = Grow();
+
+            mTransitions[theEdge] = theNext;
+        }
+
+        theState = mTransitions[theEdge];
+    }
+
+    if (inLiteral) {
+        mFlags[theState] |= kAccept;
+    } else {
+        mFlags[theState] |= kConfirm;
+        mStateGlobs[theState].push_back(inGlob);
+    }
+}
+
+// Turn the trie into a deterministic automaton: each missing
+// transition is taken from the state's failure state, the longest
+// proper suffix of its path that is also in the trie, and each state
+// inherits what ends at its failure state. States are visited
+// breadth-first, such that failure states are complete first.
+
+void
+Pattern::
+Implementation::Compile(void)
+{
+    std::vector<uint32_t> theFailures(mFlags.size(), kRoot);
+    std::deque<uint32_t>  theQueue;
+    uint32_t              theState;
+
+    for (size_t theClass = 0; theClass < mClassCount; theClass++) {
+        uint32_t & theNext = mTransitions[theClass];
+
+        if (theNext == kNone) {
+            theNext = kRoot;
+        } else {
+            theQueue.push_back(theNext);
+        }
+    }
+
+    while (!theQueue.empty()) {
+        theState = theQueue.front();
+        theQueue.pop_front();
+
+        for (size_t theClass = 0; theClass < mClassCount; theClass++) {
+            uint32_t &     theNext    = mTransitions[(theState * mClassCount) + theClass];
+            const uint32_t theFailure = mTransitions[(theFailures[theState] * mClassCount) + theClass];
+
+            if (theNext == kNone) {
+                theNext = theFailure;
+                continue;
+            }
+
+            theFailures[theNext] = theFailure;
+            mFlags[theNext]     |= mFlags[theFailure];
+            mStateGlobs[theNext].insert(mStateGlobs[theNext].end(),
+                                        mStateGlobs[theFailure].begin(),
+                                        mStateGlobs[theFailure].end());
+
+            theQueue.push_back(theNext);
+        }
+    }
+
+    // Flatten the globs to confirm at each state.
+
+    for (const std::vector<uint32_t> & theGlobs : mStateGlobs) {
+        mGlobsBegin.push_back(static_cast<uint32_t>(mGlobsEnding.size()));
+        mGlobsEnding.insert(mGlobsEnding.end(), theGlobs.begin(), theGlobs.end());
+    }
+
+    mGlobsBegin.push_back(static_cast<uint32_t>(mGlobsEnding.size()));
+    mStateGlobs.clear();
+
+    // Note the bytes that leave the root, which the prefilter skips
+    // to.
+
+    for (unsigned theByte = 1; theByte < 256; theByte++) {
+        if (mTransitions[mClasses[theByte]] != kRoot) {
+            mIsFirst[theByte] = true;
+            mFirstBytes.push_back(static_cast<uint8_t>(theByte));
+        }
+    }
+
+    if (mFirstBytes.size() > kPrefilterBytes) {
+        mFirstBytes.clear();
+    }
+}
+
+// Return whether the specified glob matches the specified message.
+
+bool
+Pattern::
+Implementation::Confirm(uint32_t inGlob, const char * inMessage) const
+{
+    return (fnmatch(mGlobs[inGlob].c_str(), inMessage, 0) == 0);
+}
+
+// Return the first byte, at or after the current one, that may begin
+// a match or, if there is none, the end.
+
+const char *
+Pattern::
+Implementation::Skip(const char * inCurrent, const char * inEnd) const
+{
+#if LOGUTILITIES_HAVE_SSE2
+    if (!mFirstBytes.empty()) {
+        __m128i      theNeedles[kPrefilterBytes];
+        const size_t theCount = mFirstBytes.size();
+
+        for (size_t theIndex = 0; theIndex < theCount; theIndex++) {
+            theNeedles[theIndex] = _mm_set1_epi8(static_cast<char>(mFirstBytes[theIndex]));
+        }
+
+        while ((inEnd - inCurrent) >= 16) {
+            const __m128i theBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inCurrent));
+            __m128i       theHits  = _mm_cmpeq_epi8(theBlock, theNeedles[0]);
+            int           theMask;
+
+            for (size_t theIndex = 1; theIndex < theCount; theIndex++) {
+                theHits = _mm_or_si128(theHits, _mm_cmpeq_epi8(theBlock, theNeedles[theIndex]));
+            }
+
+            theMask = _mm_movemask_epi8(theHits);
+
+            if (theMask != 0) {
+                return (inCurrent + __builtin_ctz(static_cast<unsigned>(theMask)));
+            }
+
+            inCurrent += 16;
+        }
+    }
+#endif // LOGUTILITIES_HAVE_SSE2
+
+    while ((inCurrent < inEnd) && !mIsFirst[static_cast<unsigned char>(*inCurrent)]) {
+        inCurrent++;
+    }
+
+    return (inCurrent);
+}
+
+// Return whether the specified message contains any of the patterns.
+
+bool
+Pattern::
+Implementation::Match(const char * inMessage) const
+{
+    const char * theCurrent;
+    const char * theEnd;
+    uint32_t     theState = kRoot;
+    uint8_t      theFlags;
+
+    if (mMatchesAll) {
+        return (true);
+    }
+
+    for (const uint32_t theGlob : mUnanchored) {
+        if (Confirm(theGlob, inMessage)) {
+            return (true);
+        }
+    }
+
+    if (mFlags.size() == 1) {
+        return (false);
+    }
+
+    theCurrent = inMessage;
+    theEnd     = inMessage + strlen(inMessage);
+
+    while (theCurrent < theEnd) {
+        if (theState == kRoot) {
+            theCurrent = Skip(theCurrent, theEnd);
+
+            if (theCurrent == theEnd) {
+                break;
+            }
+        }
+
+        theState = mTransitions[(theState * mClassCount) +
+                                mClasses[static_cast<unsigned char>(*theCurrent++)]];
+        theFlags = mFlags[theState];
+
+        if (theFlags == 0) {
+            continue;
+
+        } else if ((theFlags & kAccept) != 0) {
+            return (true);
+
+        } else {
+            for (uint32_t theIndex = mGlobsBegin[theState]; theIndex < mGlobsBegin[theState + 1]; theIndex++) {
+                if (Confirm(mGlobsEnding[theIndex], inMessage)) {
+                    return (true);
+                }
+            }
+
+        }
+    }
+
+    return (false);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor compiles the specified patterns.
+ *
+ *  @param[in]  inAction    What becomes of messages that match any
+ *                          of the patterns.
+ *  @param[in]  inPatterns  An immutable reference to the literal and
+ *                          glob patterns to match.
+ *
+ */
+Pattern::Pattern(Action inAction, const std::vector<std::string> & inPatterns) :
+    Base(),
+    mImplementation(new Implementation(inAction, inPatterns))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *    The copy shares the compiled patterns of the original.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        copy.
+ *
+ */
+Pattern::Pattern(const Pattern & inFilter) :
+    Base(),
+    mImplementation(inFilter.mImplementation)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Pattern::~Pattern(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class assignment operator.
+ *
+ *    The filter shares the compiled patterns of the assigned filter
+ *    thereafter.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        assign.
+ *
+ *  @returns
+ *    A reference to this filter.
+ *
+ */
+Pattern &
+Pattern::operator =(const Pattern & inFilter)
+{
+    mImplementation = inFilter.mImplementation;
+
+    return (*this);
+}
+
+/**
+ *  @brief
+ *    Return what becomes of messages that match any of the patterns.
+ *
+ */
+Pattern::Action
+Pattern::GetAction(void) const
+{
+    return (mImplementation->mAction);
+}
+
+/**
+ *  @brief
+ *    Return the number of patterns.
+ *
+ */
+size_t
+Pattern::GetPatterns(void) const
+{
+    return (mImplementation->mPatterns);
+}
+
+/**
+ *  @brief
+ *    Return whether the specified message contains any of the
+ *    patterns.
+ *
+ *  @param[in]  inMessage  A pointer to the null-terminated message
+ *                         to search.
+ *
+ *  @returns
+ *    True if any pattern matches the message; otherwise, false.
+ *
+ */
+bool
+Pattern::Match(const char * inMessage) const
+{
+    return (mImplementation->Match(inMessage));
+}
+
+/**
+ *  @brief
+ *    Pass a message based on the specified level alone.
+ *
+ *  @param[in]  inLevel  The level of the message, which is ignored.
+ *
+ *  @returns
+ *    True, since matches are only known from the message content.
+ *
+ */
+bool
+Pattern::Allow(Log::Level inLevel)
+{
+    (void)inLevel;
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Pass or reject a message based on whether it matches any of the
+ *    patterns.
+ *
+ *  @param[in]  inLevel    The level the current message is to be
+ *                         logged at.
+ *  @param[in]  inMessage  The log message to be filtered.
+ *
+ *  @returns
+ *    True if the message should be passed; otherwise, false.
+ *
+ */
+bool
+Pattern::Allow(Log::Level inLevel, const char * inMessage)
+{
+    return (AllowMessage(inLevel, inMessage));
+}
+
+/**
+ *  @brief
+ *    Pass or reject a message based on whether it matches any of the
+ *    patterns.
+ *
+ *  @param[in]  inLevel    The level the current message is to be
+ *                         logged at, which is ignored.
+ *  @param[in]  inMessage  The log message to be filtered.
+ *
+ *  @returns
+ *    True if the message should be passed; otherwise, false.
+ *
+ */
+bool
+Pattern::AllowMessage(Log::Level inLevel, const char * inMessage)
+{
+    const bool theMatch = Match(inMessage);
+
+    (void)inLevel;
+
+    return ((mImplementation->mAction == Action::kPass) ? theMatch : !theMatch);
+}
+
+}; // namespace Filter
+
+}; // namespace Log
+
+}; // namespace Nuovations
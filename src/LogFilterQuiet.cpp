@@ -69,6 +69,21 @@ Quiet::Quiet(bool inQuiet) :
     return;
 }
 
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter whose
+ *                        quiet state is to be copied.
+ *
+ */
+Quiet::Quiet(const Quiet & inFilter) :
+    Base(),
+    mQuiet(inFilter.GetQuiet())
+{
+    return;
+}
+
 /**
  *  @brief
  *    This is the class destructor.
@@ -90,7 +105,7 @@ Quiet::~Quiet(void)
 bool
 Quiet::GetQuiet(void) const
 {
-    return (mQuiet);
+    return (mQuiet.load(std::memory_order_relaxed));
 }
 
 /**
@@ -109,54 +124,28 @@ Quiet::GetQuiet(void) const
 void
 Quiet::SetQuiet(bool inQuiet)
 {
-    mQuiet = inQuiet;
-}
-
-/**
- *  @brief
- *    Pass or reject a message based on the specified level (unused)
- *    and the current quiet state of the filter.
- *
- *    When the quiet state is asserted, messages are rejected; otherwise,
- *    they are passed.
- *
- *  @param[in]  inLevel  The level the current message is to be logged at.
- *
- *  @returns
- *    True if the log message should be passed; otherwise, false, if
- *    the message should be rejected based on the current quiet state of
- *    the filter.
- */
-bool
-Quiet::Allow(Log::Level inLevel)
-{
-    (void)inLevel;
+    mQuiet.store(inQuiet, std::memory_order_relaxed);
 
-    return (!mQuiet);
+    Invalidate();
 }
 
 /**
  *  @brief
- *    Pass or reject a message based on the specified level, the
- *    message to be logged, and the current quiet state of the filter.
+ *    This is the class assignment operator.
  *
- *    When the quiet state is asserted, messages are rejected; otherwise,
- *    they are passed.
- *
- *  @param[in]  inLevel    The level the current message is to be logged at.
- *  @param[in]  inMessage  The log message to be filtered.
+ *  @param[in]  inFilter  An immutable reference to the filter whose
+ *                        quiet state is to be assigned.
  *
  *  @returns
- *    True if the log message should be passed; otherwise, false, if
- *    the message should be rejected based on the current quiet state of
- *    the filter.
+ *    A reference to this filter.
+ *
  */
-bool
-Quiet::Allow(Log::Level inLevel, const char * inMessage)
+Quiet &
+Quiet::operator =(const Quiet & inFilter)
 {
-    (void)inMessage;
+    SetQuiet(inFilter.GetQuiet());
 
-    return (Allow(inLevel));
+    return (*this);
 }
 
 }; // namespace Filter
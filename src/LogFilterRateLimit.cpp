@@ -0,0 +1,655 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete filter
+ *      implementation that limits the rate of logged messages with
+ *      per-key token buckets.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <LogUtilities/LogCallSite.hpp>
+#include <LogUtilities/LogClockMonotonic.hpp>
+#include <LogUtilities/LogFilterRateLimit.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Filter
+{
+
+const size_t RateLimit::kBuckets;
+
+static const Clock::Ticks kNanosecondsPerSecond = 1000000000;
+static const size_t       kCacheLineSize        = 64;
+
+/**
+ * Implementation of the @a Log::Filter::RateLimit object.
+ *
+ * @private
+ */
+struct RateLimit::Implementation
+{
+    /**
+     * A token bucket, tracked as the theoretical arrival time of the
+     * next message: the bucket is full once the clock reaches it and
+     * each message passed advances it by one interval.
+     */
+    struct Bucket
+    {
+        Bucket(void);
+
+        std::atomic<uint64_t>     mKey;        //!< The key the bucket
+                                               //!< is claimed by or
+                                               //!< zero if it is
+                                               //!< unclaimed.
+        std::atomic<Clock::Ticks> mArrival;    //!< The theoretical
+                                               //!< arrival time of the
+                                               //!< next message.
+        std::atomic<uint64_t>     mSuppressed; //!< The number of
+                                               //!< messages suppressed
+                                               //!< since one was last
+                                               //!< passed.
+        char                      mPadding[kCacheLineSize -
+                                           sizeof (std::atomic<uint64_t>) -
+                                           sizeof (std::atomic<Clock::Ticks>) -
+                                           sizeof (std::atomic<uint64_t>)];
+                                               //!< Padding that keeps
+                                               //!< buckets from
+                                               //!< sharing a cache
+                                               //!< line.
+    };
+
+    Implementation(Key                 inKey,
+                   Clock::Ticks        inInterval,
+                   uint32_t            inBurst,
+                   Writer::Base *      inSummaryWriter,
+                   const Clock::Base & inClock);
+
+    bool Allow(Log::Level inLevel, const char * inFormat);
+
+    void Summarize(Log::Level       inLevel,
+                   const void *     inKey,
+                   const CallSite * inCallSite,
+                   const char *     inFormat,
+                   uint64_t         inSuppressed);
+
+    static Bucket * Claim(Bucket * inBuckets, uint64_t inKey, size_t inIndex);
+
+    const Key             mKey;            //!< What messages are
+                                           //!< limited together by.
+    const Clock::Ticks    mInterval;       //!< The clock ticks per
+                                           //!< message at the
+                                           //!< sustained rate.
+    const uint32_t        mBurst;          //!< The number of messages
+                                           //!< that may be passed at
+                                           //!< once.
+    const Clock::Ticks    mTolerance;      //!< How far ahead of the
+                                           //!< clock a bucket's arrival
+                                           //!< time may be for a
+                                           //!< message to pass.
+    Writer::Base * const  mSummaryWriter;  //!< The writer summaries
+                                           //!< are written to, if any.
+    const Clock::Base &   mClock;          //!< The clock the buckets
+                                           //!< are timed by.
+    std::atomic<uint64_t> mSuppressed;     //!< The number of messages
+                                           //!< suppressed in total.
+    Bucket                mKeyBuckets[kBuckets];   //!< The token buckets
+                                                   //!< of call sites or
+                                                   //!< formats, probed
+                                                   //!< from their hash.
+    Bucket                mLevelBuckets[kBuckets]; //!< The token buckets
+                                                   //!< of levels, probed
+                                                   //!< from the level.
+};
+
+// Return the clock filters limited to a rate per second are timed
+// by, whose ticks are nanoseconds.
+
+static const Clock::Base &
+GetSecondsClock(void)
+{
+    static const Clock::Monotonic sClock;
+
+    return (sClock);
+}
+
+// Return the clock ticks per message at the specified rate per
+// second.
+
+static Clock::Ticks
+GetSecondsInterval(uint32_t inRate)
+{
+    return (kNanosecondsPerSecond / std::max<uint32_t>(inRate, 1));
+}
+
+RateLimit::
+Implementation::Bucket::Bucket(void) :
+    mKey(0),
+    mArrival(std::numeric_limits<Clock::Ticks>::min()),
+    mSuppressed(0)
+{
+    return;
+}
+
+RateLimit::
+Implementation::Implementation(Key                 inKey,
+                               Clock::Ticks        inInterval,
+                               uint32_t            inBurst,
+                               Writer::Base *      inSummaryWriter,
+                               const Clock::Base & inClock) :
+    mKey(inKey),
+    mInterval(std::max<Clock::Ticks>(inInterval, 1)),
+    mBurst(std::max<uint32_t>(inBurst, 1)),
+    mTolerance(mInterval * (mBurst - 1)),
+    mSummaryWriter(inSummaryWriter),
+    mClock(inClock),
+    mSuppressed(0),
+    mKeyBuckets(),
+    mLevelBuckets()
+{
+    return;
+}
+
+// Return the key of a message with the specified call site and
+// format, either of which may be unknown, or null if the message is
+// to be keyed by level instead.
+
+static const void *
+SelectKey(RateLimit::Key inKey, const CallSite * inCallSite, const char * inFormat)
+{
+    switch (inKey) {
+
+    case RateLimit::Key::kLevel:
+        break;
+
+    case RateLimit::Key::kFormat:
+        if (inFormat != nullptr) {
+            return (inFormat);
+        } else if (inCallSite != nullptr) {
+            return (inCallSite->GetFormat());
+        }
+        break;
+
+    case RateLimit::Key::kCallSite:
+        return (inCallSite);
+
+    }
+
+    return (nullptr);
+}
+
+// Consume from the bucket for the message being written at the
+// specified level and with the specified format, if known, returning
+// whether the message is passed.
+
+bool
+RateLimit::
+Implementation::Allow(Log::Level inLevel, const char * inFormat)
+{
+    static const uint64_t  kMultiplier = 0x9E3779B97F4A7C15ULL;
+    const CallSite * const theCallSite = CallSite::GetCurrent();
+    const void *           theKey      = SelectKey(mKey, theCallSite, inFormat);
+    Bucket *               theBucket   = nullptr;
+    const Clock::Ticks     theNow      = mClock.Now();
+    Clock::Ticks           theArrival;
+    Clock::Ticks           theNext;
+    uint64_t               theSuppressed;
+
+    // Find the bucket claimed by the key of the message, falling back
+    // to its level once every bucket is claimed by another key.
+
+    if (theKey != nullptr) {
+        theBucket = Claim(mKeyBuckets,
+                          reinterpret_cast<uintptr_t>(theKey),
+                          ((reinterpret_cast<uintptr_t>(theKey) * kMultiplier) >> 32) % kBuckets);
+
+        if (theBucket == nullptr) {
+            theKey = nullptr;
+        }
+    }
+
+    if (theBucket == nullptr) {
+        theBucket = Claim(mLevelBuckets, static_cast<uint64_t>(inLevel) + 1, inLevel % kBuckets);
+    }
+
+    // Beyond as many levels as there are buckets, levels share them.
+
+    if (theBucket == nullptr) {
+        theBucket = &mLevelBuckets[inLevel % kBuckets];
+    }
+
+    theArrival = theBucket->mArrival.load(std::memory_order_relaxed);
+
+    do {
+        theNext = std::max(theArrival, theNow);
+
+        if ((theNext - theNow) > mTolerance) {
+            theBucket->mSuppressed.fetch_add(1, std::memory_order_relaxed);
+            mSuppressed.fetch_add(1, std::memory_order_relaxed);
+
+            return (false);
+        }
+    } while (!theBucket->mArrival.compare_exchange_weak(theArrival,
+                                                        theNext + mInterval,
+                                                        std::memory_order_relaxed));
+
+    // The key has recovered. Only when messages were suppressed
+    // does this pay for claiming their count.
+
+    if (theBucket->mSuppressed.load(std::memory_order_relaxed) != 0) {
+        theSuppressed = theBucket->mSuppressed.exchange(0, std::memory_order_relaxed);
+
+        if (theSuppressed != 0) {
+            Summarize(inLevel, theKey, theCallSite, inFormat, theSuppressed);
+        }
+    }
+
+    return (true);
+}
+
+// Return the bucket claimed by the specified, non-zero key, probing
+// linearly from the specified index and claiming the first unclaimed
+// bucket if none is, or null if every bucket is claimed by another
+// key. Buckets, once claimed, are never released.
+
+RateLimit::Implementation::Bucket *
+RateLimit::
+Implementation::Claim(Bucket * inBuckets, uint64_t inKey, size_t inIndex)
+{
+    Bucket * theBucket;
+    uint64_t theKey;
+
+    for (size_t theProbe = 0; theProbe < kBuckets; theProbe++) {
+        theBucket = &inBuckets[(inIndex + theProbe) % kBuckets];
+        theKey    = theBucket->mKey.load(std::memory_order_relaxed);
+
+        if ((theKey == 0) &&
+            theBucket->mKey.compare_exchange_strong(theKey,
+                                                    inKey,
+                                                    std::memory_order_relaxed)) {
+            return (theBucket);
+        }
+
+        // Either the bucket was already claimed or another thread
+        // has just claimed it, possibly for the same key.
+
+        if (theKey == inKey) {
+            return (theBucket);
+        }
+    }
+
+    return (nullptr);
+}
+
+// Write a summary of the messages suppressed for the key, or the
+// level if the key is null, of a message about to be passed at the
+// specified level, call site, and format.
+
+void
+RateLimit::
+Implementation::Summarize(Log::Level       inLevel,
+                          const void *     inKey,
+                          const CallSite * inCallSite,
+                          const char *     inFormat,
+                          uint64_t         inSuppressed)
+{
+    static const int kFormatLengthMaximum = 128;
+    char             theSummary[256];
+
+    if (mSummaryWriter == nullptr) {
+        return;
+    }
+
+    if (inKey == nullptr) {
+        snprintf(theSummary, sizeof (theSummary),
+                 "%llu messages suppressed at level %u\n",
+                 static_cast<unsigned long long>(inSuppressed),
+                 inLevel);
+    } else if ((mKey == Key::kFormat) && (inFormat != nullptr)) {
+        snprintf(theSummary, sizeof (theSummary),
+                 "%llu messages suppressed like \"%.*s\"\n",
+                 static_cast<unsigned long long>(inSuppressed),
+                 std::min(static_cast<int>(strcspn(inFormat, "\n")), kFormatLengthMaximum),
+                 inFormat);
+    } else {
+        snprintf(theSummary, sizeof (theSummary),
+                 "%llu messages suppressed from %s:%u\n",
+                 static_cast<unsigned long long>(inSuppressed),
+                 inCallSite->GetFile(),
+                 inCallSite->GetLine());
+    }
+
+    mSummaryWriter->Write(inLevel, theSummary);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates a rate limit filter, without a
+ *    summary writer, that passes messages for each key at the
+ *    specified rate per second after an initial burst.
+ *
+ *  @param[in]  inKey    What messages are limited together by.
+ *  @param[in]  inRate   The number of messages per second passed for
+ *                       each key at the sustained rate. Zero is
+ *                       treated as one.
+ *  @param[in]  inBurst  The number of messages that may be passed
+ *                       at once for each key. Zero is treated as
+ *                       one.
+ *
+ */
+RateLimit::RateLimit(Key inKey, uint32_t inRate, uint32_t inBurst) :
+    Base(),
+    mImplementation(new Implementation(inKey,
+                                       GetSecondsInterval(inRate),
+                                       inBurst,
+                                       nullptr,
+                                       GetSecondsClock()))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates a rate limit filter that passes
+ *    messages for each key at the specified rate per second after
+ *    an initial burst, summarizing suppressed messages to the
+ *    specified writer.
+ *
+ *  @param[in]  inKey            What messages are limited together by.
+ *  @param[in]  inRate           The number of messages per second
+ *                               passed for each key at the sustained
+ *                               rate. Zero is treated as one.
+ *  @param[in]  inBurst          The number of messages that may be
+ *                               passed at once for each key. Zero is
+ *                               treated as one.
+ *  @param[in]  inSummaryWriter  A reference to the writer that
+ *                               summaries of suppressed messages are
+ *                               written to. It must outlive the filter.
+ *
+ */
+RateLimit::RateLimit(Key            inKey,
+                     uint32_t       inRate,
+                     uint32_t       inBurst,
+                     Writer::Base & inSummaryWriter) :
+    Base(),
+    mImplementation(new Implementation(inKey,
+                                       GetSecondsInterval(inRate),
+                                       inBurst,
+                                       &inSummaryWriter,
+                                       GetSecondsClock()))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates a rate limit filter, timed by the
+ *    specified clock, that passes one message for each key every
+ *    interval after an initial burst.
+ *
+ *  @param[in]  inKey            What messages are limited together by.
+ *  @param[in]  inInterval       The number of clock ticks per message
+ *                               passed for each key at the sustained
+ *                               rate.
+ *  @param[in]  inBurst          The number of messages that may be
+ *                               passed at once for each key. Zero is
+ *                               treated as one.
+ *  @param[in]  inSummaryWriter  A pointer to the writer that summaries
+ *                               of suppressed messages are written to
+ *                               or null for none. It must outlive the
+ *                               filter.
+ *  @param[in]  inClock          A reference to the clock the buckets
+ *                               are timed by. It must outlive the
+ *                               filter.
+ *
+ */
+RateLimit::RateLimit(Key                 inKey,
+                     Clock::Ticks        inInterval,
+                     uint32_t            inBurst,
+                     Writer::Base *      inSummaryWriter,
+                     const Clock::Base & inClock) :
+    Base(),
+    mImplementation(new Implementation(inKey,
+                                       inInterval,
+                                       inBurst,
+                                       inSummaryWriter,
+                                       inClock))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *    The copy shares the buckets and counters of the original.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        copy.
+ *
+ */
+RateLimit::RateLimit(const RateLimit & inFilter) :
+    Base(),
+    mImplementation(inFilter.mImplementation)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+RateLimit::~RateLimit(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class assignment operator.
+ *
+ *    The filter shares the buckets and counters of the assigned
+ *    filter thereafter.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        assign.
+ *
+ *  @returns
+ *    A reference to this filter.
+ *
+ */
+RateLimit &
+RateLimit::operator =(const RateLimit & inFilter)
+{
+    mImplementation = inFilter.mImplementation;
+
+    return (*this);
+}
+
+/**
+ *  @brief
+ *    Return what messages are limited together by.
+ *
+ */
+RateLimit::Key
+RateLimit::GetKey(void) const
+{
+    return (mImplementation->mKey);
+}
+
+/**
+ *  @brief
+ *    Return the number of clock ticks per message passed for each
+ *    key at the sustained rate.
+ *
+ */
+Clock::Ticks
+RateLimit::GetInterval(void) const
+{
+    return (mImplementation->mInterval);
+}
+
+/**
+ *  @brief
+ *    Return the number of messages that may be passed at once for
+ *    each key.
+ *
+ */
+uint32_t
+RateLimit::GetBurst(void) const
+{
+    return (mImplementation->mBurst);
+}
+
+/**
+ *  @brief
+ *    Return the number of messages suppressed, across all keys,
+ *    since the filter was instantiated.
+ *
+ */
+uint64_t
+RateLimit::GetSuppressed(void) const
+{
+    return (mImplementation->mSuppressed.load(std::memory_order_relaxed));
+}
+
+/**
+ *  @brief
+ *    Determine whether to pass or reject a message on its level.
+ *
+ *  Nothing is consumed on level alone, which defers to #AllowFormat,
+ *  consulted once every other filter has passed the message on its
+ *  level.
+ *
+ *  @param[in]  inLevel  The level of the message to pass or reject.
+ *
+ *  @returns
+ *    True, always.
+ *
+ */
+bool
+RateLimit::Allow(Log::Level inLevel)
+{
+    (void)inLevel;
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Determine whether to pass or reject a message.
+ *
+ *  Passing a message consumes from the bucket for its key. Loggers
+ *  do not call this, since the filter needs no message content (see
+ *  #NeedsMessage); it serves callers that filter whole messages at
+ *  once.
+ *
+ *  @param[in]  inLevel    The level of the message to pass or reject.
+ *  @param[in]  inMessage  The message to pass or reject, which is
+ *                         ignored.
+ *
+ *  @returns
+ *    True if the bucket for the key of the message had room;
+ *    otherwise, false.
+ *
+ */
+bool
+RateLimit::Allow(Log::Level inLevel, const char * inMessage)
+{
+    (void)inMessage;
+
+    return (mImplementation->Allow(inLevel, nullptr));
+}
+
+/**
+ *  @brief
+ *    Return whether the filter needs the format string of a message
+ *    to pass or reject it.
+ *
+ *  @returns
+ *    True, since the filter consumes from its buckets in the format
+ *    phase, whatever its key.
+ *
+ */
+bool
+RateLimit::NeedsFormat(void) const
+{
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Return whether the filter must be consulted on the format string
+ *    of a message after every other filter it is chained with.
+ *
+ *  @returns
+ *    True, since passing a message consumes from its bucket.
+ *
+ */
+bool
+RateLimit::NeedsLast(void) const
+{
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Determine whether to pass or reject a message, before it is
+ *    formatted, based on its key.
+ *
+ *  Passing a message consumes from the bucket for its key, which is
+ *  its format string only when keyed by format.
+ *
+ *  @param[in]  inLevel   The level of the message to pass or reject.
+ *  @param[in]  inFormat  The printf-style format string of the
+ *                        message to pass or reject.
+ *
+ *  @returns
+ *    True if the bucket for the key of the message had room;
+ *    otherwise, false.
+ *
+ */
+bool
+RateLimit::AllowFormat(Log::Level inLevel, const char * inFormat)
+{
+    return (mImplementation->Allow(inLevel, inFormat));
+}
+
+}; // namespace Filter
+
+}; // namespace Log
+
+}; // namespace Nuovations
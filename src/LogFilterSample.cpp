@@ -0,0 +1,196 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete filter
+ *      implementation that passes a sample of logged messages.
+ */
+
+#include <algorithm>
+
+#include <LogUtilities/LogFilterSample.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Filter
+{
+
+const uint64_t Sample::kRequestNone;
+
+thread_local uint64_t Sample::sRequest = Sample::kRequestNone;
+thread_local uint64_t Sample::sState   = 0;
+
+static const Log::Level kLevelDefault = 0;
+
+// Return the value below which the upper half of a uniformly
+// distributed 64-bit value falls with a probability of one in the
+// specified period.
+
+static uint64_t
+GetThreshold(uint32_t inPeriod)
+{
+    return ((UINT64_C(1) << 32) / inPeriod);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates a sample filter instance that
+ *    samples messages at all levels.
+ *
+ *  @param[in]  inMode    How the messages passed are chosen.
+ *  @param[in]  inPeriod  The number of messages, or requests, for
+ *                        each one passed. Zero is treated as one,
+ *                        passing all messages.
+ *
+ */
+Sample::Sample(Mode inMode, uint32_t inPeriod) :
+    Sample(inMode, inPeriod, kLevelDefault)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates a sample filter instance that
+ *    samples messages at or above the specified level and passes
+ *    those below it.
+ *
+ *  @param[in]  inMode    How the messages passed are chosen.
+ *  @param[in]  inPeriod  The number of messages, or requests, for
+ *                        each one passed. Zero is treated as one,
+ *                        passing all messages.
+ *  @param[in]  inLevel   The level at or above which messages are
+ *                        sampled.
+ *
+ */
+Sample::Sample(Mode inMode, uint32_t inPeriod, Log::Level inLevel) :
+    Base(),
+    mMode(inMode),
+    mPeriod(std::max<uint32_t>(inPeriod, 1)),
+    mThreshold(GetThreshold(mPeriod)),
+    mLevel(inLevel),
+    mCount(0)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *    The copy samples as the original does, counting afresh.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        copy.
+ *
+ */
+Sample::Sample(const Sample & inFilter) :
+    Base(),
+    mMode(inFilter.mMode),
+    mPeriod(inFilter.mPeriod),
+    mThreshold(inFilter.mThreshold),
+    mLevel(inFilter.mLevel),
+    mCount(0)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Sample::~Sample(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class assignment operator.
+ *
+ *    The filter samples as the assigned filter does thereafter,
+ *    counting afresh.
+ *
+ *  @param[in]  inFilter  An immutable reference to the filter to
+ *                        assign.
+ *
+ *  @returns
+ *    A reference to this filter.
+ *
+ */
+Sample &
+Sample::operator =(const Sample & inFilter)
+{
+    mMode      = inFilter.mMode;
+    mPeriod    = inFilter.mPeriod;
+    mThreshold = inFilter.mThreshold;
+    mLevel     = inFilter.mLevel;
+
+    mCount.store(0, std::memory_order_relaxed);
+
+    return (*this);
+}
+
+/**
+ *  @brief
+ *    Return how the messages passed are chosen.
+ *
+ */
+Sample::Mode
+Sample::GetMode(void) const
+{
+    return (mMode);
+}
+
+/**
+ *  @brief
+ *    Return the number of messages, or requests, for each one
+ *    passed.
+ *
+ */
+uint32_t
+Sample::GetPeriod(void) const
+{
+    return (mPeriod);
+}
+
+/**
+ *  @brief
+ *    Return the level at or above which messages are sampled.
+ *
+ */
+Log::Level
+Sample::GetLevel(void) const
+{
+    return (mLevel);
+}
+
+}; // namespace Filter
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -0,0 +1,327 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Nuovations Log Utilities run-time parsing
+ *      of, and output conversion against, printf-style format
+ *      strings.
+ */
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+using namespace std;
+
+#include <LogUtilities/LogFormatString.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace FormatString
+{
+
+// Parse a decimal number at the cursor, advancing past it.
+
+static int
+ParseNumber(const char *& inCursor)
+{
+    int theNumber = 0;
+
+    while (IsDigit(*inCursor)) {
+        theNumber = (theNumber * 10) + (*inCursor - '0');
+        inCursor++;
+    }
+
+    return (theNumber);
+}
+
+// Parse an optional positional argument reference ("n$") at the
+// cursor, advancing past it, returning the zero-based argument index
+// or -1 if there is none.
+
+static int
+ParsePosition(const char *& inCursor)
+{
+    const char * theCursor = inCursor;
+    const int    theNumber = ParseNumber(theCursor);
+
+    if ((theCursor != inCursor) && (*theCursor == '$') && (theNumber > 0)) {
+        inCursor = theCursor + 1;
+
+        return (theNumber - 1);
+    }
+
+    return (-1);
+}
+
+// Parse a single flag character into the directive, returning
+// whether it was one.
+
+static bool
+ParseFlag(char inFlag, Directive & inDirective)
+{
+    switch (inFlag) {
+
+    case '-':
+        inDirective.mLeft = true;
+        break;
+
+    case '+':
+        inDirective.mSign = true;
+        break;
+
+    case ' ':
+        inDirective.mSpace = true;
+        break;
+
+    case '#':
+        inDirective.mAlternate = true;
+        break;
+
+    case '0':
+        inDirective.mZero = true;
+        break;
+
+    case '\'':
+    case 'I':
+        inDirective.mGrouping = true;
+        break;
+
+    default:
+        return (false);
+
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Parse the conversion directive at the specified position in a
+ *    printf-style format string.
+ *
+ *  Any directive that is terminated by a conversion specifier is
+ *  parsed, whether or not the specifier is known; the kind of an
+ *  unknown one is Kind::kInvalid. Callers decide for themselves what
+ *  to do with such directives and with positional arguments.
+ *
+ *  @param[in]   inPercent     A pointer to the '%' introducing the
+ *                             directive.
+ *  @param[out]  outDirective  The parsed directive.
+ *
+ *  @returns
+ *    True if the directive was parsed; otherwise, false if the
+ *    format string ends before its conversion specifier.
+ *
+ */
+bool
+Parse(const char * inPercent, Directive & outDirective)
+{
+    const char * theCursor = inPercent + 1;
+
+    memset(&outDirective, 0, sizeof (outDirective));
+
+    outDirective.mPosition          = -1;
+    outDirective.mWidthPosition     = -1;
+    outDirective.mWidth             = -1;
+    outDirective.mPrecisionPosition = -1;
+    outDirective.mPrecision         = -1;
+
+    if (*theCursor == '%') {
+        outDirective.mSize       = 2;
+        outDirective.mConversion = '%';
+        outDirective.mKind       = Kind::kPercent;
+
+        return (true);
+    }
+
+    outDirective.mPosition = ParsePosition(theCursor);
+
+    // Flags
+
+    while (ParseFlag(*theCursor, outDirective)) {
+        theCursor++;
+    }
+
+    // Width
+
+    if (*theCursor == '*') {
+        theCursor++;
+
+        outDirective.mWidthStar     = true;
+        outDirective.mWidthPosition = ParsePosition(theCursor);
+
+    } else if (IsDigit(*theCursor)) {
+        outDirective.mWidth = ParseNumber(theCursor);
+
+    }
+
+    // Precision
+
+    if (*theCursor == '.') {
+        theCursor++;
+
+        if (*theCursor == '*') {
+            theCursor++;
+
+            outDirective.mPrecisionStar     = true;
+            outDirective.mPrecisionPosition = ParsePosition(theCursor);
+
+        } else {
+            outDirective.mPrecision = ParseNumber(theCursor);
+
+        }
+    }
+
+    // Length modifier
+
+    if (IsLength(*theCursor)) {
+        outDirective.mLength[0] = *theCursor++;
+
+        if (((outDirective.mLength[0] == 'h') || (outDirective.mLength[0] == 'l')) &&
+            (*theCursor == outDirective.mLength[0])) {
+            outDirective.mLength[1] = *theCursor++;
+        }
+    }
+
+    // Conversion
+
+    if (*theCursor == '\0') {
+        return (false);
+    }
+
+    outDirective.mConversion = *theCursor++;
+    outDirective.mSize       = static_cast<size_t>(theCursor - inPercent);
+    outDirective.mKind       = Classify(outDirective.mLength[0],
+                                        outDirective.mLength[1],
+                                        outDirective.mConversion);
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Perform output format conversion based on the specified
+ *    printf-style format string and the variadic argument list,
+ *    appending the result to the provided message.
+ *
+ *  @param[in,out]  inMessage  A reference to the message to append
+ *                             the formatted output to.
+ *  @param[in]      inFormat   A printf-style format string composed
+ *                             of zero or more output conversion
+ *                             directives.
+ *  @param[in]      ...        A variadic argument list, where each
+ *                             argument corresponds with its peer
+ *                             output conversion directive in @a
+ *                             inFormat.
+ *
+ */
+void
+Append(string & inMessage, const char * inFormat, ...)
+{
+    va_list theList;
+
+    va_start(theList, inFormat);
+
+    Append(inMessage, inFormat, theList);
+
+    va_end(theList);
+}
+
+/**
+ *  @brief
+ *    Perform output format conversion based on the specified
+ *    printf-style format string and the variable argument list,
+ *    appending the result to the provided message.
+ *
+ *  The conversion is first attempted directly into the unused
+ *  capacity of @a inMessage and is only repeated, after growing
+ *  the message, when that capacity was insufficient.
+ *
+ *  @param[in,out]  inMessage  A reference to the message to append
+ *                             the formatted output to.
+ *  @param[in]      inFormat   A printf-style format string composed
+ *                             of zero or more output conversion
+ *                             directives.
+ *  @param[in]      inList     A variable argument list, where each
+ *                             argument corresponds with its peer
+ *                             output conversion directive in @a
+ *                             inFormat.
+ *
+ */
+void
+Append(string & inMessage, const char * inFormat, std::va_list inList)
+{
+    const size_t theOffset = inMessage.size();
+    size_t       theAvailable;
+    va_list      theList;
+    int          status;
+
+    // Expose whatever capacity the message already has and try to
+    // format into it.
+
+    inMessage.resize(inMessage.capacity());
+
+    theAvailable = inMessage.size() - theOffset;
+
+    va_copy(theList, inList);
+
+    status = vsnprintf(&inMessage[0] + theOffset, theAvailable, inFormat, theList);
+
+    va_end(theList);
+
+    if (status < 0) {
+        inMessage.resize(theOffset);
+        return;
+    }
+
+    // If the output was truncated, grow the message to fit, with
+    // room for the null terminator vsnprintf insists on writing, and
+    // try again.
+
+    if (static_cast<size_t>(status) >= theAvailable) {
+        inMessage.resize(theOffset + static_cast<size_t>(status) + 1);
+
+        va_copy(theList, inList);
+
+        status = vsnprintf(&inMessage[0] + theOffset,
+                           static_cast<size_t>(status) + 1,
+                           inFormat,
+                           theList);
+
+        va_end(theList);
+
+        if (status < 0) {
+            inMessage.resize(theOffset);
+            return;
+        }
+    }
+
+    inMessage.resize(theOffset + static_cast<size_t>(status));
+}
+
+}; // namespace FormatString
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -23,6 +23,13 @@
 
 #include <LogUtilities/LogFormatterBase.hpp>
 
+#include <string>
+
+using namespace std;
+
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogValues.hpp>
+
 namespace Nuovations
 {
 
@@ -52,6 +59,135 @@ Base::~Base(void)
     return;
 }
 
+/**
+ *  @brief
+ *    Performs output format conversion on a log message at the
+ *    indicated level based on the specified printf-style format
+ *    string and the variable argument list, placing the result in
+ *    the caller-provided buffer.
+ *
+ *  This default implementation defers to the string-returning
+ *  interface. Concrete formatters should override it to format
+ *  directly into @a outMessage such that its existing capacity is
+ *  reused rather than allocating a new string for each message.
+ *
+ *  @param[out]  outMessage  A reference to the buffer to replace
+ *                           with the formatted output message.
+ *  @param[in]   inLevel     The level the current message is to be
+ *                           logged at.
+ *  @param[in]   inFormat    The log message, consisting of a
+ *                           printf-style format string composed of
+ *                           zero or more output conversion
+ *                           directives.
+ *  @param[in]   inList      A variable argument list, where each
+ *                           argument corresponds with its peer
+ *                           output conversion directive in @a
+ *                           inFormat.
+ *
+ */
+void
+Base::Format(std::string & outMessage,
+             Level         inLevel,
+             const char *  inFormat,
+             std::va_list  inList)
+{
+    outMessage = Format(inLevel, inFormat, inList);
+}
+
+/**
+ *  @brief
+ *    Performs output format conversion on a log message at the
+ *    indicated level based on the specified printf-style format
+ *    string and arguments previously captured against it, placing
+ *    the result in the caller-provided buffer.
+ *
+ *  This default implementation renders the captured arguments and
+ *  passes the result through the variadic interface as a single
+ *  string. Concrete formatters should override it to render
+ *  directly into @a outMessage.
+ *
+ *  @note
+ *    The variadic interface receives a format of "%s", not @a
+ *    inFormat, so formatters that depend on the format string must
+ *    override this.
+ *
+ *  @param[out]  outMessage   A reference to the buffer to replace
+ *                            with the formatted output message.
+ *  @param[in]   inLevel      The level the current message is to be
+ *                            logged at.
+ *  @param[in]   inFormat     The log message, consisting of a
+ *                            printf-style format string composed of
+ *                            zero or more output conversion
+ *                            directives.
+ *  @param[in]   inArguments  The arguments captured against @a
+ *                            inFormat.
+ *
+ */
+void
+Base::Format(std::string &     outMessage,
+             Level             inLevel,
+             const char *      inFormat,
+             const Arguments & inArguments)
+{
+    string theRendered;
+
+    if (inFormat == NULL) {
+        outMessage.clear();
+        return;
+    }
+
+    inArguments.Render(theRendered, inFormat);
+
+    outMessage = Format(inLevel, "%s", theRendered.c_str());
+}
+
+/**
+ *  @brief
+ *    Performs output format conversion on a log message at the
+ *    indicated level based on the specified printf-style format
+ *    string and typed arguments, placing the result in the
+ *    caller-provided buffer.
+ *
+ *  This default implementation renders the typed arguments and
+ *  passes the result through the variadic interface as a single
+ *  string. Concrete formatters should override it to render
+ *  directly into @a outMessage.
+ *
+ *  @note
+ *    As for the overload taking captured arguments, the variadic
+ *    interface receives a format of "%s", not @a inFormat.
+ *
+ *  @param[out]  outMessage  A reference to the buffer to replace
+ *                           with the formatted output message.
+ *  @param[in]   inLevel     The level the current message is to be
+ *                           logged at.
+ *  @param[in]   inFormat    The log message, consisting of a
+ *                           printf-style format string composed of
+ *                           zero or more output conversion
+ *                           directives.
+ *  @param[in]   inValues    The typed arguments, each corresponding
+ *                           with its peer output conversion
+ *                           directive in @a inFormat.
+ *
+ */
+void
+Base::Format(std::string &  outMessage,
+             Level          inLevel,
+             const char *   inFormat,
+             const Values & inValues)
+{
+    string theRendered;
+
+    if (inFormat == NULL) {
+        outMessage.clear();
+        return;
+    }
+
+    inValues.Render(theRendered, inFormat);
+
+    outMessage = Format(inLevel, "%s", theRendered.c_str());
+}
+
 }; // namespace Formatter
 
 }; // namespace Log
@@ -24,8 +24,10 @@
  */
 
 #include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogFormatString.hpp>
+#include <LogUtilities/LogValues.hpp>
 
-#include <cstdio>
 #include <string>
 
 
@@ -109,19 +111,8 @@ string
 Plain::Format(Level inLevel, const char * inFormat, std::va_list inList)
 {
     string theString;
-    int    status;
-    char * p = NULL;
 
-    (void)inLevel;
-
-    if (inFormat != NULL) {
-        status = vasprintf(&p, inFormat, inList);
-
-        if ((status != -1) && (p != NULL)) {
-            theString = p;
-            free(p);
-        }
-    }
+    Plain::Format(theString, inLevel, inFormat, inList);
 
     return (theString);
 }
@@ -181,6 +172,170 @@ Plain::Format(const char * inFormat, std::va_list inList)
     return (Format(kLevel, inFormat, inList));
 }
 
+/**
+ *  @brief
+ *    Performs output format conversion on a log message at the
+ *    indicated level based on the specified printf-style format
+ *    string and the variable argument list, placing the result in
+ *    the caller-provided buffer.
+ *
+ *  The existing capacity of @a outMessage is reused such that, once
+ *  it has grown to accommodate the largest message formatted into
+ *  it, no further allocations occur.
+ *
+ *  @param[out]  outMessage  A reference to the buffer to replace
+ *                           with the formatted output message.
+ *  @param[in]   inLevel     The level the current message is to be
+ *                           logged at.
+ *  @param[in]   inFormat    The log message, consisting of a
+ *                           printf-style format string composed of
+ *                           zero or more output conversion
+ *                           directives.
+ *  @param[in]   inList      A variable argument list, where each
+ *                           argument corresponds with its peer
+ *                           output conversion directive in @a
+ *                           inFormat.
+ *
+ */
+void
+Plain::Format(string &     outMessage,
+              Level        inLevel,
+              const char * inFormat,
+              std::va_list inList)
+{
+    (void)inLevel;
+
+    outMessage.clear();
+
+    if (inFormat != NULL) {
+        Append(outMessage, inFormat, inList);
+    }
+}
+
+/**
+ *  @brief
+ *    Performs output format conversion on a log message at the
+ *    indicated level based on the specified printf-style format
+ *    string and arguments previously captured against it, placing
+ *    the result in the caller-provided buffer.
+ *
+ *  @param[out]  outMessage   A reference to the buffer to replace
+ *                            with the formatted output message.
+ *  @param[in]   inLevel      The level the current message is to be
+ *                            logged at.
+ *  @param[in]   inFormat     The log message, consisting of a
+ *                            printf-style format string composed of
+ *                            zero or more output conversion
+ *                            directives.
+ *  @param[in]   inArguments  The arguments captured against @a
+ *                            inFormat.
+ *
+ */
+void
+Plain::Format(string &          outMessage,
+              Level             inLevel,
+              const char *      inFormat,
+              const Arguments & inArguments)
+{
+    (void)inLevel;
+
+    outMessage.clear();
+
+    if (inFormat != NULL) {
+        inArguments.Render(outMessage, inFormat);
+    }
+}
+
+/**
+ *  @brief
+ *    Performs output format conversion on a log message at the
+ *    indicated level based on the specified printf-style format
+ *    string and typed arguments, placing the result in the
+ *    caller-provided buffer.
+ *
+ *  @param[out]  outMessage  A reference to the buffer to replace
+ *                           with the formatted output message.
+ *  @param[in]   inLevel     The level the current message is to be
+ *                           logged at.
+ *  @param[in]   inFormat    The log message, consisting of a
+ *                           printf-style format string composed of
+ *                           zero or more output conversion
+ *                           directives.
+ *  @param[in]   inValues    The typed arguments, each corresponding
+ *                           with its peer output conversion
+ *                           directive in @a inFormat.
+ *
+ */
+void
+Plain::Format(string &       outMessage,
+              Level          inLevel,
+              const char *   inFormat,
+              const Values & inValues)
+{
+    (void)inLevel;
+
+    outMessage.clear();
+
+    if (inFormat != NULL) {
+        inValues.Render(outMessage, inFormat);
+    }
+}
+
+/**
+ *  @brief
+ *    Performs output format conversion based on the specified
+ *    printf-style format string and the variadic argument list,
+ *    appending the result to the provided message.
+ *
+ *  @param[in,out]  inMessage  A reference to the message to append
+ *                             the formatted output to.
+ *  @param[in]      inFormat   A printf-style format string composed
+ *                             of zero or more output conversion
+ *                             directives.
+ *  @param[in]      ...        A variadic argument list, where each
+ *                             argument corresponds with its peer
+ *                             output conversion directive in @a
+ *                             inFormat.
+ *
+ */
+void
+Plain::Append(string & inMessage, const char * inFormat, ...)
+{
+    va_list theList;
+
+    va_start(theList, inFormat);
+
+    Append(inMessage, inFormat, theList);
+
+    va_end(theList);
+}
+
+/**
+ *  @brief
+ *    Performs output format conversion based on the specified
+ *    printf-style format string and the variable argument list,
+ *    appending the result to the provided message.
+ *
+ *  The conversion reuses the unused capacity of @a inMessage, as
+ *  FormatString::Append does.
+ *
+ *  @param[in,out]  inMessage  A reference to the message to append
+ *                             the formatted output to.
+ *  @param[in]      inFormat   A printf-style format string composed
+ *                             of zero or more output conversion
+ *                             directives.
+ *  @param[in]      inList     A variable argument list, where each
+ *                             argument corresponds with its peer
+ *                             output conversion directive in @a
+ *                             inFormat.
+ *
+ */
+void
+Plain::Append(string & inMessage, const char * inFormat, std::va_list inList)
+{
+    FormatString::Append(inMessage, inFormat, inList);
+}
+
 }; // namespace Formatter
 
 }; // namespace Log
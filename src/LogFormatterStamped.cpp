@@ -23,8 +23,13 @@
  */
 
 #include <LogUtilities/LogFormatterStamped.hpp>
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogClockBase.hpp>
+#include <LogUtilities/LogValues.hpp>
 
+#include <atomic>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <string>
 
@@ -53,7 +58,188 @@ namespace Log
 namespace Formatter
 {
 
-Stamped::Stamped(void)
+namespace
+{
+
+/**
+ *  The largest rendered date and time or process and thread portion
+ *  of a stamp.
+ *
+ *  @private
+ */
+static const size_t kStampPartMax = 64;
+
+/**
+ *  The number of fractional digits, and the divisor from nanoseconds
+ *  to them, for each stamp resolution.
+ *
+ *  @private
+ */
+static const struct
+{
+    unsigned int mDigits;
+    long         mDivisor;
+} kFractions[] =
+{
+    { 0, 1000000000 },
+    { 3, 1000000    },
+    { 6, 1000       },
+    { 9, 1          }
+};
+
+/**
+ *  Per-thread storage for the most recently rendered portions of a
+ *  stamp.
+ *
+ *  The date and time, to the second, changes at most once a second
+ *  and the process and thread not at all for a thread stamping its
+ *  own messages, so each is rendered, with localtime_r and
+ *  snprintf, only when it changes. Otherwise, stamping a message is
+ *  no more than copying the cached portions and writing out the
+ *  level.
+ *
+ *  This is plain old data such that accessing it requires no guard
+ *  for dynamic initialization.
+ *
+ *  @private
+ */
+struct StampCache
+{
+    bool         mHaveDate;                 //!< Whether @a mDate is valid.
+    time_t       mTime;                     //!< The time @a mDate was
+                                            //!< rendered for.
+    size_t       mDateSize;                 //!< The length of @a mDate.
+    char         mDate[kStampPartMax];      //!< The rendered date and
+                                            //!< time.
+    bool         mHaveIdentity;             //!< Whether @a mIdentity is
+                                            //!< valid.
+    pid_t        mProcess;                  //!< The process @a mIdentity
+                                            //!< was rendered for.
+    pthread_t    mThread;                   //!< The thread @a mIdentity
+                                            //!< was rendered for.
+    size_t       mIdentitySize;             //!< The length of @a
+                                            //!< mIdentity.
+    char         mIdentity[kStampPartMax];  //!< The rendered process and
+                                            //!< thread.
+    bool         mHaveSelf;                 //!< Whether @a mSelf is valid.
+    unsigned int mSelfForks;                //!< The fork count @a mSelf
+                                            //!< was retrieved at.
+    pid_t        mSelf;                     //!< The current process.
+};
+
+static thread_local StampCache sStampCache;
+
+/**
+ *  The number of times the process has forked, such that cached
+ *  process identifiers are refreshed in the child.
+ *
+ *  @private
+ */
+static std::atomic<unsigned int> sForks(0);
+
+static pthread_once_t sForkOnce = PTHREAD_ONCE_INIT;
+
+static void
+ForkChild(void)
+{
+    sForks.fetch_add(1, std::memory_order_relaxed);
+}
+
+static void
+ForkRegister(void)
+{
+    pthread_atfork(NULL, NULL, ForkChild);
+}
+
+// Return the current process identifier, which getpid does not
+// cache on all C libraries, from the thread's cache.
+
+static pid_t
+CurrentProcess(void)
+{
+    StampCache & theCache = sStampCache;
+
+    if (!theCache.mHaveSelf ||
+        (theCache.mSelfForks != sForks.load(std::memory_order_relaxed))) {
+        pthread_once(&sForkOnce, ForkRegister);
+
+        theCache.mSelfForks = sForks.load(std::memory_order_relaxed);
+        theCache.mSelf      = getpid();
+        theCache.mHaveSelf  = true;
+    }
+
+    return (theCache.mSelf);
+}
+
+// Render an unsigned value in decimal, right-aligned at the end of
+// the specified buffer, returning a pointer to its first digit.
+
+static char *
+RenderUnsigned(char * inEnd, unsigned int inValue)
+{
+    char * theCursor = inEnd;
+
+    do {
+        *--theCursor = static_cast<char>('0' + (inValue % 10));
+        inValue /= 10;
+    } while (inValue != 0);
+
+    return (theCursor);
+}
+
+}; // namespace
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ *    This constructor instantiates the formatter to stamp messages
+ *    with the default clock to the second.
+ *
+ */
+Stamped::Stamped(void) :
+    Plain(),
+    mClock(NULL),
+    mResolution(Resolution::kSeconds)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the formatter to stamp messages
+ *    with the default clock to the specified resolution.
+ *
+ *  @param[in]  inResolution  The resolution of the time in stamps.
+ *
+ */
+Stamped::Stamped(Resolution inResolution) :
+    Plain(),
+    mClock(NULL),
+    mResolution(inResolution)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the formatter to stamp messages
+ *    with the specified clock to the specified resolution.
+ *
+ *  @param[in]  inClock       A reference to the clock to read stamps
+ *                            from. It must remain in scope for the
+ *                            lifetime of the formatter.
+ *  @param[in]  inResolution  The resolution of the time in stamps.
+ *
+ */
+Stamped::Stamped(const Clock::Base & inClock, Resolution inResolution) :
+    Plain(),
+    mClock(&inClock),
+    mResolution(inResolution)
 {
     return;
 }
@@ -68,6 +254,17 @@ Stamped::~Stamped(void)
     return;
 }
 
+/**
+ *  @brief
+ *    Return the resolution of the time in stamps.
+ *
+ */
+Stamped::Resolution
+Stamped::GetResolution(void) const
+{
+    return (mResolution);
+}
+
 /**
  *  @brief
  *    Prepends a unique information stamp to the log message and
@@ -77,11 +274,13 @@ Stamped::~Stamped(void)
  *
  *  The formatted information stamp is of the form:
  *
- *      <year>-<month>-<day> <hour>:<minute>:<second> [\<PID\>:<thread>] (<level>) <message>
+ *      <year>-<month>-<day> <hour>:<minute>:<second>[.<fraction>] [\<PID\>:<thread>] (<level>) <message>
  *
- *  where @a PID is the process identification number, @a thread is the
- *  POSIX thread identifier/object pointer returned by pthread_self,
- *  and @a level is the level the logged message was specified at.
+ *  where @a fraction is the fraction of the second, to the resolution
+ *  the formatter was instantiated with, @a PID is the process
+ *  identification number, @a thread is the POSIX thread
+ *  identifier/object pointer returned by pthread_self, and @a level
+ *  is the level the logged message was specified at.
  *
  *  @param[in]  inLevel   The level the current message is to be logged at.
  *  @param[in]  inFormat  The log message, consisting of a printf-style
@@ -118,11 +317,13 @@ Stamped::Format(Level inLevel, const char * inFormat, ...)
  *
  *  The formatted information stamp is of the form:
  *
- *      <year>-<month>-<day> <hour>:<minute>:<second> [\<PID\>:<thread>] (<level>) <message>
+ *      <year>-<month>-<day> <hour>:<minute>:<second>[.<fraction>] [\<PID\>:<thread>] (<level>) <message>
  *
- *  where @a PID is the process identification number, @a thread is the
- *  POSIX thread identifier/object pointer returned by pthread_self,
- *  and @a level is the level the logged message was specified at.
+ *  where @a fraction is the fraction of the second, to the resolution
+ *  the formatter was instantiated with, @a PID is the process
+ *  identification number, @a thread is the POSIX thread
+ *  identifier/object pointer returned by pthread_self, and @a level
+ *  is the level the logged message was specified at.
  *
  *  @param[in]  inLevel   The level the current message is to be logged at.
  *  @param[in]  inFormat  The log message, consisting of a printf-style
@@ -139,35 +340,8 @@ string
 Stamped::Format(Level inLevel, const char * inFormat, std::va_list inList)
 {
     string theString;
-    int    status;
-    char * p = NULL;
 
-    if (inFormat != NULL) {
-        time_t    theTime;
-        struct tm theDate;
-
-        theTime = time(NULL);
-        localtime_r(&theTime, &theDate);
-
-        status = asprintf(&p,
-                          "%04d-%02d-%02d %02d:%02d:%02d [%d:" kPThreadSelfFormat "] (%u) ",
-                          theDate.tm_year + 1900,
-                          theDate.tm_mon,
-                          theDate.tm_mday,
-                          theDate.tm_hour,
-                          theDate.tm_min,
-                          theDate.tm_sec,
-                          getpid(),
-                          pthread_self(),
-                          inLevel);
-
-        if ((status != -1) && (p != NULL)) {
-            theString = p;
-            free(p);
-
-            theString += Plain::Format(inLevel, inFormat, inList);
-        }
-    }
+    Stamped::Format(theString, inLevel, inFormat, inList);
 
     return (theString);
 }
@@ -181,11 +355,13 @@ Stamped::Format(Level inLevel, const char * inFormat, std::va_list inList)
  *
  *  The formatted information stamp is of the form:
  *
- *      <year>-<month>-<day> <hour>:<minute>:<second> [\<PID\>:<thread>] (<level>) <message>
+ *      <year>-<month>-<day> <hour>:<minute>:<second>[.<fraction>] [\<PID\>:<thread>] (<level>) <message>
  *
- *  where @a PID is the process identification number, @a thread is the
- *  POSIX thread identifier/object pointer returned by pthread_self,
- *  and @a level is the level the logged message was specified at.
+ *  where @a fraction is the fraction of the second, to the resolution
+ *  the formatter was instantiated with, @a PID is the process
+ *  identification number, @a thread is the POSIX thread
+ *  identifier/object pointer returned by pthread_self, and @a level
+ *  is the level the logged message was specified at.
  *
  *  @param[in]  inFormat  The log message, consisting of a printf-style
  *                        format string composed of zero or more
@@ -221,11 +397,13 @@ Stamped::Format(const char * inFormat, ...)
  *
  *  The formatted information stamp is of the form:
  *
- *      <year>-<month>-<day> <hour>:<minute>:<second> [\<PID\>:<thread>] (<level>) <message>
+ *      <year>-<month>-<day> <hour>:<minute>:<second>[.<fraction>] [\<PID\>:<thread>] (<level>) <message>
  *
- *  where @a PID is the process identification number, @a thread is the
- *  POSIX thread identifier/object pointer returned by pthread_self,
- *  and @a level is the level the logged message was specified at.
+ *  where @a fraction is the fraction of the second, to the resolution
+ *  the formatter was instantiated with, @a PID is the process
+ *  identification number, @a thread is the POSIX thread
+ *  identifier/object pointer returned by pthread_self, and @a level
+ *  is the level the logged message was specified at.
  *
  *  @param[in]  inFormat  The log message, consisting of a printf-style
  *                        format string composed of zero or more
@@ -245,6 +423,267 @@ Stamped::Format(const char * inFormat, std::va_list inList)
     return (Format(kLevel, inFormat, inList));
 }
 
+/**
+ *  @brief
+ *    Prepends a unique information stamp to the log message and
+ *    performs output format conversion on a log message at the
+ *    indicated level based on the specified printf-style format
+ *    string and the variable argument list, placing the result in
+ *    the caller-provided buffer.
+ *
+ *  The formatted information stamp is of the form:
+ *
+ *      <year>-<month>-<day> <hour>:<minute>:<second>[.<fraction>] [\<PID\>:<thread>] (<level>) <message>
+ *
+ *  where @a fraction is the fraction of the second, to the resolution
+ *  the formatter was instantiated with, @a PID is the process
+ *  identification number, @a thread is the POSIX thread
+ *  identifier/object pointer returned by pthread_self, and @a level
+ *  is the level the logged message was specified at.
+ *
+ *  @param[out]  outMessage  A reference to the buffer to replace
+ *                           with the formatted output message.
+ *  @param[in]   inLevel     The level the current message is to be
+ *                           logged at.
+ *  @param[in]   inFormat    The log message, consisting of a
+ *                           printf-style format string composed of
+ *                           zero or more output conversion
+ *                           directives.
+ *  @param[in]   inList      A variable argument list, where each
+ *                           argument corresponds with its peer
+ *                           output conversion directive in @a
+ *                           inFormat.
+ *
+ */
+void
+Stamped::Format(string &     outMessage,
+                Level        inLevel,
+                const char * inFormat,
+                std::va_list inList)
+{
+    outMessage.clear();
+
+    if (inFormat != NULL) {
+        struct timespec theTime;
+
+        Now(theTime);
+
+        Stamp(outMessage, inLevel, theTime, CurrentProcess(), pthread_self());
+
+        if (!outMessage.empty()) {
+            Append(outMessage, inFormat, inList);
+        }
+    }
+}
+
+/**
+ *  @brief
+ *    Prepends a unique information stamp to the log message and
+ *    performs output format conversion on a log message at the
+ *    indicated level based on the specified printf-style format
+ *    string and arguments previously captured against it, placing
+ *    the result in the caller-provided buffer.
+ *
+ *  The information stamp reflects the time, process, and thread at
+ *  which the arguments were captured rather than those at which
+ *  they are formatted.
+ *
+ *  @param[out]  outMessage   A reference to the buffer to replace
+ *                            with the formatted output message.
+ *  @param[in]   inLevel      The level the current message is to be
+ *                            logged at.
+ *  @param[in]   inFormat     The log message, consisting of a
+ *                            printf-style format string composed of
+ *                            zero or more output conversion
+ *                            directives.
+ *  @param[in]   inArguments  The arguments captured against @a
+ *                            inFormat.
+ *
+ */
+void
+Stamped::Format(string &          outMessage,
+                Level             inLevel,
+                const char *      inFormat,
+                const Arguments & inArguments)
+{
+    outMessage.clear();
+
+    if (inFormat != NULL) {
+        struct timespec theTime;
+
+        inArguments.GetTimestamp(theTime);
+
+        Stamp(outMessage,
+              inLevel,
+              theTime,
+              inArguments.GetProcess(),
+              inArguments.GetThread());
+
+        if (!outMessage.empty()) {
+            inArguments.Render(outMessage, inFormat);
+        }
+    }
+}
+
+/**
+ *  @brief
+ *    Prepends a unique information stamp to the log message and
+ *    performs output format conversion on a log message at the
+ *    indicated level based on the specified printf-style format
+ *    string and typed arguments, placing the result in the
+ *    caller-provided buffer.
+ *
+ *  @param[out]  outMessage  A reference to the buffer to replace
+ *                           with the formatted output message.
+ *  @param[in]   inLevel     The level the current message is to be
+ *                           logged at.
+ *  @param[in]   inFormat    The log message, consisting of a
+ *                           printf-style format string composed of
+ *                           zero or more output conversion
+ *                           directives.
+ *  @param[in]   inValues    The typed arguments, each corresponding
+ *                           with its peer output conversion
+ *                           directive in @a inFormat.
+ *
+ */
+void
+Stamped::Format(string &       outMessage,
+                Level          inLevel,
+                const char *   inFormat,
+                const Values & inValues)
+{
+    outMessage.clear();
+
+    if (inFormat != NULL) {
+        struct timespec theTime;
+
+        Now(theTime);
+
+        Stamp(outMessage, inLevel, theTime, CurrentProcess(), pthread_self());
+
+        if (!outMessage.empty()) {
+            inValues.Render(outMessage, inFormat);
+        }
+    }
+}
+
+// Read the current wall-clock time from the formatter's clock.
+
+void
+Stamped::Now(struct timespec & outTime) const
+{
+    const Clock::Base & theClock = (mClock != NULL) ? *mClock : Clock::GetDefault();
+
+    theClock.Convert(theClock.Now(), outTime);
+}
+
+/**
+ *  @brief
+ *    Appends the information stamp for a message logged at the
+ *    indicated level, time, process, and thread.
+ *
+ *  @param[in,out]  outMessage  A reference to the message to append
+ *                              the stamp to.
+ *  @param[in]      inLevel     The level the message is logged at.
+ *  @param[in]      inTime      The time the message was logged at.
+ *  @param[in]      inProcess   The process the message was logged
+ *                              from.
+ *  @param[in]      inThread    The thread the message was logged
+ *                              from.
+ *
+ *  The date and time, to the second, and the process and thread
+ *  portions of the stamp are rendered only when they differ from
+ *  those last rendered on the calling thread, which, for a thread
+ *  stamping its own messages, is at most once a second.
+ *
+ */
+void
+Stamped::Stamp(string &                outMessage,
+               Level                   inLevel,
+               const struct timespec & inTime,
+               pid_t                   inProcess,
+               pthread_t               inThread)
+{
+    StampCache & theCache   = sStampCache;
+    const auto & theFormat  = kFractions[static_cast<size_t>(mResolution)];
+    char         theFraction[sizeof (".000000000 ")];
+    char *       theCursor  = theFraction;
+    char         theLevel[sizeof ("(4294967295) ")];
+    char * const theLast    = theLevel + sizeof (theLevel);
+    char *       theStart   = theLast - (sizeof (") ") - 1);
+    int          theSize;
+
+    if (!theCache.mHaveDate || (theCache.mTime != inTime.tv_sec)) {
+        struct tm theDate;
+
+        localtime_r(&inTime.tv_sec, &theDate);
+
+        theSize = snprintf(theCache.mDate,
+                           sizeof (theCache.mDate),
+                           "%04d-%02d-%02d %02d:%02d:%02d",
+                           theDate.tm_year + 1900,
+                           theDate.tm_mon,
+                           theDate.tm_mday,
+                           theDate.tm_hour,
+                           theDate.tm_min,
+                           theDate.tm_sec);
+
+        theCache.mDateSize = static_cast<size_t>(theSize);
+        theCache.mTime     = inTime.tv_sec;
+        theCache.mHaveDate = true;
+    }
+
+    // Render the fraction of the second, zero-padded to the
+    // resolution's width, and the space following it.
+
+    if (theFormat.mDigits > 0) {
+        unsigned long theValue = static_cast<unsigned long>(inTime.tv_nsec / theFormat.mDivisor);
+
+        *theCursor++ = '.';
+
+        for (unsigned int theDigit = theFormat.mDigits; theDigit > 0; theDigit--) {
+            theCursor[theDigit - 1] = static_cast<char>('0' + (theValue % 10));
+            theValue /= 10;
+        }
+
+        theCursor += theFormat.mDigits;
+    }
+
+    *theCursor++ = ' ';
+
+    if (!theCache.mHaveIdentity ||
+        (theCache.mProcess != inProcess) ||
+        !pthread_equal(theCache.mThread, inThread)) {
+        theSize = snprintf(theCache.mIdentity,
+                           sizeof (theCache.mIdentity),
+                           "[%d:" kPThreadSelfFormat "] ",
+                           inProcess,
+                           inThread);
+
+        theCache.mIdentitySize = static_cast<size_t>(theSize);
+        theCache.mProcess      = inProcess;
+        theCache.mThread       = inThread;
+        theCache.mHaveIdentity = true;
+    }
+
+    // Render the level, and the punctuation around it, backwards
+    // from the end of its buffer.
+
+    theStart[0] = ')';
+    theStart[1] = ' ';
+
+    theStart    = RenderUnsigned(theStart, inLevel);
+
+    *--theStart = '(';
+
+    outMessage.append(theCache.mDate, theCache.mDateSize);
+
+    outMessage.append(theFraction, static_cast<size_t>(theCursor - theFraction));
+
+    outMessage.append(theCache.mIdentity, theCache.mIdentitySize);
+    outMessage.append(theStart, static_cast<size_t>(theLast - theStart));
+}
+
 }; // namespace Formatter
 
 }; // namespace Log
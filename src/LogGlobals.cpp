@@ -45,6 +45,12 @@ namespace Nuovations
 namespace Log
 {
 
+// The highest level messages from the global loggers are written to
+// syslog at; messages above it are written to the standard streams
+// only.
+
+static const Level kSyslogLevelMaximum = 2;
+
 /**
  *  @brief
  *    This routine returns the global shared logger instance for debug
@@ -52,7 +58,8 @@ namespace Log
  *
  *    @note Because most systems filter anything below LOG_NOTICE for
  *    syslog, this instance uses LOG_NOTICE rather than LOG_DEBUG for
- *    the syslog writer.
+ *    the syslog writer, to which only messages at levels two (2) and
+ *    below are written.
  *
  *  @returns
  *    A reference to the global shared debug logger instance.
@@ -75,7 +82,7 @@ Debug(void)
         chainFilter.Push(quietFilter);
         chainFilter.Push(levelFilter);
         chainWriter.Push(stdoutWriter);
-        chainWriter.Push(syslogWriter);
+        chainWriter.Push(syslogWriter, 0, kSyslogLevelMaximum);
         isInitialized = true;
     }
 
@@ -94,7 +101,8 @@ Debug(void)
  *
  *    @note Because most systems filter anything below LOG_NOTICE for
  *    syslog, this instance uses LOG_NOTICE rather than LOG_INFO for
- *    the syslog writer.
+ *    the syslog writer, to which only messages at levels two (2) and
+ *    below are written.
  *
  *    @note While the initialization of this object is not
  *    thread-safe; the post-initialization use of the object is
@@ -121,7 +129,7 @@ Info(void)
         chainFilter.Push(quietFilter);
         chainFilter.Push(levelFilter);
         chainWriter.Push(stdoutWriter);
-        chainWriter.Push(syslogWriter);
+        chainWriter.Push(syslogWriter, 0, kSyslogLevelMaximum);
         isInitialized = true;
     }
 
@@ -138,6 +146,9 @@ Info(void)
  *    This routine returns the global shared logger instance for error
  *    messages.
  *
+ *    @note Only messages at levels two (2) and below are written to
+ *    syslog.
+ *
  *    @note While the initialization of this object is not
  *    thread-safe; the post-initialization use of the object is
  *    thread-safe.
@@ -159,7 +170,7 @@ Error(void)
 
     if (!isInitialized) {
         chainWriter.Push(stderrWriter);
-        chainWriter.Push(syslogWriter);
+        chainWriter.Push(syslogWriter, 0, kSyslogLevelMaximum);
         isInitialized = true;
     }
 
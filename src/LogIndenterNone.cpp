@@ -56,27 +56,6 @@ None::~None(void)
     return;
 }
 
-/**
- *  @brief
- *    Performs no indentation on the provided message.
- *
- *  @param[in]  inIndent   The level of indendation desired for
- *                         the provided log message, which is ignored.
- *  @param[in]  inMessage  A reference to the log message to indent,
- *                         which is unchanged.
- *
- *  @returns
- *     A reference to @a inMessage, unchanged.
- *
- */
-string &
-None::Indent(Log::Indent inIndent, string & inMessage)
-{
-    (void)inIndent;
-
-    return (inMessage);
-}
-
 }; // namespace Indenter
 
 }; // namespace Log
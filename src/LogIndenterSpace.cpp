@@ -36,6 +36,19 @@ namespace Indenter
 static const char   kSpace = ' ';
 static const size_t kCount = 4;
 
+#define kSpaces16 "                "
+
+/**
+ *  The table of indents for any number of spaces per level. For the
+ *  default of four spaces, it covers the first 64 levels.
+ */
+static constexpr char kSpaces[] = kSpaces16 kSpaces16 kSpaces16 kSpaces16
+                                  kSpaces16 kSpaces16 kSpaces16 kSpaces16
+                                  kSpaces16 kSpaces16 kSpaces16 kSpaces16
+                                  kSpaces16 kSpaces16 kSpaces16 kSpaces16;
+
+#undef kSpaces16
+
 /**
  *  @brief
  *    This is the class default constructor.
@@ -46,7 +59,7 @@ static const size_t kCount = 4;
  *
  */
 Space::Space(void) :
-    String(kSpace, kCount)
+    String(kSpace, kCount, kSpaces, sizeof (kSpaces) - 1)
 {
     return;
 }
@@ -64,7 +77,7 @@ Space::Space(void) :
  *
  */
 Space::Space(Flags inFlags) :
-    String(kSpace, kCount, inFlags)
+    String(kSpace, kCount, inFlags, kSpaces, sizeof (kSpaces) - 1)
 {
     return;
 }
@@ -82,7 +95,7 @@ Space::Space(Flags inFlags) :
  *
  */
 Space::Space(size_t inCount) :
-    String(kSpace, inCount)
+    String(kSpace, inCount, kSpaces, sizeof (kSpaces) - 1)
 {
     return;
 }
@@ -102,7 +115,7 @@ Space::Space(size_t inCount) :
  *
  */
 Space::Space(size_t inCount, Flags inFlags) :
-    String(kSpace, inCount, inFlags)
+    String(kSpace, inCount, inFlags, kSpaces, sizeof (kSpaces) - 1)
 {
     return;
 }
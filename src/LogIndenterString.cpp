@@ -22,13 +22,19 @@
  *      string, character, or repeated characters.
  */
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
 #include <string>
-#include <vector>
 
 using namespace std;
 
 #include <LogUtilities/LogIndenterString.hpp>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif // defined(__SSE2__)
+
 namespace Nuovations
 {
 
@@ -40,6 +46,122 @@ namespace Indenter
 
 static const String::Flags kFlagsDefault = String::Flags::kFirst;
 
+/**
+ *  The number of levels of indent precomputed at construction.
+ */
+static const size_t kPrefixLevels = 16;
+
+namespace
+{
+
+#if defined(__SSE2__)
+/**
+ *  The number of characters scanned at a time for new lines.
+ *
+ *  @private
+ */
+static const size_t kBlockSize = sizeof (__m128i);
+
+// Return a mask with a bit set for each new line in the block
+// starting at the specified position.
+
+static inline unsigned int
+NewlineMask(const char * inBlock, __m128i inNewlines)
+{
+    const __m128i theBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inBlock));
+
+    return (static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(theBlock, inNewlines))));
+}
+#endif // defined(__SSE2__)
+
+// Return the number of new lines in the half-open range [inFirst,
+// inLast).
+
+static size_t
+CountNewlines(const char * inFirst, const char * inLast)
+{
+    size_t theCount = 0;
+
+#if defined(__SSE2__)
+    // Each byte lane counts the new lines found in it, by subtracting
+    // the all-ones comparison result, for up to 255 blocks before the
+    // lanes are summed.
+
+    const __m128i theNewlines = _mm_set1_epi8('\n');
+    const __m128i theZero     = _mm_setzero_si128();
+
+    while (static_cast<size_t>(inLast - inFirst) >= kBlockSize) {
+        __m128i theLanes  = theZero;
+        size_t  theBlocks = std::min(static_cast<size_t>(inLast - inFirst) / kBlockSize, static_cast<size_t>(255));
+
+        while (theBlocks--) {
+            const __m128i theBlock = _mm_loadu_si128(reinterpret_cast<const __m128i *>(inFirst));
+
+            theLanes = _mm_sub_epi8(theLanes, _mm_cmpeq_epi8(theBlock, theNewlines));
+            inFirst += kBlockSize;
+        }
+
+        theLanes  = _mm_sad_epu8(theLanes, theZero);
+        theCount += static_cast<size_t>(_mm_cvtsi128_si32(theLanes)) +
+                    static_cast<size_t>(_mm_cvtsi128_si32(_mm_srli_si128(theLanes, 8)));
+    }
+#endif // defined(__SSE2__)
+
+    while (inFirst != inLast) {
+        theCount += (*inFirst++ == '\n');
+    }
+
+    return (theCount);
+}
+
+// Return a pointer to the last new line in the half-open range
+// [inFirst, inLast) or null if there is none.
+
+static const char *
+FindLastNewline(const char * inFirst, const char * inLast)
+{
+#if defined(__SSE2__)
+    const __m128i theNewlines = _mm_set1_epi8('\n');
+    unsigned int  theMask;
+
+    while (static_cast<size_t>(inLast - inFirst) >= kBlockSize) {
+        inLast  -= kBlockSize;
+        theMask  = NewlineMask(inLast, theNewlines);
+
+        if (theMask != 0) {
+            return (inLast + ((sizeof (theMask) * 8) - 1 - __builtin_clz(theMask)));
+        }
+    }
+#endif // defined(__SSE2__)
+
+    while (inLast != inFirst) {
+        if (*--inLast == '\n') {
+            return (inLast);
+        }
+    }
+
+    return (NULL);
+}
+
+// Return the specified string repeated the specified number of
+// times.
+
+static string
+Repeat(const string & inString, size_t inCount)
+{
+    string theRepeated;
+
+    theRepeated.reserve(inString.size() * inCount);
+
+    while (inCount--) {
+        theRepeated.append(inString);
+    }
+
+    return (theRepeated);
+}
+
+}; // namespace
+
 /**
  *  @brief
  *    This is a class constructor.
@@ -54,7 +176,11 @@ static const String::Flags kFlagsDefault = String::Flags::kFirst;
  */
 String::String(const char * inString) :
     mString(inString),
-    mFlags(kFlagsDefault)
+    mFlags(kFlagsDefault),
+    mStaticPrefixes(NULL),
+    mPrefixes(Repeat(mString, kPrefixLevels)),
+    mPrefixesSize(mPrefixes.size()),
+    mGrown()
 {
     return;
 }
@@ -73,7 +199,11 @@ String::String(const char * inString) :
  */
 String::String(const std::string & inString) :
     mString(inString),
-    mFlags(kFlagsDefault)
+    mFlags(kFlagsDefault),
+    mStaticPrefixes(NULL),
+    mPrefixes(Repeat(mString, kPrefixLevels)),
+    mPrefixesSize(mPrefixes.size()),
+    mGrown()
 {
     return;
 }
@@ -91,7 +221,11 @@ String::String(const std::string & inString) :
  */
 String::String(char inCharacter) :
     mString(1, inCharacter),
-    mFlags(kFlagsDefault)
+    mFlags(kFlagsDefault),
+    mStaticPrefixes(NULL),
+    mPrefixes(Repeat(mString, kPrefixLevels)),
+    mPrefixesSize(mPrefixes.size()),
+    mGrown()
 {
     return;
 }
@@ -111,7 +245,11 @@ String::String(char inCharacter) :
  */
 String::String(char inCharacter, size_t inCount) :
     mString(inCount, inCharacter),
-    mFlags(kFlagsDefault)
+    mFlags(kFlagsDefault),
+    mStaticPrefixes(NULL),
+    mPrefixes(Repeat(mString, kPrefixLevels)),
+    mPrefixesSize(mPrefixes.size()),
+    mGrown()
 {
     return;
 }
@@ -132,7 +270,11 @@ String::String(char inCharacter, size_t inCount) :
  */
 String::String(const char * inString, Flags inFlags) :
     mString(inString),
-    mFlags(inFlags)
+    mFlags(inFlags),
+    mStaticPrefixes(NULL),
+    mPrefixes(Repeat(mString, kPrefixLevels)),
+    mPrefixesSize(mPrefixes.size()),
+    mGrown()
 {
     return;
 }
@@ -153,7 +295,11 @@ String::String(const char * inString, Flags inFlags) :
  */
 String::String(const std::string & inString, Flags inFlags) :
     mString(inString),
-    mFlags(inFlags)
+    mFlags(inFlags),
+    mStaticPrefixes(NULL),
+    mPrefixes(Repeat(mString, kPrefixLevels)),
+    mPrefixesSize(mPrefixes.size()),
+    mGrown()
 {
     return;
 }
@@ -173,7 +319,11 @@ String::String(const std::string & inString, Flags inFlags) :
  */
 String::String(char inCharacter, Flags inFlags) :
     mString(1, inCharacter),
-    mFlags(inFlags)
+    mFlags(inFlags),
+    mStaticPrefixes(NULL),
+    mPrefixes(Repeat(mString, kPrefixLevels)),
+    mPrefixesSize(mPrefixes.size()),
+    mGrown()
 {
     return;
 }
@@ -195,7 +345,80 @@ String::String(char inCharacter, Flags inFlags) :
  */
 String::String(char inCharacter, size_t inCount, Flags inFlags) :
     mString(inCount, inCharacter),
-    mFlags(inFlags)
+    mFlags(inFlags),
+    mStaticPrefixes(NULL),
+    mPrefixes(Repeat(mString, kPrefixLevels)),
+    mPrefixesSize(mPrefixes.size()),
+    mGrown()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *  This constructor instantiates the indenter with the specified
+ *  number of characters to use as the indent and a static table of
+ *  indents for it, and only indents the first line of a log message.
+ *
+ *  @param[in]  inCharacter     The character to use as the indent.
+ *  @param[in]  inCount         The number of @a inCharacter to use
+ *                              as the indent.
+ *  @param[in]  inPrefixes      A pointer to a table of @a
+ *                              inCharacter, of static storage
+ *                              duration, whose prefixes are the
+ *                              indents for each level it covers.
+ *  @param[in]  inPrefixesSize  The size, in characters, of @a
+ *                              inPrefixes.
+ *
+ */
+String::String(char         inCharacter,
+               size_t       inCount,
+               const char * inPrefixes,
+               size_t       inPrefixesSize) :
+    mString(inCount, inCharacter),
+    mFlags(kFlagsDefault),
+    mStaticPrefixes(inPrefixes),
+    mPrefixes(),
+    mPrefixesSize(inPrefixesSize),
+    mGrown()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *  This constructor instantiates the indenter with the specified
+ *  number of characters to use as the indent and a static table of
+ *  indents for it, and indents with the specified behavior flags.
+ *
+ *  @param[in]  inCharacter     The character to use as the indent.
+ *  @param[in]  inCount         The number of @a inCharacter to use
+ *                              as the indent.
+ *  @param[in]  inFlags         The behavior flags indicating how a
+ *                              log message should be indented.
+ *  @param[in]  inPrefixes      A pointer to a table of @a
+ *                              inCharacter, of static storage
+ *                              duration, whose prefixes are the
+ *                              indents for each level it covers.
+ *  @param[in]  inPrefixesSize  The size, in characters, of @a
+ *                              inPrefixes.
+ *
+ */
+String::String(char         inCharacter,
+               size_t       inCount,
+               Flags        inFlags,
+               const char * inPrefixes,
+               size_t       inPrefixesSize) :
+    mString(inCount, inCharacter),
+    mFlags(inFlags),
+    mStaticPrefixes(inPrefixes),
+    mPrefixes(),
+    mPrefixesSize(inPrefixesSize),
+    mGrown()
 {
     return;
 }
@@ -210,59 +433,126 @@ String::~String(void)
     return;
 }
 
+// Return a table of indents at least the specified size, growing
+// the table for deep levels if need be. Any grown table is returned
+// through the specified pointer to keep it in scope while in use.
+
+const char *
+String::Prefixes(size_t inSize, std::shared_ptr<const std::string> & outGrown) const
+{
+    if (inSize <= mPrefixesSize) {
+        return ((mStaticPrefixes != NULL) ? mStaticPrefixes : mPrefixes.data());
+    }
+
+    outGrown = std::atomic_load(&mGrown);
+
+    if (!outGrown || (outGrown->size() < inSize)) {
+        // Grow geometrically, such that deepening indents cost few
+        // regrowths. Should threads race to grow the table, each
+        // grown table suffices and the last stored wins.
+
+        const size_t theLevels = std::max(inSize, (outGrown ? outGrown->size() : mPrefixesSize) * 2) / mString.size();
+
+        outGrown = std::make_shared<const std::string>(Repeat(mString, theLevels + 1));
+
+        std::atomic_store(&mGrown, outGrown);
+    }
+
+    return (outGrown->data());
+}
+
 /**
  *  @brief
- *    Inserts the specified indent into the provided log message at
- *    the indicated position.
+ *    Inserts the indent for the specified level into the provided log
+ *    message at the indicated position.
+ *
+ *  The indent is copied from the table of indents, such that no
+ *  temporary indent string is built and, when the message already
+ *  has sufficient capacity, no allocation occurs.
  *
- *  @param[in]  inIndent    An immutable reference to the indent to
- *                          insert.
+ *  @param[in]  inIndent    The level of indendation to insert.
  *  @param[in]  inMessage   A reference to the log message to indent.
- *  @param[in]  inPosition  The position in @a inMessage to insert @a
- *                          inIndent at.
+ *  @param[in]  inPosition  The position in @a inMessage to insert the
+ *                          indent at.
  *
  */
 void
-String::Indent(const string & inIndent,
-               string &       inMessage,
-               size_t         inPosition) const
+String::Indent(Log::Indent inIndent,
+               string &    inMessage,
+               size_t      inPosition) const
 {
-    inMessage.insert(inPosition, inIndent);
+    const size_t                       theSize = inIndent * mString.size();
+    std::shared_ptr<const std::string> theGrown;
+
+    inMessage.insert(inPosition, Prefixes(theSize, theGrown), theSize);
 }
 
 /**
  *  @brief
- *    Inserts the specified indent into the provided log message at
- *    the indicated positions.
+ *    Inserts the indent for the specified level at the start of
+ *    every line of the provided log message.
  *
- *  @param[in]  inIndent     An immutable reference to the indent to
- *                           insert.
- *  @param[in]  inMessage    A reference to the log message to indent.
- *  @param[in]  inPositions  A reference to the the positions in @a
- *                           inMessage to insert @a inIndent at.
+ *  A terminating new line does not start a line to indent.
  *
- *  @returns
- *    A reference to the indented log message.
+ *  Rather than inserting at each line, which shifts the remainder of
+ *  the message each time, the new lines are first counted, such
+ *  that the message can be grown once to its indented size. The
+ *  lines are then moved, last first, to their final positions, each
+ *  behind its indent, such that each character is moved at most
+ *  once. Both scans for new lines are vectorized where the platform
+ *  supports it.
+ *
+ *  @param[in]  inIndent   The level of indendation to insert.
+ *  @param[in]  inMessage  A reference to the non-empty log message
+ *                         to indent.
  *
  */
-string &
-String::Indent(const string &   inIndent,
-               string &         inMessage,
-               vector<size_t> & inPositions) const
+void
+String::IndentEvery(Log::Indent inIndent, string & inMessage) const
 {
-    vector<size_t>::const_iterator current = inPositions.begin();
-    vector<size_t>::const_iterator end     = inPositions.end();
+    const size_t                       theSize  = inMessage.size();
+    const size_t                       theWidth = inIndent * mString.size();
+    std::shared_ptr<const std::string> theGrown;
+    const char *                       thePrefix;
+    size_t                             theLines;
+    char *                             theData;
+    const char *                       theSource;
+    const char *                       theScan;
+    const char *                       theLine;
+    char *                             theTarget;
+    size_t                             theLength;
+
+    if (theWidth == 0) {
+        return;
+    }
 
-    // Iterate over each indent position, inserting the indent string
-    // into the message string at that position.
+    thePrefix = Prefixes(theWidth, theGrown);
 
-    while (current != end) {
-        Indent(inIndent, inMessage, *current);
+    theLines = CountNewlines(inMessage.data(), inMessage.data() + theSize - 1) + 1;
 
-        std::advance(current, 1);
-    }
+    inMessage.resize(theSize + (theLines * theWidth));
 
-    return (inMessage);
+    theData   = &inMessage[0];
+    theSource = theData + theSize;
+    theScan   = theSource - 1;
+    theTarget = theData + inMessage.size();
+
+    do {
+        theScan   = FindLastNewline(theData, theScan);
+        theLine   = (theScan != NULL) ? theScan + 1 : theData;
+        theLength = static_cast<size_t>(theSource - theLine);
+
+        theTarget -= theLength;
+
+        memmove(theTarget, theLine, theLength);
+
+        theTarget -= theWidth;
+
+        memcpy(theTarget, thePrefix, theWidth);
+
+        theSource = theLine;
+
+    } while (theScan != NULL);
 }
 
 /**
@@ -281,64 +571,23 @@ String::Indent(const string &   inIndent,
 string &
 String::Indent(Log::Indent inIndent, string & inMessage)
 {
-    vector<size_t> thePositions;
-    string         theIndent;
-    const size_t   theSize = inMessage.size();
-
     // If we are at indent level zero (0) or if the message is empty,
     // then there's nothing to indent. Simply return the message as
     // is.
 
-    if (inIndent == 0 || theSize == 0) {
+    if (inIndent == 0 || inMessage.empty()) {
         return (inMessage);
     }
 
-    // Otherwise, we will be indenting something. Prebuild the indent
-    // string since this needs to only be done once regardless of how
-    // many lines we are indenting.
-
-    while (inIndent--) {
-        theIndent += mString;
-    }
-
-    // If we were asking to indent every line, work our way from the
-    // end of the string to the beginning, finding new lines
-    // characters that demarcate the start of a new line to indent.
+    // Indent either every line or, otherwise, just the first line.
 
     if (mFlags == Flags::kEvery) {
-        size_t thePosition = string::npos;
-
-        do {
-            // Find, in reverse, the last new line in the message
-            // starting at the specified position.
-
-            thePosition = inMessage.find_last_of('\n', thePosition);
-
-            // If we found one, push the position one character after
-            // the position (the first character on the new line) onto
-            // the insertion container if it wasn't a terminating new
-            // line. Then, decrement the position so we don't refind
-            // the new line we just found.
-
-            if (thePosition != string::npos) {
-                if (thePosition < (theSize - 1)) {
-                    thePositions.push_back(thePosition + 1);
-                }
-
-                thePosition--;
-            }
-
-        } while (thePosition != string::npos);
+        IndentEvery(inIndent, inMessage);
+    } else {
+        Indent(inIndent, inMessage, 0);
     }
 
-    // We always indent the first line, so push the start-of-
-    // string position onto the insertion container.
-
-    thePositions.push_back(0);
-
-    // Return the string, indented at the found insertion locations.
-
-    return (Indent(theIndent, inMessage, thePositions));
+    return (inMessage);
 }
 
 }; // namespace Indenter
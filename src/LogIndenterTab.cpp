@@ -35,6 +35,15 @@ namespace Indenter
 
 static const char kTab = '\t';
 
+#define kTabs8 "\t\t\t\t\t\t\t\t"
+
+/**
+ *  The table of indents, one tab per level, for the first 64 levels.
+ */
+static constexpr char kTabs[] = kTabs8 kTabs8 kTabs8 kTabs8 kTabs8 kTabs8 kTabs8 kTabs8;
+
+#undef kTabs8
+
 /**
  *  @brief
  *    This is the class default constructor.
@@ -45,7 +54,7 @@ static const char kTab = '\t';
  *
  */
 Tab::Tab(void) :
-    String(kTab)
+    String(kTab, 1, kTabs, sizeof (kTabs) - 1)
 {
     return;
 }
@@ -63,7 +72,7 @@ Tab::Tab(void) :
  *
  */
 Tab::Tab(Flags inFlags) :
-    String(kTab, inFlags)
+    String(kTab, 1, inFlags, kTabs, sizeof (kTabs) - 1)
 {
     return;
 }
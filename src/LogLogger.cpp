@@ -27,6 +27,9 @@ using namespace std;
 
 #include <LogUtilities/LogLogger.hpp>
 
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogScopedMessage.hpp>
+
 namespace Nuovations
 {
 
@@ -59,7 +62,9 @@ Logger::Logger(Filter::Base &    inFilter,
     mFilter(&inFilter),
     mIndenter(&inIndenter),
     mFormatter(&inFormatter),
-    mWriter(&inWriter)
+    mWriter(&inWriter),
+    mRecorder(NULL),
+    mGate(inFilter, inWriter)
 {
     return;
 }
@@ -223,6 +228,8 @@ void
 Logger::SetFilter(Filter::Base & inFilter)
 {
     mFilter = &inFilter;
+
+    mGate.Bind(inFilter);
 }
 
 
@@ -274,6 +281,68 @@ void
 Logger::SetWriter(Writer::Base & inWriter)
 {
     mWriter = &inWriter;
+
+    mGate.Bind((mRecorder == NULL) ? mWriter : NULL);
+}
+
+/**
+ *  @brief
+ *    Return a pointer to the recorder associated with the logger, if
+ *    any.
+ *
+ *  @returns
+ *    A pointer to the recorder associated with the logger or null if
+ *    messages are formatted and written synchronously.
+ *
+ */
+Recorder::Base *
+Logger::GetRecorder(void)
+{
+    return (mRecorder);
+}
+
+/**
+ *  @brief
+ *    Return an immutable pointer to the recorder associated with the
+ *    logger, if any.
+ *
+ *  @returns
+ *    An immutable pointer to the recorder associated with the logger
+ *    or null if messages are formatted and written synchronously.
+ *
+ */
+const Recorder::Base *
+Logger::GetRecorder(void) const
+{
+    return (mRecorder);
+}
+
+/**
+ *  @brief
+ *    This sets the recorder for the logger.
+ *
+ *  @note
+ *    The specified recorder instance, if any, must be in scope for
+ *    the duration of the logger instance scope. Otherwise, undefined
+ *    behavior will occur when the logger instance is used.
+ *
+ *  @note
+ *    This interface is not thread-safe.
+ *
+ *  @param[in]  inRecorder  A pointer to the recorder to set or null
+ *                          to format and write messages
+ *                          synchronously.
+ *
+ */
+void
+Logger::SetRecorder(Recorder::Base * inRecorder)
+{
+    mRecorder = inRecorder;
+
+    // A recorder may write messages other than through the writer,
+    // so the writer's levels gate messages only without one.
+
+    mGate.Bind((mRecorder == NULL) ? mWriter : NULL);
 }
 
 /**
@@ -329,28 +398,138 @@ Logger::Write(Log::Indent  inIndent,
               const char * inFormat,
               std::va_list inArguments)
 {
-    string theMessage;
-
     // Perform any up front, level-only filtering to avoid spending
     // any cycles formatting messages that are going to be tossed
     // anyway.
 
+    if (!IsEnabled(inLevel)) {
+        return;
+    }
+
     if (!mFilter->Allow(inLevel)) {
         return;
     }
 
-    // Format the message.
+    // Likewise, perform any filtering on the format string before
+    // formatting, if any filters need it.
+
+    if (mFilter->NeedsFormat() && !mFilter->AllowFormat(inLevel, inFormat)) {
+        return;
+    }
+
+    // Hand the message to the recorder, if any, which may take
+    // responsibility for formatting and writing it later.
+
+    if ((mRecorder != NULL) &&
+        mRecorder->Record(*this, inIndent, inLevel, inFormat, inArguments)) {
+        return;
+    }
+
+    ScopedMessage theScope;
+    string &      theMessage = theScope.Get();
+
+    // Format the message, in place, into the message buffer.
+
+    mFormatter->Format(theMessage, inLevel, inFormat, inArguments);
+
+    // Indent the message, in place.
+
+    mIndenter->Indent(inIndent, theMessage);
 
-    theMessage = mFormatter->Format(inLevel, inFormat, inArguments);
+    // Finally, write the message, if allowed based on its contents.
+    // The level has already been passed above, so only filters that
+    // need the message content are consulted, if there are any.
+
+    if (!mFilter->NeedsMessage() || mFilter->AllowMessage(inLevel, theMessage.c_str())) {
+        mWriter->Write(inLevel, theMessage.c_str());
+    }
+}
+
+/**
+ *  @brief
+ *    Write a log message, whose arguments were previously captured,
+ *    at the specified indent and level.
+ *
+ *  This is typically invoked by a recorder, on its own thread, for
+ *  a message that has already passed the level-only filter.
+ *
+ *  @param[in]  inIndent     The level of indendation desired for
+ *                           the provided log message.
+ *  @param[in]  inLevel      The level the current message is to be
+ *                           logged at.
+ *  @param[in]  inFormat     The log message, consisting of a printf-
+ *                           style format string composed of zero or
+ *                           more output conversion directives.
+ *  @param[in]  inArguments  The arguments captured against @a
+ *                           inFormat.
+ *
+ */
+void
+Logger::Write(Log::Indent       inIndent,
+              Log::Level        inLevel,
+              const char *      inFormat,
+              const Arguments & inArguments)
+{
+    ScopedMessage theScope;
+    string &      theMessage = theScope.Get();
+
+    mFormatter->Format(theMessage, inLevel, inFormat, inArguments);
+
+    mIndenter->Indent(inIndent, theMessage);
+
+    if (!mFilter->NeedsMessage() || mFilter->AllowMessage(inLevel, theMessage.c_str())) {
+        mWriter->Write(inLevel, theMessage.c_str());
+    }
+}
+
+/**
+ *  @brief
+ *    Write a log message, with typed arguments, at the specified
+ *    indent and level.
+ *
+ *  @param[in]  inIndent  The level of indendation desired for the
+ *                        provided log message.
+ *  @param[in]  inLevel   The level the current message is to be
+ *                        logged at.
+ *  @param[in]  inFormat  The log message, consisting of a printf-
+ *                        style format string composed of zero or
+ *                        more output conversion directives.
+ *  @param[in]  inValues  The typed arguments, each corresponding with
+ *                        its peer output conversion directive in @a
+ *                        inFormat.
+ *
+ */
+void
+Logger::Write(Log::Indent    inIndent,
+              Log::Level     inLevel,
+              const char *   inFormat,
+              const Values & inValues)
+{
+    if (!IsEnabled(inLevel)) {
+        return;
+    }
+
+    if (!mFilter->Allow(inLevel)) {
+        return;
+    }
+
+    if (mFilter->NeedsFormat() && !mFilter->AllowFormat(inLevel, inFormat)) {
+        return;
+    }
+
+    if ((mRecorder != NULL) &&
+        mRecorder->Record(*this, inIndent, inLevel, inFormat, inValues)) {
+        return;
+    }
 
-    // Indent the message.
+    ScopedMessage theScope;
+    string &      theMessage = theScope.Get();
 
-    theMessage = mIndenter->Indent(inIndent, theMessage);
+    mFormatter->Format(theMessage, inLevel, inFormat, inValues);
 
-    // Finally, write the message, if allowed based on the level and
-    // message contents.
+    mIndenter->Indent(inIndent, theMessage);
 
-    if (mFilter->Allow(inLevel, theMessage.c_str())) {
+    if (!mFilter->NeedsMessage() || mFilter->AllowMessage(inLevel, theMessage.c_str())) {
         mWriter->Write(inLevel, theMessage.c_str());
     }
 }
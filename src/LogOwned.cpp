@@ -0,0 +1,179 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities base object for
+ *      filters and writers that may be held as links by others.
+ */
+
+#include <LogUtilities/LogOwned.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+// The lock guarding the owners of every object. It is constant-
+// initialized, such that filters and writers may be constructed
+// during static initialization.
+
+static std::mutex sOwnersMutex;
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ */
+Owned::Owned(void) :
+    mOwners()
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *  The copy is held as a link by no object, whatever the object
+ *  copied may be.
+ *
+ *  @param[in]  inOwned  An immutable reference to the object to copy.
+ *
+ */
+Owned::Owned(const Owned & inOwned) :
+    mOwners()
+{
+    (void)inOwned;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Owned::~Owned(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class assignment operator.
+ *
+ *  The objects holding this one as a link continue to do so.
+ *
+ *  @param[in]  inOwned  An immutable reference to the object to
+ *                       assign from.
+ *
+ *  @returns
+ *    A reference to the object.
+ *
+ */
+Owned &
+Owned::operator =(const Owned & inOwned)
+{
+    (void)inOwned;
+
+    return (*this);
+}
+
+/**
+ *  @brief
+ *    Record that the object holds the specified object as a link,
+ *    such that what it reports depends on the link.
+ *
+ *  Objects that hold others as links, such as chains and queues,
+ *  must adopt each of them and disown each (see #Disown) that
+ *  outlives them.
+ *
+ *  @param[in]  inLink  A reference to the link.
+ *
+ */
+void
+Owned::Adopt(Owned & inLink)
+{
+    std::lock_guard<std::mutex> theLock(sOwnersMutex);
+
+    inLink.mOwners.push_back(this);
+}
+
+/**
+ *  @brief
+ *    Record that the object no longer holds the specified object as
+ *    a link.
+ *
+ *  Disowning a link that was never adopted has no effect.
+ *
+ *  @param[in]  inLink  A reference to the link.
+ *
+ */
+void
+Owned::Disown(Owned & inLink)
+{
+    std::lock_guard<std::mutex> theLock(sOwnersMutex);
+    std::vector<const Owned *>::iterator theOwner = std::find(inLink.mOwners.begin(),
+                                                              inLink.mOwners.end(),
+                                                              this);
+
+    if (theOwner != inLink.mOwners.end()) {
+        inLink.mOwners.erase(theOwner);
+    }
+}
+
+/**
+ *  @brief
+ *    Recompute the enabled levels of the gates (see Filter::Gate) of
+ *    the object and of every object holding it as a link, directly or
+ *    not, since what they report may have changed.
+ *
+ *  Gates of other objects are left alone.
+ *
+ */
+void
+Owned::Invalidate(void) const
+{
+    std::lock_guard<std::mutex> theLock(sOwnersMutex);
+
+    Refresh(*this);
+}
+
+// Refresh the gates of the object and of those holding it as a link.
+// The owners lock must be held.
+
+void
+Owned::Refresh(const Owned & inOwned)
+{
+    std::vector<const Owned *>::const_iterator current = inOwned.mOwners.begin();
+    std::vector<const Owned *>::const_iterator end     = inOwned.mOwners.end();
+
+    inOwned.RefreshGates();
+
+    while (current != end) {
+        Refresh(**current);
+
+        std::advance(current, 1);
+    }
+}
+
+}; // namespace Log
+
+}; // namespace Nuovations
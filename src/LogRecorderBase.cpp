@@ -0,0 +1,89 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities abstract
+ *      recorder object.
+ */
+
+#include <LogUtilities/LogRecorderBase.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Recorder
+{
+
+Base::Base(void)
+{
+    return;
+}
+
+Base::~Base(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Record a log message, with typed arguments, at the specified
+ *    indent and level.
+ *
+ *  This default implementation declines every message, such that
+ *  the logger formats and writes it immediately. Concrete recorders
+ *  should override it to take such messages as well.
+ *
+ *  @param[in]  inLogger  The logger the message was written to.
+ *  @param[in]  inIndent  The level of indentation desired for the
+ *                        message.
+ *  @param[in]  inLevel   The level the message is to be logged at.
+ *  @param[in]  inFormat  The log message, consisting of a
+ *                        printf-style format string composed of
+ *                        zero or more output conversion directives.
+ *  @param[in]  inValues  The typed arguments, each corresponding with
+ *                        its peer output conversion directive in @a
+ *                        inFormat.
+ *
+ *  @returns
+ *    False, always.
+ *
+ */
+bool
+Base::Record(Logger &       inLogger,
+             Indent         inIndent,
+             Level          inLevel,
+             const char *   inFormat,
+             const Values & inValues)
+{
+    (void)inLogger;
+    (void)inIndent;
+    (void)inLevel;
+    (void)inFormat;
+    (void)inValues;
+
+    return (false);
+}
+
+}; // namespace Recorder
+
+}; // namespace Log
+
+}; // namespace Nuovations
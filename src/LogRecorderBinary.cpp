@@ -0,0 +1,475 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete
+ *      recorder implementation that writes messages, unformatted, as
+ *      compact binary records for later, offline decoding.
+ */
+
+#include <atomic>
+#include <cstring>
+#include <cwchar>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+#include <stddef.h>
+
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogRecorderBinary.hpp>
+#include <LogUtilities/LogValues.hpp>
+#include <LogUtilities/LogWriterStdio.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Recorder
+{
+
+const char     Binary::kMagic[8] = { 'N', 'L', 'U', 'B', 'L', 'O', 'G', '\0' };
+const uint8_t  Binary::kVersion;
+const uint32_t Binary::kByteOrder;
+
+namespace
+{
+
+/**
+ *  The number of format registrations each thread caches.
+ *
+ *  @private
+ */
+static const size_t kCacheSize = 64;
+
+/**
+ *  A format registration cached by a thread.
+ *
+ *  @private
+ */
+struct CacheEntry
+{
+    uint64_t     mRecorder;   //!< The serial number of the recorder
+                              //!< the format was registered with.
+    const char * mFormat;     //!< The format string registered.
+    const char * mCopy;       //!< The recorder's copy of @a mFormat.
+    uint32_t     mIdentifier; //!< The identifier assigned to @a
+                              //!< mFormat.
+};
+
+/**
+ *  Per-thread storage for encoding messages.
+ *
+ *  Because the storage persists across messages, its capacity
+ *  settles at the largest message recorded on the thread and, from
+ *  then on, recording a message requires no heap allocation.
+ *
+ *  @private
+ */
+struct EncoderStorage
+{
+    EncoderStorage(void) :
+        mArguments(),
+        mRecord(),
+        mCache()
+    {
+        return;
+    }
+
+    Arguments  mArguments;         //!< The message arguments.
+    string     mRecord;            //!< The message record.
+    CacheEntry mCache[kCacheSize]; //!< The cached format
+                                   //!< registrations.
+};
+
+static thread_local EncoderStorage sEncoder;
+
+/**
+ *  The serial number of the last recorder instantiated, such that
+ *  cached registrations never outlive the recorder they came from,
+ *  even should another be instantiated at the same address.
+ *
+ *  @private
+ */
+static std::atomic<uint64_t> sRecorders(0);
+
+template <typename T>
+static inline void
+Put(string & inRecord, const T & inValue)
+{
+    inRecord.append(reinterpret_cast<const char *>(&inValue), sizeof (T));
+}
+
+// Start a record of the specified type, with a placeholder size that
+// End fills in once the payload is complete.
+
+static inline void
+Begin(string & inRecord, Binary::Type inType)
+{
+    inRecord.clear();
+
+    Put(inRecord, static_cast<uint32_t>(0));
+    Put(inRecord, static_cast<uint8_t>(inType));
+}
+
+static inline void
+End(string & inRecord)
+{
+    const uint32_t theSize = static_cast<uint32_t>(inRecord.size() - sizeof (uint32_t));
+
+    memcpy(&inRecord[0], &theSize, sizeof (theSize));
+}
+
+static inline size_t
+CacheIndex(const char * inFormat)
+{
+    const uintptr_t theAddress = reinterpret_cast<uintptr_t>(inFormat);
+
+    return ((theAddress ^ (theAddress >> 6)) & (kCacheSize - 1));
+}
+
+}; // namespace
+
+/**
+ * Implementation of the @a Log::Recorder::Binary object.
+ *
+ * @private
+ */
+struct Binary::Implementation
+{
+    typedef std::unordered_map<const char *, uint32_t> IdentifierMap;
+
+    Implementation(Writer::Stdio & inWriter);
+
+    void WriteHeader(void);
+    uint32_t Register(const char * inFormat, const char *& outCopy);
+    uint32_t Lookup(const char * inFormat);
+    void WriteMessage(Indent inIndent, Level inLevel, const char * inFormat);
+
+    Writer::Stdio &         mWriter;      //!< The writer records are
+                                          //!< written to.
+    const uint64_t          mSerial;      //!< The serial number of the
+                                          //!< recorder.
+    std::mutex              mMutex;       //!< Guards format registration.
+    IdentifierMap           mIdentifiers; //!< The identifier for each
+                                          //!< format string address.
+    std::deque<std::string> mFormats;     //!< Copies of the registered
+                                          //!< format strings, by
+                                          //!< identifier, whose storage
+                                          //!< never moves.
+    std::atomic<size_t>     mCount;       //!< The number of registered
+                                          //!< formats.
+    std::atomic<uint64_t>   mWritten;     //!< The number of messages
+                                          //!< written.
+};
+
+Binary::
+Implementation::Implementation(Writer::Stdio & inWriter) :
+    mWriter(inWriter),
+    mSerial(sRecorders.fetch_add(1, std::memory_order_relaxed) + 1),
+    mMutex(),
+    mIdentifiers(),
+    mFormats(),
+    mCount(0),
+    mWritten(0)
+{
+    WriteHeader();
+}
+
+void
+Binary::
+Implementation::WriteHeader(void)
+{
+    string theRecord;
+
+    Begin(theRecord, Type::kHeader);
+
+    theRecord.append(kMagic, sizeof (kMagic));
+
+    Put(theRecord, kVersion);
+    Put(theRecord, kByteOrder);
+
+    // The sizes of the types arguments and stamps are captured as.
+
+    Put(theRecord, static_cast<uint8_t>(sizeof (int)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (long)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (long long)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (intmax_t)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (size_t)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (ptrdiff_t)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (double)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (long double)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (void *)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (wint_t)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (wchar_t)));
+    Put(theRecord, static_cast<uint8_t>(sizeof (pthread_t)));
+
+    End(theRecord);
+
+    mWriter.WriteData(theRecord.data(), theRecord.size());
+}
+
+// Register the format string, writing its definition ahead of any
+// message that refers to it. A format string at an address already
+// registered whose contents have since changed is registered anew.
+
+uint32_t
+Binary::
+Implementation::Register(const char * inFormat, const char *& outCopy)
+{
+    std::lock_guard<std::mutex> theLock(mMutex);
+    auto                        theIterator = mIdentifiers.find(inFormat);
+    uint32_t                    theIdentifier;
+    string                      theRecord;
+
+    if (theIterator != mIdentifiers.end()) {
+        theIdentifier = theIterator->second;
+
+        if (strcmp(mFormats[theIdentifier].c_str(), inFormat) == 0) {
+            outCopy = mFormats[theIdentifier].c_str();
+
+            return (theIdentifier);
+        }
+    }
+
+    theIdentifier = static_cast<uint32_t>(mFormats.size());
+
+    mFormats.push_back(inFormat);
+
+    Begin(theRecord, Type::kFormat);
+    Put(theRecord, theIdentifier);
+    theRecord.append(inFormat);
+    End(theRecord);
+
+    mWriter.WriteData(theRecord.data(), theRecord.size());
+
+    mIdentifiers[inFormat] = theIdentifier;
+    mCount.store(mFormats.size(), std::memory_order_relaxed);
+
+    outCopy = mFormats[theIdentifier].c_str();
+
+    return (theIdentifier);
+}
+
+// Look the format string up in the thread's cache, registering it on
+// a miss. The copy is only ever read here, and the recorder's copies
+// are never modified, so no lock is needed to confirm a hit.
+
+uint32_t
+Binary::
+Implementation::Lookup(const char * inFormat)
+{
+    CacheEntry & theEntry = sEncoder.mCache[CacheIndex(inFormat)];
+
+    if ((theEntry.mRecorder != mSerial) ||
+        (theEntry.mFormat != inFormat)  ||
+        (strcmp(theEntry.mCopy, inFormat) != 0)) {
+        theEntry.mIdentifier = Register(inFormat, theEntry.mCopy);
+        theEntry.mFormat     = inFormat;
+        theEntry.mRecorder   = mSerial;
+    }
+
+    return (theEntry.mIdentifier);
+}
+
+void
+Binary::
+Implementation::WriteMessage(Indent inIndent, Level inLevel, const char * inFormat)
+{
+    const Arguments & theArguments  = sEncoder.mArguments;
+    string &          theRecord     = sEncoder.mRecord;
+    const uint32_t    theIdentifier = Lookup(inFormat);
+    const pthread_t   theThread     = theArguments.GetThread();
+    struct timespec   theTime;
+
+    theArguments.GetTimestamp(theTime);
+
+    Begin(theRecord, Type::kMessage);
+
+    Put(theRecord, theIdentifier);
+    Put(theRecord, static_cast<uint32_t>(inLevel));
+    Put(theRecord, static_cast<uint32_t>(inIndent));
+    Put(theRecord, static_cast<int64_t>(theTime.tv_sec));
+    Put(theRecord, static_cast<uint32_t>(theTime.tv_nsec));
+    Put(theRecord, static_cast<int64_t>(theArguments.GetProcess()));
+    Put(theRecord, theThread);
+    Put(theRecord, static_cast<uint8_t>(theArguments.IsPreformatted()));
+
+    theRecord.append(theArguments.GetData());
+
+    End(theRecord);
+
+    mWriter.WriteData(theRecord.data(), theRecord.size());
+
+    mWritten.fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the recorder and writes a stream
+ *    header to the specified writer.
+ *
+ *  @note
+ *    The specified writer must be in scope for the duration of the
+ *    recorder instance scope and should not be written to other than
+ *    through the recorder.
+ *
+ *  @param[in]  inWriter  A reference to the writer to write binary
+ *                        records to, typically a Writer::Descriptor
+ *                        or Writer::Path.
+ *
+ */
+Binary::Binary(Writer::Stdio & inWriter) :
+    Base(),
+    mImplementation(new Implementation(inWriter))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ */
+Binary::~Binary(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Capture the arguments for a log message and write it as a
+ *    binary record.
+ *
+ *  @param[in]  inLogger     The logger the message was written to.
+ *  @param[in]  inIndent     The level of indentation desired for the
+ *                           message.
+ *  @param[in]  inLevel      The level the message is to be logged at.
+ *  @param[in]  inFormat     The log message, consisting of a
+ *                           printf-style format string composed of
+ *                           zero or more output conversion
+ *                           directives.
+ *  @param[in]  inArguments  A variable argument list, where each
+ *                           argument corresponds with its peer output
+ *                           conversion directive in @a inFormat.
+ *
+ *  @returns
+ *    True, since the recorder always takes the message.
+ *
+ */
+bool
+Binary::Record(Logger &     inLogger,
+               Indent       inIndent,
+               Level        inLevel,
+               const char * inFormat,
+               std::va_list inArguments)
+{
+    (void)inLogger;
+
+    if (inFormat != NULL) {
+        sEncoder.mArguments.Capture(inFormat, inArguments);
+
+        mImplementation->WriteMessage(inIndent, inLevel, inFormat);
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Capture the typed arguments for a log message and write it as
+ *    a binary record.
+ *
+ *  @param[in]  inLogger  The logger the message was written to.
+ *  @param[in]  inIndent  The level of indentation desired for the
+ *                        message.
+ *  @param[in]  inLevel   The level the message is to be logged at.
+ *  @param[in]  inFormat  The log message, consisting of a
+ *                        printf-style format string composed of
+ *                        zero or more output conversion directives.
+ *  @param[in]  inValues  The typed arguments, each corresponding with
+ *                        its peer output conversion directive in @a
+ *                        inFormat.
+ *
+ *  @returns
+ *    True, since the recorder always takes the message.
+ *
+ */
+bool
+Binary::Record(Logger &       inLogger,
+               Indent         inIndent,
+               Level          inLevel,
+               const char *   inFormat,
+               const Values & inValues)
+{
+    (void)inLogger;
+
+    if (inFormat != NULL) {
+        sEncoder.mArguments.Capture(inFormat, inValues);
+
+        mImplementation->WriteMessage(inIndent, inLevel, inFormat);
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Flush any records buffered by the writer's stream.
+ *
+ */
+void
+Binary::Flush(void)
+{
+    mImplementation->mWriter.Flush();
+}
+
+/**
+ *  @brief
+ *    Return the number of format strings registered.
+ *
+ */
+size_t
+Binary::GetFormats(void) const
+{
+    return (mImplementation->mCount.load(std::memory_order_relaxed));
+}
+
+/**
+ *  @brief
+ *    Return the number of messages written.
+ *
+ */
+uint64_t
+Binary::GetWritten(void) const
+{
+    return (mImplementation->mWritten.load(std::memory_order_relaxed));
+}
+
+}; // namespace Recorder
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -0,0 +1,338 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete
+ *      recorder implementation that captures message arguments on
+ *      the logging thread and formats and writes the message on a
+ *      dedicated backend thread.
+ */
+
+#include <functional>
+
+using namespace std;
+
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogBackend.hpp>
+#include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogRecorderDeferred.hpp>
+#include <LogUtilities/LogValues.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Recorder
+{
+
+const size_t Deferred::kCapacityDefault;
+
+/**
+ * Implementation of the @a Log::Recorder::Deferred object.
+ *
+ * @private
+ */
+struct Deferred::Implementation
+{
+    /**
+     * A message queued for the backend thread.
+     */
+    struct Record
+    {
+        Logger *     mLogger;    //!< The logger the message was
+                                 //!< written to.
+        Indent       mIndent;    //!< The indentation for the message.
+        Level        mLevel;     //!< The level the message is to be
+                                 //!< written at.
+        const char * mFormat;    //!< The message format string.
+        Arguments    mArguments; //!< The arguments captured against
+                                 //!< @a mFormat, whose storage is
+                                 //!< reused each time the record is
+                                 //!< refilled.
+    };
+
+    Implementation(size_t inCapacity, Overflow inOverflow);
+
+    void Drain(Record & inRecord);
+
+    Backend<Record> mBackend; //!< The queue of messages pending the
+                              //!< backend thread.
+};
+
+Deferred::
+Implementation::Implementation(size_t inCapacity, Overflow inOverflow) :
+    mBackend(inCapacity,
+             (inOverflow == Overflow::kBlock),
+             std::bind(&Implementation::Drain, this, std::placeholders::_1))
+{
+    return;
+}
+
+void
+Deferred::
+Implementation::Drain(Record & inRecord)
+{
+    inRecord.mLogger->Write(inRecord.mIndent,
+                            inRecord.mLevel,
+                            inRecord.mFormat,
+                            inRecord.mArguments);
+}
+
+/**
+ *  @brief
+ *    This is the class default constructor.
+ *
+ *    This constructor instantiates the recorder, with the default
+ *    queue capacity and the drop overflow policy, and starts its
+ *    backend thread.
+ *
+ */
+Deferred::Deferred(void) :
+    Base(),
+    mImplementation(new Implementation(kCapacityDefault, Overflow::kDrop))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the recorder, with the specified
+ *    queue capacity and the drop overflow policy, and starts its
+ *    backend thread.
+ *
+ *  @param[in]  inCapacity  The minimum number of messages that may be
+ *                          queued before the overflow policy applies.
+ *
+ */
+Deferred::Deferred(size_t inCapacity) :
+    Base(),
+    mImplementation(new Implementation(inCapacity, Overflow::kDrop))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the recorder, with the specified
+ *    queue capacity and overflow policy, and starts its backend
+ *    thread.
+ *
+ *  @param[in]  inCapacity  The minimum number of messages that may be
+ *                          queued before the overflow policy applies.
+ *  @param[in]  inOverflow  The policy to apply when a message is
+ *                          recorded while the queue is full.
+ *
+ */
+Deferred::Deferred(size_t inCapacity, Overflow inOverflow) :
+    Base(),
+    mImplementation(new Implementation(inCapacity, inOverflow))
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ *    Any queued messages are formatted and written before the
+ *    backend thread exits.
+ *
+ */
+Deferred::~Deferred(void)
+{
+    return;
+}
+
+/**
+ *  @brief
+ *    Capture the arguments for a log message and queue it for
+ *    formatting and writing from the backend thread.
+ *
+ *  @param[in]  inLogger     The logger the message was written to.
+ *  @param[in]  inIndent     The level of indentation desired for the
+ *                           message.
+ *  @param[in]  inLevel      The level the message is to be logged at.
+ *  @param[in]  inFormat     The log message, consisting of a
+ *                           printf-style format string composed of
+ *                           zero or more output conversion
+ *                           directives.
+ *  @param[in]  inArguments  A variable argument list, where each
+ *                           argument corresponds with its peer output
+ *                           conversion directive in @a inFormat.
+ *
+ *  @returns
+ *    True if the message was queued or dropped; otherwise, false, if
+ *    the backend thread has stopped and the logger should instead
+ *    write the message immediately.
+ *
+ */
+bool
+Deferred::Record(Logger &     inLogger,
+                 Indent       inIndent,
+                 Level        inLevel,
+                 const char * inFormat,
+                 std::va_list inArguments)
+{
+    typedef Implementation::Record Record;
+
+    if (mImplementation->mBackend.IsStopped()) {
+        return (false);
+    }
+
+    mImplementation->mBackend.Push([&](Record & inRecord) {
+        inRecord.mLogger = &inLogger;
+        inRecord.mIndent = inIndent;
+        inRecord.mLevel  = inLevel;
+        inRecord.mFormat = inFormat;
+
+        inRecord.mArguments.Capture(inFormat, inArguments);
+    });
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Capture the typed arguments for a log message and queue it for
+ *    formatting and writing from the backend thread.
+ *
+ *  @param[in]  inLogger  The logger the message was written to.
+ *  @param[in]  inIndent  The level of indentation desired for the
+ *                        message.
+ *  @param[in]  inLevel   The level the message is to be logged at.
+ *  @param[in]  inFormat  The log message, consisting of a
+ *                        printf-style format string composed of
+ *                        zero or more output conversion directives.
+ *  @param[in]  inValues  The typed arguments, each corresponding with
+ *                        its peer output conversion directive in @a
+ *                        inFormat.
+ *
+ *  @returns
+ *    True if the message was queued or dropped; otherwise, false, if
+ *    the backend thread has stopped and the logger should instead
+ *    write the message immediately.
+ *
+ */
+bool
+Deferred::Record(Logger &       inLogger,
+                 Indent         inIndent,
+                 Level          inLevel,
+                 const char *   inFormat,
+                 const Values & inValues)
+{
+    typedef Implementation::Record Record;
+
+    if (mImplementation->mBackend.IsStopped()) {
+        return (false);
+    }
+
+    mImplementation->mBackend.Push([&](Record & inRecord) {
+        inRecord.mLogger = &inLogger;
+        inRecord.mIndent = inIndent;
+        inRecord.mLevel  = inLevel;
+        inRecord.mFormat = inFormat;
+
+        inRecord.mArguments.Capture(inFormat, inValues);
+    });
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Wait until every message recorded before this call has been
+ *    formatted and written.
+ *
+ */
+void
+Deferred::Flush(void)
+{
+    mImplementation->mBackend.Flush();
+}
+
+/**
+ *  @brief
+ *    Format and write any queued messages and stop the backend
+ *    thread.
+ *
+ *  Messages recorded after the recorder has stopped are formatted
+ *  and written synchronously by the logger on the calling thread.
+ *  Stopping an already-stopped recorder has no effect.
+ *
+ */
+void
+Deferred::Stop(void)
+{
+    mImplementation->mBackend.Stop();
+}
+
+/**
+ *  @brief
+ *    Return the maximum number of messages that may be queued.
+ *
+ */
+size_t
+Deferred::GetCapacity(void) const
+{
+    return (mImplementation->mBackend.Capacity());
+}
+
+/**
+ *  @brief
+ *    Return the number of messages currently queued.
+ *
+ */
+size_t
+Deferred::GetDepth(void) const
+{
+    return (mImplementation->mBackend.Depth());
+}
+
+/**
+ *  @brief
+ *    Return the number of queued messages formatted and written.
+ *
+ */
+uint64_t
+Deferred::GetWritten(void) const
+{
+    return (mImplementation->mBackend.Drained());
+}
+
+/**
+ *  @brief
+ *    Return the number of messages discarded due to overflow.
+ *
+ */
+uint64_t
+Deferred::GetDropped(void) const
+{
+    return (mImplementation->mBackend.Dropped());
+}
+
+}; // namespace Recorder
+
+}; // namespace Log
+
+}; // namespace Nuovations
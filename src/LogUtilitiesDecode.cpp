@@ -0,0 +1,381 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a command line tool for decoding the
+ *      binary records written by Log::Recorder::Binary back into
+ *      text, in parallel.
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+#include <fcntl.h>
+#include <getopt.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <LogUtilities/LogDecoder.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogFormatterStamped.hpp>
+#include <LogUtilities/LogIndenterNone.hpp>
+#include <LogUtilities/LogIndenterSpace.hpp>
+#include <LogUtilities/LogIndenterTab.hpp>
+
+using namespace Nuovations;
+
+/**
+ *  The number of messages each thread decodes at a time.
+ */
+static const size_t kBlockSize = 4096;
+
+/**
+ *  Decoding options.
+ */
+struct Options
+{
+    const char * mFormatter; //!< The formatter name.
+    const char * mIndenter;  //!< The indenter name.
+    const char * mOutput;    //!< The output path, if any.
+    const char * mPrecision; //!< The stamped time precision name.
+    size_t       mJobs;      //!< The number of decoding threads.
+};
+
+static const char * sProgram = "logutilities-decode";
+
+static void
+Usage(FILE * inStream)
+{
+    fprintf(inStream,
+            "Usage: %s [ options ] <path>\n"
+            "\n"
+            "Decode a binary log, written by Log::Recorder::Binary, into text.\n"
+            "\n"
+            " Options:\n"
+            "\n"
+            "  -f, --formatter NAME   Format messages with the 'plain' (default) or\n"
+            "                         'stamped' formatter.\n"
+            "  -h, --help             Print this usage information and exit.\n"
+            "  -i, --indenter NAME    Indent messages with the 'none' (default),\n"
+            "                         'space', or 'tab' indenter.\n"
+            "  -j, --jobs N           Decode with N threads (default: one per CPU).\n"
+            "  -o, --output PATH      Write the decoded text to PATH rather than\n"
+            "                         standard output.\n"
+            "  -p, --precision NAME   Stamp times to the 's' (default), 'ms', 'us',\n"
+            "                         or 'ns' with the 'stamped' formatter.\n"
+            "\n",
+            sProgram);
+}
+
+static bool
+ParseOptions(int inArgc, char * const inArgv[], Options & outOptions, const char *& outPath)
+{
+    static const struct option kOptions[] = {
+        { "formatter", required_argument, NULL, 'f' },
+        { "help",      no_argument,       NULL, 'h' },
+        { "indenter",  required_argument, NULL, 'i' },
+        { "jobs",      required_argument, NULL, 'j' },
+        { "output",    required_argument, NULL, 'o' },
+        { "precision", required_argument, NULL, 'p' },
+        { NULL,        0,                 NULL, 0   }
+    };
+    int theOption;
+
+    outOptions.mFormatter = "plain";
+    outOptions.mIndenter  = "none";
+    outOptions.mOutput    = NULL;
+    outOptions.mPrecision = "s";
+    outOptions.mJobs      = std::max(std::thread::hardware_concurrency(), 1U);
+
+    while ((theOption = getopt_long(inArgc, inArgv, "f:hi:j:o:p:", kOptions, NULL)) != -1) {
+        switch (theOption) {
+
+        case 'f':
+            outOptions.mFormatter = optarg;
+            break;
+
+        case 'h':
+            Usage(stdout);
+            exit(EXIT_SUCCESS);
+
+        case 'i':
+            outOptions.mIndenter = optarg;
+            break;
+
+        case 'j':
+            {
+                char *              theEnd;
+                const unsigned long theJobs = strtoul(optarg, &theEnd, 10);
+
+                if ((*theEnd != '\0') || (theJobs == 0)) {
+                    fprintf(stderr, "%s: invalid number of jobs '%s'\n", sProgram, optarg);
+                    return (false);
+                }
+
+                outOptions.mJobs = theJobs;
+            }
+            break;
+
+        case 'o':
+            outOptions.mOutput = optarg;
+            break;
+
+        case 'p':
+            outOptions.mPrecision = optarg;
+            break;
+
+        default:
+            return (false);
+
+        }
+    }
+
+    if ((strcmp(outOptions.mFormatter, "plain") != 0) &&
+        (strcmp(outOptions.mFormatter, "stamped") != 0)) {
+        fprintf(stderr, "%s: unknown formatter '%s'\n", sProgram, outOptions.mFormatter);
+        return (false);
+    }
+
+    if ((strcmp(outOptions.mIndenter, "none") != 0) &&
+        (strcmp(outOptions.mIndenter, "space") != 0) &&
+        (strcmp(outOptions.mIndenter, "tab") != 0)) {
+        fprintf(stderr, "%s: unknown indenter '%s'\n", sProgram, outOptions.mIndenter);
+        return (false);
+    }
+
+    if ((strcmp(outOptions.mPrecision, "s") != 0) &&
+        (strcmp(outOptions.mPrecision, "ms") != 0) &&
+        (strcmp(outOptions.mPrecision, "us") != 0) &&
+        (strcmp(outOptions.mPrecision, "ns") != 0)) {
+        fprintf(stderr, "%s: unknown precision '%s'\n", sProgram, outOptions.mPrecision);
+        return (false);
+    }
+
+    if (optind != (inArgc - 1)) {
+        fprintf(stderr, "%s: expected exactly one input path\n", sProgram);
+        return (false);
+    }
+
+    outPath = inArgv[optind];
+
+    return (true);
+}
+
+static Log::Formatter::Base *
+CreateFormatter(const Options & inOptions)
+{
+    typedef Log::Formatter::Stamped::Resolution Resolution;
+
+    if (strcmp(inOptions.mFormatter, "stamped") == 0) {
+        Resolution theResolution = Resolution::kSeconds;
+
+        if (strcmp(inOptions.mPrecision, "ms") == 0) {
+            theResolution = Resolution::kMilliseconds;
+
+        } else if (strcmp(inOptions.mPrecision, "us") == 0) {
+            theResolution = Resolution::kMicroseconds;
+
+        } else if (strcmp(inOptions.mPrecision, "ns") == 0) {
+            theResolution = Resolution::kNanoseconds;
+
+        }
+
+        return (new Log::Formatter::Stamped(theResolution));
+    }
+
+    return (new Log::Formatter::Plain());
+}
+
+static Log::Indenter::Base *
+CreateIndenter(const Options & inOptions)
+{
+    if (strcmp(inOptions.mIndenter, "space") == 0) {
+        return (new Log::Indenter::Space());
+
+    } else if (strcmp(inOptions.mIndenter, "tab") == 0) {
+        return (new Log::Indenter::Tab());
+
+    }
+
+    return (new Log::Indenter::None());
+}
+
+// Decode the messages in the half-open range into text, appending
+// each to the output buffer. Messages that fail to decode are noted
+// in place such that the remainder of the log is still recovered.
+
+static void
+DecodeBlock(const Log::Decoder & inDecoder,
+            const Options &      inOptions,
+            size_t               inFirst,
+            size_t               inLast,
+            string &             outText)
+{
+    unique_ptr<Log::Formatter::Base> theFormatter(CreateFormatter(inOptions));
+    unique_ptr<Log::Indenter::Base>  theIndenter(CreateIndenter(inOptions));
+    string                           theMessage;
+    char                             theError[64];
+
+    outText.clear();
+
+    for (size_t theIndex = inFirst; theIndex < inLast; theIndex++) {
+        if (inDecoder.Decode(theIndex, *theFormatter, *theIndenter, theMessage)) {
+            outText.append(theMessage);
+
+        } else {
+            snprintf(theError, sizeof (theError), "<undecodable message %zu>\n", theIndex);
+
+            outText.append(theError);
+
+        }
+    }
+}
+
+// Decode all of the messages, a round of blocks at a time, one block
+// per thread, writing each round out in order as it completes.
+
+static bool
+DecodeAll(const Log::Decoder & inDecoder, const Options & inOptions, FILE * inStream)
+{
+    const size_t        theMessages = inDecoder.GetMessages();
+    vector<string>      theTexts(inOptions.mJobs);
+    vector<std::thread> theThreads;
+    size_t              theFirst = 0;
+
+    while (theFirst < theMessages) {
+        size_t theBlocks = 0;
+
+        theThreads.clear();
+
+        for (size_t theJob = 0; (theJob < inOptions.mJobs) && (theFirst < theMessages); theJob++) {
+            const size_t theLast = std::min(theFirst + kBlockSize, theMessages);
+
+            theThreads.push_back(std::thread(DecodeBlock,
+                                             std::cref(inDecoder),
+                                             std::cref(inOptions),
+                                             theFirst,
+                                             theLast,
+                                             std::ref(theTexts[theJob])));
+
+            theFirst = theLast;
+            theBlocks++;
+        }
+
+        for (size_t theBlock = 0; theBlock < theBlocks; theBlock++) {
+            theThreads[theBlock].join();
+        }
+
+        for (size_t theBlock = 0; theBlock < theBlocks; theBlock++) {
+            const string & theText = theTexts[theBlock];
+
+            if (fwrite(theText.data(), 1, theText.size(), inStream) != theText.size()) {
+                return (false);
+            }
+        }
+    }
+
+    return (true);
+}
+
+int
+main(int argc, char * const argv[])
+{
+    Options       theOptions;
+    const char *  thePath;
+    int           theDescriptor;
+    struct stat   theStat;
+    const void *  theData = NULL;
+    FILE *        theStream = stdout;
+    Log::Decoder  theDecoder;
+    int           theStatus = EXIT_SUCCESS;
+
+    if (!ParseOptions(argc, argv, theOptions, thePath)) {
+        Usage(stderr);
+        return (EXIT_FAILURE);
+    }
+
+    theDescriptor = open(thePath, O_RDONLY);
+
+    if ((theDescriptor < 0) || (fstat(theDescriptor, &theStat) != 0)) {
+        fprintf(stderr, "%s: %s: %s\n", sProgram, thePath, strerror(errno));
+        return (EXIT_FAILURE);
+    }
+
+    if (theStat.st_size > 0) {
+        theData = mmap(NULL, static_cast<size_t>(theStat.st_size), PROT_READ, MAP_PRIVATE, theDescriptor, 0);
+
+        if (theData == MAP_FAILED) {
+            fprintf(stderr, "%s: %s: %s\n", sProgram, thePath, strerror(errno));
+            close(theDescriptor);
+            return (EXIT_FAILURE);
+        }
+    }
+
+    close(theDescriptor);
+
+    // Index the whole log, sequentially, then decode what was
+    // indexed, in parallel.
+
+    if (!theDecoder.Load(theData, static_cast<size_t>(theStat.st_size))) {
+        fprintf(stderr,
+                "%s: %s: truncated, malformed, or incompatible record at offset %zu\n",
+                sProgram,
+                thePath,
+                theDecoder.GetLoaded());
+
+        theStatus = EXIT_FAILURE;
+    }
+
+    if (theOptions.mOutput != NULL) {
+        theStream = fopen(theOptions.mOutput, "w");
+
+        if (theStream == NULL) {
+            fprintf(stderr, "%s: %s: %s\n", sProgram, theOptions.mOutput, strerror(errno));
+            theStatus = EXIT_FAILURE;
+        }
+    }
+
+    if (theStream != NULL) {
+        if (!DecodeAll(theDecoder, theOptions, theStream) || (fflush(theStream) != 0)) {
+            fprintf(stderr, "%s: write failed: %s\n", sProgram, strerror(errno));
+            theStatus = EXIT_FAILURE;
+        }
+
+        if (theStream != stdout) {
+            fclose(theStream);
+        }
+    }
+
+    if (theData != NULL) {
+        munmap(const_cast<void *>(theData), static_cast<size_t>(theStat.st_size));
+    }
+
+    return (theStatus);
+}
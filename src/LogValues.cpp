@@ -0,0 +1,911 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Nuovations Log Utilities objects for the
+ *      typed arguments to a printf-style format string and for
+ *      performing output conversion against them directly.
+ */
+
+#include <LogUtilities/LogValues.hpp>
+#include <LogUtilities/LogFormatString.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <string>
+
+using namespace std;
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+/**
+ *  The longest conversion directive, including the leading '%',
+ *  that is regenerated for the printf engine.
+ */
+static const size_t kDirectiveMax = 64;
+
+using FormatString::Directive;
+using FormatString::Kind;
+
+/**
+ *  Take the argument at the specified position or, if there is none,
+ *  the next argument in sequence.
+ *
+ *  @returns
+ *    A pointer to the argument, or null if there is no such
+ *    argument.
+ *
+ */
+static const Value *
+Take(const Values & inValues, int inPosition, size_t & inNext)
+{
+    const size_t theIndex = (inPosition >= 0) ? static_cast<size_t>(inPosition) : inNext++;
+
+    return ((theIndex < inValues.Size()) ? &inValues[theIndex] : NULL);
+}
+
+/**
+ *  Take an argument for a '*' width or precision.
+ *
+ *  @returns
+ *    True if there was an integer argument; otherwise, false.
+ *
+ */
+static bool
+TakeStar(const Values & inValues, int inPosition, size_t & inNext, int & outStar)
+{
+    const Value * theValue = Take(inValues, inPosition, inNext);
+    intmax_t      theStar;
+
+    if ((theValue == NULL) || !theValue->GetInteger(theStar)) {
+        return (false);
+    }
+
+    outStar = static_cast<int>(theStar);
+
+    return (true);
+}
+
+// Adapt to whichever of the GNU or XSI strerror_r the platform has.
+
+static inline const char *
+ErrorString(int inStatus, const char * inBuffer)
+{
+    return ((inStatus == 0) ? inBuffer : "Unknown error");
+}
+
+static inline const char *
+ErrorString(const char * inResult, const char * inBuffer)
+{
+    (void)inBuffer;
+
+    return (inResult);
+}
+
+/**
+ *  Append @a inCount copies of @a inCharacter.
+ */
+static inline void
+Pad(string & inMessage, size_t inCount, char inCharacter)
+{
+    if (inCount > 0) {
+        inMessage.append(inCount, inCharacter);
+    }
+}
+
+/**
+ *  Append @a inLength characters of @a inText, padded to the width
+ *  of the directive.
+ */
+static void
+AppendText(string & inMessage, const Directive & inDirective, const char * inText, size_t inLength)
+{
+    const size_t theWidth = (inDirective.mWidth > 0) ? static_cast<size_t>(inDirective.mWidth) : 0;
+    const size_t thePad   = (theWidth > inLength) ? (theWidth - inLength) : 0;
+
+    if (!inDirective.mLeft) {
+        Pad(inMessage, thePad, ' ');
+    }
+
+    inMessage.append(inText, inLength);
+
+    if (inDirective.mLeft) {
+        Pad(inMessage, thePad, ' ');
+    }
+}
+
+/**
+ *  Append an integer, already reduced to the width its length
+ *  modifier calls for, as its magnitude and sign.
+ */
+static void
+AppendInteger(string &          inMessage,
+              const Directive & inDirective,
+              bool              inNegative,
+              uintmax_t         inMagnitude,
+              unsigned int      inBase)
+{
+    const char * const theDigitSet = (inDirective.mConversion == 'X') ? "0123456789ABCDEF" : "0123456789abcdef";
+    const bool         theSigned   = (inDirective.mConversion == 'd') || (inDirective.mConversion == 'i');
+    char               theDigits[sizeof (uintmax_t) * 3];
+    size_t             theCount    = 0;
+    const char *       thePrefix   = "";
+    size_t             theZeros    = 0;
+    size_t             theTotal;
+    size_t             theWidth;
+    uintmax_t          theMagnitude = inMagnitude;
+
+    // A zero value with a zero precision has no digits at all.
+
+    if ((theMagnitude != 0) || (inDirective.mPrecision != 0)) {
+        do {
+            theDigits[theCount++] = theDigitSet[theMagnitude % inBase];
+            theMagnitude /= inBase;
+        } while (theMagnitude != 0);
+    }
+
+    if ((inDirective.mPrecision > 0) && (static_cast<size_t>(inDirective.mPrecision) > theCount)) {
+        theZeros = static_cast<size_t>(inDirective.mPrecision) - theCount;
+    }
+
+    if (theSigned) {
+        if (inNegative) {
+            thePrefix = "-";
+        } else if (inDirective.mSign) {
+            thePrefix = "+";
+        } else if (inDirective.mSpace) {
+            thePrefix = " ";
+        }
+
+    } else if (inDirective.mAlternate) {
+        if (inBase == 8) {
+            if ((theZeros == 0) && ((theCount == 0) || (theDigits[theCount - 1] != '0'))) {
+                theZeros = 1;
+            }
+
+        } else if ((inBase == 16) && (inMagnitude != 0)) {
+            thePrefix = (inDirective.mConversion == 'X') ? "0X" : "0x";
+
+        }
+    }
+
+    theTotal = strlen(thePrefix) + theZeros + theCount;
+    theWidth = (inDirective.mWidth > 0) ? static_cast<size_t>(inDirective.mWidth) : 0;
+
+    // The '0' flag pads with zeros between the prefix and the digits,
+    // unless a precision is given or the value is left justified.
+
+    if (inDirective.mZero && !inDirective.mLeft && (inDirective.mPrecision < 0) && (theWidth > theTotal)) {
+        theZeros += theWidth - theTotal;
+        theTotal  = theWidth;
+    }
+
+    if (!inDirective.mLeft && (theWidth > theTotal)) {
+        Pad(inMessage, theWidth - theTotal, ' ');
+    }
+
+    inMessage.append(thePrefix);
+
+    Pad(inMessage, theZeros, '0');
+
+    while (theCount > 0) {
+        inMessage.push_back(theDigits[--theCount]);
+    }
+
+    if (inDirective.mLeft && (theWidth > theTotal)) {
+        Pad(inMessage, theWidth - theTotal, ' ');
+    }
+}
+
+/**
+ *  Regenerate the text of a directive, with any '*' width and
+ *  precision replaced by their values and with the specified
+ *  length modifier and conversion.
+ */
+static void
+Regenerate(const Directive & inDirective, const char * inLength, char inConversion, char * outText)
+{
+    char * theCursor = outText;
+
+    *theCursor++ = '%';
+
+    if (inDirective.mLeft) {
+        *theCursor++ = '-';
+    }
+
+    if (inDirective.mSign) {
+        *theCursor++ = '+';
+    }
+
+    if (inDirective.mSpace) {
+        *theCursor++ = ' ';
+    }
+
+    if (inDirective.mAlternate) {
+        *theCursor++ = '#';
+    }
+
+    if (inDirective.mZero) {
+        *theCursor++ = '0';
+    }
+
+    if (inDirective.mGrouping) {
+        *theCursor++ = '\'';
+    }
+
+    if (inDirective.mWidth >= 0) {
+        theCursor += snprintf(theCursor, 12, "%d", inDirective.mWidth);
+    }
+
+    if (inDirective.mPrecision >= 0) {
+        theCursor += snprintf(theCursor, 13, ".%d", inDirective.mPrecision);
+    }
+
+    while (*inLength != '\0') {
+        *theCursor++ = *inLength++;
+    }
+
+    *theCursor++ = inConversion;
+    *theCursor   = '\0';
+}
+
+/**
+ *  Append a signed integer conversion, reducing the argument to the
+ *  type its length modifier calls for, just as printf would.
+ */
+static void
+AppendSigned(string & inMessage, const Directive & inDirective, intmax_t inValue)
+{
+    char     theText[kDirectiveMax];
+    intmax_t theValue;
+
+    switch (inDirective.mLength[0]) {
+
+    case 'h':
+        theValue = (inDirective.mLength[1] == 'h') ? static_cast<signed char>(inValue) : static_cast<short>(inValue);
+        break;
+
+    case 'l':
+        theValue = (inDirective.mLength[1] == 'l') ? static_cast<long long>(inValue) : static_cast<long>(inValue);
+        break;
+
+    case 'L':
+    case 'q':
+        theValue = static_cast<long long>(inValue);
+        break;
+
+    case 'j':
+        theValue = inValue;
+        break;
+
+    case 'z':
+    case 'Z':
+        theValue = static_cast<ssize_t>(inValue);
+        break;
+
+    case 't':
+        theValue = static_cast<ptrdiff_t>(inValue);
+        break;
+
+    default:
+        theValue = static_cast<int>(inValue);
+        break;
+
+    }
+
+    if (inDirective.mGrouping) {
+        Regenerate(inDirective, "j", inDirective.mConversion, theText);
+
+        FormatString::Append(inMessage, theText, theValue);
+
+    } else {
+        AppendInteger(inMessage,
+                      inDirective,
+                      (theValue < 0),
+                      (theValue < 0) ? (0 - static_cast<uintmax_t>(theValue)) : static_cast<uintmax_t>(theValue),
+                      10);
+
+    }
+}
+
+/**
+ *  Append an unsigned integer conversion, reducing the argument to
+ *  the type its length modifier calls for, just as printf would.
+ */
+static void
+AppendUnsigned(string & inMessage, const Directive & inDirective, intmax_t inValue)
+{
+    const uintmax_t theBits = static_cast<uintmax_t>(inValue);
+    char            theText[kDirectiveMax];
+    uintmax_t       theValue;
+
+    switch (inDirective.mLength[0]) {
+
+    case 'h':
+        theValue = (inDirective.mLength[1] == 'h') ? static_cast<unsigned char>(theBits) : static_cast<unsigned short>(theBits);
+        break;
+
+    case 'l':
+        theValue = (inDirective.mLength[1] == 'l') ? static_cast<unsigned long long>(theBits) : static_cast<unsigned long>(theBits);
+        break;
+
+    case 'L':
+    case 'q':
+        theValue = static_cast<unsigned long long>(theBits);
+        break;
+
+    case 'j':
+        theValue = theBits;
+        break;
+
+    case 'z':
+    case 'Z':
+    case 't':
+        theValue = static_cast<size_t>(theBits);
+        break;
+
+    default:
+        theValue = static_cast<unsigned int>(theBits);
+        break;
+
+    }
+
+    if (inDirective.mGrouping) {
+        Regenerate(inDirective, "j", inDirective.mConversion, theText);
+
+        FormatString::Append(inMessage, theText, theValue);
+
+    } else {
+        AppendInteger(inMessage,
+                      inDirective,
+                      false,
+                      theValue,
+                      (inDirective.mConversion == 'u') ? 10 : ((inDirective.mConversion == 'o') ? 8 : 16));
+
+    }
+}
+
+/**
+ *  Append a string conversion.
+ */
+static void
+AppendString(string & inMessage, const Directive & inDirective, const char * inString)
+{
+    char theText[kDirectiveMax];
+
+    // Defer to the printf engine for how it renders a null string
+    // and for zero padding, both of which vary by platform.
+
+    if ((inString == NULL) || inDirective.mZero) {
+        Regenerate(inDirective, "", 's', theText);
+
+        FormatString::Append(inMessage, theText, inString);
+
+    } else {
+        const size_t theLength = (inDirective.mPrecision >= 0) ?
+            strnlen(inString, static_cast<size_t>(inDirective.mPrecision)) :
+            strlen(inString);
+
+        AppendText(inMessage, inDirective, inString, theLength);
+
+    }
+}
+
+/**
+ *  Perform output conversion of a single directive against its
+ *  argument.
+ *
+ *  @returns
+ *    True if the argument was of a type the directive can convert;
+ *    otherwise, false.
+ *
+ */
+static bool
+AppendValue(string & inMessage, const Directive & inDirective, const Value & inValue)
+{
+    char            theText[kDirectiveMax];
+    intmax_t        theInteger;
+    long double     theFloat;
+    const void *    thePointer;
+    const char *    theString;
+    const wchar_t * theWideString;
+
+    switch (inDirective.mConversion) {
+
+    case 'd':
+    case 'i':
+        if (!inValue.GetInteger(theInteger)) {
+            return (false);
+        }
+
+        AppendSigned(inMessage, inDirective, theInteger);
+        break;
+
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+        if (!inValue.GetInteger(theInteger)) {
+            return (false);
+        }
+
+        AppendUnsigned(inMessage, inDirective, theInteger);
+        break;
+
+    case 'c':
+        if (!inValue.GetInteger(theInteger)) {
+            return (false);
+        }
+
+        if ((inDirective.mLength[0] == 'l') || inDirective.mZero) {
+            Regenerate(inDirective, inDirective.mLength, 'c', theText);
+
+            FormatString::Append(inMessage, theText, static_cast<wint_t>(theInteger));
+
+        } else {
+            const char theCharacter = static_cast<char>(static_cast<unsigned char>(theInteger));
+
+            AppendText(inMessage, inDirective, &theCharacter, 1);
+
+        }
+        break;
+
+    case 'C':
+        if (!inValue.GetInteger(theInteger)) {
+            return (false);
+        }
+
+        Regenerate(inDirective, "", 'C', theText);
+
+        FormatString::Append(inMessage, theText, static_cast<wint_t>(theInteger));
+        break;
+
+    case 's':
+        if (inDirective.mLength[0] == 'l') {
+            if (!inValue.GetWideString(theWideString)) {
+                return (false);
+            }
+
+            Regenerate(inDirective, "l", 's', theText);
+
+            FormatString::Append(inMessage, theText, theWideString);
+
+        } else {
+            if (!inValue.GetString(theString)) {
+                return (false);
+            }
+
+            AppendString(inMessage, inDirective, theString);
+
+        }
+        break;
+
+    case 'S':
+        if (!inValue.GetWideString(theWideString)) {
+            return (false);
+        }
+
+        Regenerate(inDirective, "", 'S', theText);
+
+        FormatString::Append(inMessage, theText, theWideString);
+        break;
+
+    case 'p':
+        if (!inValue.GetPointer(thePointer)) {
+            return (false);
+        }
+
+        // Convert non-null pointers directly; how a null pointer and
+        // any flags or precision are rendered varies by platform.
+
+        if ((thePointer != NULL) &&
+            !inDirective.mSign && !inDirective.mSpace && !inDirective.mZero &&
+            (inDirective.mPrecision < 0)) {
+            Directive theHexadecimal = inDirective;
+
+            theHexadecimal.mConversion = 'x';
+            theHexadecimal.mAlternate  = true;
+
+            AppendInteger(inMessage,
+                          theHexadecimal,
+                          false,
+                          reinterpret_cast<uintptr_t>(thePointer),
+                          16);
+
+        } else {
+            Regenerate(inDirective, "", 'p', theText);
+
+            FormatString::Append(inMessage, theText, thePointer);
+
+        }
+        break;
+
+    case 'a':
+    case 'A':
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+        if (!inValue.GetFloat(theFloat)) {
+            return (false);
+        }
+
+        if (inDirective.mLength[0] == 'L') {
+            Regenerate(inDirective, "L", inDirective.mConversion, theText);
+
+            FormatString::Append(inMessage, theText, theFloat);
+
+        } else {
+            Regenerate(inDirective, "", inDirective.mConversion, theText);
+
+            FormatString::Append(inMessage, theText, static_cast<double>(theFloat));
+
+        }
+        break;
+
+    case 'n':
+        break;
+
+    default:
+        return (false);
+
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Return the type of the argument.
+ *
+ */
+Value::Type
+Value::GetType(void) const
+{
+    return (mType);
+}
+
+/**
+ *  @brief
+ *    Return the argument as an integer, if it is one.
+ *
+ *  Unsigned integers are returned with their bits unchanged and
+ *  pointers as their address, such that they may be reduced to any
+ *  integer type, as printf itself would.
+ *
+ *  @param[out]  outValue  The argument as an integer.
+ *
+ *  @returns
+ *    True if the argument is an integer or a pointer; otherwise,
+ *    false.
+ *
+ */
+bool
+Value::GetInteger(intmax_t & outValue) const
+{
+    switch (mType) {
+
+    case Type::kSigned:
+        outValue = mValue.mSigned;
+        break;
+
+    case Type::kUnsigned:
+        outValue = static_cast<intmax_t>(mValue.mUnsigned);
+        break;
+
+    case Type::kPointer:
+        outValue = static_cast<intmax_t>(reinterpret_cast<uintptr_t>(mValue.mPointer));
+        break;
+
+    default:
+        return (false);
+
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Return the argument as a floating point number, if it is a
+ *    number.
+ *
+ *  @param[out]  outValue  The argument as a floating point number.
+ *
+ *  @returns
+ *    True if the argument is a floating point number or an integer;
+ *    otherwise, false.
+ *
+ */
+bool
+Value::GetFloat(long double & outValue) const
+{
+    switch (mType) {
+
+    case Type::kSigned:
+        outValue = static_cast<long double>(mValue.mSigned);
+        break;
+
+    case Type::kUnsigned:
+        outValue = static_cast<long double>(mValue.mUnsigned);
+        break;
+
+    case Type::kDouble:
+        outValue = mValue.mDouble;
+        break;
+
+    case Type::kLongDouble:
+        outValue = mValue.mLongDouble;
+        break;
+
+    default:
+        return (false);
+
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Return the argument as a pointer, if it is one.
+ *
+ *  @param[out]  outValue  The argument as a pointer.
+ *
+ *  @returns
+ *    True if the argument is a pointer, including a string;
+ *    otherwise, false.
+ *
+ */
+bool
+Value::GetPointer(const void *& outValue) const
+{
+    switch (mType) {
+
+    case Type::kPointer:
+        outValue = mValue.mPointer;
+        break;
+
+    case Type::kString:
+        outValue = mValue.mString;
+        break;
+
+    case Type::kWideString:
+        outValue = mValue.mWideString;
+        break;
+
+    default:
+        return (false);
+
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Return the argument as a narrow string, if it is one.
+ *
+ *  @param[out]  outValue  The argument as a narrow string.
+ *
+ *  @returns
+ *    True if the argument is a narrow string or a null pointer;
+ *    otherwise, false.
+ *
+ */
+bool
+Value::GetString(const char *& outValue) const
+{
+    if (mType == Type::kString) {
+        outValue = mValue.mString;
+
+    } else if ((mType == Type::kPointer) && (mValue.mPointer == NULL)) {
+        outValue = NULL;
+
+    } else {
+        return (false);
+
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Return the argument as a wide string, if it is one.
+ *
+ *  @param[out]  outValue  The argument as a wide string.
+ *
+ *  @returns
+ *    True if the argument is a wide string or a null pointer;
+ *    otherwise, false.
+ *
+ */
+bool
+Value::GetWideString(const wchar_t *& outValue) const
+{
+    if (mType == Type::kWideString) {
+        outValue = mValue.mWideString;
+
+    } else if ((mType == Type::kPointer) && (mValue.mPointer == NULL)) {
+        outValue = NULL;
+
+    } else {
+        return (false);
+
+    }
+
+    return (true);
+}
+
+/**
+ *  @brief
+ *    Return whether the view is a literal one, for a format string
+ *    with no directives.
+ *
+ */
+bool
+Values::IsLiteral(void) const
+{
+    return (mLiteral);
+}
+
+/**
+ *  @brief
+ *    Return the number of arguments.
+ *
+ */
+size_t
+Values::Size(void) const
+{
+    return (mCount);
+}
+
+/**
+ *  @brief
+ *    Return the argument at the specified index, which must be less
+ *    than the number of arguments.
+ *
+ */
+const Value &
+Values::operator [](size_t inIndex) const
+{
+    return (mValues[inIndex]);
+}
+
+/**
+ *  @brief
+ *    Return the value of errno when the view was made.
+ *
+ */
+int
+Values::GetError(void) const
+{
+    return (mError);
+}
+
+/**
+ *  @brief
+ *    Perform output format conversion of the specified printf-style
+ *    format string against the arguments, appending the result to
+ *    the provided message.
+ *
+ *  Positional ("n$") directives are supported. Directives without a
+ *  matching argument are appended verbatim. The format string of a
+ *  literal view is appended as is.
+ *
+ *  @param[in,out]  inMessage  A reference to the message to append
+ *                             the formatted output to.
+ *  @param[in]      inFormat   A printf-style format string composed
+ *                             of zero or more output conversion
+ *                             directives.
+ *
+ */
+void
+Values::Render(std::string & inMessage, const char * inFormat) const
+{
+    const char * theCursor = inFormat;
+    const char * theStart;
+    size_t       theNext   = 0;
+    Directive    theDirective;
+
+    if (inFormat == NULL) {
+        return;
+    }
+
+    if (mLiteral) {
+        inMessage.append(inFormat);
+        return;
+    }
+
+    while ((theStart = strchr(theCursor, '%')) != NULL) {
+        const Value * theValue;
+        bool          theConverted = true;
+
+        inMessage.append(theCursor, static_cast<size_t>(theStart - theCursor));
+
+        if (!FormatString::Parse(theStart, theDirective)) {
+            inMessage.append(theStart);
+            return;
+        }
+
+        theCursor = theStart + theDirective.mSize;
+
+        if (theDirective.mKind == Kind::kPercent) {
+            inMessage.push_back('%');
+            continue;
+        }
+
+        if (theDirective.mWidthStar) {
+            theConverted = TakeStar(*this, theDirective.mWidthPosition, theNext, theDirective.mWidth);
+
+            if (theConverted && (theDirective.mWidth < 0)) {
+                theDirective.mLeft  = true;
+                theDirective.mWidth = -theDirective.mWidth;
+            }
+        }
+
+        if (theDirective.mPrecisionStar) {
+            theConverted = TakeStar(*this, theDirective.mPrecisionPosition, theNext, theDirective.mPrecision) && theConverted;
+
+            if (theDirective.mPrecision < 0) {
+                theDirective.mPrecision = -1;
+            }
+        }
+
+        if (theDirective.mKind == Kind::kError) {
+            char theBuffer[128];
+
+            theDirective.mConversion = 's';
+
+            AppendString(inMessage,
+                         theDirective,
+                         ErrorString(strerror_r(mError, theBuffer, sizeof (theBuffer)), theBuffer));
+            continue;
+        }
+
+        if (theConverted) {
+            theValue     = Take(*this, theDirective.mPosition, theNext);
+            theConverted = (theValue != NULL) && AppendValue(inMessage, theDirective, *theValue);
+        }
+
+        // Reproduce a directive that could not be converted, rather
+        // than guess at its argument.
+
+        if (!theConverted) {
+            inMessage.append(theStart, theDirective.mSize);
+        }
+    }
+
+    inMessage.append(theCursor);
+}
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -0,0 +1,499 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a Nuovations Log Utilities concrete writer
+ *      implementation that queues messages from the writing thread
+ *      and writes them to another writer from a dedicated backend
+ *      thread.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <string>
+
+using namespace std;
+
+#include <LogUtilities/LogBackend.hpp>
+#include <LogUtilities/LogClockMonotonic.hpp>
+#include <LogUtilities/LogWriterAsynchronous.hpp>
+
+namespace Nuovations
+{
+
+namespace Log
+{
+
+namespace Writer
+{
+
+const size_t Asynchronous::kCapacityDefault;
+
+static const Clock::Ticks kNanosecondsPerMillisecond = 1000000;
+
+// Return the clock queueing and writing are timed by, whose ticks
+// are nanoseconds.
+
+static const Clock::Base &
+GetLatencyClock(void)
+{
+    static const Clock::Monotonic sClock;
+
+    return (sClock);
+}
+
+/**
+ * Implementation of the @a Log::Writer::Asynchronous object.
+ *
+ * @private
+ */
+struct Asynchronous::Implementation
+{
+    /**
+     * A message queued for the backend thread.
+     */
+    struct Record
+    {
+        Level        mLevel;   //!< The level the message is to be written at.
+        bool         mValid;   //!< Whether the message is non-null.
+        Clock::Ticks mQueued;  //!< When the message was queued.
+        std::string  mMessage; //!< The message, whose capacity is reused
+                               //!< each time the record is refilled.
+    };
+
+    Implementation(Base & inWriter, size_t inCapacity, Overflow inOverflow, uint32_t inStallTimeout);
+
+    void Write(Level inLevel, const char * inMessage);
+    void Drain(Record & inRecord);
+    bool Wait(Clock::Ticks inStart) const;
+    bool IsStalled(Clock::Ticks inNow) const;
+
+    Base &                    mWriter;       //!< The writer the backend
+                                             //!< thread writes queued
+                                             //!< messages to.
+    const Clock::Ticks        mStallTimeout; //!< The longest a write may
+                                             //!< wait for room, or the
+                                             //!< target may take, in
+                                             //!< nanoseconds, or zero
+                                             //!< (0) for no limit.
+    std::atomic<Clock::Ticks> mWriting;      //!< When the backend thread
+                                             //!< began writing the current
+                                             //!< message, or zero (0) if
+                                             //!< it is not writing.
+    std::atomic<uint64_t>     mLatency;      //!< The total time, in
+                                             //!< nanoseconds, messages
+                                             //!< took from being queued to
+                                             //!< being written.
+    std::atomic<uint64_t>     mLatencyMax;   //!< The longest such time.
+    std::atomic<uint64_t>     mLatencyCount; //!< The number of messages
+                                             //!< @a mLatency covers.
+    Backend<Record>           mBackend;      //!< The queue of messages
+                                             //!< pending the backend
+                                             //!< thread.
+};
+
+Asynchronous::
+Implementation::Implementation(Base & inWriter, size_t inCapacity, Overflow inOverflow, uint32_t inStallTimeout) :
+    mWriter(inWriter),
+    mStallTimeout(static_cast<Clock::Ticks>(inStallTimeout) * kNanosecondsPerMillisecond),
+    mWriting(0),
+    mLatency(0),
+    mLatencyMax(0),
+    mLatencyCount(0),
+    mBackend(inCapacity,
+             (inOverflow == Overflow::kBlock),
+             std::bind(&Implementation::Drain, this, std::placeholders::_1))
+{
+    return;
+}
+
+void
+Asynchronous::
+Implementation::Write(Level inLevel, const char * inMessage)
+{
+    // Once the backend thread has exited, fall back to writing
+    // synchronously such that late messages are not lost.
+
+    if (mBackend.IsStopped()) {
+        mWriter.Write(inLevel, inMessage);
+        return;
+    }
+
+    const Clock::Ticks theQueued = GetLatencyClock().Now();
+
+    mBackend.Push([inLevel, inMessage, theQueued](Record & inRecord) {
+        inRecord.mLevel  = inLevel;
+        inRecord.mValid  = (inMessage != NULL);
+        inRecord.mQueued = theQueued;
+
+        if (inMessage != NULL) {
+            inRecord.mMessage.assign(inMessage);
+        } else {
+            inRecord.mMessage.clear();
+        }
+    },
+    [this, theQueued](void) {
+        return (Wait(theQueued));
+    });
+}
+
+void
+Asynchronous::
+Implementation::Drain(Record & inRecord)
+{
+    const Clock::Base & theClock = GetLatencyClock();
+    Clock::Ticks        theNow   = theClock.Now();
+    uint64_t            theLatency;
+
+    // Zero (0) means idle, so a writer that begins at the clock's
+    // origin is marked as beginning just after it.
+
+    mWriting.store(std::max<Clock::Ticks>(theNow, 1), std::memory_order_relaxed);
+
+    mWriter.Write(inRecord.mLevel,
+                  inRecord.mValid ? inRecord.mMessage.c_str() : NULL);
+
+    mWriting.store(0, std::memory_order_relaxed);
+
+    theNow     = theClock.Now();
+    theLatency = static_cast<uint64_t>(std::max<Clock::Ticks>(theNow - inRecord.mQueued, 0));
+
+    // Only the backend thread, or the thread stopping it once it has
+    // exited, drains, so the maximum need not be updated atomically.
+
+    mLatency.fetch_add(theLatency, std::memory_order_relaxed);
+    mLatencyCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (theLatency > mLatencyMax.load(std::memory_order_relaxed)) {
+        mLatencyMax.store(theLatency, std::memory_order_relaxed);
+    }
+}
+
+// Return whether a write, queued at the specified time and finding
+// the queue full, should keep waiting for room.
+
+bool
+Asynchronous::
+Implementation::Wait(Clock::Ticks inStart) const
+{
+    Clock::Ticks theNow;
+
+    if (mStallTimeout == 0) {
+        return (true);
+    }
+
+    theNow = GetLatencyClock().Now();
+
+    return (((theNow - inStart) < mStallTimeout) && !IsStalled(theNow));
+}
+
+// Return whether the backend thread has, as of the specified time,
+// been writing the current message for at least the stall timeout.
+
+bool
+Asynchronous::
+Implementation::IsStalled(Clock::Ticks inNow) const
+{
+    const Clock::Ticks theWriting = mWriting.load(std::memory_order_relaxed);
+
+    return ((mStallTimeout != 0) &&
+            (theWriting != 0) &&
+            ((inNow - theWriting) >= mStallTimeout));
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the writer, with the default
+ *    queue capacity and the drop overflow policy, and starts its
+ *    backend thread.
+ *
+ *  @param[in]  inWriter  A reference to the writer that queued
+ *                        messages are written to from the backend
+ *                        thread. Its lifetime must exceed that of
+ *                        this writer.
+ *
+ */
+Asynchronous::Asynchronous(Base & inWriter) :
+    Base(),
+    mImplementation(new Implementation(inWriter, kCapacityDefault, Overflow::kDrop, 0))
+{
+    Adopt(inWriter);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the writer, with the specified
+ *    queue capacity and the drop overflow policy, and starts its
+ *    backend thread.
+ *
+ *  @param[in]  inWriter    A reference to the writer that queued
+ *                          messages are written to from the backend
+ *                          thread. Its lifetime must exceed that of
+ *                          this writer.
+ *  @param[in]  inCapacity  The minimum number of messages that may be
+ *                          queued before the overflow policy applies.
+ *
+ */
+Asynchronous::Asynchronous(Base & inWriter, size_t inCapacity) :
+    Base(),
+    mImplementation(new Implementation(inWriter, inCapacity, Overflow::kDrop, 0))
+{
+    Adopt(inWriter);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the writer, with the specified
+ *    queue capacity and overflow policy, and starts its backend
+ *    thread.
+ *
+ *  @param[in]  inWriter    A reference to the writer that queued
+ *                          messages are written to from the backend
+ *                          thread. Its lifetime must exceed that of
+ *                          this writer.
+ *  @param[in]  inCapacity  The minimum number of messages that may be
+ *                          queued before the overflow policy applies.
+ *  @param[in]  inOverflow  The policy to apply when a message is
+ *                          written while the queue is full.
+ *
+ */
+Asynchronous::Asynchronous(Base & inWriter, size_t inCapacity, Overflow inOverflow) :
+    Base(),
+    mImplementation(new Implementation(inWriter, inCapacity, inOverflow, 0))
+{
+    Adopt(inWriter);
+}
+
+/**
+ *  @brief
+ *    This is a class constructor.
+ *
+ *    This constructor instantiates the writer, with the specified
+ *    queue capacity, overflow policy, and stall timeout, and starts
+ *    its backend thread.
+ *
+ *  @param[in]  inWriter        A reference to the writer that queued
+ *                              messages are written to from the
+ *                              backend thread. Its lifetime must
+ *                              exceed that of this writer.
+ *  @param[in]  inCapacity      The minimum number of messages that
+ *                              may be queued before the overflow
+ *                              policy applies.
+ *  @param[in]  inOverflow      The policy to apply when a message is
+ *                              written while the queue is full.
+ *  @param[in]  inStallTimeout  The longest, in milliseconds, a write
+ *                              may wait for room under the blocking
+ *                              policy, and after which a write to
+ *                              the target writer is considered
+ *                              stalled, or zero (0) for no limit.
+ *
+ */
+Asynchronous::Asynchronous(Base & inWriter, size_t inCapacity, Overflow inOverflow, uint32_t inStallTimeout) :
+    Base(),
+    mImplementation(new Implementation(inWriter, inCapacity, inOverflow, inStallTimeout))
+{
+    Adopt(inWriter);
+}
+
+/**
+ *  @brief
+ *    This is the class destructor.
+ *
+ *    Any queued messages are written before the backend thread
+ *    exits.
+ *
+ */
+Asynchronous::~Asynchronous(void)
+{
+    Disown(mImplementation->mWriter);
+}
+
+/**
+ *  @brief
+ *    Queue a log message at the specified level for writing from the
+ *    backend thread.
+ *
+ *  If the backend thread has been stopped, the message is instead
+ *  written synchronously.
+ *
+ *  @param[in]  inLevel    The level the current message is to be logged
+ *                         at.
+ *  @param[in]  inMessage  The log message to write.
+ *
+ */
+void
+Asynchronous::Write(Level inLevel, const char * inMessage)
+{
+    mImplementation->Write(inLevel, inMessage);
+}
+
+/**
+ *  @brief
+ *    Queue a log message at the default level for writing from the
+ *    backend thread.
+ *
+ *  @param[in]  inMessage  The log message to write.
+ *
+ */
+void
+Asynchronous::Write(const char * inMessage)
+{
+    static const Log::Level kLevel = 0;
+
+    Write(kLevel, inMessage);
+}
+
+/**
+ *  @brief
+ *    Return the levels the target writer may write messages at.
+ *
+ */
+uint64_t
+Asynchronous::GetLevels(void) const
+{
+    return (mImplementation->mWriter.GetLevels());
+}
+
+/**
+ *  @brief
+ *    Wait until every message queued before this call has been
+ *    written to the target writer.
+ *
+ */
+void
+Asynchronous::Flush(void)
+{
+    mImplementation->mBackend.Flush();
+}
+
+/**
+ *  @brief
+ *    Write any queued messages and stop the backend thread.
+ *
+ *  Messages written after the writer has stopped are written
+ *  synchronously on the calling thread. Stopping an already-stopped
+ *  writer has no effect.
+ *
+ */
+void
+Asynchronous::Stop(void)
+{
+    mImplementation->mBackend.Stop();
+}
+
+/**
+ *  @brief
+ *    Return the maximum number of messages that may be queued.
+ *
+ */
+size_t
+Asynchronous::GetCapacity(void) const
+{
+    return (mImplementation->mBackend.Capacity());
+}
+
+/**
+ *  @brief
+ *    Return the number of messages currently queued.
+ *
+ */
+size_t
+Asynchronous::GetDepth(void) const
+{
+    return (mImplementation->mBackend.Depth());
+}
+
+/**
+ *  @brief
+ *    Return the number of queued messages written to the target
+ *    writer.
+ *
+ */
+uint64_t
+Asynchronous::GetWritten(void) const
+{
+    return (mImplementation->mBackend.Drained());
+}
+
+/**
+ *  @brief
+ *    Return the number of messages discarded due to overflow.
+ *
+ */
+uint64_t
+Asynchronous::GetDropped(void) const
+{
+    return (mImplementation->mBackend.Dropped());
+}
+
+/**
+ *  @brief
+ *    Return the mean time, in nanoseconds, messages have taken from
+ *    being queued to being written to the target writer.
+ *
+ */
+uint64_t
+Asynchronous::GetMeanLatency(void) const
+{
+    const uint64_t theCount = mImplementation->mLatencyCount.load(std::memory_order_relaxed);
+
+    if (theCount == 0) {
+        return (0);
+    }
+
+    return (mImplementation->mLatency.load(std::memory_order_relaxed) / theCount);
+}
+
+/**
+ *  @brief
+ *    Return the longest time, in nanoseconds, a message has taken
+ *    from being queued to being written to the target writer.
+ *
+ */
+uint64_t
+Asynchronous::GetMaxLatency(void) const
+{
+    return (mImplementation->mLatencyMax.load(std::memory_order_relaxed));
+}
+
+/**
+ *  @brief
+ *    Return whether the backend thread has been inside a single
+ *    write to the target writer for at least the stall timeout.
+ *
+ *  A writer without a stall timeout is never considered stalled.
+ *
+ */
+bool
+Asynchronous::IsStalled(void) const
+{
+    return (mImplementation->IsStalled(GetLatencyClock().Now()));
+}
+
+}; // namespace Writer
+
+}; // namespace Log
+
+}; // namespace Nuovations
@@ -24,6 +24,8 @@
 
 #include <LogUtilities/LogWriterBase.hpp>
 
+#include <LogUtilities/LogFilterGate.hpp>
+
 namespace Nuovations
 {
 
@@ -38,7 +40,8 @@ namespace Writer
  *    This is the class default constructor.
  *
  */
-Base::Base(void)
+Base::Base(void) :
+    Owned()
 {
     return;
 }
@@ -53,6 +56,39 @@ Base::~Base(void)
     return;
 }
 
+/**
+ *  @brief
+ *    Return the levels the writer may write messages at.
+ *
+ *  A logger gates messages on these, alongside its filter, such that
+ *  a message no writer would write is rejected before it is
+ *  formatted (see Log::Filter::Gate).
+ *
+ *  Writers that override this must call #Invalidate whenever their
+ *  levels may have changed. This may be called, from any thread,
+ *  while messages are being written.
+ *
+ *  @returns
+ *    A bitmap with bit N set if messages at level N may be written,
+ *    where the last bit stands for that level and every one above
+ *    it. By default, every bit is set.
+ *
+ */
+uint64_t
+Base::GetLevels(void) const
+{
+    return (~static_cast<uint64_t>(0));
+}
+
+// Refresh the gates of the writer, whose levels may have changed
+// (see Owned::Invalidate).
+
+void
+Base::RefreshGates(void) const
+{
+    Filter::Gate::Refresh(*this);
+}
+
 }; // namespace Writer
 
 }; // namespace Log
@@ -24,6 +24,10 @@
 
 #include <LogUtilities/LogWriterChain.hpp>
 
+#include <algorithm>
+
+#include <LogUtilities/LogFilterGate.hpp>
+
 namespace Nuovations
 {
 
@@ -33,9 +37,33 @@ namespace Log
 namespace Writer
 {
 
-Chain::Chain(void)
+const Level Chain::kLevelMaximum;
+
+Chain::Chain(void) :
+    mRoutes(new routes_type()),
+    mCopies(new copies_type())
 {
-    return;
+    mCopies->push_back(this);
+}
+
+/**
+ *  @brief
+ *    This is the class copy constructor.
+ *
+ *  The copy shares the links, and their routes, of the chain copied.
+ *
+ *  @param[in]  inChain  An immutable reference to the chain to copy.
+ *
+ */
+Chain::Chain(const Chain & inChain) :
+    Log::Chain<Base>(inChain),
+    Base(inChain),
+    mRoutes(inChain.mRoutes),
+    mCopies(inChain.mCopies)
+{
+    mCopies->push_back(this);
+
+    AdoptLinks();
 }
 
 /**
@@ -45,19 +73,219 @@ Chain::Chain(void)
  */
 Chain::~Chain(void)
 {
-    return;
+    DisownLinks();
+
+    mCopies->erase(std::find(mCopies->begin(), mCopies->end(), this));
+}
+
+/**
+ *  @brief
+ *    This is the class assignment operator.
+ *
+ *  The chain shares the links, and their routes, of the chain
+ *  assigned from, in place of its own.
+ *
+ *  @param[in]  inChain  An immutable reference to the chain to
+ *                       assign from.
+ *
+ *  @returns
+ *    A reference to the chain.
+ *
+ */
+Chain &
+Chain::operator =(const Chain & inChain)
+{
+    if (this != &inChain) {
+        DisownLinks();
+
+        mCopies->erase(std::find(mCopies->begin(), mCopies->end(), this));
+
+        // Release the routes before the links, such that, where this
+        // was the last copy, the queues write what they hold to, and
+        // let go of, links that are still there.
+
+        mRoutes = inChain.mRoutes;
+
+        Log::Chain<Base>::operator =(inChain);
+        Base::operator =(inChain);
+
+        mCopies = inChain.mCopies;
+
+        mCopies->push_back(this);
+
+        AdoptLinks();
+
+        InvalidateCopies();
+    }
+
+    return (*this);
+}
+
+/**
+ *  @brief
+ *   Remove the trailing link of the chain.
+ *
+ *  If the link has a queue of its own, any messages queued for it are
+ *  written before it is removed.
+ *
+ */
+void
+Chain::Pop(void)
+{
+    DisownTrailingLink();
+
+    mRoutes->pop_back();
+
+    Log::Chain<Base>::Pop();
+
+    InvalidateCopies();
+}
+
+/**
+ *  @brief
+ *    Removes all links from the chain (which are destroyed), leaving
+ *    the chain with a size of zero (0).
+ *
+ *  Any messages queued for links with queues of their own are written
+ *  before the links are removed.
+ *
+ */
+void
+Chain::Reset(void)
+{
+    DisownSharedLinks();
+
+    mRoutes->clear();
+
+    Log::Chain<Base>::Reset();
+
+    InvalidateCopies();
+}
+
+/**
+ *  @brief
+ *    Return the queue of the specified link, if it has one.
+ *
+ *  The queue reports how many messages the link has had written and
+ *  dropped, and how long they took to be written.
+ *
+ *  @param[in]  inIndex  The zero-based index of the link whose queue
+ *                       to return.
+ *
+ *  @returns
+ *    A pointer to the queue of the link, if it was pushed with one;
+ *    otherwise, null.
+ *
+ */
+Asynchronous *
+Chain::GetQueue(size_t inIndex) const
+{
+    if (inIndex >= mRoutes->size()) {
+        return (NULL);
+    }
+
+    return ((*mRoutes)[inIndex].mQueue.get());
+}
+
+/**
+ *  @brief
+ *    Limit the specified link to an inclusive range of levels.
+ *
+ *  As with pushing and popping links, this must not race with writes
+ *  to the chain or its copies.
+ *
+ *  @param[in]  inIndex    The zero-based index of the link to limit.
+ *  @param[in]  inMinimum  The lowest level the link is written to at.
+ *  @param[in]  inMaximum  The highest level the link is written to at.
+ *
+ */
+void
+Chain::SetLevels(size_t inIndex, Level inMinimum, Level inMaximum)
+{
+    if (inIndex >= mRoutes->size()) {
+        return;
+    }
+
+    (*mRoutes)[inIndex].mMinimum = inMinimum;
+    (*mRoutes)[inIndex].mMaximum = inMaximum;
+
+    InvalidateCopies();
+}
+
+/**
+ *  @brief
+ *    Return the levels the chain may write messages at.
+ *
+ *  This is the union, over the links, of the levels each link both
+ *  is limited to and may itself write at. An empty chain writes at
+ *  no level.
+ *
+ *  @returns
+ *    A bitmap with bit N set if messages at level N may be written,
+ *    where the last bit stands for that level and every one above it.
+ *
+ */
+uint64_t
+Chain::GetLevels(void) const
+{
+    container_type::const_iterator current   = Container().begin();
+    container_type::const_iterator end       = Container().end();
+    routes_type::const_iterator    route     = mRoutes->begin();
+    uint64_t                       theLevels = 0;
+
+    while (current != end) {
+        theLevels |= (Filter::Gate::GetLevels(route->mMinimum, route->mMaximum) &
+                      (*current)->GetLevels());
+
+        std::advance(current, 1);
+        std::advance(route, 1);
+    }
+
+    return (theLevels);
+}
+
+/**
+ *  @brief
+ *    Wait until every message queued, for any link, before this call
+ *    has been written.
+ *
+ */
+void
+Chain::Flush(void)
+{
+    routes_type::const_iterator current = mRoutes->begin();
+    routes_type::const_iterator end     = mRoutes->end();
+
+    while (current != end) {
+        if (current->mQueue) {
+            current->mQueue->Flush();
+        }
+
+        std::advance(current, 1);
+    }
 }
 
 void
 Chain::Write(Level inLevel, const char * inMessage)
 {
-    container_type::iterator current = Container().begin();
-    container_type::iterator end     = Container().end();
+    container_type::iterator    current = Container().begin();
+    container_type::iterator    end     = Container().end();
+    routes_type::const_iterator route   = mRoutes->begin();
 
     while (current != end) {
-        (*current)->Write(inLevel, inMessage);
+        if ((inLevel < route->mMinimum) || (inLevel > route->mMaximum)) {
+            // The link is not written to at this level.
+
+        } else if (route->mQueue) {
+            route->mQueue->Write(inLevel, inMessage);
+
+        } else {
+            (*current)->Write(inLevel, inMessage);
 
-        advance(current, 1);
+        }
+
+        std::advance(current, 1);
+        std::advance(route, 1);
     }
 }
 
@@ -67,6 +295,167 @@ Chain::Write(const char * inMessage)
     Write(0, inMessage);
 }
 
+// Route messages to the link just pushed at the specified levels.
+
+void
+Chain::AddRoute(Level inMinimum, Level inMaximum)
+{
+    Route theRoute;
+
+    theRoute.mMinimum = inMinimum;
+    theRoute.mMaximum = inMaximum;
+
+    AppendRoute(theRoute);
+}
+
+// Route messages to the link just pushed, at every level, through a
+// queue of its own. Should the queue not be created, the link is
+// popped again.
+
+void
+Chain::AddRoute(size_t inCapacity, Asynchronous::Overflow inOverflow, uint32_t inStallTimeout)
+{
+    Route theRoute;
+
+    theRoute.mMinimum = 0;
+    theRoute.mMaximum = kLevelMaximum;
+
+    try {
+        theRoute.mQueue.reset(new Asynchronous(*Container().back(),
+                                               inCapacity,
+                                               inOverflow,
+                                               inStallTimeout));
+    } catch (...) {
+        Log::Chain<Base>::Pop();
+        throw;
+    }
+
+    AppendRoute(theRoute);
+}
+
+// Append the specified route, to the link just pushed, such that the
+// links and routes stay in step. Should that fail, the route, and
+// then the link, are removed again.
+
+void
+Chain::AppendRoute(Route & inRoute)
+{
+    try {
+        mRoutes->push_back(inRoute);
+
+        AdoptTrailingLink();
+    } catch (...) {
+        DisownTrailingLink();
+
+        if (mRoutes->size() == Size()) {
+            mRoutes->pop_back();
+        }
+
+        inRoute.mQueue.reset();
+
+        Log::Chain<Base>::Pop();
+        throw;
+    }
+
+    InvalidateCopies();
+}
+
+// Record that the chain holds each of its links (see
+// Owned::Adopt).
+
+void
+Chain::AdoptLinks(void)
+{
+    container_type::iterator current = Container().begin();
+    container_type::iterator end     = Container().end();
+
+    while (current != end) {
+        Adopt(**current);
+
+        std::advance(current, 1);
+    }
+}
+
+// Record that the chain no longer holds its links (see
+// Owned::Disown), which may outlive it in copies of it.
+
+void
+Chain::DisownLinks(void)
+{
+    container_type::iterator current = Container().begin();
+    container_type::iterator end     = Container().end();
+
+    while (current != end) {
+        Disown(**current);
+
+        std::advance(current, 1);
+    }
+}
+
+// Record that every copy of the chain, each sharing its links, holds
+// the link just pushed.
+
+void
+Chain::AdoptTrailingLink(void)
+{
+    copies_type::const_iterator current = mCopies->begin();
+    copies_type::const_iterator end     = mCopies->end();
+
+    while (current != end) {
+        (*current)->Adopt(*Container().back());
+
+        std::advance(current, 1);
+    }
+}
+
+// Record that no copy of the chain, each sharing its links, holds
+// the link about to be popped.
+
+void
+Chain::DisownTrailingLink(void)
+{
+    copies_type::const_iterator current = mCopies->begin();
+    copies_type::const_iterator end     = mCopies->end();
+
+    while (current != end) {
+        (*current)->Disown(*Container().back());
+
+        std::advance(current, 1);
+    }
+}
+
+// Record that no copy of the chain holds any of the links about to be
+// removed.
+
+void
+Chain::DisownSharedLinks(void)
+{
+    copies_type::const_iterator current = mCopies->begin();
+    copies_type::const_iterator end     = mCopies->end();
+
+    while (current != end) {
+        (*current)->DisownLinks();
+
+        std::advance(current, 1);
+    }
+}
+
+// Invalidate every copy of the chain, since the links, and so the
+// levels, each shares with it have changed.
+
+void
+Chain::InvalidateCopies(void)
+{
+    copies_type::const_iterator current = mCopies->begin();
+    copies_type::const_iterator end     = mCopies->end();
+
+    while (current != end) {
+        (*current)->Invalidate();
+
+        std::advance(current, 1);
+    }
+}
+
 }; // namespace Writer
 
 }; // namespace Log
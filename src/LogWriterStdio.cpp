@@ -116,6 +116,37 @@ Stdio::Write(const char * inMessage)
     Write(kLevel, inMessage);
 }
 
+/**
+ *  @brief
+ *    Write raw, binary data.
+ *
+ *  The data is written with a single call to fwrite(3) such that,
+ *  as with messages, data written concurrently from several threads
+ *  is not interleaved.
+ *
+ *  @param[in]  inData  A pointer to the data to write.
+ *  @param[in]  inSize  The size, in bytes, of @a inData.
+ *
+ */
+void
+Stdio::WriteData(const void * inData, size_t inSize)
+{
+    if ((inData != NULL) && (inSize > 0)) {
+        fwrite(inData, 1, inSize, mStream);
+    }
+}
+
+/**
+ *  @brief
+ *    Flush any data buffered by the stream.
+ *
+ */
+void
+Stdio::Flush(void)
+{
+    fflush(mStream);
+}
+
 /**
  *  @brief
  *    This sets the stream for the writer.
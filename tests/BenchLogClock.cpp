@@ -0,0 +1,150 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of the cost of reading each
+ *      Log::Clock and of stamping a message with it.
+ */
+
+#include <LogUtilities/LogClock.hpp>
+#include <LogUtilities/LogFormatterStamped.hpp>
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+
+#include <stdint.h>
+
+
+using namespace Nuovations;
+
+namespace
+{
+
+// A clock reading time(NULL), as Formatter::Stamped once did, as a
+// baseline.
+
+class Seconds :
+    public Log::Clock::Base
+{
+public:
+    virtual Log::Clock::Ticks Now(void) const
+    {
+        return (static_cast<Log::Clock::Ticks>(time(NULL)));
+    }
+
+    virtual void Convert(Log::Clock::Ticks inTicks, struct timespec & outTime) const
+    {
+        outTime.tv_sec  = static_cast<time_t>(inTicks);
+        outTime.tv_nsec = 0;
+    }
+};
+
+typedef std::chrono::steady_clock Timer;
+
+// Format a message into the specified buffer, as Log::Logger does.
+
+void
+Format(Log::Formatter::Stamped & inFormatter, std::string & outMessage, const char * inFormat, ...)
+{
+    va_list lList;
+
+    va_start(lList, inFormat);
+
+    inFormatter.Format(outMessage, 1, inFormat, lList);
+
+    va_end(lList);
+}
+
+// Return the mean cost, in nanoseconds, of the specified operation
+// over the specified number of iterations.
+
+template <typename Operation>
+double
+Measure(size_t inIterations, Operation inOperation)
+{
+    const Timer::time_point lStart = Timer::now();
+
+    for (size_t lIteration = 0; lIteration < inIterations; lIteration++) {
+        inOperation();
+    }
+
+    const Timer::duration lElapsed = Timer::now() - lStart;
+
+    return (static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(lElapsed).count()) /
+            static_cast<double>(inIterations));
+}
+
+void
+Bench(const char * inName, const Log::Clock::Base & inClock, size_t inIterations)
+{
+    typedef Log::Formatter::Stamped::Resolution Resolution;
+    Log::Formatter::Stamped lFormatter(inClock, Resolution::kMicroseconds);
+    volatile int64_t        lSink = 0;
+    struct timespec         lTime;
+    std::string             lMessage;
+    double                  lNow;
+    double                  lConvert;
+    double                  lStamp;
+
+    lNow = Measure(inIterations, [&](void) {
+        lSink = lSink + inClock.Now();
+    });
+
+    lConvert = Measure(inIterations, [&](void) {
+        inClock.Convert(inClock.Now(), lTime);
+        lSink = lSink + lTime.tv_nsec;
+    });
+
+    lStamp = Measure(inIterations, [&](void) {
+        Format(lFormatter, lMessage, "%s %d", "message", 42);
+    });
+
+    printf("%-16s %10.1f %14.1f %14.1f\n", inName, lNow, lConvert, lStamp);
+}
+
+}; // namespace
+
+int
+main(int argc, char * argv[])
+{
+    const size_t               lIterations = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    Seconds                    lSeconds;
+    Log::Clock::Realtime       lRealtime;
+    Log::Clock::RealtimeCoarse lRealtimeCoarse;
+    Log::Clock::Monotonic      lMonotonic;
+    Log::Clock::TSC            lTSC;
+
+    printf("%zu iterations; TSC %savailable at %.0f Hz\n\n",
+           lIterations,
+           lTSC.IsAvailable() ? "" : "un",
+           lTSC.GetFrequency());
+
+    printf("%-16s %10s %14s %14s\n", "clock", "now (ns)", "convert (ns)", "stamp (ns)");
+
+    Bench("time",            lSeconds,        lIterations);
+    Bench("realtime",        lRealtime,       lIterations);
+    Bench("realtime-coarse", lRealtimeCoarse, lIterations);
+    Bench("monotonic",       lMonotonic,      lIterations);
+    Bench("tsc",             lTSC,            lIterations);
+
+    return (EXIT_SUCCESS);
+}
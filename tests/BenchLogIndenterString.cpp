@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of indenting every line of
+ *      single- and multi-line messages with Log::Indenter::String.
+ */
+
+#include <LogUtilities/LogIndenterString.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+
+using namespace Nuovations;
+
+namespace
+{
+
+typedef std::chrono::steady_clock Timer;
+
+// Indent every line as Indenter::String once did, inserting at each
+// line, last first, for comparison.
+
+void
+IndentByInsertion(const std::string & inIndent, Log::Indent inLevel, std::string & inMessage)
+{
+    const size_t lSize     = inMessage.size();
+    size_t       lPosition = std::string::npos;
+    std::string  lIndent;
+
+    for (Log::Indent lLevel = 0; lLevel < inLevel; lLevel++) {
+        lIndent += inIndent;
+    }
+
+    do {
+        lPosition = inMessage.find_last_of('\n', lPosition);
+
+        if (lPosition != std::string::npos) {
+            if (lPosition < (lSize - 1)) {
+                inMessage.insert(lPosition + 1, lIndent);
+            }
+
+            lPosition--;
+        }
+    } while (lPosition != std::string::npos);
+
+    inMessage.insert(0, lIndent);
+}
+
+// Return the mean cost, in nanoseconds, of the specified operation
+// over the specified number of iterations.
+
+template <typename Operation>
+double
+Measure(size_t inIterations, Operation inOperation)
+{
+    const Timer::time_point lStart = Timer::now();
+
+    for (size_t lIteration = 0; lIteration < inIterations; lIteration++) {
+        inOperation();
+    }
+
+    const Timer::duration lElapsed = Timer::now() - lStart;
+
+    return (static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(lElapsed).count()) /
+            static_cast<double>(inIterations));
+}
+
+void
+Bench(size_t inLines, size_t inIterations)
+{
+    static const Log::Indent kLevel = 2;
+    Log::Indenter::String    lIndenter("    ", Log::Indenter::String::Flags::kEvery);
+    std::string              lInput;
+    std::string              lMessage;
+    std::string              lReference;
+    double                   lCopy;
+    double                   lInsertion;
+    double                   lIndent;
+
+    // Lines resemble those of a hex dump.
+
+    for (size_t lLine = 0; lLine < inLines; lLine++) {
+        lInput += "0000: 00 01 02 03 04 05 06 07 08 09 0a 0b 0c 0d 0e 0f  ................\n";
+    }
+
+    lMessage = lInput;
+    lIndenter.Indent(kLevel, lMessage);
+
+    lReference = lInput;
+    IndentByInsertion("    ", kLevel, lReference);
+
+    if (lMessage != lReference) {
+        fprintf(stderr, "%zu lines: indented output differs from the reference\n", inLines);
+        exit(EXIT_FAILURE);
+    }
+
+    lCopy = Measure(inIterations, [&](void) {
+        lMessage = lInput;
+    });
+
+    lInsertion = Measure(inIterations, [&](void) {
+        lMessage = lInput;
+        IndentByInsertion("    ", kLevel, lMessage);
+    });
+
+    lIndent = Measure(inIterations, [&](void) {
+        lMessage = lInput;
+        lIndenter.Indent(kLevel, lMessage);
+    });
+
+    printf("%8zu %12.1f %16.1f %14.1f\n", inLines, lCopy, lInsertion, lIndent);
+}
+
+}; // namespace
+
+int
+main(int argc, char * argv[])
+{
+    const size_t lIterations = (argc > 1) ? strtoul(argv[1], NULL, 10) : 20000;
+
+    printf("%zu iterations\n\n", lIterations);
+
+    printf("%8s %12s %16s %14s\n", "lines", "copy (ns)", "insertion (ns)", "indent (ns)");
+
+    Bench(1,    lIterations);
+    Bench(10,   lIterations);
+    Bench(1000, lIterations / 100);
+
+    return (EXIT_SUCCESS);
+}
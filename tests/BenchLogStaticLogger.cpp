@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark of writing messages through
+ *      Log::StaticLogger against writing them through the equivalent
+ *      runtime Log::Logger.
+ */
+
+#include <LogUtilities/LogFilterAlways.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterNever.hpp>
+#include <LogUtilities/LogFilterQuiet.hpp>
+#include <LogUtilities/LogFilterStaticChain.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogIndenterNone.hpp>
+#include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogStaticLogger.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+
+using namespace Nuovations;
+
+namespace
+{
+
+typedef std::chrono::steady_clock Timer;
+
+// A writer that discards messages, such that the cost measured is
+// that of the logger itself.
+
+class Discard :
+    public Log::Writer::Base
+{
+public:
+    Discard(void) :
+        mWritten(0)
+    {
+        return;
+    }
+
+    void Write(Log::Level inLevel, const char * inMessage)
+    {
+        (void)inLevel;
+
+        mWritten += (inMessage[0] != '\0');
+    }
+
+    void Write(const char * inMessage)
+    {
+        Write(0, inMessage);
+    }
+
+    size_t mWritten;
+};
+
+typedef Log::Filter::StaticChain<Log::Filter::Quiet, Log::Filter::Level> QuietLevel;
+
+// Return the mean cost, in nanoseconds, of the specified operation
+// over the specified number of iterations.
+
+template <typename Operation>
+double
+Measure(size_t inIterations, Operation inOperation)
+{
+    const Timer::time_point lStart = Timer::now();
+
+    for (size_t lIteration = 0; lIteration < inIterations; lIteration++) {
+        inOperation();
+    }
+
+    const Timer::duration lElapsed = Timer::now() - lStart;
+
+    return (static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(lElapsed).count()) /
+            static_cast<double>(inIterations));
+}
+
+// Measure a message at the specified level written through a runtime
+// logger and through a static logger, each built from a filter of
+// the specified type.
+
+template <typename FilterT>
+void
+Bench(const char * inName, FilterT & inFilter, Log::Level inLevel, size_t inIterations)
+{
+    Log::Indenter::None   lIndenter;
+    Log::Formatter::Plain lFormatter;
+    Discard               lWriter;
+    Log::Logger           lRuntime(inFilter, lIndenter, lFormatter, lWriter);
+    Log::StaticLogger<FilterT,
+                      Log::Indenter::None,
+                      Log::Formatter::Plain,
+                      Discard> lStatic(inFilter,
+                                       Log::Indenter::None(),
+                                       Log::Formatter::Plain(),
+                                       Discard());
+    double                lRuntimeCost;
+    double                lStaticCost;
+
+    lRuntimeCost = Measure(inIterations, [&](void) {
+        lRuntime.Write(0, inLevel, "message %d\n", 42);
+    });
+
+    lStaticCost = Measure(inIterations, [&](void) {
+        lStatic.Write(0, inLevel, "message %d\n", 42);
+    });
+
+    if (lWriter.mWritten != lStatic.GetWriter().mWritten) {
+        fprintf(stderr, "%s: the loggers wrote differing messages\n", inName);
+        exit(EXIT_FAILURE);
+    }
+
+    printf("%-24s %14.1f %14.1f\n", inName, lRuntimeCost, lStaticCost);
+}
+
+}; // namespace
+
+int
+main(int argc, char * argv[])
+{
+    const size_t        lIterations = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    Log::Filter::Always lAlways;
+    Log::Filter::Never  lNever;
+    Log::Filter::Level  lLevel(1);
+    QuietLevel          lQuietLevel(Log::Filter::Quiet(false), Log::Filter::Level(1));
+
+    printf("%zu iterations\n\n", lIterations);
+
+    printf("%-24s %14s %14s\n", "filter", "runtime (ns)", "static (ns)");
+
+    Bench("never",                  lNever,      0, lIterations);
+    Bench("level, rejected",        lLevel,      2, lIterations);
+    Bench("quiet+level, rejected",  lQuietLevel, 2, lIterations);
+    Bench("always",                 lAlways,     0, lIterations);
+    Bench("level, passed",          lLevel,      1, lIterations);
+    Bench("quiet+level, passed",    lQuietLevel, 1, lIterations);
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,342 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Arguments.
+ */
+
+#include <LogUtilities/LogArguments.hpp>
+
+#include <string>
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <wchar.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+class TestLogArguments :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogArguments);
+    CPPUNIT_TEST(TestIntegers);
+    CPPUNIT_TEST(TestFloatingPoint);
+    CPPUNIT_TEST(TestStrings);
+    CPPUNIT_TEST(TestStars);
+    CPPUNIT_TEST(TestDeepCopy);
+    CPPUNIT_TEST(TestError);
+    CPPUNIT_TEST(TestPositional);
+    CPPUNIT_TEST(TestContext);
+    CPPUNIT_TEST(TestReuse);
+    CPPUNIT_TEST(TestRestore);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestIntegers(void);
+    void TestFloatingPoint(void);
+    void TestStrings(void);
+    void TestStars(void);
+    void TestDeepCopy(void);
+    void TestError(void);
+    void TestPositional(void);
+    void TestContext(void);
+    void TestReuse(void);
+    void TestRestore(void);
+
+private:
+    static void Capture(Log::Arguments & inArguments, const char * inFormat, ...)
+        __attribute__((format(printf, 2, 3)));
+    static void Check(const char * inFormat, ...)
+        __attribute__((format(printf, 1, 2)));
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogArguments);
+
+void
+TestLogArguments :: Capture(Log::Arguments & inArguments, const char * inFormat, ...)
+{
+    va_list lArguments;
+
+    va_start(lArguments, inFormat);
+
+    inArguments.Capture(inFormat, lArguments);
+
+    va_end(lArguments);
+}
+
+// Capture the arguments, render them, and check that the result
+// matches immediate output conversion with vsnprintf.
+
+void
+TestLogArguments :: Check(const char * inFormat, ...)
+{
+    Log::Arguments lArguments;
+    char           lExpected[512];
+    std::string    lActual;
+    va_list        lList;
+
+    va_start(lList, inFormat);
+    vsnprintf(lExpected, sizeof (lExpected), inFormat, lList);
+    va_end(lList);
+
+    va_start(lList, inFormat);
+    lArguments.Capture(inFormat, lList);
+    va_end(lList);
+
+    lArguments.Render(lActual, inFormat);
+
+    CPPUNIT_ASSERT_EQUAL(std::string(lExpected), lActual);
+}
+
+void
+TestLogArguments :: TestIntegers(void)
+{
+    Check("No directives at all");
+    Check("%% literal %d%%", 50);
+    Check("%d %i %u %x %X %o", -1, 42, 3000000000U, 0xbeef, 0xcafe, 0755);
+    Check("%hhd %hhu %hd %hu", 300, 300, 70000, 70000);
+    Check("%ld %lu %lx", -1234567890L, 4000000000UL, 0xdeadbeefUL);
+    Check("%lld %llu", -9000000000000LL, 18000000000000000000ULL);
+    Check("%jd %zu %zd %td", static_cast<intmax_t>(-7), sizeof (long), static_cast<ssize_t>(-3), static_cast<ptrdiff_t>(-9));
+    Check("%c%c%c", 'a', 'b', 'c');
+    Check("[%5d] [%-5d] [%05d] [%+d] [% d] [%#x] [%.3d]", 42, 42, 42, 42, 42, 42, 7);
+    Check("%p %p", reinterpret_cast<void *>(0x1234), static_cast<void *>(NULL));
+}
+
+void
+TestLogArguments :: TestFloatingPoint(void)
+{
+    Check("%f %e %g %a", 3.14159, 2.5e10, 0.0001, 1.0);
+    Check("%F %E %G %A", 3.14159, 2.5e10, 0.0001, 1.0);
+    Check("[%10.3f] [%-10.2e] [%+g]", 3.14159, 2.5e10, 1.5);
+    Check("%Lf %Lg", 1.25L, 6.5e-3L);
+    Check("%d %f %d %f", 1, 2.0, 3, 4.0);
+}
+
+void
+TestLogArguments :: TestStrings(void)
+{
+    const char    lBuffer[] = { 'a', 'b', 'c', 'd' };
+    const wchar_t lWide[]   = L"wide";
+
+    Check("%s", "string");
+    Check("[%10s] [%-10s] [%.3s]", "right", "left", "truncated");
+    Check("%s %d %s", "one", 2, "three");
+    Check("%s", "");
+    Check("%ls", lWide);
+    Check("%lc", static_cast<wint_t>(L'w'));
+
+    // Test that a precision bounds the copy of a string that is not
+    // null-terminated.
+
+    Check("%.*s", static_cast<int>(sizeof (lBuffer)), lBuffer);
+    Check("%.2s", lBuffer);
+}
+
+void
+TestLogArguments :: TestStars(void)
+{
+    Check("[%*d] [%-*d]", 6, 42, 6, 42);
+    Check("[%.*f] [%*.*f]", 2, 3.14159, 10, 4, 2.71828);
+    Check("[%*s] [%.*s]", 8, "star", 2, "star");
+    Check("[%*d]", -6, 42);
+}
+
+void
+TestLogArguments :: TestDeepCopy(void)
+{
+    Log::Arguments lArguments;
+    char           lBuffer[32];
+    std::string    lMessage;
+
+    strcpy(lBuffer, "before");
+
+    Capture(lArguments, "%s/%d", lBuffer, 1);
+
+    // Test that the rendered string reflects the argument as it was
+    // at capture time, not as it is at render time.
+
+    strcpy(lBuffer, "after");
+
+    lArguments.Render(lMessage, "%s/%d");
+
+    CPPUNIT_ASSERT_EQUAL(std::string("before/1"), lMessage);
+
+    // Test that a null string is rendered the same as printf renders
+    // it.
+
+    {
+        const char * volatile lNull = NULL;
+
+        Check("%s", lNull);
+    }
+}
+
+void
+TestLogArguments :: TestError(void)
+{
+    Log::Arguments lArguments;
+    std::string    lMessage;
+
+    // Test that %m is resolved against errno at capture time.
+
+    errno = ENOENT;
+
+    Capture(lArguments, "failed: %m (%d)", 3);
+
+    errno = EACCES;
+
+    lArguments.Render(lMessage, "failed: %m (%d)");
+
+    CPPUNIT_ASSERT_EQUAL(std::string("failed: ") + strerror(ENOENT) + " (3)",
+                         lMessage);
+}
+
+void
+TestLogArguments :: TestPositional(void)
+{
+    // Test that formats which cannot be captured argument-by-argument
+    // still render correctly.
+
+    Check("%2$s %1$s", "world", "hello");
+    Check("%1$d-%1$d", 5);
+}
+
+void
+TestLogArguments :: TestContext(void)
+{
+    Log::Arguments  lArguments;
+    const time_t    lBefore = time(NULL);
+    struct timespec lTime;
+
+    Capture(lArguments, "%d", 1);
+
+    CPPUNIT_ASSERT(lArguments.GetTime() >= lBefore);
+    CPPUNIT_ASSERT(lArguments.GetTime() <= time(NULL));
+
+    lArguments.GetTimestamp(lTime);
+
+    CPPUNIT_ASSERT_EQUAL(lArguments.GetTime(), lTime.tv_sec);
+    CPPUNIT_ASSERT(lTime.tv_nsec >= 0);
+    CPPUNIT_ASSERT(lTime.tv_nsec < 1000000000);
+    CPPUNIT_ASSERT_EQUAL(getpid(), lArguments.GetProcess());
+    CPPUNIT_ASSERT(pthread_equal(pthread_self(), lArguments.GetThread()));
+}
+
+void
+TestLogArguments :: TestReuse(void)
+{
+    Log::Arguments lArguments;
+    std::string    lMessage;
+
+    // Test that rendering appends and that recapturing replaces the
+    // prior arguments.
+
+    lMessage = "> ";
+
+    Capture(lArguments, "%s %d", "a long string argument", 1);
+    Capture(lArguments, "%d", 2);
+
+    lArguments.Render(lMessage, "%d");
+
+    CPPUNIT_ASSERT_EQUAL(std::string("> 2"), lMessage);
+}
+
+void
+TestLogArguments :: TestRestore(void)
+{
+    static const char * const kFormat = "%s %d %ls %*.*f %p %m";
+    Log::Arguments            lCaptured;
+    Log::Arguments            lRestored;
+    std::string               lExpected;
+    std::string               lActual;
+    std::string               lData;
+    struct timespec           lTime;
+    struct timespec           lRestoredTime;
+    bool                      lStatus;
+
+    errno = ENOENT;
+
+    Capture(lCaptured, kFormat, "text", 3, L"wide", 6, 2, 1.5, static_cast<void *>(&lData));
+
+    lCaptured.Render(lExpected, kFormat);
+
+    lData = lCaptured.GetData();
+
+    // Test that restored arguments render and stamp as the captured
+    // ones did.
+
+    lCaptured.GetTimestamp(lTime);
+
+    lStatus = lRestored.Restore(kFormat,
+                                lData.data(),
+                                lData.size(),
+                                lCaptured.IsPreformatted(),
+                                lTime,
+                                lCaptured.GetProcess(),
+                                lCaptured.GetThread());
+    CPPUNIT_ASSERT(lStatus);
+
+    lRestored.Render(lActual, kFormat);
+
+    CPPUNIT_ASSERT_EQUAL(lExpected, lActual);
+    CPPUNIT_ASSERT_EQUAL(lCaptured.GetTime(), lRestored.GetTime());
+
+    lRestored.GetTimestamp(lRestoredTime);
+
+    CPPUNIT_ASSERT_EQUAL(lTime.tv_sec, lRestoredTime.tv_sec);
+    CPPUNIT_ASSERT_EQUAL(lTime.tv_nsec, lRestoredTime.tv_nsec);
+    CPPUNIT_ASSERT_EQUAL(lCaptured.GetProcess(), lRestored.GetProcess());
+    CPPUNIT_ASSERT(pthread_equal(lCaptured.GetThread(), lRestored.GetThread()));
+
+    // Test that data inconsistent with the format, whether short,
+    // long, or with a bad string length, is rejected.
+
+    lStatus = lRestored.Restore(kFormat, lData.data(), lData.size() - 1, false, lTime, 0, pthread_self());
+    CPPUNIT_ASSERT(!lStatus);
+    CPPUNIT_ASSERT(lRestored.GetData().empty());
+
+    lStatus = lRestored.Restore("%s %d", lData.data(), lData.size(), false, lTime, 0, pthread_self());
+    CPPUNIT_ASSERT(!lStatus);
+
+    lData.replace(0, sizeof (size_t), sizeof (size_t), '\x7f');
+
+    lStatus = lRestored.Restore(kFormat, lData.data(), lData.size(), false, lTime, 0, pthread_self());
+    CPPUNIT_ASSERT(!lStatus);
+
+    // Test that preformatted data is accepted as is.
+
+    lStatus = lRestored.Restore("%2$s", "as is", 5, true, lTime, 0, pthread_self());
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT(lRestored.IsPreformatted());
+
+    lActual.clear();
+    lRestored.Render(lActual, "%2$s");
+
+    CPPUNIT_ASSERT_EQUAL(std::string("as is"), lActual);
+}
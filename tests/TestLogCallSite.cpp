@@ -0,0 +1,211 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::CallSite.
+ */
+
+#include <LogUtilities/LogCallSite.hpp>
+
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+class TestLogCallSite :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogCallSite);
+    CPPUNIT_TEST(TestObservation);
+    CPPUNIT_TEST(TestRegistration);
+    CPPUNIT_TEST(TestFind);
+    CPPUNIT_TEST(TestSetEnabled);
+    CPPUNIT_TEST(TestRules);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void tearDown(void);
+
+    void TestObservation(void);
+    void TestRegistration(void);
+    void TestFind(void);
+    void TestSetEnabled(void);
+    void TestRules(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogCallSite);
+
+// Call sites such as the logging macros would define, in other files
+// and functions.
+
+static Log::CallSite sNetworkSend("src/net/Socket.cpp",    10, "Send",    "sent %zu bytes\n");
+static Log::CallSite sNetworkRecv("src/net/Socket.cpp",    20, "Receive", "received %zu bytes\n");
+static Log::CallSite sNetworkDNS("src/net/Resolver.cpp",   30, "Resolve", "resolved %s\n");
+static Log::CallSite sStorageRead("src/disk/Storage.cpp",  40, "Read",    "read %zu bytes\n");
+static Log::CallSite sStorageSync("src/disk/Storage.cpp",  50, "Sync",    "synced\n");
+static Log::CallSite sLateRead("src/disk/Cache.cpp",       60, "Read",    "cache read\n");
+
+static size_t
+Find(const char * inFilePattern, const char * inFunctionPattern)
+{
+    std::vector<const Log::CallSite *> lCallSites;
+
+    return (Log::CallSite::Find(inFilePattern, inFunctionPattern, lCallSites));
+}
+
+void
+TestLogCallSite :: tearDown(void)
+{
+    Log::CallSite::Reset();
+}
+
+void
+TestLogCallSite :: TestObservation(void)
+{
+    CPPUNIT_ASSERT(strcmp(sNetworkSend.GetFile(), "src/net/Socket.cpp") == 0);
+    CPPUNIT_ASSERT_EQUAL(10U, sNetworkSend.GetLine());
+    CPPUNIT_ASSERT(strcmp(sNetworkSend.GetFunction(), "Send") == 0);
+    CPPUNIT_ASSERT(strcmp(sNetworkSend.GetFormat(), "sent %zu bytes\n") == 0);
+}
+
+void
+TestLogCallSite :: TestRegistration(void)
+{
+    // Test that call sites are enabled by default and registered on
+    // their first test.
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Find("src/net/*", NULL));
+
+    CPPUNIT_ASSERT(sNetworkSend.IsEnabled());
+    CPPUNIT_ASSERT(sNetworkRecv.IsEnabled());
+    CPPUNIT_ASSERT(sNetworkDNS.IsEnabled());
+    CPPUNIT_ASSERT(sStorageRead.IsEnabled());
+    CPPUNIT_ASSERT(sStorageSync.IsEnabled());
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), Find("src/net/*", NULL));
+
+    // Test that testing again does not register again.
+
+    CPPUNIT_ASSERT(sNetworkSend.IsEnabled());
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), Find("src/net/*", NULL));
+}
+
+void
+TestLogCallSite :: TestFind(void)
+{
+    std::vector<const Log::CallSite *> lCallSites;
+    size_t                             lMatches;
+
+    sNetworkSend.IsEnabled();
+    sNetworkRecv.IsEnabled();
+    sNetworkDNS.IsEnabled();
+    sStorageRead.IsEnabled();
+    sStorageSync.IsEnabled();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), Find("*/Socket.cpp", NULL));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), Find(NULL, "Resolve"));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), Find("src/disk/*", "*"));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), Find("src/*", "S[ey]n[cd]"));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Find("src/net/*", "Read"));
+
+    lMatches = Log::CallSite::Find("*/Socket.cpp", "Receive", lCallSites);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lMatches);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCallSites.size());
+    CPPUNIT_ASSERT(lCallSites[0] == &sNetworkRecv);
+}
+
+void
+TestLogCallSite :: TestSetEnabled(void)
+{
+    size_t lMatches;
+
+    sNetworkSend.IsEnabled();
+    sNetworkRecv.IsEnabled();
+    sNetworkDNS.IsEnabled();
+    sStorageRead.IsEnabled();
+    sStorageSync.IsEnabled();
+
+    // Test disabling by file.
+
+    lMatches = Log::CallSite::SetEnabled("src/net/*", NULL, false);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), lMatches);
+
+    CPPUNIT_ASSERT(!sNetworkSend.IsEnabled());
+    CPPUNIT_ASSERT(!sNetworkRecv.IsEnabled());
+    CPPUNIT_ASSERT(!sNetworkDNS.IsEnabled());
+    CPPUNIT_ASSERT(sStorageRead.IsEnabled());
+
+    // Test re-enabling by function, within the disabled file.
+
+    lMatches = Log::CallSite::SetEnabled("src/net/*", "Re*", true);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lMatches);
+
+    CPPUNIT_ASSERT(!sNetworkSend.IsEnabled());
+    CPPUNIT_ASSERT(sNetworkRecv.IsEnabled());
+    CPPUNIT_ASSERT(sNetworkDNS.IsEnabled());
+
+    // Test a single call site.
+
+    sStorageSync.SetEnabled(false);
+
+    CPPUNIT_ASSERT(sStorageRead.IsEnabled());
+    CPPUNIT_ASSERT(!sStorageSync.IsEnabled());
+
+    // Test that resetting enables everything.
+
+    Log::CallSite::Reset();
+
+    CPPUNIT_ASSERT(sNetworkSend.IsEnabled());
+    CPPUNIT_ASSERT(sStorageSync.IsEnabled());
+}
+
+void
+TestLogCallSite :: TestRules(void)
+{
+    // Test that a call site registered after a setting that matches
+    // it takes that setting.
+
+    Log::CallSite::SetEnabled(NULL, "Read", false);
+
+    CPPUNIT_ASSERT(!sLateRead.IsEnabled());
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), Find("src/disk/Cache.cpp", NULL));
+
+    // Test that the last matching rule wins.
+
+    Log::CallSite::SetEnabled("src/disk/*", NULL, true);
+
+    CPPUNIT_ASSERT(sLateRead.IsEnabled());
+
+    Log::CallSite::SetEnabled(NULL, "Read", false);
+
+    CPPUNIT_ASSERT(!sLateRead.IsEnabled());
+
+    // Test that a setting matching anything applies to every call
+    // site.
+
+    Log::CallSite::SetEnabled(NULL, NULL, true);
+
+    CPPUNIT_ASSERT(sLateRead.IsEnabled());
+}
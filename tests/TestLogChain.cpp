@@ -91,6 +91,31 @@ public:
     }
 };
 
+// A link too large to be held inline, which counts its instances
+// such that leaks are detected.
+
+class LogChainTestLargeLink :
+    public LogChainTestBaseLink
+{
+public:
+    LogChainTestLargeLink(int inValue) : mValue(inValue) { sInstances++; }
+    LogChainTestLargeLink(const LogChainTestLargeLink & inLink) : LogChainTestBaseLink(), mValue(inLink.mValue) { sInstances++; }
+    virtual ~LogChainTestLargeLink(void) { sInstances--; }
+
+    void Action(const int &inValue) final
+    {
+        sValues.push_back(inValue + mValue);
+    }
+
+    static int sInstances;
+
+private:
+    int  mValue;
+    char mPadding[256];
+};
+
+int LogChainTestLargeLink::sInstances = 0;
+
 class LogChainTestChain :
     public Log::Chain<LogChainTestBaseLink>,
     public LogChainTestBaseLink
@@ -121,6 +146,7 @@ class TestLogChain :
     CPPUNIT_TEST(TestObservation);
     CPPUNIT_TEST(TestMutation);
     CPPUNIT_TEST(TestChainedAction);
+    CPPUNIT_TEST(TestManyLinks);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -129,6 +155,7 @@ public:
     void TestObservation(void);
     void TestMutation(void);
     void TestChainedAction(void);
+    void TestManyLinks(void);
 
 private:
     void TestObservation(const LogChainTestChain & inChain);
@@ -346,3 +373,85 @@ TestLogChain :: TestChainedAction(void)
     CPPUNIT_ASSERT_EQUAL(26, sValues.at(1));
     CPPUNIT_ASSERT_EQUAL(20, sValues.at(2));
 }
+
+void
+TestLogChain :: TestManyLinks(void)
+{
+    static const size_t   kLinks = 20;
+    LogChainTestALink     lLogChainTestLinkA;
+    LogChainTestLargeLink lLogChainTestLinkLarge(100);
+
+    sValues.clear();
+
+    {
+        LogChainTestChain      lLogChainTestChain;
+        LogChainTestBaseLink * lFirst;
+        LogChainTestBaseLink * lSecond;
+
+        // Push alternating small and large links, well beyond those
+        // held inline, and check that the links pushed first stay
+        // put as more are pushed.
+
+        lLogChainTestChain.Push(lLogChainTestLinkA);
+        lLogChainTestChain.Push(lLogChainTestLinkLarge);
+
+        lFirst  = lLogChainTestChain.Link<LogChainTestBaseLink>(0);
+        lSecond = lLogChainTestChain.Link<LogChainTestBaseLink>(1);
+
+        for (size_t lLink = 2; lLink < kLinks; lLink++) {
+            if ((lLink % 2) == 0) {
+                lLogChainTestChain.Push(lLogChainTestLinkA);
+            } else {
+                lLogChainTestChain.Push(lLogChainTestLinkLarge);
+            }
+        }
+
+        CPPUNIT_ASSERT_EQUAL(kLinks, lLogChainTestChain.Size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<int>(kLinks / 2) + 1, LogChainTestLargeLink::sInstances);
+        CPPUNIT_ASSERT(lFirst == lLogChainTestChain.Link<LogChainTestBaseLink>(0));
+        CPPUNIT_ASSERT(lSecond == lLogChainTestChain.Link<LogChainTestBaseLink>(1));
+
+        for (size_t lLink = 0; lLink < kLinks; lLink++) {
+            LogChainTestBaseLink * lCurrent = lLogChainTestChain.Link<LogChainTestBaseLink>(lLink);
+
+            CPPUNIT_ASSERT(lCurrent != NULL);
+
+            if ((lLink % 2) == 0) {
+                CPPUNIT_ASSERT(typeid(*lCurrent) == typeid(LogChainTestALink));
+            } else {
+                CPPUNIT_ASSERT(typeid(*lCurrent) == typeid(LogChainTestLargeLink));
+            }
+        }
+
+        CPPUNIT_ASSERT(lLogChainTestChain.Link<LogChainTestBaseLink>(kLinks) == NULL);
+
+        // Test that every link acts, in order.
+
+        lLogChainTestChain.Action(1);
+
+        CPPUNIT_ASSERT_EQUAL(kLinks, sValues.size());
+
+        for (size_t lLink = 0; lLink < kLinks; lLink++) {
+            CPPUNIT_ASSERT_EQUAL(((lLink % 2) == 0) ? 1 : 101, sValues[lLink]);
+        }
+
+        // Test that popping links back into the inline ones and then
+        // pushing again destroys and reconstructs them.
+
+        while (lLogChainTestChain.Size() > 1) {
+            lLogChainTestChain.Pop();
+        }
+
+        CPPUNIT_ASSERT_EQUAL(1, LogChainTestLargeLink::sInstances);
+
+        lLogChainTestChain.Push(lLogChainTestLinkLarge);
+        lLogChainTestChain.Push(lLogChainTestLinkA);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), lLogChainTestChain.Size());
+        CPPUNIT_ASSERT_EQUAL(2, LogChainTestLargeLink::sInstances);
+    }
+
+    // Test that destroying the chain destroys its links.
+
+    CPPUNIT_ASSERT_EQUAL(1, LogChainTestLargeLink::sInstances);
+}
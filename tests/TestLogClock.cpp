@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Clock.
+ */
+
+#include <LogUtilities/LogClock.hpp>
+
+#include <ctime>
+
+#include <stdint.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+class TestLogClock :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogClock);
+    CPPUNIT_TEST(TestRealtime);
+    CPPUNIT_TEST(TestRealtimeCoarse);
+    CPPUNIT_TEST(TestMonotonic);
+    CPPUNIT_TEST(TestTSC);
+    CPPUNIT_TEST(TestDefault);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestRealtime(void);
+    void TestRealtimeCoarse(void);
+    void TestMonotonic(void);
+    void TestTSC(void);
+    void TestDefault(void);
+
+private:
+    static void CheckClock(const Log::Clock::Base & inClock, int64_t inTolerance);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogClock);
+
+// Check that successive readings of the clock do not go backwards
+// and that, converted, they bracket the system real-time clock to
+// within the specified tolerance, in nanoseconds.
+
+void
+TestLogClock :: CheckClock(const Log::Clock::Base & inClock, int64_t inTolerance)
+{
+    static const int64_t    kNanosecondsPerSecond = 1000000000;
+    struct timespec         lTime;
+    struct timespec         lConverted;
+    Log::Clock::Ticks       lFirst;
+    Log::Clock::Ticks       lSecond;
+    int64_t                 lExpected;
+    int64_t                 lActual;
+
+    lFirst  = inClock.Now();
+    lSecond = inClock.Now();
+
+    CPPUNIT_ASSERT(lSecond >= lFirst);
+
+    clock_gettime(CLOCK_REALTIME, &lTime);
+
+    inClock.Convert(inClock.Now(), lConverted);
+
+    CPPUNIT_ASSERT(lConverted.tv_nsec >= 0);
+    CPPUNIT_ASSERT(lConverted.tv_nsec < kNanosecondsPerSecond);
+
+    lExpected = (static_cast<int64_t>(lTime.tv_sec) * kNanosecondsPerSecond) + lTime.tv_nsec;
+    lActual   = (static_cast<int64_t>(lConverted.tv_sec) * kNanosecondsPerSecond) + lConverted.tv_nsec;
+
+    CPPUNIT_ASSERT(lActual > (lExpected - inTolerance));
+    CPPUNIT_ASSERT(lActual < (lExpected + inTolerance));
+}
+
+void
+TestLogClock :: TestRealtime(void)
+{
+    Log::Clock::Realtime lClock;
+
+    CheckClock(lClock, 50000000);
+}
+
+void
+TestLogClock :: TestRealtimeCoarse(void)
+{
+    Log::Clock::RealtimeCoarse lClock;
+
+    // The coarse clock may lag by up to a scheduler tick.
+
+    CheckClock(lClock, 50000000);
+}
+
+void
+TestLogClock :: TestMonotonic(void)
+{
+    Log::Clock::Monotonic lClock;
+
+    CheckClock(lClock, 50000000);
+}
+
+void
+TestLogClock :: TestTSC(void)
+{
+    Log::Clock::TSC lClock;
+
+    CheckClock(lClock, 50000000);
+
+    // Test that the frequency is plausible: that of the counter, if
+    // it is available, or, otherwise, that of nanoseconds.
+
+    if (lClock.IsAvailable()) {
+        CPPUNIT_ASSERT(lClock.GetFrequency() > 1.0e7);
+        CPPUNIT_ASSERT(lClock.GetFrequency() < 1.0e11);
+    } else {
+        CPPUNIT_ASSERT(lClock.GetFrequency() > (1.0e9 - 1.0));
+        CPPUNIT_ASSERT(lClock.GetFrequency() < (1.0e9 + 1.0));
+    }
+}
+
+void
+TestLogClock :: TestDefault(void)
+{
+    static Log::Clock::Monotonic sClock;
+    Log::Clock::Base &           lDefault = Log::Clock::GetDefault();
+
+    // Test that the default clock may be replaced and restored.
+
+    CPPUNIT_ASSERT(&lDefault != &sClock);
+
+    Log::Clock::SetDefault(sClock);
+
+    CPPUNIT_ASSERT(&Log::Clock::GetDefault() == &sClock);
+
+    Log::Clock::SetDefault(lDefault);
+
+    CPPUNIT_ASSERT(&Log::Clock::GetDefault() == &lDefault);
+
+    CheckClock(lDefault, 50000000);
+}
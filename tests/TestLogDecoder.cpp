@@ -0,0 +1,266 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Decoder.
+ */
+
+#include <LogUtilities/LogDecoder.hpp>
+#include <LogUtilities/LogFilterAlways.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogIndenterNone.hpp>
+#include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogRecorderBinary.hpp>
+#include <LogUtilities/LogWriterStdio.hpp>
+
+#include <string>
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+class TestLogDecoder :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogDecoder);
+    CPPUNIT_TEST(TestEmpty);
+    CPPUNIT_TEST(TestSessions);
+    CPPUNIT_TEST(TestTruncated);
+    CPPUNIT_TEST(TestMalformed);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void);
+    void tearDown(void);
+
+    void TestEmpty(void);
+    void TestSessions(void);
+    void TestTruncated(void);
+    void TestMalformed(void);
+
+private:
+    void Record(const char * inPrefix, int inMessages);
+    std::string Read(void);
+    void Check(const Log::Decoder & inDecoder, size_t inMessage, const std::string & inExpected);
+
+    FILE * mStream;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogDecoder);
+
+void
+TestLogDecoder :: setUp(void)
+{
+    mStream = tmpfile();
+
+    CPPUNIT_ASSERT(mStream != NULL);
+}
+
+void
+TestLogDecoder :: tearDown(void)
+{
+    fclose(mStream);
+}
+
+// Record the specified number of messages, with a fresh recorder and,
+// so, a fresh header and set of format identifiers.
+
+void
+TestLogDecoder :: Record(const char * inPrefix, int inMessages)
+{
+    Log::Filter::Always   lFilter;
+    Log::Indenter::None   lIndenter;
+    Log::Formatter::Plain lFormatter;
+    Log::Writer::Stdio    lWriter(mStream);
+    Log::Logger           lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Recorder::Binary lRecorder(lWriter);
+
+    lLogger.SetRecorder(&lRecorder);
+
+    for (int lMessage = 0; lMessage < inMessages; lMessage++) {
+        if (lMessage % 2) {
+            lLogger.Write("%s odd %d", inPrefix, lMessage);
+        } else {
+            lLogger.Write("%s even %d", inPrefix, lMessage);
+        }
+    }
+
+    lLogger.SetRecorder(NULL);
+
+    lRecorder.Flush();
+}
+
+std::string
+TestLogDecoder :: Read(void)
+{
+    std::string lData;
+    char        lBuffer[4096];
+    size_t      lSize;
+
+    fflush(mStream);
+    rewind(mStream);
+
+    while ((lSize = fread(lBuffer, 1, sizeof (lBuffer), mStream)) > 0) {
+        lData.append(lBuffer, lSize);
+    }
+
+    return (lData);
+}
+
+void
+TestLogDecoder :: Check(const Log::Decoder & inDecoder, size_t inMessage, const std::string & inExpected)
+{
+    Log::Indenter::None   lIndenter;
+    Log::Formatter::Plain lFormatter;
+    std::string           lMessage;
+    bool                  lStatus;
+
+    lStatus = inDecoder.Decode(inMessage, lFormatter, lIndenter, lMessage);
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(inExpected, lMessage);
+}
+
+void
+TestLogDecoder :: TestEmpty(void)
+{
+    Log::Decoder          lDecoder;
+    Log::Indenter::None   lIndenter;
+    Log::Formatter::Plain lFormatter;
+    std::string           lMessage("stale");
+    bool                  lStatus;
+
+    lStatus = lDecoder.Load(NULL, 0);
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lDecoder.GetLoaded());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lDecoder.GetMessages());
+
+    // Test that decoding out of range fails and clears the message.
+
+    lStatus = lDecoder.Decode(0, lFormatter, lIndenter, lMessage);
+    CPPUNIT_ASSERT(!lStatus);
+    CPPUNIT_ASSERT(lMessage.empty());
+}
+
+void
+TestLogDecoder :: TestSessions(void)
+{
+    Log::Decoder lDecoder;
+    std::string  lData;
+    bool         lStatus;
+
+    // Test that logs appended by successive recorders, whose format
+    // identifiers overlap, each decode against their own formats.
+
+    Record("first", 3);
+    Record("second", 2);
+
+    lData = Read();
+
+    lStatus = lDecoder.Load(lData.data(), lData.size());
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), lDecoder.GetMessages());
+
+    Check(lDecoder, 0, "first even 0");
+    Check(lDecoder, 1, "first odd 1");
+    Check(lDecoder, 2, "first even 2");
+    Check(lDecoder, 3, "second even 0");
+    Check(lDecoder, 4, "second odd 1");
+}
+
+void
+TestLogDecoder :: TestTruncated(void)
+{
+    Log::Decoder lDecoder;
+    std::string  lData;
+    bool         lStatus;
+
+    Record("truncated", 10);
+
+    lData = Read();
+
+    // Test that a log cut off mid-record still decodes up to the
+    // last whole record.
+
+    lStatus = lDecoder.Load(lData.data(), lData.size() - 1);
+    CPPUNIT_ASSERT(!lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(9), lDecoder.GetMessages());
+    CPPUNIT_ASSERT(lDecoder.GetLoaded() < lData.size());
+
+    Check(lDecoder, 8, "truncated even 8");
+
+    // Test that reloading replaces what was loaded.
+
+    lStatus = lDecoder.Load(lData.data(), lData.size());
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(10), lDecoder.GetMessages());
+    CPPUNIT_ASSERT_EQUAL(lData.size(), lDecoder.GetLoaded());
+
+    Check(lDecoder, 9, "truncated odd 9");
+}
+
+void
+TestLogDecoder :: TestMalformed(void)
+{
+    Log::Decoder lDecoder;
+    std::string  lData;
+    std::string  lCorrupt;
+    uint32_t     lSize;
+    bool         lStatus;
+
+    Record("malformed", 1);
+
+    lData = Read();
+
+    // Test that a log without a valid header is rejected outright.
+
+    lCorrupt = lData;
+    lCorrupt[sizeof (uint32_t) + 1] = 'X';
+
+    lStatus = lDecoder.Load(lCorrupt.data(), lCorrupt.size());
+    CPPUNIT_ASSERT(!lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lDecoder.GetLoaded());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lDecoder.GetMessages());
+
+    // Test that records ahead of any header are rejected.
+
+    memcpy(&lSize, lData.data(), sizeof (lSize));
+
+    lCorrupt = lData.substr(sizeof (lSize) + lSize);
+
+    lStatus = lDecoder.Load(lCorrupt.data(), lCorrupt.size());
+    CPPUNIT_ASSERT(!lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lDecoder.GetMessages());
+
+    // Test that a record claiming more than remains is rejected.
+
+    lCorrupt = lData;
+    lSize    = UINT32_MAX;
+
+    memcpy(&lCorrupt[0], &lSize, sizeof (lSize));
+
+    lStatus = lDecoder.Load(lCorrupt.data(), lCorrupt.size());
+    CPPUNIT_ASSERT(!lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lDecoder.GetMessages());
+}
@@ -20,6 +20,7 @@
  *      This file implements a unit test for Log::Filter::Chain.
  */
 
+#include <LogUtilities/LogClockBase.hpp>
 #include <LogUtilities/LogFilterAlways.hpp>
 #include <LogUtilities/LogFilterChain.hpp>
 #include <LogUtilities/LogFilterLevel.hpp>
@@ -28,6 +29,7 @@
 
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <cppunit/TestAssert.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -35,6 +37,88 @@
 
 using namespace Nuovations;
 
+/**
+ *  A filter, which rejects messages containing a given word, that
+ *  counts how often each of its phases is consulted.
+ */
+class TestLogFilterCounter :
+    public Log::Filter::Base
+{
+public:
+    TestLogFilterCounter(const char * inWord, bool inNeedsMessage, unsigned * outLevelCount, unsigned * outMessageCount) :
+        mWord(inWord),
+        mNeedsMessage(inNeedsMessage),
+        mLevelCount(outLevelCount),
+        mMessageCount(outMessageCount)
+    {
+        return;
+    }
+
+    bool Allow(Log::Level inLevel) final
+    {
+        (void)inLevel;
+
+        (*mLevelCount)++;
+
+        return (true);
+    }
+
+    bool Allow(Log::Level inLevel, const char * inMessage) final
+    {
+        return (Allow(inLevel) && AllowMessage(inLevel, inMessage));
+    }
+
+    bool NeedsMessage(void) const final
+    {
+        return (mNeedsMessage);
+    }
+
+    bool AllowMessage(Log::Level inLevel, const char * inMessage) final
+    {
+        (void)inLevel;
+
+        (*mMessageCount)++;
+
+        return (strstr(inMessage, mWord) == NULL);
+    }
+
+private:
+    const char * mWord;
+    bool         mNeedsMessage;
+    unsigned *   mLevelCount;
+    unsigned *   mMessageCount;
+};
+
+/**
+ *  A clock that advances one tick each time it is read, such that
+ *  every link an adaptive chain samples takes the same time, however
+ *  loaded the system running the test.
+ */
+class TestLogClockStepping :
+    public Log::Clock::Base
+{
+public:
+    TestLogClockStepping(void) :
+        mNow(0)
+    {
+        return;
+    }
+
+    Log::Clock::Ticks Now(void) const final
+    {
+        return (++mNow);
+    }
+
+    void Convert(Log::Clock::Ticks inTicks, struct timespec & outTime) const final
+    {
+        outTime.tv_sec  = inTicks;
+        outTime.tv_nsec = 0;
+    }
+
+private:
+    mutable Log::Clock::Ticks mNow;
+};
+
 
 class TestLogFilterChain :
     public CppUnit::TestFixture
@@ -45,6 +129,9 @@ class TestLogFilterChain :
     CPPUNIT_TEST(TestObservation);
     CPPUNIT_TEST(TestAlwaysChain);
     CPPUNIT_TEST(TestNeverChain);
+    CPPUNIT_TEST(TestLevelLimit);
+    CPPUNIT_TEST(TestPhases);
+    CPPUNIT_TEST(TestAdaptive);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -53,9 +140,12 @@ public:
     void TestObservation(void);
     void TestAlwaysChain(void);
     void TestNeverChain(void);
+    void TestPhases(void);
+    void TestAdaptive(void);
 
 private:
     void TestObservation(const Log::Filter::Chain & inChain);
+    void TestLevelLimit(void);
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterChain);
@@ -405,3 +495,212 @@ TestLogFilterChain :: TestNeverChain(void)
     lAllow = lChainFilter.Allow(UINT_MAX, "At level UINT_MAX, when empty the chain will never allow.\n");
     CPPUNIT_ASSERT(lAllow == false);
 }
+
+void
+TestLogFilterChain :: TestLevelLimit(void)
+{
+    Log::Filter::Always lAlwaysFilter;
+    Log::Filter::Never  lNeverFilter;
+    Log::Filter::Level  lLevelFilter(3);
+    Log::Filter::Chain  lChainFilter;
+
+    // Test that an empty chain, which passes nothing, has no level
+    // limit.
+
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitNone, lChainFilter.GetLevelLimit());
+
+    // Test that the level limit of a chain is the lowest among its
+    // links.
+
+    lChainFilter.Push(lAlwaysFilter);
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitAll, lChainFilter.GetLevelLimit());
+
+    lChainFilter.Push(lLevelFilter);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(4), lChainFilter.GetLevelLimit());
+
+    lChainFilter.Push(lNeverFilter);
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitNone, lChainFilter.GetLevelLimit());
+
+    lChainFilter.Pop();
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(4), lChainFilter.GetLevelLimit());
+
+    lChainFilter.Reset();
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitNone, lChainFilter.GetLevelLimit());
+}
+
+void
+TestLogFilterChain :: TestPhases(void)
+{
+    Log::Filter::Level   lLevelFilter(3);
+    Log::Filter::Quiet   lQuietFilter(false);
+    unsigned             lLevelCount   = 0;
+    unsigned             lMessageCount = 0;
+    TestLogFilterCounter lLevelOnlyFilter("secret", false, &lLevelCount, &lMessageCount);
+    TestLogFilterCounter lContentFilter("secret", true, &lLevelCount, &lMessageCount);
+    Log::Filter::Chain   lChainFilter;
+    bool                 lAllow;
+
+    // Test that a chain of content-free links does not need message
+    // content.
+
+    CPPUNIT_ASSERT(!lChainFilter.NeedsMessage());
+
+    lChainFilter.Push(lLevelFilter);
+    lChainFilter.Push(lQuietFilter);
+    lChainFilter.Push(lLevelOnlyFilter);
+    CPPUNIT_ASSERT(!lChainFilter.NeedsMessage());
+
+    lAllow = lChainFilter.Allow(2);
+    CPPUNIT_ASSERT(lAllow == true);
+    CPPUNIT_ASSERT_EQUAL(1U, lLevelCount);
+
+    // Test that pushing a link that needs message content makes the
+    // chain need it, too, and that each phase consults each link
+    // exactly once.
+
+    lChainFilter.Push(lContentFilter);
+    CPPUNIT_ASSERT(lChainFilter.NeedsMessage());
+
+    lLevelCount   = 0;
+    lMessageCount = 0;
+
+    lAllow = lChainFilter.Allow(2);
+    CPPUNIT_ASSERT(lAllow == true);
+    CPPUNIT_ASSERT_EQUAL(2U, lLevelCount);
+    CPPUNIT_ASSERT_EQUAL(0U, lMessageCount);
+
+    lAllow = lChainFilter.AllowMessage(2, "A public message.\n");
+    CPPUNIT_ASSERT(lAllow == true);
+    CPPUNIT_ASSERT_EQUAL(2U, lLevelCount);
+    CPPUNIT_ASSERT_EQUAL(1U, lMessageCount);
+
+    lAllow = lChainFilter.AllowMessage(2, "A secret message.\n");
+    CPPUNIT_ASSERT(lAllow == false);
+    CPPUNIT_ASSERT_EQUAL(2U, lLevelCount);
+    CPPUNIT_ASSERT_EQUAL(2U, lMessageCount);
+
+    // Test that a copy of the chain shares its post-format list.
+
+    {
+        Log::Filter::Chain lCopiedChain(lChainFilter);
+
+        CPPUNIT_ASSERT(lCopiedChain.NeedsMessage());
+
+        lAllow = lCopiedChain.AllowMessage(2, "A secret message.\n");
+        CPPUNIT_ASSERT(lAllow == false);
+    }
+
+    // Test that popping or resetting the links that need message
+    // content leaves the chain content-free again.
+
+    lChainFilter.Pop();
+    CPPUNIT_ASSERT(!lChainFilter.NeedsMessage());
+
+    lChainFilter.Push(lContentFilter);
+    CPPUNIT_ASSERT(lChainFilter.NeedsMessage());
+
+    lChainFilter.Reset();
+    CPPUNIT_ASSERT(!lChainFilter.NeedsMessage());
+}
+
+void
+TestLogFilterChain :: TestAdaptive(void)
+{
+    // Enough walks for the chain to be sampled and reordered several
+    // times over.
+
+    static const unsigned kWalks = 40000;
+    TestLogClockStepping  lClock;
+    Log::Filter::Level    lLevelFilter(1);
+    unsigned              lLevelCount   = 0;
+    unsigned              lMessageCount = 0;
+    TestLogFilterCounter  lPassFilter("secret", true, &lLevelCount, &lMessageCount);
+    TestLogFilterCounter  lRejectFilter("public", true, &lLevelCount, &lMessageCount);
+    Log::Filter::Chain    lChainFilter(lClock);
+    bool                  lAllow = true;
+
+    CPPUNIT_ASSERT(!lChainFilter.IsAdaptive());
+
+    // Test that, by default, links are consulted in push order, such
+    // that a link ahead of one that always rejects is consulted on
+    // every message.
+
+    lChainFilter.Push(lPassFilter);
+    lChainFilter.Push(lLevelFilter);
+
+    for (unsigned lWalk = 0; lWalk < kWalks; lWalk++) {
+        lAllow = lChainFilter.Allow(2) && lAllow;
+    }
+
+    CPPUNIT_ASSERT(lAllow == false);
+    CPPUNIT_ASSERT_EQUAL(kWalks, lLevelCount);
+
+    // Test that, in adaptive mode, the link that always rejects comes
+    // to be consulted first, with the same outcome. Since the clock
+    // charges every link alike, the order follows rejections alone.
+
+    lChainFilter.SetAdaptive(true);
+    CPPUNIT_ASSERT(lChainFilter.IsAdaptive());
+
+    for (unsigned lWalk = 0; lWalk < kWalks; lWalk++) {
+        lAllow = lChainFilter.Allow(2) && lAllow;
+    }
+
+    lLevelCount = 0;
+
+    for (unsigned lWalk = 0; lWalk < kWalks; lWalk++) {
+        lAllow = lChainFilter.Allow(2) && lAllow;
+    }
+
+    CPPUNIT_ASSERT(lAllow == false);
+    CPPUNIT_ASSERT_EQUAL(0U, lLevelCount);
+
+    lAllow = lChainFilter.Allow(1);
+    CPPUNIT_ASSERT(lAllow == true);
+    CPPUNIT_ASSERT_EQUAL(1U, lLevelCount);
+
+    // Test that an order-dependent link keeps its place.
+
+    lChainFilter.Reset();
+    lChainFilter.Push(lPassFilter, Log::Filter::Chain::Order::kDependent);
+    lChainFilter.Push(lLevelFilter);
+    CPPUNIT_ASSERT(lChainFilter.IsAdaptive());
+
+    lLevelCount = 0;
+
+    for (unsigned lWalk = 0; lWalk < (kWalks * 2); lWalk++) {
+        lAllow = lChainFilter.Allow(2) && lAllow;
+    }
+
+    CPPUNIT_ASSERT(lAllow == false);
+    CPPUNIT_ASSERT_EQUAL(kWalks * 2, lLevelCount);
+
+    // Test that the post-format phase is reordered, too, and that
+    // disabling adaptive mode restores push order.
+
+    lChainFilter.Reset();
+    lChainFilter.Push(lPassFilter);
+    lChainFilter.Push(lRejectFilter);
+
+    for (unsigned lWalk = 0; lWalk < kWalks; lWalk++) {
+        lAllow = lChainFilter.AllowMessage(2, "A public message.\n") && lAllow;
+    }
+
+    lMessageCount = 0;
+
+    for (unsigned lWalk = 0; lWalk < kWalks; lWalk++) {
+        lAllow = lChainFilter.AllowMessage(2, "A public message.\n") && lAllow;
+    }
+
+    CPPUNIT_ASSERT(lAllow == false);
+    CPPUNIT_ASSERT_EQUAL(kWalks, lMessageCount);
+
+    lChainFilter.SetAdaptive(false);
+    CPPUNIT_ASSERT(!lChainFilter.IsAdaptive());
+
+    lMessageCount = 0;
+
+    lAllow = lChainFilter.AllowMessage(2, "A public message.\n");
+    CPPUNIT_ASSERT(lAllow == false);
+    CPPUNIT_ASSERT_EQUAL(2U, lMessageCount);
+}
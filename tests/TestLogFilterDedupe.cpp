@@ -0,0 +1,295 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Filter::Dedupe.
+ */
+
+#include <LogUtilities/LogClockBase.hpp>
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterDedupe.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogIndenterNone.hpp>
+#include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+/**
+ *  A clock that only advances when told to.
+ */
+class TestLogClockManual :
+    public Log::Clock::Base
+{
+public:
+    TestLogClockManual(void) :
+        mNow(1000)
+    {
+        return;
+    }
+
+    Log::Clock::Ticks Now(void) const final
+    {
+        return (mNow);
+    }
+
+    void Convert(Log::Clock::Ticks inTicks, struct timespec & outTime) const final
+    {
+        outTime.tv_sec  = inTicks;
+        outTime.tv_nsec = 0;
+    }
+
+    Log::Clock::Ticks mNow;
+};
+
+/**
+ *  A writer that collects the messages written to it.
+ */
+class TestLogWriterCollector :
+    public Log::Writer::Base
+{
+public:
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        (void)inLevel;
+
+        mMessages.push_back(inMessage);
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    std::vector<std::string> mMessages;
+};
+
+class TestLogFilterDedupe :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogFilterDedupe);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestRepeats);
+    CPPUNIT_TEST(TestWindow);
+    CPPUNIT_TEST(TestSummary);
+    CPPUNIT_TEST(TestEviction);
+    CPPUNIT_TEST(TestFlush);
+    CPPUNIT_TEST(TestLogger);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestConstruction(void);
+    void TestRepeats(void);
+    void TestWindow(void);
+    void TestSummary(void);
+    void TestEviction(void);
+    void TestFlush(void);
+    void TestLogger(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterDedupe);
+
+void
+TestLogFilterDedupe :: TestConstruction(void)
+{
+    TestLogWriterCollector lCollector;
+    Log::Filter::Dedupe    lFilter(250);
+    Log::Filter::Dedupe    lSummaryFilter(1000, lCollector);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Clock::Ticks>(250000000), lFilter.GetWindow());
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Clock::Ticks>(1000000000), lSummaryFilter.GetWindow());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lFilter.GetSuppressed());
+    CPPUNIT_ASSERT(lFilter.NeedsMessage());
+    CPPUNIT_ASSERT(lFilter.Allow(1));
+}
+
+void
+TestLogFilterDedupe :: TestRepeats(void)
+{
+    TestLogClockManual  lClock;
+    Log::Filter::Dedupe lFilter(100, nullptr, lClock);
+
+    // Test that exact repeats are suppressed and that distinct
+    // messages are not.
+
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "disk full\n"));
+    CPPUNIT_ASSERT(!lFilter.AllowMessage(1, "disk full\n"));
+    CPPUNIT_ASSERT(!lFilter.Allow(1, "disk full\n"));
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "disk full!\n"));
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "link down\n"));
+    CPPUNIT_ASSERT(!lFilter.AllowMessage(2, "link down\n"));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(3), lFilter.GetSuppressed());
+}
+
+void
+TestLogFilterDedupe :: TestWindow(void)
+{
+    TestLogClockManual  lClock;
+    Log::Filter::Dedupe lFilter(100, nullptr, lClock);
+
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "disk full\n"));
+
+    lClock.mNow += 99;
+
+    CPPUNIT_ASSERT(!lFilter.AllowMessage(1, "disk full\n"));
+
+    // Test that the window is measured from when the message was
+    // last passed, not last repeated.
+
+    lClock.mNow += 1;
+
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "disk full\n"));
+    CPPUNIT_ASSERT(!lFilter.AllowMessage(1, "disk full\n"));
+}
+
+void
+TestLogFilterDedupe :: TestSummary(void)
+{
+    TestLogClockManual     lClock;
+    TestLogWriterCollector lCollector;
+    Log::Filter::Dedupe    lFilter(100, &lCollector, lClock);
+
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "disk full\n"));
+
+    for (unsigned lRepeat = 0; lRepeat < 5; lRepeat++) {
+        CPPUNIT_ASSERT(!lFilter.AllowMessage(1, "disk full\n"));
+    }
+
+    CPPUNIT_ASSERT(lCollector.mMessages.empty());
+
+    // Test that passing the message again summarizes its repeats,
+    // once.
+
+    lClock.mNow += 100;
+
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "disk full\n"));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCollector.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("last message repeated 5 times\n"),
+                         lCollector.mMessages[0]);
+
+    lClock.mNow += 100;
+
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "disk full\n"));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCollector.mMessages.size());
+}
+
+void
+TestLogFilterDedupe :: TestEviction(void)
+{
+    TestLogClockManual     lClock;
+    TestLogWriterCollector lCollector;
+    Log::Filter::Dedupe    lFilter(100, &lCollector, lClock);
+    char                   lMessage[32];
+    size_t                 lSummaries = 0;
+
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "disk full\n"));
+    CPPUNIT_ASSERT(!lFilter.AllowMessage(1, "disk full\n"));
+
+    // Test that, with more distinct messages than slots, the repeat
+    // is summarized when its slot is taken over.
+
+    for (size_t lIndex = 0; lIndex < Log::Filter::Dedupe::kSlots * 4; lIndex++) {
+        snprintf(lMessage, sizeof (lMessage), "message %zu\n", lIndex);
+
+        lFilter.AllowMessage(1, lMessage);
+    }
+
+    for (const std::string & lSummary : lCollector.mMessages) {
+        if (lSummary == "earlier message repeated 1 times\n") {
+            lSummaries++;
+        }
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lSummaries);
+}
+
+void
+TestLogFilterDedupe :: TestFlush(void)
+{
+    TestLogClockManual     lClock;
+    TestLogWriterCollector lCollector;
+    Log::Filter::Dedupe    lFilter(100, &lCollector, lClock);
+    Log::Filter::Dedupe    lCopyFilter(lFilter);
+
+    CPPUNIT_ASSERT(lFilter.AllowMessage(1, "disk full\n"));
+    CPPUNIT_ASSERT(!lCopyFilter.AllowMessage(1, "disk full\n"));
+    CPPUNIT_ASSERT(!lFilter.AllowMessage(1, "disk full\n"));
+
+    // Test that flushing summarizes pending repeats, once, and that
+    // copies share their table.
+
+    lCopyFilter.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCollector.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("earlier message repeated 2 times\n"),
+                         lCollector.mMessages[0]);
+
+    lFilter.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCollector.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(2), lFilter.GetSuppressed());
+}
+
+void
+TestLogFilterDedupe :: TestLogger(void)
+{
+    TestLogClockManual     lClock;
+    TestLogWriterCollector lCollector;
+    Log::Filter::Level     lLevelFilter(2);
+    Log::Filter::Dedupe    lDedupeFilter(100, &lCollector, lClock);
+    Log::Filter::Chain     lChainFilter;
+    Log::Indenter::None    lNoneIndenter;
+    Log::Formatter::Plain  lPlainFormatter;
+
+    lChainFilter.Push(lLevelFilter);
+    lChainFilter.Push(lDedupeFilter);
+
+    Log::Logger lLogger(lChainFilter,
+                        lNoneIndenter,
+                        lPlainFormatter,
+                        lCollector);
+
+    // Test that repeats are compared after formatting.
+
+    lLogger.Write(1, "Disk %d is full.\n", 1);
+    lLogger.Write(1, "Disk %d is full.\n", 1);
+    lLogger.Write(1, "Disk %d is full.\n", 2);
+    lLogger.Write(1, "Disk %d is full.\n", 1);
+
+    lClock.mNow += 100;
+
+    lLogger.Write(1, "Disk %d is full.\n", 1);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), lCollector.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("Disk 1 is full.\n"), lCollector.mMessages[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("Disk 2 is full.\n"), lCollector.mMessages[1]);
+    CPPUNIT_ASSERT_EQUAL(std::string("last message repeated 2 times\n"), lCollector.mMessages[2]);
+    CPPUNIT_ASSERT_EQUAL(std::string("Disk 1 is full.\n"), lCollector.mMessages[3]);
+}
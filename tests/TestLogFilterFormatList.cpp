@@ -0,0 +1,327 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Filter::FormatList.
+ */
+
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterFormatList.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterStaticChain.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogIndenterNone.hpp>
+#include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogStaticLogger.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+/**
+ *  A writer that collects the messages written to it.
+ */
+class TestLogWriterCollector :
+    public Log::Writer::Base
+{
+public:
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        (void)inLevel;
+
+        mMessages.push_back(inMessage);
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    std::vector<std::string> mMessages;
+};
+
+/**
+ *  A filter that counts how often its post-format phase is consulted.
+ */
+class TestLogFilterMessageCounter :
+    public Log::Filter::Base
+{
+public:
+    TestLogFilterMessageCounter(unsigned * outCount) :
+        mCount(outCount)
+    {
+        return;
+    }
+
+    bool Allow(Log::Level inLevel) final
+    {
+        (void)inLevel;
+
+        return (true);
+    }
+
+    bool Allow(Log::Level inLevel, const char * inMessage) final
+    {
+        return (AllowMessage(inLevel, inMessage));
+    }
+
+    bool AllowMessage(Log::Level inLevel, const char * inMessage) final
+    {
+        (void)inLevel;
+        (void)inMessage;
+
+        (*mCount)++;
+
+        return (true);
+    }
+
+private:
+    unsigned * mCount;
+};
+
+static const char kHealthFormat[]  = "GET /health %d\n";
+static const char kOrdersFormat[]  = "GET /orders %d\n";
+static const char kHealthCopy[]    = "GET /health %d\n";
+
+class TestLogFilterFormatList :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogFilterFormatList);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestPointerKey);
+    CPPUNIT_TEST(TestHashKey);
+    CPPUNIT_TEST(TestCache);
+    CPPUNIT_TEST(TestActions);
+    CPPUNIT_TEST(TestChain);
+    CPPUNIT_TEST(TestLogger);
+    CPPUNIT_TEST(TestStaticLogger);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestConstruction(void);
+    void TestPointerKey(void);
+    void TestHashKey(void);
+    void TestCache(void);
+    void TestActions(void);
+    void TestChain(void);
+    void TestLogger(void);
+    void TestStaticLogger(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterFormatList);
+
+void
+TestLogFilterFormatList :: TestConstruction(void)
+{
+    Log::Filter::FormatList lFilter(Log::Filter::FormatList::Action::kReject,
+                                    Log::Filter::FormatList::Key::kPointer,
+                                    { kHealthFormat, kOrdersFormat });
+    Log::Filter::FormatList lCopyFilter(lFilter);
+
+    CPPUNIT_ASSERT(lFilter.GetAction() == Log::Filter::FormatList::Action::kReject);
+    CPPUNIT_ASSERT(lFilter.GetKey() == Log::Filter::FormatList::Key::kPointer);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lFilter.GetFormats());
+    CPPUNIT_ASSERT(lFilter.NeedsFormat());
+    CPPUNIT_ASSERT(!lFilter.NeedsMessage());
+    CPPUNIT_ASSERT(lFilter.Allow(1));
+    CPPUNIT_ASSERT(lFilter.Allow(1, "GET /health 200\n"));
+
+    CPPUNIT_ASSERT(lCopyFilter.GetAction() == Log::Filter::FormatList::Action::kReject);
+    CPPUNIT_ASSERT(lCopyFilter.Contains(kHealthFormat));
+}
+
+void
+TestLogFilterFormatList :: TestPointerKey(void)
+{
+    Log::Filter::FormatList lFilter(Log::Filter::FormatList::Action::kReject,
+                                    Log::Filter::FormatList::Key::kPointer,
+                                    { kHealthFormat });
+
+    // Test that only the very format listed matches.
+
+    CPPUNIT_ASSERT(lFilter.Contains(kHealthFormat));
+    CPPUNIT_ASSERT(!lFilter.Contains(kHealthCopy));
+    CPPUNIT_ASSERT(!lFilter.Contains(kOrdersFormat));
+}
+
+void
+TestLogFilterFormatList :: TestHashKey(void)
+{
+    std::string             lFormat(kHealthFormat);
+    Log::Filter::FormatList lFilter(Log::Filter::FormatList::Action::kReject,
+                                    Log::Filter::FormatList::Key::kHash,
+                                    { lFormat.c_str() });
+
+    // Test that the format is copied and that equal formats anywhere
+    // match.
+
+    lFormat.assign("changed");
+
+    CPPUNIT_ASSERT(lFilter.Contains(kHealthFormat));
+    CPPUNIT_ASSERT(lFilter.Contains(kHealthCopy));
+    CPPUNIT_ASSERT(!lFilter.Contains(kOrdersFormat));
+    CPPUNIT_ASSERT(!lFilter.Contains(""));
+}
+
+void
+TestLogFilterFormatList :: TestCache(void)
+{
+    static const size_t       kFormats = Log::Filter::FormatList::kCacheSlots * 4;
+    std::vector<std::string>  lFormats(kFormats);
+    std::vector<const char *> lListed;
+    char                      lBuffer[32];
+
+    for (size_t lIndex = 0; lIndex < kFormats; lIndex++) {
+        snprintf(lBuffer, sizeof (lBuffer), "format %zu %%d\n", lIndex);
+
+        lFormats[lIndex] = lBuffer;
+
+        if ((lIndex % 3) == 0) {
+            lListed.push_back(lFormats[lIndex].c_str());
+        }
+    }
+
+    Log::Filter::FormatList lFilter(Log::Filter::FormatList::Action::kPass,
+                                    Log::Filter::FormatList::Key::kPointer,
+                                    lListed);
+
+    // Test that results are the same whether cached, uncached, or
+    // evicted by other formats.
+
+    for (unsigned lPass = 0; lPass < 3; lPass++) {
+        for (size_t lIndex = 0; lIndex < kFormats; lIndex++) {
+            CPPUNIT_ASSERT_EQUAL((lIndex % 3) == 0, lFilter.Contains(lFormats[lIndex].c_str()));
+            CPPUNIT_ASSERT_EQUAL((lIndex % 3) == 0, lFilter.Contains(lFormats[lIndex].c_str()));
+        }
+    }
+}
+
+void
+TestLogFilterFormatList :: TestActions(void)
+{
+    Log::Filter::FormatList lRejectFilter(Log::Filter::FormatList::Action::kReject,
+                                          Log::Filter::FormatList::Key::kPointer,
+                                          { kHealthFormat });
+    Log::Filter::FormatList lPassFilter(Log::Filter::FormatList::Action::kPass,
+                                        Log::Filter::FormatList::Key::kPointer,
+                                        { kHealthFormat });
+
+    CPPUNIT_ASSERT(!lRejectFilter.AllowFormat(1, kHealthFormat));
+    CPPUNIT_ASSERT(lRejectFilter.AllowFormat(1, kOrdersFormat));
+
+    CPPUNIT_ASSERT(lPassFilter.AllowFormat(1, kHealthFormat));
+    CPPUNIT_ASSERT(!lPassFilter.AllowFormat(1, kOrdersFormat));
+}
+
+void
+TestLogFilterFormatList :: TestChain(void)
+{
+    Log::Filter::Level      lLevelFilter(2);
+    Log::Filter::FormatList lFormatFilter(Log::Filter::FormatList::Action::kReject,
+                                          Log::Filter::FormatList::Key::kPointer,
+                                          { kHealthFormat });
+    Log::Filter::Chain      lChainFilter;
+
+    lChainFilter.Push(lLevelFilter);
+
+    // Test that a chain without format links skips the phase.
+
+    CPPUNIT_ASSERT(!lChainFilter.NeedsFormat());
+    CPPUNIT_ASSERT(lChainFilter.AllowFormat(1, kHealthFormat));
+
+    lChainFilter.Push(lFormatFilter);
+
+    CPPUNIT_ASSERT(lChainFilter.NeedsFormat());
+    CPPUNIT_ASSERT(!lChainFilter.NeedsMessage());
+    CPPUNIT_ASSERT(!lChainFilter.AllowFormat(1, kHealthFormat));
+    CPPUNIT_ASSERT(lChainFilter.AllowFormat(1, kOrdersFormat));
+
+    lChainFilter.Pop();
+
+    CPPUNIT_ASSERT(!lChainFilter.NeedsFormat());
+}
+
+void
+TestLogFilterFormatList :: TestLogger(void)
+{
+    unsigned                    lMessageCount = 0;
+    TestLogWriterCollector      lCollector;
+    TestLogFilterMessageCounter lCounterFilter(&lMessageCount);
+    Log::Filter::FormatList     lFormatFilter(Log::Filter::FormatList::Action::kReject,
+                                              Log::Filter::FormatList::Key::kPointer,
+                                              { kHealthFormat });
+    Log::Filter::Chain          lChainFilter;
+    Log::Indenter::None         lNoneIndenter;
+    Log::Formatter::Plain       lPlainFormatter;
+
+    lChainFilter.Push(lFormatFilter);
+    lChainFilter.Push(lCounterFilter);
+
+    Log::Logger lLogger(lChainFilter,
+                        lNoneIndenter,
+                        lPlainFormatter,
+                        lCollector);
+
+    // Test that messages rejected on their format never reach
+    // formatting or the post-format phase.
+
+    lLogger.Write(1, kHealthFormat, 200);
+    lLogger.Write(1, kOrdersFormat, 200);
+    lLogger.Write(1, kHealthFormat, 503);
+
+    CPPUNIT_ASSERT_EQUAL(1U, lMessageCount);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCollector.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("GET /orders 200\n"), lCollector.mMessages[0]);
+}
+
+void
+TestLogFilterFormatList :: TestStaticLogger(void)
+{
+    typedef Log::Filter::StaticChain<Log::Filter::Level,
+                                     Log::Filter::FormatList> FilterType;
+
+    Log::StaticLogger<FilterType,
+                      Log::Indenter::None,
+                      Log::Formatter::Plain,
+                      TestLogWriterCollector> lLogger(FilterType(Log::Filter::Level(2),
+                                                                 Log::Filter::FormatList(Log::Filter::FormatList::Action::kReject,
+                                                                                         Log::Filter::FormatList::Key::kHash,
+                                                                                         { kHealthCopy })),
+                                                      Log::Indenter::None(),
+                                                      Log::Formatter::Plain(),
+                                                      TestLogWriterCollector());
+
+    CPPUNIT_ASSERT(lLogger.GetFilter().NeedsFormat());
+
+    lLogger.Write(1, kHealthFormat, 200);
+    lLogger.Write(1, kOrdersFormat, 200);
+    lLogger.Write(3, kOrdersFormat, 500);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lLogger.GetWriter().mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("GET /orders 200\n"), lLogger.GetWriter().mMessages[0]);
+}
@@ -0,0 +1,388 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Filter::Gate.
+ */
+
+#include <LogUtilities/LogFilterAlways.hpp>
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterGate.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterNever.hpp>
+#include <LogUtilities/LogFilterQuiet.hpp>
+#include <LogUtilities/LogFilterStaticChain.hpp>
+#include <LogUtilities/LogWriterChain.hpp>
+#include <LogUtilities/LogWriterStderr.hpp>
+
+#include <atomic>
+#include <thread>
+
+#include <limits.h>
+#include <stdint.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+// A filter that counts how many times its level limit is queried,
+// which a gate does each time it is refreshed.
+
+class TestCountingFilter :
+    public Log::Filter::Always
+{
+public:
+    TestCountingFilter(void) : mQueries(0) { return; }
+
+    virtual uint64_t GetLevelLimit(void) const
+    {
+        mQueries++;
+
+        return (Log::Filter::Always::GetLevelLimit());
+    }
+
+    mutable unsigned mQueries;
+};
+
+
+class TestLogFilterGate :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogFilterGate);
+    CPPUNIT_TEST(TestLevels);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestRefresh);
+    CPPUNIT_TEST(TestBind);
+    CPPUNIT_TEST(TestWriter);
+    CPPUNIT_TEST(TestCopy);
+    CPPUNIT_TEST(TestScope);
+    CPPUNIT_TEST(TestOwners);
+    CPPUNIT_TEST(TestConcurrency);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestLevels(void);
+    void TestConstruction(void);
+    void TestRefresh(void);
+    void TestBind(void);
+    void TestWriter(void);
+    void TestCopy(void);
+    void TestScope(void);
+    void TestOwners(void);
+    void TestConcurrency(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterGate);
+
+void
+TestLogFilterGate :: TestLevels(void)
+{
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0),
+                         Log::Filter::Gate::GetLevels(Log::Filter::Base::kLevelLimitNone));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x1),
+                         Log::Filter::Gate::GetLevels(1));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x7),
+                         Log::Filter::Gate::GetLevels(3));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x7FFFFFFFFFFFFFFFULL),
+                         Log::Filter::Gate::GetLevels(63));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xFFFFFFFFFFFFFFFFULL),
+                         Log::Filter::Gate::GetLevels(64));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xFFFFFFFFFFFFFFFFULL),
+                         Log::Filter::Gate::GetLevels(Log::Filter::Base::kLevelLimitAll));
+
+    // Test inclusive ranges, including those reaching the last bit.
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x7),
+                         Log::Filter::Gate::GetLevels(0, 2));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x38),
+                         Log::Filter::Gate::GetLevels(3, 5));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x10),
+                         Log::Filter::Gate::GetLevels(4, 4));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0),
+                         Log::Filter::Gate::GetLevels(5, 4));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xC000000000000000ULL),
+                         Log::Filter::Gate::GetLevels(62, 70));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x8000000000000000ULL),
+                         Log::Filter::Gate::GetLevels(70, UINT_MAX));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xFFFFFFFFFFFFFFFFULL),
+                         Log::Filter::Gate::GetLevels(0, UINT_MAX));
+}
+
+void
+TestLogFilterGate :: TestConstruction(void)
+{
+    Log::Filter::Always lAlwaysFilter;
+    Log::Filter::Never  lNeverFilter;
+    Log::Filter::Level  lLevelFilter(2);
+    Log::Filter::Gate   lAlwaysGate(lAlwaysFilter);
+    Log::Filter::Gate   lNeverGate(lNeverFilter);
+    Log::Filter::Gate   lLevelGate(lLevelFilter);
+
+    CPPUNIT_ASSERT(lAlwaysGate.IsEnabled(0));
+    CPPUNIT_ASSERT(lAlwaysGate.IsEnabled(UINT_MAX));
+
+    CPPUNIT_ASSERT(!lNeverGate.IsEnabled(0));
+    CPPUNIT_ASSERT(!lNeverGate.IsEnabled(UINT_MAX));
+
+    CPPUNIT_ASSERT(lLevelGate.IsEnabled(0));
+    CPPUNIT_ASSERT(lLevelGate.IsEnabled(2));
+    CPPUNIT_ASSERT(!lLevelGate.IsEnabled(3));
+    CPPUNIT_ASSERT(!lLevelGate.IsEnabled(UINT_MAX));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x7), lLevelGate.GetLevels());
+}
+
+void
+TestLogFilterGate :: TestRefresh(void)
+{
+    Log::Filter::Quiet lQuietFilter(false);
+    Log::Filter::Level lLevelFilter(2);
+    Log::Filter::Chain lChainFilter;
+    Log::Filter::Gate  lChainGate(lChainFilter);
+
+    // An empty chain passes nothing.
+
+    CPPUNIT_ASSERT(!lChainGate.IsEnabled(0));
+
+    // Test that pushing links refreshes the gate.
+
+    lChainFilter.Push(lQuietFilter);
+    lChainFilter.Push(lLevelFilter);
+
+    CPPUNIT_ASSERT(lChainGate.IsEnabled(2));
+    CPPUNIT_ASSERT(!lChainGate.IsEnabled(3));
+
+    // Test that changing the links refreshes the gate.
+
+    lChainFilter.GetLevelLink()->SetLevel(70);
+
+    CPPUNIT_ASSERT(lChainGate.IsEnabled(63));
+    CPPUNIT_ASSERT(lChainGate.IsEnabled(70));
+
+    // Levels sharing the last bit are conservatively enabled.
+
+    CPPUNIT_ASSERT(lChainGate.IsEnabled(71));
+
+    lChainFilter.GetQuietLink()->SetQuiet(true);
+
+    CPPUNIT_ASSERT(!lChainGate.IsEnabled(0));
+
+    lChainFilter.Reset();
+
+    CPPUNIT_ASSERT(!lChainGate.IsEnabled(0));
+}
+
+void
+TestLogFilterGate :: TestBind(void)
+{
+    Log::Filter::Always lAlwaysFilter;
+    Log::Filter::Level  lLevelFilter(1);
+    Log::Filter::Gate   lGate(lAlwaysFilter);
+
+    CPPUNIT_ASSERT(lGate.IsEnabled(UINT_MAX));
+
+    lGate.Bind(lLevelFilter);
+
+    CPPUNIT_ASSERT(lGate.IsEnabled(1));
+    CPPUNIT_ASSERT(!lGate.IsEnabled(2));
+
+    // Test that only changes to the bound filter matter.
+
+    lGate.Bind(lAlwaysFilter);
+
+    lLevelFilter.SetLevel(0);
+
+    CPPUNIT_ASSERT(lGate.IsEnabled(UINT_MAX));
+}
+
+void
+TestLogFilterGate :: TestWriter(void)
+{
+    Log::Filter::Level  lLevelFilter(5);
+    Log::Writer::Stderr lStderrWriter;
+    Log::Writer::Chain  lChainWriter;
+    Log::Filter::Gate   lGate(lLevelFilter, lChainWriter);
+
+    // An empty chain writes nothing.
+
+    CPPUNIT_ASSERT(!lGate.IsEnabled(0));
+
+    // Test that pushing ranged links enables the union of their
+    // ranges, within the levels the filter passes.
+
+    lChainWriter.Push(lStderrWriter, 0, 1);
+    lChainWriter.Push(lStderrWriter, 4, 9);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x33), lGate.GetLevels());
+
+    // Test that changing a link's range refreshes the gate.
+
+    lChainWriter.SetLevels(0, 0, 3);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x3F), lGate.GetLevels());
+
+    lChainWriter.Pop();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xF), lGate.GetLevels());
+
+    // Test that unbinding the writer gates the filter alone.
+
+    lGate.Bind(static_cast<const Log::Writer::Base *>(NULL));
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x3F), lGate.GetLevels());
+}
+
+void
+TestLogFilterGate :: TestCopy(void)
+{
+    Log::Filter::Level  lLevelFilter(2);
+    Log::Filter::Never  lNeverFilter;
+    Log::Filter::Gate   lGate(lLevelFilter);
+    Log::Filter::Gate   lNeverGate(lNeverFilter);
+
+    // Test that a copy gates the same filter and is refreshed along
+    // with it, even once the original is gone.
+
+    {
+        Log::Filter::Gate lCopy(lGate);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x7), lCopy.GetLevels());
+
+        lNeverGate = lCopy;
+    }
+
+    lLevelFilter.SetLevel(3);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xF), lGate.GetLevels());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xF), lNeverGate.GetLevels());
+}
+
+void
+TestLogFilterGate :: TestScope(void)
+{
+    TestCountingFilter lCountingFilter;
+    Log::Filter::Level lLevelFilter(2);
+    Log::Filter::Gate  lCountingGate(lCountingFilter);
+    Log::Filter::Gate  lLevelGate(lLevelFilter);
+    const unsigned     lQueries = lCountingFilter.mQueries;
+
+    // Test that a change to one filter refreshes its gates alone.
+
+    lLevelFilter.SetLevel(3);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xF), lLevelGate.GetLevels());
+    CPPUNIT_ASSERT_EQUAL(lQueries, lCountingFilter.mQueries);
+}
+
+void
+TestLogFilterGate :: TestOwners(void)
+{
+    Log::Filter::Level                           lLevelFilter(2);
+    Log::Filter::Chain                           lInnerFilter;
+    Log::Filter::Chain                           lOuterFilter;
+    Log::Filter::StaticChain<Log::Filter::Level> lStaticFilter(lLevelFilter);
+    Log::Filter::Gate                            lOuterGate(lOuterFilter);
+    Log::Filter::Gate                            lStaticGate(lStaticFilter);
+    Log::Writer::Stderr                          lStderrWriter;
+    Log::Writer::Chain                           lChainWriter;
+
+    lInnerFilter.Push(lLevelFilter);
+
+    // Test that a change to a link of a chain copy, held as a link
+    // of another chain, refreshes the gates of the latter.
+
+    {
+        Log::Filter::Chain lCopyFilter(lInnerFilter);
+
+        lOuterFilter.Push(lCopyFilter);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x7), lOuterGate.GetLevels());
+
+        lInnerFilter.GetLevelLink()->SetLevel(3);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xF), lOuterGate.GetLevels());
+
+        // As does a change, through the original, to the links the
+        // copy shares.
+
+        lInnerFilter.Pop();
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lOuterGate.GetLevels());
+
+        lOuterFilter.Reset();
+    }
+
+    // Test that a change to a link held by value in a static chain
+    // refreshes the gates of the chain.
+
+    lStaticFilter.Link<0>().SetLevel(1);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x3), lStaticGate.GetLevels());
+
+    // Test that a change through the original of a writer chain
+    // refreshes the gates of its copies.
+
+    {
+        Log::Writer::Chain lCopyWriter(lChainWriter);
+        Log::Filter::Gate  lWriterGate(lLevelFilter, lCopyWriter);
+
+        lChainWriter.Push(lStderrWriter, 1, 2);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x6), lWriterGate.GetLevels());
+
+        lChainWriter.SetLevels(0, 0, 1);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0x3), lWriterGate.GetLevels());
+    }
+}
+
+void
+TestLogFilterGate :: TestConcurrency(void)
+{
+    static const unsigned kChanges = 10000;
+    Log::Filter::Level    lLevelFilter(1);
+    Log::Filter::Gate     lGate(lLevelFilter);
+    std::atomic<bool>     lDone(false);
+    unsigned              lInconsistent = 0;
+
+    // Test that, while a control thread changes the level, readers
+    // only ever see either the old or the new set of levels.
+
+    std::thread lControl([&lLevelFilter, &lDone](void) {
+        for (unsigned lChange = 0; lChange < kChanges; lChange++) {
+            lLevelFilter.SetLevel((lChange % 2) ? 1 : 3);
+        }
+
+        lDone.store(true);
+    });
+
+    while (!lDone.load()) {
+        const uint64_t lLevels = lGate.GetLevels();
+
+        if ((lLevels != 0x3) && (lLevels != 0xF)) {
+            lInconsistent++;
+        }
+    }
+
+    lControl.join();
+
+    CPPUNIT_ASSERT_EQUAL(0U, lInconsistent);
+    CPPUNIT_ASSERT(lGate.IsEnabled(1));
+    CPPUNIT_ASSERT(!lGate.IsEnabled(2));
+}
@@ -23,6 +23,7 @@
 #include <LogUtilities/LogFilterLevel.hpp>
 
 #include <limits.h>
+#include <stdint.h>
 
 #include <cppunit/TestAssert.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -40,6 +41,7 @@ class TestLogFilterLevel :
     CPPUNIT_TEST(TestObservation);
     CPPUNIT_TEST(TestMutation);
     CPPUNIT_TEST(TestAllow);
+    CPPUNIT_TEST(TestLevelLimit);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -48,6 +50,7 @@ public:
     void TestObservation(void);
     void TestMutation(void);
     void TestAllow(void);
+    void TestLevelLimit(void);
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterLevel);
@@ -182,3 +185,21 @@ TestLogFilterLevel :: TestAllow(void)
     lAllow = lLevelMaxFilter.Allow(kLevelMax, kTestMessage);
     CPPUNIT_ASSERT_EQUAL(true, lAllow);
 }
+
+void
+TestLogFilterLevel :: TestLevelLimit(void)
+{
+    const Log::Level   kLevelMin = 0;
+    const Log::Level   kLevelMax = UINT_MAX;
+    Log::Filter::Level lLevelFilter(kLevelMin);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(1), lLevelFilter.GetLevelLimit());
+
+    // Test that changing the level changes the level limit.
+
+    lLevelFilter.SetLevel(5);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(6), lLevelFilter.GetLevelLimit());
+
+    lLevelFilter.SetLevel(kLevelMax);
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitAll, lLevelFilter.GetLevelLimit());
+}
@@ -0,0 +1,286 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Filter::Pattern.
+ */
+
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterPattern.hpp>
+
+#include <string>
+#include <vector>
+
+#include <fnmatch.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+class TestLogFilterPattern :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogFilterPattern);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestLiterals);
+    CPPUNIT_TEST(TestOverlapping);
+    CPPUNIT_TEST(TestGlobs);
+    CPPUNIT_TEST(TestPrefilter);
+    CPPUNIT_TEST(TestActions);
+    CPPUNIT_TEST(TestMany);
+    CPPUNIT_TEST(TestChain);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestConstruction(void);
+    void TestLiterals(void);
+    void TestOverlapping(void);
+    void TestGlobs(void);
+    void TestPrefilter(void);
+    void TestActions(void);
+    void TestMany(void);
+    void TestChain(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterPattern);
+
+void
+TestLogFilterPattern :: TestConstruction(void)
+{
+    const std::vector<std::string> kPatterns = { "health", "tenant-*" };
+    Log::Filter::Pattern           lFilter(Log::Filter::Pattern::Action::kReject, kPatterns);
+    Log::Filter::Pattern           lEmptyFilter(Log::Filter::Pattern::Action::kPass, std::vector<std::string>());
+    Log::Filter::Pattern           lCopyFilter(lFilter);
+
+    CPPUNIT_ASSERT(lFilter.GetAction() == Log::Filter::Pattern::Action::kReject);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lFilter.GetPatterns());
+    CPPUNIT_ASSERT(lFilter.NeedsMessage());
+    CPPUNIT_ASSERT(lFilter.Allow(1));
+
+    CPPUNIT_ASSERT(lCopyFilter.GetAction() == Log::Filter::Pattern::Action::kReject);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lCopyFilter.GetPatterns());
+
+    lCopyFilter = lEmptyFilter;
+
+    CPPUNIT_ASSERT(lCopyFilter.GetAction() == Log::Filter::Pattern::Action::kPass);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lCopyFilter.GetPatterns());
+
+    // Test that no patterns match nothing.
+
+    CPPUNIT_ASSERT(!lEmptyFilter.Match(""));
+    CPPUNIT_ASSERT(!lEmptyFilter.Match("message\n"));
+}
+
+void
+TestLogFilterPattern :: TestLiterals(void)
+{
+    const std::vector<std::string> kPatterns = { "GET /health", "tenant=42 ", "\xc3\xa9t\xc3\xa9" };
+    Log::Filter::Pattern           lFilter(Log::Filter::Pattern::Action::kReject, kPatterns);
+    Log::Filter::Pattern           lEmptyFilter(Log::Filter::Pattern::Action::kReject, { "" });
+
+    CPPUNIT_ASSERT(lFilter.Match("GET /health"));
+    CPPUNIT_ASSERT(lFilter.Match("127.0.0.1 GET /healthz 200\n"));
+    CPPUNIT_ASSERT(lFilter.Match("request tenant=42 done\n"));
+    CPPUNIT_ASSERT(lFilter.Match("summer \xc3\xa9t\xc3\xa9\n"));
+
+    CPPUNIT_ASSERT(!lFilter.Match(""));
+    CPPUNIT_ASSERT(!lFilter.Match("GET /healt"));
+    CPPUNIT_ASSERT(!lFilter.Match("get /health\n"));
+    CPPUNIT_ASSERT(!lFilter.Match("request tenant=421 done\n"));
+
+    // Test that an empty literal matches everything.
+
+    CPPUNIT_ASSERT(lEmptyFilter.Match(""));
+    CPPUNIT_ASSERT(lEmptyFilter.Match("message\n"));
+}
+
+void
+TestLogFilterPattern :: TestOverlapping(void)
+{
+    const std::vector<std::string> kPatterns = { "hers", "she", "his", "abcd", "bcx" };
+    Log::Filter::Pattern           lFilter(Log::Filter::Pattern::Action::kPass, kPatterns);
+
+    // Test that matches are found through failure transitions.
+
+    CPPUNIT_ASSERT(lFilter.Match("ushers"));
+    CPPUNIT_ASSERT(lFilter.Match("ahishers"));
+    CPPUNIT_ASSERT(lFilter.Match("abcx"));
+    CPPUNIT_ASSERT(lFilter.Match("ababcd"));
+
+    CPPUNIT_ASSERT(!lFilter.Match("ush her"));
+    CPPUNIT_ASSERT(!lFilter.Match("abc"));
+    CPPUNIT_ASSERT(!lFilter.Match("hi s her"));
+}
+
+void
+TestLogFilterPattern :: TestGlobs(void)
+{
+    const std::vector<std::string> kPatterns = { "tenant-[0-9][0-9]*:denied", "user=? ", "\\*star\\*" };
+    const std::vector<std::string> kAnyPatterns = { "?" };
+    Log::Filter::Pattern           lFilter(Log::Filter::Pattern::Action::kReject, kPatterns);
+    Log::Filter::Pattern           lAnyFilter(Log::Filter::Pattern::Action::kReject, kAnyPatterns);
+
+    CPPUNIT_ASSERT(lFilter.Match("tenant-42:denied"));
+    CPPUNIT_ASSERT(lFilter.Match("req tenant-42 path /a/b:denied\n"));
+    CPPUNIT_ASSERT(lFilter.Match("login user=a ok\n"));
+    CPPUNIT_ASSERT(lFilter.Match("a *star* is born\n"));
+
+    CPPUNIT_ASSERT(!lFilter.Match("tenant-4x:denied\n"));
+    CPPUNIT_ASSERT(!lFilter.Match("tenant-42:allowed\n"));
+    CPPUNIT_ASSERT(!lFilter.Match("login user=ab ok\n"));
+    CPPUNIT_ASSERT(!lFilter.Match("a star is born\n"));
+
+    // Test that globs without any literal run are still matched.
+
+    CPPUNIT_ASSERT(lAnyFilter.Match("x"));
+    CPPUNIT_ASSERT(!lAnyFilter.Match(""));
+}
+
+void
+TestLogFilterPattern :: TestPrefilter(void)
+{
+    const std::vector<std::string> kFewPatterns  = { "needle" };
+    const std::vector<std::string> kManyPatterns = { "a1", "b2", "c3", "d4", "e5", "f6", "g7", "h8", "i9", "needle" };
+    Log::Filter::Pattern           lFewFilter(Log::Filter::Pattern::Action::kPass, kFewPatterns);
+    Log::Filter::Pattern           lManyFilter(Log::Filter::Pattern::Action::kPass, kManyPatterns);
+    std::string                    lMessage;
+
+    // Test matches at every offset, across and beyond the blocks the
+    // prefilter compares at once, with near misses ahead of them.
+
+    for (size_t lOffset = 0; lOffset < 70; lOffset++) {
+        lMessage.assign(lOffset, 'n');
+        lMessage += "needl needle";
+
+        CPPUNIT_ASSERT(lFewFilter.Match(lMessage.c_str()));
+        CPPUNIT_ASSERT(lManyFilter.Match(lMessage.c_str()));
+
+        lMessage.resize(lMessage.size() - 1);
+
+        CPPUNIT_ASSERT(!lFewFilter.Match(lMessage.c_str()));
+        CPPUNIT_ASSERT(!lManyFilter.Match(lMessage.c_str()));
+    }
+}
+
+void
+TestLogFilterPattern :: TestActions(void)
+{
+    const std::vector<std::string> kPatterns = { "health" };
+    Log::Filter::Pattern           lRejectFilter(Log::Filter::Pattern::Action::kReject, kPatterns);
+    Log::Filter::Pattern           lPassFilter(Log::Filter::Pattern::Action::kPass, kPatterns);
+
+    CPPUNIT_ASSERT(!lRejectFilter.AllowMessage(1, "GET /health\n"));
+    CPPUNIT_ASSERT(!lRejectFilter.Allow(1, "GET /health\n"));
+    CPPUNIT_ASSERT(lRejectFilter.AllowMessage(1, "GET /orders\n"));
+
+    CPPUNIT_ASSERT(lPassFilter.AllowMessage(1, "GET /health\n"));
+    CPPUNIT_ASSERT(lPassFilter.Allow(1, "GET /health\n"));
+    CPPUNIT_ASSERT(!lPassFilter.AllowMessage(1, "GET /orders\n"));
+}
+
+void
+TestLogFilterPattern :: TestMany(void)
+{
+    static const size_t      kPatterns = 500;
+    static const size_t      kMessages = 2000;
+    std::vector<std::string> lPatterns;
+    char                     lBuffer[128];
+    size_t                   lMatches = 0;
+    bool                     lExpected;
+
+    srandom(1);
+
+    // Build hundreds of short patterns over a small alphabet, some of
+    // them globs, such that matches and near misses are common.
+
+    for (size_t lIndex = 0; lIndex < kPatterns; lIndex++) {
+        std::string lPattern;
+        const size_t lLength = 3 + (random() % 4);
+
+        for (size_t lByte = 0; lByte < lLength; lByte++) {
+            lPattern += static_cast<char>('a' + (random() % 8));
+        }
+
+        if ((lIndex % 10) == 0) {
+            lPattern.insert(lLength / 2, "*");
+        }
+
+        lPatterns.push_back(lPattern);
+    }
+
+    Log::Filter::Pattern lFilter(Log::Filter::Pattern::Action::kPass, lPatterns);
+
+    // Test the automaton against matching each pattern in turn.
+
+    for (size_t lMessage = 0; lMessage < kMessages; lMessage++) {
+        const size_t lLength = random() % (sizeof (lBuffer) - 1);
+
+        for (size_t lByte = 0; lByte < lLength; lByte++) {
+            lBuffer[lByte] = static_cast<char>('a' + (random() % 12));
+        }
+
+        lBuffer[lLength] = '\0';
+
+        lExpected = false;
+
+        for (const std::string & lPattern : lPatterns) {
+            const std::string lGlob = "*" + lPattern + "*";
+
+            if (fnmatch(lGlob.c_str(), lBuffer, 0) == 0) {
+                lExpected = true;
+                break;
+            }
+        }
+
+        CPPUNIT_ASSERT_EQUAL(lExpected, lFilter.Match(lBuffer));
+
+        if (lExpected) {
+            lMatches++;
+        }
+    }
+
+    // Test that the messages exercised both outcomes.
+
+    CPPUNIT_ASSERT(lMatches > 0);
+    CPPUNIT_ASSERT(lMatches < kMessages);
+}
+
+void
+TestLogFilterPattern :: TestChain(void)
+{
+    const std::vector<std::string> kPatterns = { "health" };
+    Log::Filter::Level             lLevelFilter(2);
+    Log::Filter::Pattern           lPatternFilter(Log::Filter::Pattern::Action::kReject, kPatterns);
+    Log::Filter::Chain             lChainFilter;
+
+    lChainFilter.Push(lLevelFilter);
+    lChainFilter.Push(lPatternFilter);
+
+    CPPUNIT_ASSERT(lChainFilter.NeedsMessage());
+    CPPUNIT_ASSERT(lChainFilter.Allow(2));
+    CPPUNIT_ASSERT(!lChainFilter.Allow(3));
+    CPPUNIT_ASSERT(lChainFilter.AllowMessage(2, "GET /orders\n"));
+    CPPUNIT_ASSERT(!lChainFilter.AllowMessage(2, "GET /health\n"));
+}
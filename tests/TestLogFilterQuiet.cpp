@@ -23,6 +23,7 @@
 #include <LogUtilities/LogFilterQuiet.hpp>
 
 #include <limits.h>
+#include <stdint.h>
 
 #include <cppunit/TestAssert.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -40,6 +41,7 @@ class TestLogFilterQuiet :
     CPPUNIT_TEST(TestObservation);
     CPPUNIT_TEST(TestMutation);
     CPPUNIT_TEST(TestAllow);
+    CPPUNIT_TEST(TestLevelLimit);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -48,6 +50,7 @@ public:
     void TestObservation(void);
     void TestMutation(void);
     void TestAllow(void);
+    void TestLevelLimit(void);
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterQuiet);
@@ -180,3 +183,16 @@ TestLogFilterQuiet :: TestAllow(void)
     lAllow = lQuietFalseFilter.Allow(kLevelMax, kTestMessage);
     CPPUNIT_ASSERT_EQUAL(true, lAllow);
 }
+
+void
+TestLogFilterQuiet :: TestLevelLimit(void)
+{
+    Log::Filter::Quiet lQuietFilter(false);
+
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitAll, lQuietFilter.GetLevelLimit());
+
+    // Test that quieting the filter changes the level limit.
+
+    lQuietFilter.SetQuiet(true);
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitNone, lQuietFilter.GetLevelLimit());
+}
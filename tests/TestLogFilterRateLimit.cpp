@@ -0,0 +1,522 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Filter::RateLimit.
+ */
+
+#include <LogUtilities/LogCallSite.hpp>
+#include <LogUtilities/LogClockBase.hpp>
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterFormatList.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterRateLimit.hpp>
+#include <LogUtilities/LogFilterStaticChain.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+/**
+ *  A clock that only advances when told to.
+ */
+class TestLogClockManual :
+    public Log::Clock::Base
+{
+public:
+    TestLogClockManual(void) :
+        mNow(1000)
+    {
+        return;
+    }
+
+    Log::Clock::Ticks Now(void) const final
+    {
+        return (mNow);
+    }
+
+    void Convert(Log::Clock::Ticks inTicks, struct timespec & outTime) const final
+    {
+        outTime.tv_sec  = inTicks;
+        outTime.tv_nsec = 0;
+    }
+
+    Log::Clock::Ticks mNow;
+};
+
+/**
+ *  A writer that collects the messages written to it.
+ */
+class TestLogWriterCollector :
+    public Log::Writer::Base
+{
+public:
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        (void)inLevel;
+
+        mMessages.push_back(inMessage);
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    std::vector<std::string> mMessages;
+};
+
+static Log::CallSite sConnect("src/net/Socket.cpp",  10, "Connect", "connecting to %s\n");
+static Log::CallSite sRetry("src/net/Socket.cpp",    20, "Connect", "connecting to %s\n");
+static Log::CallSite sClose("src/net/Socket.cpp",    30, "Close",   "closed %d\n");
+
+class TestLogFilterRateLimit :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogFilterRateLimit);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestBurst);
+    CPPUNIT_TEST(TestRefill);
+    CPPUNIT_TEST(TestSummary);
+    CPPUNIT_TEST(TestLevelKey);
+    CPPUNIT_TEST(TestCallSiteKey);
+    CPPUNIT_TEST(TestFormatKey);
+    CPPUNIT_TEST(TestCollisions);
+    CPPUNIT_TEST(TestChain);
+    CPPUNIT_TEST(TestConcurrency);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestConstruction(void);
+    void TestBurst(void);
+    void TestRefill(void);
+    void TestSummary(void);
+    void TestLevelKey(void);
+    void TestCallSiteKey(void);
+    void TestFormatKey(void);
+    void TestCollisions(void);
+    void TestChain(void);
+    void TestConcurrency(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterRateLimit);
+
+void
+TestLogFilterRateLimit :: TestConstruction(void)
+{
+    TestLogWriterCollector  lCollector;
+    Log::Filter::RateLimit  lPerSecondFilter(Log::Filter::RateLimit::Key::kLevel, 10, 5);
+    Log::Filter::RateLimit  lSummaryFilter(Log::Filter::RateLimit::Key::kCallSite, 0, 0, lCollector);
+
+    CPPUNIT_ASSERT(lPerSecondFilter.GetKey() == Log::Filter::RateLimit::Key::kLevel);
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Clock::Ticks>(100000000), lPerSecondFilter.GetInterval());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(5), lPerSecondFilter.GetBurst());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lPerSecondFilter.GetSuppressed());
+    CPPUNIT_ASSERT(!lPerSecondFilter.NeedsMessage());
+
+    // Test that a zero rate and burst are treated as one.
+
+    CPPUNIT_ASSERT(lSummaryFilter.GetKey() == Log::Filter::RateLimit::Key::kCallSite);
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Clock::Ticks>(1000000000), lSummaryFilter.GetInterval());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(1), lSummaryFilter.GetBurst());
+}
+
+void
+TestLogFilterRateLimit :: TestBurst(void)
+{
+    TestLogClockManual     lClock;
+    Log::Filter::RateLimit lFilter(Log::Filter::RateLimit::Key::kLevel, 100, 3, nullptr, lClock);
+
+    // Test that the burst is passed at once and the remainder is
+    // suppressed.
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(lFilter.Allow(1, "message\n"));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(!lFilter.Allow(1, "message\n"));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(2), lFilter.GetSuppressed());
+}
+
+void
+TestLogFilterRateLimit :: TestRefill(void)
+{
+    TestLogClockManual     lClock;
+    Log::Filter::RateLimit lFilter(Log::Filter::RateLimit::Key::kLevel, 100, 2, nullptr, lClock);
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+
+    // Test that part of an interval passes nothing more.
+
+    lClock.mNow += 99;
+
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+
+    // Test that each interval passes one more message.
+
+    lClock.mNow += 1;
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+
+    // Test that an idle key refills to its burst, but no further.
+
+    lClock.mNow += 1000;
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(4), lFilter.GetSuppressed());
+}
+
+void
+TestLogFilterRateLimit :: TestSummary(void)
+{
+    TestLogClockManual     lClock;
+    TestLogWriterCollector lCollector;
+    Log::Filter::RateLimit lFilter(Log::Filter::RateLimit::Key::kLevel, 100, 1, &lCollector, lClock);
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(2, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(2, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(2, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(2, nullptr));
+
+    // Test that nothing is summarized while the key is suppressed.
+
+    CPPUNIT_ASSERT(lCollector.mMessages.empty());
+
+    // Test that the key recovering summarizes what was suppressed,
+    // once.
+
+    lClock.mNow += 100;
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(2, nullptr));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCollector.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("3 messages suppressed at level 2\n"),
+                         lCollector.mMessages[0]);
+
+    lClock.mNow += 100;
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(2, nullptr));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCollector.mMessages.size());
+
+    // Test that messages written through a call site are summarized
+    // by their level when keyed by level.
+
+    {
+        const Log::CallSite::Scope lScope(sConnect);
+
+        CPPUNIT_ASSERT(!lFilter.AllowFormat(2, nullptr));
+
+        lClock.mNow += 100;
+
+        CPPUNIT_ASSERT(lFilter.AllowFormat(2, nullptr));
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lCollector.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("1 messages suppressed at level 2\n"),
+                         lCollector.mMessages[1]);
+}
+
+void
+TestLogFilterRateLimit :: TestLevelKey(void)
+{
+    TestLogClockManual     lClock;
+    Log::Filter::RateLimit lFilter(Log::Filter::RateLimit::Key::kLevel, 100, 1, nullptr, lClock);
+
+    // Test that each level is limited separately.
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(lFilter.AllowFormat(2, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(2, nullptr));
+
+    // Test that call sites do not matter when keyed by level.
+
+    {
+        const Log::CallSite::Scope lScope(sClose);
+
+        CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+        CPPUNIT_ASSERT(lFilter.AllowFormat(3, nullptr));
+    }
+}
+
+void
+TestLogFilterRateLimit :: TestCallSiteKey(void)
+{
+    TestLogClockManual     lClock;
+    TestLogWriterCollector lCollector;
+    Log::Filter::RateLimit lFilter(Log::Filter::RateLimit::Key::kCallSite, 100, 1, &lCollector, lClock);
+
+    CPPUNIT_ASSERT(Log::CallSite::GetCurrent() == nullptr);
+
+    // Test that each call site is limited separately, even those
+    // sharing a format.
+
+    {
+        const Log::CallSite::Scope lScope(sConnect);
+
+        CPPUNIT_ASSERT(Log::CallSite::GetCurrent() == &sConnect);
+        CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+        CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+
+        {
+            const Log::CallSite::Scope lNestedScope(sRetry);
+
+            CPPUNIT_ASSERT(Log::CallSite::GetCurrent() == &sRetry);
+            CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+            CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+        }
+
+        CPPUNIT_ASSERT(Log::CallSite::GetCurrent() == &sConnect);
+        CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+    }
+
+    CPPUNIT_ASSERT(Log::CallSite::GetCurrent() == nullptr);
+
+    // Test that messages written without a call site are keyed by
+    // level instead.
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+
+    // Test that recovering summarizes by call site.
+
+    lClock.mNow += 100;
+
+    {
+        const Log::CallSite::Scope lScope(sConnect);
+
+        CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCollector.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("2 messages suppressed from src/net/Socket.cpp:10\n"),
+                         lCollector.mMessages[0]);
+}
+
+void
+TestLogFilterRateLimit :: TestFormatKey(void)
+{
+    static const char * const kFormat = "sent %zu bytes\n";
+    TestLogClockManual        lClock;
+    TestLogWriterCollector    lCollector;
+    Log::Filter::RateLimit    lFilter(Log::Filter::RateLimit::Key::kFormat, 100, 1, &lCollector, lClock);
+
+    // Test that, keyed by format, the level phase passes everything
+    // and the format phase limits each format.
+
+    CPPUNIT_ASSERT(lFilter.NeedsFormat());
+    CPPUNIT_ASSERT(lFilter.Allow(1));
+    CPPUNIT_ASSERT(lFilter.Allow(1));
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, kFormat));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(1, kFormat));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(2, kFormat));
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, sClose.GetFormat()));
+
+    // Test that recovering summarizes by format.
+
+    lClock.mNow += 100;
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, kFormat));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lCollector.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("2 messages suppressed like \"sent %zu bytes\"\n"),
+                         lCollector.mMessages[0]);
+
+    // Test that, filtered without their format, messages are keyed by
+    // the format of their call site.
+
+    {
+        const Log::CallSite::Scope lScope(sConnect);
+
+        CPPUNIT_ASSERT(lFilter.Allow(1, "connecting to a\n"));
+    }
+
+    if (sConnect.GetFormat() == sRetry.GetFormat()) {
+        const Log::CallSite::Scope lScope(sRetry);
+
+        CPPUNIT_ASSERT(!lFilter.Allow(1, "connecting to b\n"));
+    }
+
+    // Test that other filters, too, pass everything on level and
+    // consume only in the format phase, whatever the format.
+
+    Log::Filter::RateLimit lLevelFilter(Log::Filter::RateLimit::Key::kLevel, 100, 1, nullptr, lClock);
+
+    CPPUNIT_ASSERT(lLevelFilter.NeedsFormat());
+    CPPUNIT_ASSERT(lLevelFilter.NeedsLast());
+    CPPUNIT_ASSERT(lLevelFilter.Allow(1));
+    CPPUNIT_ASSERT(lLevelFilter.Allow(1));
+    CPPUNIT_ASSERT(lLevelFilter.AllowFormat(1, kFormat));
+    CPPUNIT_ASSERT(!lLevelFilter.AllowFormat(1, sClose.GetFormat()));
+}
+
+void
+TestLogFilterRateLimit :: TestCollisions(void)
+{
+    static const size_t                         kCallSites = Log::Filter::RateLimit::kBuckets;
+    TestLogClockManual                          lClock;
+    TestLogWriterCollector                      lCollector;
+    Log::Filter::RateLimit                      lFilter(Log::Filter::RateLimit::Key::kCallSite, 100, 2, &lCollector, lClock);
+    std::vector<std::unique_ptr<Log::CallSite>> lCallSites;
+    char                                        lSummary[64];
+
+    for (size_t lCallSite = 0; lCallSite < kCallSites; lCallSite++) {
+        lCallSites.emplace_back(new Log::CallSite("src/net/Socket.cpp", static_cast<unsigned int>(100 + lCallSite), "Send", "sent %zu bytes\n"));
+    }
+
+    // Test that, with more call sites than fit without their hashes
+    // colliding, each is limited separately and gets its full burst.
+
+    for (size_t lCallSite = 0; lCallSite < kCallSites; lCallSite++) {
+        const Log::CallSite::Scope lScope(*lCallSites[lCallSite]);
+
+        CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+        CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+        CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+    }
+
+    // Test that, once every bucket is claimed, further call sites are
+    // keyed by level instead, as are messages without one.
+
+    {
+        const Log::CallSite::Scope lScope(sClose);
+
+        CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    }
+
+    CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+    CPPUNIT_ASSERT(!lFilter.AllowFormat(1, nullptr));
+
+    // Test that recovering summarizes each call site by itself.
+
+    lClock.mNow += 100;
+
+    for (size_t lCallSite = 0; lCallSite < kCallSites; lCallSite++) {
+        const Log::CallSite::Scope lScope(*lCallSites[lCallSite]);
+
+        CPPUNIT_ASSERT(lFilter.AllowFormat(1, nullptr));
+
+        snprintf(lSummary, sizeof (lSummary), "1 messages suppressed from src/net/Socket.cpp:%zu\n", 100 + lCallSite);
+
+        CPPUNIT_ASSERT_EQUAL(lCallSite + 1, lCollector.mMessages.size());
+        CPPUNIT_ASSERT_EQUAL(std::string(lSummary), lCollector.mMessages[lCallSite]);
+    }
+}
+
+void
+TestLogFilterRateLimit :: TestChain(void)
+{
+    static const char * const kPassed   = "passed\n";
+    static const char * const kRejected = "rejected\n";
+    TestLogClockManual        lClock;
+    Log::Filter::RateLimit    lRateFilter(Log::Filter::RateLimit::Key::kLevel, 100, 1, nullptr, lClock);
+    Log::Filter::Level        lLevelFilter(2);
+    Log::Filter::FormatList   lFormatFilter(Log::Filter::FormatList::Action::kReject,
+                                            Log::Filter::FormatList::Key::kPointer,
+                                            { kRejected });
+    Log::Filter::Chain        lChainFilter;
+
+    // Push the rate limit ahead of the links that may reject what it
+    // would otherwise have consumed for.
+
+    lChainFilter.Push(lRateFilter);
+    lChainFilter.Push(lLevelFilter);
+    lChainFilter.Push(lFormatFilter);
+
+    CPPUNIT_ASSERT(lChainFilter.NeedsLast());
+    CPPUNIT_ASSERT(!lChainFilter.NeedsMessage());
+
+    // Test that messages the level or format links reject do not
+    // consume from the bucket.
+
+    CPPUNIT_ASSERT(!lChainFilter.Allow(3));
+    CPPUNIT_ASSERT(!lChainFilter.Allow(3));
+    CPPUNIT_ASSERT(lChainFilter.Allow(1));
+    CPPUNIT_ASSERT(!lChainFilter.AllowFormat(1, kRejected));
+    CPPUNIT_ASSERT(!lChainFilter.AllowFormat(1, kRejected));
+    CPPUNIT_ASSERT(lChainFilter.AllowFormat(1, kPassed));
+
+    // Test that the copy in the chain shares its buckets and counters
+    // with the original.
+
+    CPPUNIT_ASSERT(!lRateFilter.AllowFormat(1, kPassed));
+    CPPUNIT_ASSERT(!lChainFilter.AllowFormat(1, kPassed));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(2), lRateFilter.GetSuppressed());
+
+    // Test that a static chain, likewise, consults the rate limit
+    // last, wherever it is.
+
+    Log::Filter::RateLimit lStaticRateFilter(Log::Filter::RateLimit::Key::kLevel, 100, 1, nullptr, lClock);
+    Log::Filter::StaticChain<Log::Filter::RateLimit, Log::Filter::FormatList> lStaticFilter(lStaticRateFilter, lFormatFilter);
+
+    CPPUNIT_ASSERT(lStaticFilter.NeedsLast());
+    CPPUNIT_ASSERT(lStaticFilter.Allow(1));
+    CPPUNIT_ASSERT(!lStaticFilter.AllowFormat(1, kRejected));
+    CPPUNIT_ASSERT(lStaticFilter.AllowFormat(1, kPassed));
+    CPPUNIT_ASSERT(!lStaticFilter.AllowFormat(1, kPassed));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(1), lStaticRateFilter.GetSuppressed());
+}
+
+void
+TestLogFilterRateLimit :: TestConcurrency(void)
+{
+    static const unsigned    kThreads  = 4;
+    static const unsigned    kMessages = 1000;
+    static const uint32_t    kBurst    = 100;
+    TestLogClockManual       lClock;
+    Log::Filter::RateLimit   lFilter(Log::Filter::RateLimit::Key::kLevel, 1, kBurst, nullptr, lClock);
+    std::vector<std::thread> lThreads;
+    std::vector<unsigned>    lPassed(kThreads, 0);
+
+    // Test that, with the clock stopped, exactly the burst is passed
+    // across all threads.
+
+    for (unsigned lThread = 0; lThread < kThreads; lThread++) {
+        lThreads.push_back(std::thread([&, lThread](void) {
+            for (unsigned lMessage = 0; lMessage < kMessages; lMessage++) {
+                if (lFilter.AllowFormat(1, nullptr)) {
+                    lPassed[lThread]++;
+                }
+            }
+        }));
+    }
+
+    for (std::thread & lThread : lThreads) {
+        lThread.join();
+    }
+
+    CPPUNIT_ASSERT_EQUAL(kBurst, lPassed[0] + lPassed[1] + lPassed[2] + lPassed[3]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>((kThreads * kMessages) - kBurst),
+                         lFilter.GetSuppressed());
+}
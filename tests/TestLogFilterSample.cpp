@@ -0,0 +1,246 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Filter::Sample.
+ */
+
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterSample.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <stdint.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+class TestLogFilterSample :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogFilterSample);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestRandom);
+    CPPUNIT_TEST(TestCount);
+    CPPUNIT_TEST(TestRequest);
+    CPPUNIT_TEST(TestLevel);
+    CPPUNIT_TEST(TestChain);
+    CPPUNIT_TEST(TestConcurrency);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestConstruction(void);
+    void TestRandom(void);
+    void TestCount(void);
+    void TestRequest(void);
+    void TestLevel(void);
+    void TestChain(void);
+    void TestConcurrency(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterSample);
+
+void
+TestLogFilterSample :: TestConstruction(void)
+{
+    Log::Filter::Sample lRandomFilter(Log::Filter::Sample::Mode::kRandom, 10);
+    Log::Filter::Sample lCountFilter(Log::Filter::Sample::Mode::kCount, 0, 3);
+    Log::Filter::Sample lCopyFilter(lCountFilter);
+
+    CPPUNIT_ASSERT(lRandomFilter.GetMode() == Log::Filter::Sample::Mode::kRandom);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(10), lRandomFilter.GetPeriod());
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(0), lRandomFilter.GetLevel());
+    CPPUNIT_ASSERT(!lRandomFilter.NeedsMessage());
+
+    // Test that a zero period is treated as one.
+
+    CPPUNIT_ASSERT(lCountFilter.GetMode() == Log::Filter::Sample::Mode::kCount);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(1), lCountFilter.GetPeriod());
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(3), lCountFilter.GetLevel());
+
+    CPPUNIT_ASSERT(lCopyFilter.GetMode() == Log::Filter::Sample::Mode::kCount);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(1), lCopyFilter.GetPeriod());
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(3), lCopyFilter.GetLevel());
+
+    lCopyFilter = lRandomFilter;
+
+    CPPUNIT_ASSERT(lCopyFilter.GetMode() == Log::Filter::Sample::Mode::kRandom);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint32_t>(10), lCopyFilter.GetPeriod());
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(0), lCopyFilter.GetLevel());
+}
+
+void
+TestLogFilterSample :: TestRandom(void)
+{
+    static const unsigned kMessages = 100000;
+    Log::Filter::Sample   lAllFilter(Log::Filter::Sample::Mode::kRandom, 1);
+    Log::Filter::Sample   lQuarterFilter(Log::Filter::Sample::Mode::kRandom, 4);
+    unsigned              lPassed = 0;
+
+    for (unsigned lMessage = 0; lMessage < kMessages; lMessage++) {
+        CPPUNIT_ASSERT(lAllFilter.Allow(1));
+
+        if (lQuarterFilter.Allow(1, "message\n")) {
+            lPassed++;
+        }
+    }
+
+    // Test that about a quarter is passed.
+
+    CPPUNIT_ASSERT(lPassed > (kMessages / 4) - (kMessages / 50));
+    CPPUNIT_ASSERT(lPassed < (kMessages / 4) + (kMessages / 50));
+}
+
+void
+TestLogFilterSample :: TestCount(void)
+{
+    Log::Filter::Sample lFilter(Log::Filter::Sample::Mode::kCount, 3);
+
+    // Test that exactly every third message is passed, starting with
+    // the first.
+
+    for (unsigned lMessage = 0; lMessage < 30; lMessage++) {
+        CPPUNIT_ASSERT_EQUAL((lMessage % 3) == 0, lFilter.Allow(1));
+    }
+}
+
+void
+TestLogFilterSample :: TestRequest(void)
+{
+    static const unsigned kRequests = 10000;
+    Log::Filter::Sample   lFilter(Log::Filter::Sample::Mode::kRequest, 10);
+    unsigned              lPassed = 0;
+    bool                  lAllow;
+
+    // Test that messages outside of any request are passed.
+
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Sample::kRequestNone, Log::Filter::Sample::GetRequest());
+    CPPUNIT_ASSERT(lFilter.Allow(1));
+
+    // Test that the messages for a request are kept or discarded
+    // together and that about a tenth of the requests are kept.
+
+    for (uint64_t lRequest = 1; lRequest <= kRequests; lRequest++) {
+        const Log::Filter::Sample::Scope lScope(lRequest);
+
+        CPPUNIT_ASSERT_EQUAL(lRequest, Log::Filter::Sample::GetRequest());
+
+        lAllow = lFilter.Allow(1);
+
+        CPPUNIT_ASSERT_EQUAL(lAllow, lFilter.Allow(2));
+        CPPUNIT_ASSERT_EQUAL(lAllow, lFilter.Allow(1, "message\n"));
+
+        if (lAllow) {
+            lPassed++;
+        }
+    }
+
+    CPPUNIT_ASSERT(lPassed > (kRequests / 10) - (kRequests / 50));
+    CPPUNIT_ASSERT(lPassed < (kRequests / 10) + (kRequests / 50));
+
+    // Test that scopes nest.
+
+    {
+        const Log::Filter::Sample::Scope lOuterScope(1);
+
+        {
+            const Log::Filter::Sample::Scope lInnerScope(2);
+
+            CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(2), Log::Filter::Sample::GetRequest());
+        }
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(1), Log::Filter::Sample::GetRequest());
+    }
+
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Sample::kRequestNone, Log::Filter::Sample::GetRequest());
+}
+
+void
+TestLogFilterSample :: TestLevel(void)
+{
+    Log::Filter::Sample lFilter(Log::Filter::Sample::Mode::kCount, 1000, 3);
+
+    // Test that messages below the sampled level are always passed.
+
+    for (unsigned lMessage = 0; lMessage < 10; lMessage++) {
+        CPPUNIT_ASSERT(lFilter.Allow(0));
+        CPPUNIT_ASSERT(lFilter.Allow(2));
+    }
+
+    // Test that those at or above it are sampled.
+
+    CPPUNIT_ASSERT(lFilter.Allow(3));
+    CPPUNIT_ASSERT(!lFilter.Allow(3));
+    CPPUNIT_ASSERT(!lFilter.Allow(4));
+}
+
+void
+TestLogFilterSample :: TestChain(void)
+{
+    Log::Filter::Level  lLevelFilter(5);
+    Log::Filter::Sample lSampleFilter(Log::Filter::Sample::Mode::kCount, 2, 5);
+    Log::Filter::Chain  lChainFilter;
+
+    lChainFilter.Push(lLevelFilter);
+    lChainFilter.Push(lSampleFilter);
+
+    CPPUNIT_ASSERT(!lChainFilter.NeedsMessage());
+
+    CPPUNIT_ASSERT(lChainFilter.Allow(4));
+    CPPUNIT_ASSERT(lChainFilter.Allow(4));
+    CPPUNIT_ASSERT(lChainFilter.Allow(5));
+    CPPUNIT_ASSERT(!lChainFilter.Allow(5));
+    CPPUNIT_ASSERT(lChainFilter.Allow(5));
+    CPPUNIT_ASSERT(!lChainFilter.Allow(6));
+}
+
+void
+TestLogFilterSample :: TestConcurrency(void)
+{
+    static const unsigned    kThreads  = 4;
+    static const unsigned    kMessages = 1000;
+    Log::Filter::Sample      lFilter(Log::Filter::Sample::Mode::kCount, 10);
+    std::vector<std::thread> lThreads;
+    std::vector<unsigned>    lPassed(kThreads, 0);
+
+    // Test that counting passes exactly one in every period across
+    // all threads.
+
+    for (unsigned lThread = 0; lThread < kThreads; lThread++) {
+        lThreads.push_back(std::thread([&, lThread](void) {
+            for (unsigned lMessage = 0; lMessage < kMessages; lMessage++) {
+                if (lFilter.Allow(1)) {
+                    lPassed[lThread]++;
+                }
+            }
+        }));
+    }
+
+    for (std::thread & lThread : lThreads) {
+        lThread.join();
+    }
+
+    CPPUNIT_ASSERT_EQUAL((kThreads * kMessages) / 10,
+                         lPassed[0] + lPassed[1] + lPassed[2] + lPassed[3]);
+}
@@ -0,0 +1,252 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Filter::StaticChain.
+ */
+
+#include <LogUtilities/LogFilterAlways.hpp>
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterNever.hpp>
+#include <LogUtilities/LogFilterQuiet.hpp>
+#include <LogUtilities/LogFilterStaticChain.hpp>
+
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+typedef Log::Filter::StaticChain<Log::Filter::Always,
+                                 Log::Filter::Quiet,
+                                 Log::Filter::Level> AlwaysFilterChain;
+
+typedef Log::Filter::StaticChain<Log::Filter::Never,
+                                 Log::Filter::Quiet,
+                                 Log::Filter::Level> NeverFilterChain;
+
+/**
+ *  A filter that rejects messages containing the word "secret".
+ */
+class TestLogFilterSecret :
+    public Log::Filter::Base
+{
+public:
+    bool Allow(Log::Level inLevel) final
+    {
+        (void)inLevel;
+
+        return (true);
+    }
+
+    bool Allow(Log::Level inLevel, const char * inMessage) final
+    {
+        return (AllowMessage(inLevel, inMessage));
+    }
+
+    bool AllowMessage(Log::Level inLevel, const char * inMessage) final
+    {
+        (void)inLevel;
+
+        return (strstr(inMessage, "secret") == NULL);
+    }
+};
+
+typedef Log::Filter::StaticChain<Log::Filter::Level,
+                                 TestLogFilterSecret> SecretFilterChain;
+
+class TestLogFilterStaticChain :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogFilterStaticChain);
+    CPPUNIT_TEST(TestDefaultConstruction);
+    CPPUNIT_TEST(TestCopyConstruction);
+    CPPUNIT_TEST(TestObservation);
+    CPPUNIT_TEST(TestAlwaysChain);
+    CPPUNIT_TEST(TestNeverChain);
+    CPPUNIT_TEST(TestLevelLimit);
+    CPPUNIT_TEST(TestRuntimeChain);
+    CPPUNIT_TEST(TestPhases);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestDefaultConstruction(void);
+    void TestCopyConstruction(void);
+    void TestObservation(void);
+    void TestAlwaysChain(void);
+    void TestNeverChain(void);
+    void TestLevelLimit(void);
+    void TestRuntimeChain(void);
+    void TestPhases(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFilterStaticChain);
+
+void
+TestLogFilterStaticChain :: TestDefaultConstruction(void)
+{
+    AlwaysFilterChain lFilterChain;
+}
+
+void
+TestLogFilterStaticChain :: TestCopyConstruction(void)
+{
+    AlwaysFilterChain lFilterChainA(Log::Filter::Always(),
+                                  Log::Filter::Quiet(true),
+                                  Log::Filter::Level(3));
+    AlwaysFilterChain lFilterChainB(lFilterChainA);
+
+    CPPUNIT_ASSERT(lFilterChainB.Link<1>().GetQuiet() == true);
+    CPPUNIT_ASSERT(lFilterChainB.Link<2>().GetLevel() == 3);
+}
+
+void
+TestLogFilterStaticChain :: TestObservation(void)
+{
+    AlwaysFilterChain         lFilterChain;
+    const AlwaysFilterChain & lConstFilterChain = lFilterChain;
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), AlwaysFilterChain::Size());
+
+    CPPUNIT_ASSERT(&lConstFilterChain.Link<0>() == &lFilterChain.Link<0>());
+    CPPUNIT_ASSERT(&lConstFilterChain.Link<1>() == &lFilterChain.Link<1>());
+    CPPUNIT_ASSERT(&lConstFilterChain.Link<2>() == &lFilterChain.Link<2>());
+}
+
+void
+TestLogFilterStaticChain :: TestAlwaysChain(void)
+{
+    AlwaysFilterChain lChainFilter;
+
+    // Test filter with links at their default settings
+
+    CPPUNIT_ASSERT(lChainFilter.Allow(0) == true);
+    CPPUNIT_ASSERT(lChainFilter.Allow(0, "At level 0, with quiet false and level 0, the chain will allow.\n") == true);
+    CPPUNIT_ASSERT(lChainFilter.Allow(1) == false);
+    CPPUNIT_ASSERT(lChainFilter.Allow(1, "At level 1, with quiet false and level 0, the chain will not allow.\n") == false);
+
+    // Increase the level to UINT_MAX and retest.
+
+    lChainFilter.Link<2>().SetLevel(UINT_MAX);
+
+    CPPUNIT_ASSERT(lChainFilter.Allow(1) == true);
+    CPPUNIT_ASSERT(lChainFilter.Allow(1, "At level 1, with quiet false and level UINT_MAX, the chain will allow.\n") == true);
+    CPPUNIT_ASSERT(lChainFilter.Allow(UINT_MAX) == true);
+    CPPUNIT_ASSERT(lChainFilter.Allow(UINT_MAX, "At level UINT_MAX, with quiet false and level UINT_MAX, the chain will allow.\n") == true);
+
+    // Set quiet to true and retest
+
+    lChainFilter.Link<1>().SetQuiet(true);
+
+    CPPUNIT_ASSERT(lChainFilter.Allow(0) == false);
+    CPPUNIT_ASSERT(lChainFilter.Allow(0, "At level 0, with quiet true, the chain will not allow.\n") == false);
+    CPPUNIT_ASSERT(lChainFilter.Allow(UINT_MAX) == false);
+    CPPUNIT_ASSERT(lChainFilter.Allow(UINT_MAX, "At level UINT_MAX, with quiet true, the chain will not allow.\n") == false);
+}
+
+void
+TestLogFilterStaticChain :: TestNeverChain(void)
+{
+    NeverFilterChain lChainFilter;
+
+    lChainFilter.Link<2>().SetLevel(UINT_MAX);
+
+    CPPUNIT_ASSERT(lChainFilter.Allow(0) == false);
+    CPPUNIT_ASSERT(lChainFilter.Allow(0, "At level 0, having a never filter in the chain will never allow.\n") == false);
+    CPPUNIT_ASSERT(lChainFilter.Allow(UINT_MAX) == false);
+    CPPUNIT_ASSERT(lChainFilter.Allow(UINT_MAX, "At level UINT_MAX, having a never filter in the chain will never allow.\n") == false);
+}
+
+void
+TestLogFilterStaticChain :: TestLevelLimit(void)
+{
+    AlwaysFilterChain lAlwaysChain;
+    NeverFilterChain  lNeverChain;
+
+    // The level limit is the lowest of those of the links.
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(1), lAlwaysChain.GetLevelLimit());
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitNone, lNeverChain.GetLevelLimit());
+
+    lAlwaysChain.Link<2>().SetLevel(UINT_MAX);
+
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitAll, lAlwaysChain.GetLevelLimit());
+
+    lAlwaysChain.Link<1>().SetQuiet(true);
+
+    CPPUNIT_ASSERT_EQUAL(Log::Filter::Base::kLevelLimitNone, lAlwaysChain.GetLevelLimit());
+}
+
+void
+TestLogFilterStaticChain :: TestRuntimeChain(void)
+{
+    AlwaysFilterChain   lStaticChain;
+    Log::Filter::Chain  lRuntimeChain;
+    Log::Filter::Base & lFilter = lStaticChain;
+
+    // Through its virtual interface, the chain is just another filter.
+
+    lStaticChain.Link<2>().SetLevel(1);
+
+    CPPUNIT_ASSERT(lFilter.Allow(1) == true);
+    CPPUNIT_ASSERT(lFilter.Allow(2) == false);
+
+    lRuntimeChain.Push(lStaticChain);
+
+    CPPUNIT_ASSERT(lRuntimeChain.Allow(1) == true);
+    CPPUNIT_ASSERT(lRuntimeChain.Allow(1, "At level 1, the runtime chain will allow.\n") == true);
+    CPPUNIT_ASSERT(lRuntimeChain.Allow(2) == false);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(2), lRuntimeChain.GetLevelLimit());
+}
+
+void
+TestLogFilterStaticChain :: TestPhases(void)
+{
+    AlwaysFilterChain  lAlwaysChain;
+    SecretFilterChain  lSecretChain;
+    Log::Filter::Chain lRuntimeChain;
+
+    // Test that a chain of content-free links does not need message
+    // content, while one with any link that does, does.
+
+    CPPUNIT_ASSERT(!lAlwaysChain.NeedsMessage());
+    CPPUNIT_ASSERT(lSecretChain.NeedsMessage());
+
+    // Test that the post-format phase consults only those links that
+    // need message content.
+
+    CPPUNIT_ASSERT(lSecretChain.AllowMessage(UINT_MAX, "At level UINT_MAX, a public message passes after level filtering.\n") == true);
+    CPPUNIT_ASSERT(lSecretChain.AllowMessage(0, "At level 0, a secret message will not pass.\n") == false);
+    CPPUNIT_ASSERT(lSecretChain.Allow(UINT_MAX, "At level UINT_MAX, a public message will not pass both phases.\n") == false);
+
+    // Test that a runtime chain splits a static chain by whether it,
+    // as a whole, needs message content.
+
+    lRuntimeChain.Push(lAlwaysChain);
+    CPPUNIT_ASSERT(!lRuntimeChain.NeedsMessage());
+
+    lRuntimeChain.Push(lSecretChain);
+    CPPUNIT_ASSERT(lRuntimeChain.NeedsMessage());
+    CPPUNIT_ASSERT(lRuntimeChain.AllowMessage(0, "At level 0, a secret message will not pass.\n") == false);
+}
@@ -0,0 +1,283 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::FormatString.
+ */
+
+#include <LogUtilities/LogFormatString.hpp>
+
+#include <string>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <wchar.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+using namespace Nuovations::Log::FormatString;
+
+
+// Test that the parsing is done entirely at compile time.
+
+static_assert(IsLiteral("No directives at all"), "literal not detected");
+static_assert(!IsLiteral("100%%"), "escaped percent taken for literal");
+static_assert(Matches("%d", decltype(TypesOf(1))()), "simple match rejected");
+static_assert(!Matches("%s", decltype(TypesOf(1))()), "mismatch accepted");
+static_assert(Classify('l', 'l', 'd') == Kind::kLongLong, "classification not constant");
+
+class TestLogFormatString :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogFormatString);
+    CPPUNIT_TEST(TestLiteral);
+    CPPUNIT_TEST(TestSlots);
+    CPPUNIT_TEST(TestCount);
+    CPPUNIT_TEST(TestKinds);
+    CPPUNIT_TEST(TestPositional);
+    CPPUNIT_TEST(TestClassify);
+    CPPUNIT_TEST(TestParse);
+    CPPUNIT_TEST(TestAppend);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestLiteral(void);
+    void TestSlots(void);
+    void TestCount(void);
+    void TestKinds(void);
+    void TestPositional(void);
+    void TestClassify(void);
+    void TestParse(void);
+    void TestAppend(void);
+
+private:
+    static std::string Slots(const char * inFormat);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFormatString);
+
+// Return the characters of each of the argument slots in the format
+// string, in order.
+
+std::string
+TestLogFormatString :: Slots(const char * inFormat)
+{
+    std::string  lSlots;
+    const char * lSlot;
+
+    for (lSlot = FindSlot(inFormat); *lSlot != '\0'; lSlot = NextSlot(lSlot)) {
+        lSlots.push_back(*lSlot);
+    }
+
+    return (lSlots);
+}
+
+void
+TestLogFormatString :: TestLiteral(void)
+{
+    std::string lLong(4096, 'x');
+
+    CPPUNIT_ASSERT(IsLiteral(""));
+    CPPUNIT_ASSERT(IsLiteral("No directives at all\n"));
+    CPPUNIT_ASSERT(IsLiteral(lLong.c_str()));
+
+    CPPUNIT_ASSERT(!IsLiteral("%d"));
+    CPPUNIT_ASSERT(!IsLiteral("%%"));
+    CPPUNIT_ASSERT(!IsLiteral("%m"));
+    CPPUNIT_ASSERT(!IsLiteral("trailing %"));
+
+    lLong += "%d";
+
+    CPPUNIT_ASSERT(!IsLiteral(lLong.c_str()));
+}
+
+void
+TestLogFormatString :: TestSlots(void)
+{
+    CPPUNIT_ASSERT_EQUAL(std::string(""),      Slots("No directives"));
+    CPPUNIT_ASSERT_EQUAL(std::string(""),      Slots("%% %m %%"));
+    CPPUNIT_ASSERT_EQUAL(std::string("dsx"),   Slots("%d %s %x"));
+    CPPUNIT_ASSERT_EQUAL(std::string("d"),     Slots("%-+ #0'8.3lld"));
+    CPPUNIT_ASSERT_EQUAL(std::string("*d"),    Slots("%*d"));
+    CPPUNIT_ASSERT_EQUAL(std::string("*s"),    Slots("%.*s"));
+    CPPUNIT_ASSERT_EQUAL(std::string("**f"),   Slots("%-*.*f"));
+    CPPUNIT_ASSERT_EQUAL(std::string("*p*u"),  Slots("[%*p] [%.*u]"));
+    CPPUNIT_ASSERT_EQUAL(std::string("sc"),    Slots("%ls%lc%%"));
+}
+
+void
+TestLogFormatString :: TestCount(void)
+{
+    CPPUNIT_ASSERT(Matches("No directives", TypeList<>()));
+    CPPUNIT_ASSERT(!Matches("No directives", TypeList<int>()));
+
+    CPPUNIT_ASSERT(Matches("%d %d", TypeList<int, int>()));
+    CPPUNIT_ASSERT(!Matches("%d %d", TypeList<int>()));
+    CPPUNIT_ASSERT(!Matches("%d %d", TypeList<int, int, int>()));
+
+    CPPUNIT_ASSERT(Matches("[%*.*f]", TypeList<int, int, double>()));
+    CPPUNIT_ASSERT(!Matches("[%*.*f]", TypeList<int, double>()));
+
+    CPPUNIT_ASSERT(Matches("%m %% %d", TypeList<int>()));
+}
+
+void
+TestLogFormatString :: TestKinds(void)
+{
+    enum Color { kRed };
+    int            lObject;
+    const char     lString[] = "string";
+    char           lMutable[] = "mutable";
+    const wchar_t  lWide[] = L"wide";
+
+    // Integers, including characters, booleans, and enumerations.
+
+    CPPUNIT_ASSERT(Matches("%d %u %x %c %d %d", decltype(TypesOf(1, 2U, 3L, 'c', true, kRed))()));
+    CPPUNIT_ASSERT(Matches("%lld %zu %jd", decltype(TypesOf(1LL, sizeof (int), INTMAX_MAX))()));
+    CPPUNIT_ASSERT(!Matches("%d", decltype(TypesOf(1.5))()));
+    CPPUNIT_ASSERT(!Matches("%d", decltype(TypesOf("string"))()));
+    CPPUNIT_ASSERT(!Matches("%*d", decltype(TypesOf(1.5, 1))()));
+
+    // Floating point.
+
+    CPPUNIT_ASSERT(Matches("%f %e %g %a %Lf", decltype(TypesOf(1.5f, 1.5, 1.5, 1.5, 1.5L))()));
+    CPPUNIT_ASSERT(!Matches("%f", decltype(TypesOf(1))()));
+
+    // Strings.
+
+    CPPUNIT_ASSERT(Matches("%s %s %s %s", decltype(TypesOf("literal", lString, &lMutable[0], nullptr))()));
+    CPPUNIT_ASSERT(Matches("%ls %S", decltype(TypesOf(lWide, L"literal"))()));
+    CPPUNIT_ASSERT(!Matches("%s", decltype(TypesOf(lWide))()));
+    CPPUNIT_ASSERT(!Matches("%ls", decltype(TypesOf(lString))()));
+    CPPUNIT_ASSERT(!Matches("%s", decltype(TypesOf(&lObject))()));
+    CPPUNIT_ASSERT(!Matches("%s", decltype(TypesOf(std::string("string")))()));
+
+    // Pointers.
+
+    CPPUNIT_ASSERT(Matches("%p %p %p %n", decltype(TypesOf(&lObject, lString, nullptr, &lObject))()));
+    CPPUNIT_ASSERT(!Matches("%p", decltype(TypesOf(1))()));
+
+    // Unknown conversions.
+
+    CPPUNIT_ASSERT(!Matches("%y", decltype(TypesOf(1))()));
+}
+
+void
+TestLogFormatString :: TestPositional(void)
+{
+    CPPUNIT_ASSERT(IsPositional("%1$d"));
+    CPPUNIT_ASSERT(IsPositional("%% %2$s %1$d"));
+    CPPUNIT_ASSERT(!IsPositional("%d %s"));
+    CPPUNIT_ASSERT(!IsPositional("%10d $"));
+
+    // Test that positional arguments are left to be checked at run
+    // time.
+
+    CPPUNIT_ASSERT(Matches("%2$s %1$d", decltype(TypesOf(1, "two"))()));
+}
+
+void
+TestLogFormatString :: TestClassify(void)
+{
+    // Integers, by length modifier.
+
+    CPPUNIT_ASSERT(Classify('\0', '\0', 'd') == Kind::kInt);
+    CPPUNIT_ASSERT(Classify('h',  'h',  'u') == Kind::kInt);
+    CPPUNIT_ASSERT(Classify('l',  '\0', 'x') == Kind::kLong);
+    CPPUNIT_ASSERT(Classify('l',  'l',  'o') == Kind::kLongLong);
+    CPPUNIT_ASSERT(Classify('q',  '\0', 'd') == Kind::kLongLong);
+    CPPUNIT_ASSERT(Classify('j',  '\0', 'i') == Kind::kIntMax);
+    CPPUNIT_ASSERT(Classify('z',  '\0', 'u') == Kind::kSize);
+    CPPUNIT_ASSERT(Classify('t',  '\0', 'd') == Kind::kPtrDiff);
+
+    // Everything else.
+
+    CPPUNIT_ASSERT(Classify('\0', '\0', 'g') == Kind::kDouble);
+    CPPUNIT_ASSERT(Classify('L',  '\0', 'f') == Kind::kLongDouble);
+    CPPUNIT_ASSERT(Classify('\0', '\0', 'c') == Kind::kInt);
+    CPPUNIT_ASSERT(Classify('l',  '\0', 'c') == Kind::kWideInt);
+    CPPUNIT_ASSERT(Classify('\0', '\0', 's') == Kind::kString);
+    CPPUNIT_ASSERT(Classify('l',  '\0', 's') == Kind::kWideString);
+    CPPUNIT_ASSERT(Classify('\0', '\0', 'S') == Kind::kWideString);
+    CPPUNIT_ASSERT(Classify('\0', '\0', 'p') == Kind::kPointer);
+    CPPUNIT_ASSERT(Classify('\0', '\0', 'n') == Kind::kCount);
+    CPPUNIT_ASSERT(Classify('\0', '\0', 'm') == Kind::kError);
+    CPPUNIT_ASSERT(Classify('\0', '\0', 'y') == Kind::kInvalid);
+}
+
+void
+TestLogFormatString :: TestParse(void)
+{
+    Directive lDirective;
+
+    CPPUNIT_ASSERT(Parse("%% and more", lDirective));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lDirective.mSize);
+    CPPUNIT_ASSERT(lDirective.mKind == Kind::kPercent);
+
+    CPPUNIT_ASSERT(Parse("%-+ #0'8.3lld!", lDirective));
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(13), lDirective.mSize);
+    CPPUNIT_ASSERT(lDirective.mLeft && lDirective.mSign && lDirective.mSpace);
+    CPPUNIT_ASSERT(lDirective.mAlternate && lDirective.mZero && lDirective.mGrouping);
+    CPPUNIT_ASSERT_EQUAL(8, lDirective.mWidth);
+    CPPUNIT_ASSERT_EQUAL(3, lDirective.mPrecision);
+    CPPUNIT_ASSERT_EQUAL(std::string("ll"), std::string(lDirective.mLength));
+    CPPUNIT_ASSERT_EQUAL('d', lDirective.mConversion);
+    CPPUNIT_ASSERT(lDirective.mKind == Kind::kLongLong);
+    CPPUNIT_ASSERT_EQUAL(-1, lDirective.mPosition);
+
+    CPPUNIT_ASSERT(Parse("%*.*s", lDirective));
+    CPPUNIT_ASSERT(lDirective.mWidthStar && lDirective.mPrecisionStar);
+    CPPUNIT_ASSERT_EQUAL(-1, lDirective.mWidth);
+    CPPUNIT_ASSERT_EQUAL(-1, lDirective.mPrecision);
+    CPPUNIT_ASSERT(lDirective.mKind == Kind::kString);
+
+    // Positional arguments, for the conversion and for its stars.
+
+    CPPUNIT_ASSERT(Parse("%3$*1$.*2$f", lDirective));
+    CPPUNIT_ASSERT_EQUAL(2, lDirective.mPosition);
+    CPPUNIT_ASSERT_EQUAL(0, lDirective.mWidthPosition);
+    CPPUNIT_ASSERT_EQUAL(1, lDirective.mPrecisionPosition);
+    CPPUNIT_ASSERT(lDirective.mKind == Kind::kDouble);
+
+    // Unknown conversions parse, but unterminated directives do not.
+
+    CPPUNIT_ASSERT(Parse("%5y", lDirective));
+    CPPUNIT_ASSERT(lDirective.mKind == Kind::kInvalid);
+
+    CPPUNIT_ASSERT(!Parse("%", lDirective));
+    CPPUNIT_ASSERT(!Parse("%-08.", lDirective));
+}
+
+void
+TestLogFormatString :: TestAppend(void)
+{
+    std::string lMessage("prefix: ");
+
+    Append(lMessage, "%d %s", 42, "answer");
+    CPPUNIT_ASSERT_EQUAL(std::string("prefix: 42 answer"), lMessage);
+
+    // Test that output beyond the existing capacity is grown into.
+
+    Append(lMessage, " %s", std::string(1024, 'x').c_str());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(17 + 1 + 1024), lMessage.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("prefix: 42 answer x"), lMessage.substr(0, 19));
+}
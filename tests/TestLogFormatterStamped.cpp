@@ -20,9 +20,20 @@
  *      This file implements a unit test for Log::Formatter::Stamped.
  */
 
+#include <LogUtilities/LogArguments.hpp>
+#include <LogUtilities/LogClockBase.hpp>
 #include <LogUtilities/LogFormatterStamped.hpp>
 
+#include <string>
+
 #include <limits.h>
+#include <string.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <sys/types.h>
+#include <sys/wait.h>
 
 #include <cppunit/TestAssert.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -38,12 +49,20 @@ class TestLogFormatterStamped :
     CPPUNIT_TEST(TestDefaultConstruction);
     CPPUNIT_TEST(TestFormatWithLevel);
     CPPUNIT_TEST(TestFormatWithDefaultLevel);
+    CPPUNIT_TEST(TestStampCache);
+    CPPUNIT_TEST(TestFork);
+    CPPUNIT_TEST(TestResolution);
+    CPPUNIT_TEST(TestClock);
     CPPUNIT_TEST_SUITE_END();
 
 public:
     void TestDefaultConstruction(void);
     void TestFormatWithLevel(void);
     void TestFormatWithDefaultLevel(void);
+    void TestStampCache(void);
+    void TestFork(void);
+    void TestResolution(void);
+    void TestClock(void);
 
 private:
     void TestFormatWithLevel(const std::string &       inExpected,
@@ -57,8 +76,39 @@ private:
                                     ...);
 
     void CheckResults(const std::string & inExpected, const std::string & inActual);
+
+    static std::string Stamp(Log::Formatter::Stamped & inFormatter,
+                             Log::Level                inLevel,
+                             time_t                    inTime,
+                             pid_t                     inProcess,
+                             long                      inNanoseconds = 0);
 };
 
+namespace
+{
+
+// A clock that always reads the same, known time.
+
+class FixedClock :
+    public Log::Clock::Base
+{
+public:
+    FixedClock(Log::Clock::Ticks inTicks) : mTicks(inTicks) { return; }
+
+    virtual Log::Clock::Ticks Now(void) const { return (mTicks); }
+
+    virtual void Convert(Log::Clock::Ticks inTicks, struct timespec & outTime) const
+    {
+        outTime.tv_sec  = static_cast<time_t>(inTicks / 1000000000);
+        outTime.tv_nsec = static_cast<long>(inTicks % 1000000000);
+    }
+
+private:
+    const Log::Clock::Ticks mTicks;
+};
+
+}; // namespace
+
 CPPUNIT_TEST_SUITE_REGISTRATION(TestLogFormatterStamped);
 
 void
@@ -239,6 +289,146 @@ TestLogFormatterStamped :: TestFormatWithDefaultLevel(void)
                                1776);
 }
 
+void
+TestLogFormatterStamped :: TestStampCache(void)
+{
+    Log::Formatter::Stamped lStampedFormatter;
+    const time_t            lTime = 1000000000;
+    std::string             lFirst;
+    std::string             lSecond;
+
+    // Test that stamps for alternating times, processes, and levels
+    // each reflect their own, rather than a stale cached, stamp.
+
+    lFirst  = Stamp(lStampedFormatter, 1, lTime, 100);
+    lSecond = Stamp(lStampedFormatter, 4294967295U, lTime + 86400, 200);
+
+    CPPUNIT_ASSERT(lFirst != lSecond);
+    CPPUNIT_ASSERT(lFirst.find("[100:") != std::string::npos);
+    CPPUNIT_ASSERT(lSecond.find("[200:") != std::string::npos);
+    CPPUNIT_ASSERT_EQUAL(lFirst.size() - lFirst.find("] (1) "), strlen("] (1) "));
+    CPPUNIT_ASSERT_EQUAL(lSecond.size() - lSecond.find("] (4294967295) "), strlen("] (4294967295) "));
+
+    CPPUNIT_ASSERT_EQUAL(lFirst, Stamp(lStampedFormatter, 1, lTime, 100));
+    CPPUNIT_ASSERT_EQUAL(lSecond, Stamp(lStampedFormatter, 4294967295U, lTime + 86400, 200));
+
+    // Test that the date and time portion changes with the time
+    // alone.
+
+    CPPUNIT_ASSERT(Stamp(lStampedFormatter, 1, lTime + 1, 100) != lFirst);
+    CPPUNIT_ASSERT_EQUAL(lFirst.substr(lFirst.find('[')),
+                         Stamp(lStampedFormatter, 1, lTime + 1, 100).substr(lFirst.find('[')));
+}
+
+void
+TestLogFormatterStamped :: TestFork(void)
+{
+    Log::Formatter::Stamped lStampedFormatter;
+    std::string             lParent;
+    pid_t                   lChild;
+    int                     lStatus;
+
+    // Test that the process identifier cached before forking is not
+    // used for messages stamped in the child.
+
+    lParent = lStampedFormatter.Format("Parent.");
+
+    CPPUNIT_ASSERT(lParent.find("[" + std::to_string(getpid()) + ":") != std::string::npos);
+
+    lChild = fork();
+    CPPUNIT_ASSERT(lChild >= 0);
+
+    if (lChild == 0) {
+        const std::string lStamp = lStampedFormatter.Format("Child.");
+
+        _exit((lStamp.find("[" + std::to_string(getpid()) + ":") != std::string::npos) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(lChild, waitpid(lChild, &lStatus, 0));
+    CPPUNIT_ASSERT(WIFEXITED(lStatus));
+    CPPUNIT_ASSERT_EQUAL(EXIT_SUCCESS, WEXITSTATUS(lStatus));
+}
+
+void
+TestLogFormatterStamped :: TestResolution(void)
+{
+    typedef Log::Formatter::Stamped::Resolution Resolution;
+    Log::Formatter::Stamped  lSeconds;
+    Log::Formatter::Stamped  lMilliseconds(Resolution::kMilliseconds);
+    Log::Formatter::Stamped  lMicroseconds(Resolution::kMicroseconds);
+    Log::Formatter::Stamped  lNanoseconds(Resolution::kNanoseconds);
+    const time_t             lTime = 1000000000;
+    std::string              lDate;
+
+    CPPUNIT_ASSERT(lSeconds.GetResolution() == Resolution::kSeconds);
+    CPPUNIT_ASSERT(lNanoseconds.GetResolution() == Resolution::kNanoseconds);
+
+    // Test that the fraction of the second is truncated, not rounded,
+    // to the resolution and follows the date and time directly.
+
+    lDate = Stamp(lSeconds, 1, lTime, 100, 123456789);
+    lDate = lDate.substr(0, lDate.find(" ["));
+
+    CPPUNIT_ASSERT_EQUAL(lDate + " [100:", Stamp(lSeconds, 1, lTime, 100, 999999999).substr(0, lDate.size() + 6));
+    CPPUNIT_ASSERT_EQUAL(lDate + ".999 [100:", Stamp(lMilliseconds, 1, lTime, 100, 999999999).substr(0, lDate.size() + 10));
+    CPPUNIT_ASSERT_EQUAL(lDate + ".123456 [100:", Stamp(lMicroseconds, 1, lTime, 100, 123456789).substr(0, lDate.size() + 13));
+    CPPUNIT_ASSERT_EQUAL(lDate + ".123456789 [100:", Stamp(lNanoseconds, 1, lTime, 100, 123456789).substr(0, lDate.size() + 16));
+
+    // Test that the fraction is zero-padded.
+
+    CPPUNIT_ASSERT_EQUAL(lDate + ".000", Stamp(lMilliseconds, 1, lTime, 100, 999).substr(0, lDate.size() + 4));
+    CPPUNIT_ASSERT_EQUAL(lDate + ".000005", Stamp(lMicroseconds, 1, lTime, 100, 5000).substr(0, lDate.size() + 7));
+    CPPUNIT_ASSERT_EQUAL(lDate + ".000000005", Stamp(lNanoseconds, 1, lTime, 100, 5).substr(0, lDate.size() + 10));
+}
+
+void
+TestLogFormatterStamped :: TestClock(void)
+{
+    typedef Log::Formatter::Stamped::Resolution Resolution;
+    const time_t             lTime = 1000000000;
+    FixedClock               lClock((static_cast<Log::Clock::Ticks>(lTime) * 1000000000) + 42000);
+    Log::Formatter::Stamped  lFormatter(lClock, Resolution::kMicroseconds);
+    Log::Formatter::Stamped  lReference(Resolution::kMicroseconds);
+    std::string              lExpected;
+    std::string              lActual;
+
+    // Test that messages formatted as they are logged are stamped
+    // from the formatter's clock.
+
+    lExpected = Stamp(lReference, 2, lTime, getpid(), 42000);
+    lActual   = lFormatter.Format(2, "%s", "");
+
+    CPPUNIT_ASSERT_EQUAL(lExpected.substr(0, lExpected.find(" [")), lActual.substr(0, lActual.find(" [")));
+    CPPUNIT_ASSERT(lActual.find(".000042 [") != std::string::npos);
+    CPPUNIT_ASSERT_EQUAL(lActual.size() - lActual.find("] (2) "), strlen("] (2) "));
+}
+
+// Stamp an empty message as if its arguments had been captured at
+// the specified time and process, returning just the stamp.
+
+std::string
+TestLogFormatterStamped :: Stamp(Log::Formatter::Stamped & inFormatter,
+                                 Log::Level                inLevel,
+                                 time_t                    inTime,
+                                 pid_t                     inProcess,
+                                 long                      inNanoseconds)
+{
+    Log::Arguments  lArguments;
+    struct timespec lTime;
+    std::string     lStamp;
+    bool            lStatus;
+
+    lTime.tv_sec  = inTime;
+    lTime.tv_nsec = inNanoseconds;
+
+    lStatus = lArguments.Restore("", NULL, 0, false, lTime, inProcess, pthread_self());
+    CPPUNIT_ASSERT(lStatus);
+
+    inFormatter.Format(lStamp, inLevel, "", lArguments);
+
+    return (lStamp);
+}
+
 void
 TestLogFormatterStamped :: TestFormatWithLevel(
     const std::string &       inExpected,
@@ -21,7 +21,13 @@
  *      Log::Info(), and Log::Error() global singleton instances.
  */
 
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterQuiet.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
 #include <LogUtilities/LogGlobals.hpp>
+#include <LogUtilities/LogIndenterNone.hpp>
+#include <LogUtilities/LogWriterStdout.hpp>
 
 #include <fcntl.h>
 #include <stdlib.h>
@@ -41,10 +47,12 @@ class TestLogGlobals :
 {
     CPPUNIT_TEST_SUITE(TestLogGlobals);
     CPPUNIT_TEST(Test);
+    CPPUNIT_TEST(TestEveryLink);
     CPPUNIT_TEST_SUITE_END();
 
 public:
     void Test(void);
+    void TestEveryLink(void);
 };
 
 CPPUNIT_TEST_SUITE_REGISTRATION(TestLogGlobals);
@@ -139,3 +147,40 @@ TestLogGlobals :: Test(void)
     Log::Info().Write(lIndent, lLevel, "Test info global %d\n", 11);
     Log::Error().Write(lIndent, lLevel, "Test error global %d\n", 12);
 }
+
+void
+TestLogGlobals :: TestEveryLink(void)
+{
+    Log::Filter::Quiet      lQuietFilter;
+    Log::Filter::Level      lLevelFilter;
+    Log::Filter::Chain      lChainFilter;
+    Log::Indenter::None     lIndenter;
+    Log::Formatter::Plain   lFormatter;
+    Log::Writer::Stdout     lWriter;
+    Log::Level              lActualLevel;
+    bool                    lActualQuiet;
+    bool                    lStatus;
+
+    lChainFilter.Push(lQuietFilter);
+    lChainFilter.Push(lLevelFilter);
+    lChainFilter.Push(lQuietFilter);
+    lChainFilter.Push(lLevelFilter);
+
+    Log::Logger lLogger(lChainFilter, lIndenter, lFormatter, lWriter);
+
+    // Test that setting the filter sets every quiet and level link
+    // in the chain, not just the leading ones.
+
+    lStatus = SetFilter(lLogger, 3, true);
+    CPPUNIT_ASSERT(lStatus == true);
+
+    CPPUNIT_ASSERT(lChainFilter.Link<Log::Filter::Quiet>(0)->GetQuiet());
+    CPPUNIT_ASSERT_EQUAL(3U, lChainFilter.Link<Log::Filter::Level>(1)->GetLevel());
+    CPPUNIT_ASSERT(lChainFilter.Link<Log::Filter::Quiet>(2)->GetQuiet());
+    CPPUNIT_ASSERT_EQUAL(3U, lChainFilter.Link<Log::Filter::Level>(3)->GetLevel());
+
+    lStatus = GetFilter(lLogger, lActualLevel, lActualQuiet);
+    CPPUNIT_ASSERT(lStatus == true);
+    CPPUNIT_ASSERT_EQUAL(3U, lActualLevel);
+    CPPUNIT_ASSERT(true == lActualQuiet);
+}
@@ -38,12 +38,14 @@ class TestLogIndenterSpace :
     CPPUNIT_TEST(TestConstruction);
     CPPUNIT_TEST(TestFirstIndent);
     CPPUNIT_TEST(TestEveryIndent);
+    CPPUNIT_TEST(TestDeepIndent);
     CPPUNIT_TEST_SUITE_END();
 
 public:
     void TestConstruction(void);
     void TestFirstIndent(void);
     void TestEveryIndent(void);
+    void TestDeepIndent(void);
 
 private:
     void CheckResults(const std::string & inExpected, const std::string & inActual);
@@ -219,6 +221,25 @@ TestLogIndenterSpace :: TestEveryIndent(void)
     CheckResults(lExpectedResult, lActualResult);
 }
 
+void
+TestLogIndenterSpace :: TestDeepIndent(void)
+{
+    Log::Indenter::Space lSpaceIndenter(3, Log::Indenter::String::Flags::kEvery);
+    std::string          lInputString;
+
+    // Try levels within, just beyond, and well beyond the static
+    // table of indents for a width that does not divide it, then
+    // within it again.
+
+    for (Log::Indent lLevel : { 1U, 85U, 86U, 1000U, 2U }) {
+        lInputString = "First line.\nSecond line.";
+
+        CheckResults(std::string(lLevel * 3, ' ') + "First line.\n" +
+                     std::string(lLevel * 3, ' ') + "Second line.",
+                     lSpaceIndenter.Indent(lLevel, lInputString));
+    }
+}
+
 void
 TestLogIndenterSpace :: CheckResults(const std::string & inExpected,
                                      const std::string & inActual)
@@ -22,7 +22,10 @@
 
 #include <LogUtilities/LogIndenterString.hpp>
 
+#include <atomic>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <cppunit/TestAssert.h>
 #include <cppunit/extensions/HelperMacros.h>
@@ -38,12 +41,20 @@ class TestLogIndenterString :
     CPPUNIT_TEST(TestConstruction);
     CPPUNIT_TEST(TestFirstIndent);
     CPPUNIT_TEST(TestEveryIndent);
+    CPPUNIT_TEST(TestEveryIndentEdges);
+    CPPUNIT_TEST(TestEveryIndentLong);
+    CPPUNIT_TEST(TestDeepIndent);
+    CPPUNIT_TEST(TestConcurrentIndent);
     CPPUNIT_TEST_SUITE_END();
 
 public:
     void TestConstruction(void);
     void TestFirstIndent(void);
     void TestEveryIndent(void);
+    void TestEveryIndentEdges(void);
+    void TestEveryIndentLong(void);
+    void TestDeepIndent(void);
+    void TestConcurrentIndent(void);
 
 private:
     void CheckResults(const std::string & inExpected, const std::string & inActual);
@@ -232,6 +243,154 @@ TestLogIndenterString ::TestEveryIndent(void)
     CheckResults(lExpectedResult, lActualResult);
 }
 
+void
+TestLogIndenterString :: TestEveryIndentEdges(void)
+{
+    Log::Indenter::String lStringIndenter("->", Log::Indenter::String::Flags::kEvery);
+    std::string           lInputString;
+
+    // Try a lone new line, which starts no line to indent beyond the
+    // first.
+
+    lInputString = "\n";
+
+    CheckResults("->\n", lStringIndenter.Indent(1, lInputString));
+
+    // Try a leading new line and no terminating new line.
+
+    lInputString = "\nSecond";
+
+    CheckResults("->\n->Second", lStringIndenter.Indent(1, lInputString));
+
+    // Try a single character.
+
+    lInputString = "x";
+
+    CheckResults("->->x", lStringIndenter.Indent(2, lInputString));
+
+    // Try an empty indent string, which leaves the message as is.
+
+    Log::Indenter::String lEmptyIndenter("", Log::Indenter::String::Flags::kEvery);
+
+    lInputString = "First\nSecond\n";
+
+    CheckResults("First\nSecond\n", lEmptyIndenter.Indent(3, lInputString));
+}
+
+void
+TestLogIndenterString :: TestEveryIndentLong(void)
+{
+    Log::Indenter::String lStringIndenter("ab", Log::Indenter::String::Flags::kEvery);
+    std::string           lInputString;
+    std::string           lExpectedResult;
+
+    // Try many lines, of lengths spanning several vector blocks,
+    // including empty lines, such that new lines fall at every
+    // position relative to a block.
+
+    for (size_t lLine = 0; lLine < 1000; lLine++) {
+        const std::string lText((lLine * 7) % 41, static_cast<char>('A' + (lLine % 26)));
+
+        lInputString    += lText + "\n";
+        lExpectedResult += "ababab" + lText + "\n";
+    }
+
+    CheckResults(lExpectedResult, lStringIndenter.Indent(3, lInputString));
+
+    // Try the same without the terminating new line.
+
+    lInputString.assign(lExpectedResult, 0, lExpectedResult.size() - 1);
+    lExpectedResult.clear();
+
+    for (size_t lLine = 0; lLine < 1000; lLine++) {
+        const std::string lText((lLine * 7) % 41, static_cast<char>('A' + (lLine % 26)));
+
+        lExpectedResult += "ab" + std::string("ababab") + lText + ((lLine < 999) ? "\n" : "");
+    }
+
+    CheckResults(lExpectedResult, lStringIndenter.Indent(1, lInputString));
+}
+
+void
+TestLogIndenterString :: TestDeepIndent(void)
+{
+    Log::Indenter::String lFirstIndenter("<>");
+    Log::Indenter::String lEveryIndenter("<>", Log::Indenter::String::Flags::kEvery);
+    Log::Indenter::String lCopiedIndenter(lEveryIndenter);
+    std::string           lInputString;
+    std::string           lIndent;
+
+    // Try levels within and beyond the precomputed indents, growing
+    // them more than once, then within them again, including with a
+    // copy of the indenter.
+
+    for (Log::Indent lLevel : { 1U, 16U, 17U, 40U, 500U, 3U }) {
+        lIndent.clear();
+
+        for (Log::Indent lCount = 0; lCount < lLevel; lCount++) {
+            lIndent += "<>";
+        }
+
+        lInputString = "First line.\nSecond line.";
+
+        CheckResults(lIndent + "First line.\nSecond line.",
+                     lFirstIndenter.Indent(lLevel, lInputString));
+
+        lInputString = "First line.\nSecond line.";
+
+        CheckResults(lIndent + "First line.\n" + lIndent + "Second line.",
+                     lEveryIndenter.Indent(lLevel, lInputString));
+
+        lInputString = "First line.";
+
+        CheckResults(lIndent + "First line.",
+                     lCopiedIndenter.Indent(lLevel, lInputString));
+    }
+}
+
+void
+TestLogIndenterString :: TestConcurrentIndent(void)
+{
+    static const size_t       kThreads = 4;
+    Log::Indenter::String     lStringIndenter("ab", Log::Indenter::String::Flags::kEvery);
+    std::vector<std::thread>  lThreads;
+    std::atomic<size_t>       lFailures(0);
+
+    // Test that threads racing to grow the indents each see correct
+    // indents.
+
+    for (size_t lThread = 0; lThread < kThreads; lThread++) {
+        lThreads.push_back(std::thread([&lStringIndenter, &lFailures, lThread](void) {
+            std::string lMessage;
+            std::string lIndent;
+
+            for (Log::Indent lLevel = 1; lLevel < 300; lLevel++) {
+                const Log::Indent lActual = lLevel + static_cast<Log::Indent>(lThread * 7);
+
+                lIndent.clear();
+
+                for (Log::Indent lCount = 0; lCount < lActual; lCount++) {
+                    lIndent += "ab";
+                }
+
+                lMessage = "x\ny";
+
+                lStringIndenter.Indent(lActual, lMessage);
+
+                if (lMessage != (lIndent + "x\n" + lIndent + "y")) {
+                    lFailures++;
+                }
+            }
+        }));
+    }
+
+    for (size_t lThread = 0; lThread < kThreads; lThread++) {
+        lThreads[lThread].join();
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lFailures.load());
+}
+
 void
 TestLogIndenterString :: CheckResults(const std::string & inExpected,
                                       const std::string & inActual)
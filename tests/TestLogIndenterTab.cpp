@@ -38,12 +38,14 @@ class TestLogIndenterTab :
     CPPUNIT_TEST(TestConstruction);
     CPPUNIT_TEST(TestFirstIndent);
     CPPUNIT_TEST(TestEveryIndent);
+    CPPUNIT_TEST(TestDeepIndent);
     CPPUNIT_TEST_SUITE_END();
 
 public:
     void TestConstruction(void);
     void TestFirstIndent(void);
     void TestEveryIndent(void);
+    void TestDeepIndent(void);
 
 private:
     void CheckResults(const std::string & inExpected, const std::string & inActual);
@@ -213,6 +215,24 @@ TestLogIndenterTab :: TestEveryIndent(void)
     CheckResults(lExpectedResult, lActualResult);
 }
 
+void
+TestLogIndenterTab :: TestDeepIndent(void)
+{
+    Log::Indenter::Tab lTabIndenter(Log::Indenter::String::Flags::kEvery);
+    std::string        lInputString;
+
+    // Try levels within, just beyond, and well beyond the static
+    // table of indents, then within it again.
+
+    for (Log::Indent lLevel : { 1U, 64U, 65U, 1000U, 2U }) {
+        lInputString = "First line.\nSecond line.";
+
+        CheckResults(std::string(lLevel, '\t') + "First line.\n" +
+                     std::string(lLevel, '\t') + "Second line.",
+                     lTabIndenter.Indent(lLevel, lInputString));
+    }
+}
+
 void
 TestLogIndenterTab :: CheckResults(const std::string & inExpected,
                                    const std::string & inActual)
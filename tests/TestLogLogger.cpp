@@ -25,9 +25,12 @@
 #include <LogUtilities/LogFilterQuiet.hpp>
 #include <LogUtilities/LogFormatterPlain.hpp>
 #include <LogUtilities/LogFormatterStamped.hpp>
+#include <LogUtilities/LogGlobals.hpp>
 #include <LogUtilities/LogIndenterSpace.hpp>
 #include <LogUtilities/LogIndenterTab.hpp>
 #include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogRecorderBase.hpp>
+#include <LogUtilities/LogWriterChain.hpp>
 #include <LogUtilities/LogWriterDescriptor.hpp>
 #include <LogUtilities/LogWriterStderr.hpp>
 #include <LogUtilities/LogWriterStdout.hpp>
@@ -35,6 +38,7 @@
 #include <fcntl.h>
 #include <limits.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 #include <sys/stat.h>
@@ -48,6 +52,130 @@
 using namespace Nuovations;
 
 
+/**
+ *  A filter, which rejects messages containing a given word, that
+ *  counts how often each of its phases is consulted.
+ */
+class TestLogFilterCounter :
+    public Log::Filter::Base
+{
+public:
+    TestLogFilterCounter(const char * inWord, unsigned * outLevelCount, unsigned * outMessageCount) :
+        mWord(inWord),
+        mLevelCount(outLevelCount),
+        mMessageCount(outMessageCount)
+    {
+        return;
+    }
+
+    bool Allow(Log::Level inLevel) final
+    {
+        (void)inLevel;
+
+        (*mLevelCount)++;
+
+        return (true);
+    }
+
+    bool Allow(Log::Level inLevel, const char * inMessage) final
+    {
+        return (Allow(inLevel) && AllowMessage(inLevel, inMessage));
+    }
+
+    bool AllowMessage(Log::Level inLevel, const char * inMessage) final
+    {
+        (void)inLevel;
+
+        (*mMessageCount)++;
+
+        return (strstr(inMessage, mWord) == NULL);
+    }
+
+private:
+    const char * mWord;
+    unsigned *   mLevelCount;
+    unsigned *   mMessageCount;
+};
+
+/**
+ *  A writer that counts the messages written to it.
+ */
+class TestLogWriterCounter :
+    public Log::Writer::Base
+{
+public:
+    TestLogWriterCounter(void) :
+        mCount(0)
+    {
+        return;
+    }
+
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        (void)inLevel;
+        (void)inMessage;
+
+        mCount++;
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    unsigned mCount;
+};
+
+/**
+ *  A recorder that counts, and takes, the messages handed to it.
+ */
+class TestLogRecorderCounter :
+    public Log::Recorder::Base
+{
+public:
+    TestLogRecorderCounter(void) :
+        mCount(0)
+    {
+        return;
+    }
+
+    bool Record(Log::Logger & inLogger,
+                Log::Indent   inIndent,
+                Log::Level    inLevel,
+                const char *  inFormat,
+                std::va_list  inArguments) final
+    {
+        (void)inLogger;
+        (void)inIndent;
+        (void)inLevel;
+        (void)inFormat;
+        (void)inArguments;
+
+        mCount++;
+
+        return (true);
+    }
+
+    bool Record(Log::Logger &       inLogger,
+                Log::Indent         inIndent,
+                Log::Level          inLevel,
+                const char *        inFormat,
+                const Log::Values & inValues) final
+    {
+        (void)inLogger;
+        (void)inIndent;
+        (void)inLevel;
+        (void)inFormat;
+        (void)inValues;
+
+        mCount++;
+
+        return (true);
+    }
+
+    unsigned mCount;
+};
+
 class TestLogLogger :
     public TestLogUtilitiesBasis
 {
@@ -57,6 +185,10 @@ class TestLogLogger :
     CPPUNIT_TEST(TestImmutableObservation);
     CPPUNIT_TEST(TestMutation);
     CPPUNIT_TEST(TestLogger);
+    CPPUNIT_TEST(TestIsEnabled);
+    CPPUNIT_TEST(TestFilterPhases);
+    CPPUNIT_TEST(TestWriterLevels);
+    CPPUNIT_TEST(TestCopy);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -65,6 +197,10 @@ public:
     void TestImmutableObservation(void);
     void TestMutation(void);
     void TestLogger(void);
+    void TestIsEnabled(void);
+    void TestFilterPhases(void);
+    void TestWriterLevels(void);
+    void TestCopy(void);
 
 private:
     void TestLoggerWrite(const char * inTag, Log::Logger & inLogger);
@@ -376,6 +512,84 @@ TestLogLogger :: TestLoggerWrite(const char * inTag, Log::Logger & inLogger)
                    inTag, theLevel, theIndent);
 }
 
+void
+TestLogLogger :: TestWriterLevels(void)
+{
+    unsigned               lLevelCount   = 0;
+    unsigned               lMessageCount = 0;
+    TestLogFilterCounter   lCounterFilter("secret", &lLevelCount, &lMessageCount);
+    TestLogWriterCounter   lCounterWriter;
+    Log::Indenter::Tab     lTabIndenter;
+    Log::Formatter::Plain  lPlainFormatter;
+    Log::Writer::Chain     lChainWriter;
+    TestLogRecorderCounter lCounterRecorder;
+
+    lChainWriter.Push(lCounterWriter, 0, 2);
+
+    Log::Logger lLogger(lCounterFilter,
+                        lTabIndenter,
+                        lPlainFormatter,
+                        lChainWriter);
+
+    // Test that levels no link of the writer would write at are
+    // disabled, and messages at them rejected before filtering.
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(2));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(3));
+
+    lLogger.Write(3, "Unrouted %d.\n", 3);
+
+    CPPUNIT_ASSERT_EQUAL(0U, lLevelCount);
+    CPPUNIT_ASSERT_EQUAL(0U, lChainWriter.Link<TestLogWriterCounter>(0)->mCount);
+
+    lLogger.Write(2, "Routed %d.\n", 2);
+
+    CPPUNIT_ASSERT_EQUAL(1U, lLevelCount);
+    CPPUNIT_ASSERT_EQUAL(1U, lChainWriter.Link<TestLogWriterCounter>(0)->mCount);
+
+    // Test that widening the link's range enables its levels.
+
+    lChainWriter.SetLevels(0, 0, 5);
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(5));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(6));
+
+    // Test that, with a recorder, which may write elsewhere, the
+    // writer's levels no longer gate messages.
+
+    lLogger.SetRecorder(&lCounterRecorder);
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(6));
+
+    lLogger.Write(6, "Recorded %d.\n", 6);
+
+    CPPUNIT_ASSERT_EQUAL(1U, lCounterRecorder.mCount);
+
+    // Test that, once the recorder is cleared, the writer's levels
+    // gate messages again and the gate follows them as they change.
+
+    lLogger.SetRecorder(NULL);
+
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(6));
+
+    lLevelCount = 0;
+
+    lLogger.Write(6, "Unrouted %d.\n", 6);
+
+    CPPUNIT_ASSERT_EQUAL(0U, lLevelCount);
+    CPPUNIT_ASSERT_EQUAL(1U, lCounterRecorder.mCount);
+    CPPUNIT_ASSERT_EQUAL(1U, lChainWriter.Link<TestLogWriterCounter>(0)->mCount);
+
+    lChainWriter.SetLevels(0, 0, 6);
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(6));
+
+    lLogger.Write(6, "Routed %d.\n", 6);
+
+    CPPUNIT_ASSERT_EQUAL(1U, lLevelCount);
+    CPPUNIT_ASSERT_EQUAL(2U, lChainWriter.Link<TestLogWriterCounter>(0)->mCount);
+}
+
 int
 TestLogLogger :: CreateTemporaryFile(char * aPathBuffer)
 {
@@ -386,3 +600,152 @@ TestLogLogger :: CreateTemporaryFile(char * aPathBuffer)
 
     return (lStatus);
 }
+
+void
+TestLogLogger :: TestIsEnabled(void)
+{
+    Log::Writer::Stdout   lStdoutWriter;
+    Log::Filter::Quiet    lQuietFilter(false);
+    Log::Filter::Level    lLevelFilter(2);
+    Log::Indenter::Tab    lTabIndenter;
+    Log::Formatter::Plain lPlainFormatter;
+    Log::Filter::Chain    lChainFilter;
+
+    lChainFilter.Push(lQuietFilter);
+    lChainFilter.Push(lLevelFilter);
+
+    Log::Logger lLogger(lChainFilter,
+                        lTabIndenter,
+                        lPlainFormatter,
+                        lStdoutWriter);
+
+    // Test that, from construction, levels above the filter level
+    // are disabled.
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(0));
+    CPPUNIT_ASSERT(lLogger.IsEnabled(2));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(3));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(UINT_MAX));
+
+    // Test that changing a filter in the chain immediately changes
+    // the enabled levels, without anything being written.
+
+    CPPUNIT_ASSERT(Log::SetFilter(lLogger, 5, false));
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(5));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(6));
+
+    // Test that quieting the chain disables every level.
+
+    CPPUNIT_ASSERT(Log::SetFilter(lLogger, 5, true));
+
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(0));
+
+    // Test that replacing the filter enables its levels.
+
+    lLevelFilter.SetLevel(UINT_MAX);
+
+    lLogger.SetFilter(lLevelFilter);
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(UINT_MAX));
+}
+
+void
+TestLogLogger :: TestFilterPhases(void)
+{
+    unsigned              lLevelCount   = 0;
+    unsigned              lMessageCount = 0;
+    TestLogWriterCounter  lCounterWriter;
+    TestLogFilterCounter  lCounterFilter("secret", &lLevelCount, &lMessageCount);
+    Log::Filter::Level    lLevelFilter(2);
+    Log::Indenter::Tab    lTabIndenter;
+    Log::Formatter::Plain lPlainFormatter;
+    Log::Filter::Chain    lChainFilter;
+
+    lChainFilter.Push(lLevelFilter);
+
+    Log::Logger lLogger(lChainFilter,
+                        lTabIndenter,
+                        lPlainFormatter,
+                        lCounterWriter);
+
+    // Test that a content-free chain still passes and rejects
+    // messages on level.
+
+    lLogger.Write(2, "A %s message.\n", "passed");
+    lLogger.Write(3, "A %s message.\n", "filtered");
+
+    CPPUNIT_ASSERT_EQUAL(1U, lCounterWriter.mCount);
+
+    // Test that, with a link that needs message content, each link
+    // is consulted exactly once per message, in its phase, and that
+    // messages rejected on level never reach the post-format phase.
+
+    lChainFilter.Push(lCounterFilter);
+
+    lLogger.Write(2, "A %s message.\n", "public");
+
+    CPPUNIT_ASSERT_EQUAL(1U, lLevelCount);
+    CPPUNIT_ASSERT_EQUAL(1U, lMessageCount);
+    CPPUNIT_ASSERT_EQUAL(2U, lCounterWriter.mCount);
+
+    lLogger.Write(2, "A %s message.\n", "secret");
+
+    CPPUNIT_ASSERT_EQUAL(2U, lLevelCount);
+    CPPUNIT_ASSERT_EQUAL(2U, lMessageCount);
+    CPPUNIT_ASSERT_EQUAL(2U, lCounterWriter.mCount);
+
+    lLogger.Write(3, "A %s message.\n", "secret");
+
+    CPPUNIT_ASSERT_EQUAL(2U, lMessageCount);
+    CPPUNIT_ASSERT_EQUAL(2U, lCounterWriter.mCount);
+}
+
+void
+TestLogLogger :: TestCopy(void)
+{
+    Log::Writer::Stdout   lStdoutWriter;
+    Log::Filter::Level    lLevelFilter(2);
+    Log::Filter::Quiet    lQuietFilter(true);
+    Log::Indenter::Tab    lTabIndenter;
+    Log::Formatter::Plain lPlainFormatter;
+
+    Log::Logger lLogger(lLevelFilter,
+                        lTabIndenter,
+                        lPlainFormatter,
+                        lStdoutWriter);
+
+    // Test that a copy of a logger shares its stages and, with them,
+    // its enabled levels, which follow later changes to the filter.
+
+    Log::Logger lCopy(lLogger);
+
+    CPPUNIT_ASSERT(&lCopy.GetFilter() == &lLevelFilter);
+    CPPUNIT_ASSERT(lCopy.IsEnabled(2));
+    CPPUNIT_ASSERT(!lCopy.IsEnabled(3));
+
+    lLevelFilter.SetLevel(5);
+
+    CPPUNIT_ASSERT(lCopy.IsEnabled(5));
+    CPPUNIT_ASSERT(!lCopy.IsEnabled(6));
+
+    // Test that assigning a logger takes on its filter and enabled
+    // levels in turn.
+
+    Log::Logger lQuietLogger(lQuietFilter,
+                             lTabIndenter,
+                             lPlainFormatter,
+                             lStdoutWriter);
+
+    CPPUNIT_ASSERT(!lQuietLogger.IsEnabled(0));
+
+    lQuietLogger = lCopy;
+
+    CPPUNIT_ASSERT(&lQuietLogger.GetFilter() == &lLevelFilter);
+    CPPUNIT_ASSERT(lQuietLogger.IsEnabled(5));
+
+    lLevelFilter.SetLevel(0);
+
+    CPPUNIT_ASSERT(lQuietLogger.IsEnabled(0));
+    CPPUNIT_ASSERT(!lQuietLogger.IsEnabled(1));
+}
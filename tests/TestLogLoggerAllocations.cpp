@@ -0,0 +1,227 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for the heap allocations made
+ *      by Log::Logger in steady-state use.
+ *
+ *      Since counting allocations requires replacing the global
+ *      allocation operators, this test is built as its own program
+ *      rather than as part of the Log::Logger unit test.
+ */
+
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterQuiet.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogFormatterStamped.hpp>
+#include <LogUtilities/LogIndenterTab.hpp>
+#include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogWriterDescriptor.hpp>
+
+#include <new>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+// Replace the global allocation operators such that heap allocations
+// made while logging may be counted. The deallocation operators are
+// kept out of line such that the compiler does not mistake their
+// free() for one mismatched with the operator new that this file
+// also defines.
+
+static bool   sCountAllocations = false;
+static size_t sAllocations      = 0;
+
+void *
+operator new(std::size_t inSize)
+{
+    void * lResult = malloc((inSize != 0) ? inSize : 1);
+
+    if (lResult == NULL) {
+        throw std::bad_alloc();
+    }
+
+    if (sCountAllocations) {
+        sAllocations++;
+    }
+
+    return (lResult);
+}
+
+__attribute__((noinline)) void
+operator delete(void * inPointer) noexcept
+{
+    free(inPointer);
+}
+
+__attribute__((noinline)) void
+operator delete(void * inPointer, std::size_t inSize) noexcept
+{
+    (void)inSize;
+
+    free(inPointer);
+}
+
+class TestLogLoggerAllocations :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogLoggerAllocations);
+    CPPUNIT_TEST(TestPlain);
+    CPPUNIT_TEST(TestStamped);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void setUp(void);
+    void tearDown(void);
+
+    void TestPlain(void);
+    void TestStamped(void);
+
+private:
+    size_t Count(Log::Formatter::Base & inFormatter);
+    void Write(Log::Logger & inLogger);
+
+    int mDescriptor;
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogLoggerAllocations);
+
+void
+TestLogLoggerAllocations :: setUp(void)
+{
+    mDescriptor = open("/dev/null", O_WRONLY);
+
+    CPPUNIT_ASSERT(mDescriptor >= 0);
+}
+
+void
+TestLogLoggerAllocations :: tearDown(void)
+{
+    close(mDescriptor);
+}
+
+void
+TestLogLoggerAllocations :: TestPlain(void)
+{
+    Log::Formatter::Plain lPlainFormatter;
+
+    // Once warmed up, steady-state logging with the plain formatter
+    // should not allocate.
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Count(lPlainFormatter));
+}
+
+void
+TestLogLoggerAllocations :: TestStamped(void)
+{
+    Log::Formatter::Stamped lStampedFormatter;
+
+    // Nor should it with the stamped formatter.
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), Count(lStampedFormatter));
+}
+
+// Return the number of heap allocations made while repeatedly
+// writing to a logger with the specified formatter, once warmed up.
+
+size_t
+TestLogLoggerAllocations :: Count(Log::Formatter::Base & inFormatter)
+{
+    Log::Filter::Quiet      lQuietFilter;
+    Log::Filter::Level      lLevelFilter(UINT_MAX);
+    Log::Indenter::Tab      lTabIndenter(Log::Indenter::String::Flags::kEvery);
+    Log::Filter::Chain      lChainFilter;
+    Log::Writer::Descriptor lDescriptorWriter(mDescriptor);
+    size_t                  lAllocations;
+
+    lChainFilter.Push(lQuietFilter);
+    lChainFilter.Push(lLevelFilter);
+
+    Log::Logger lLogger(lChainFilter,
+                        lTabIndenter,
+                        inFormatter,
+                        lDescriptorWriter);
+
+    // Warm up the logger such that any per-thread buffers have grown
+    // to accommodate the messages to be logged.
+
+    Write(lLogger);
+
+    sAllocations      = 0;
+    sCountAllocations = true;
+
+    for (size_t lIteration = 0; lIteration < 16; lIteration++) {
+        Write(lLogger);
+    }
+
+    sCountAllocations = false;
+    lAllocations      = sAllocations;
+
+    return (lAllocations);
+}
+
+void
+TestLogLoggerAllocations :: Write(Log::Logger & inLogger)
+{
+    const char * const kTag = "TEST (Allocations)";
+    Log::Level         lLevel;
+    Log::Indent        lIndent;
+
+    // Write several single-line messages with various levels and
+    // indents.
+
+    inLogger.Write("%s: This is a single line message at "
+                   "level/indent default/default.\n", kTag);
+
+    for (lLevel = 0, lIndent = 0; lLevel < 3; lLevel++, lIndent++) {
+        inLogger.Write(lIndent, lLevel, "%s: This is a single line "
+                       "message at level/indent %u/%u.\n",
+                       kTag, lLevel, lIndent);
+    }
+
+    lLevel = UINT_MAX;
+
+    inLogger.Write(lIndent, lLevel, "%s: This is a single line "
+                   "message at level/indent %u/%u.\n",
+                   kTag, lLevel, lIndent);
+
+    // Write several multi-line messages with various levels and
+    // indents.
+
+    for (lLevel = 0, lIndent = 0; lLevel < 3; lLevel++, lIndent++) {
+        inLogger.Write(lIndent, lLevel, "%s: This is a multi-line\n"
+                       "message at level/indent %u/%u.\n",
+                       kTag, lLevel, lIndent);
+    }
+
+    lLevel = UINT_MAX;
+
+    inLogger.Write(lIndent, lLevel, "%s: This is a multi-line\n"
+                   "message at level/indent %u/%u.\n",
+                   kTag, lLevel, lIndent);
+}
@@ -24,7 +24,9 @@
 #include <LogUtilities/LogMacros.hpp>
 
 #include <fcntl.h>
+#include <limits.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 
 #include <sys/stat.h>
@@ -41,12 +43,30 @@ class TestLogMacros :
 {
     CPPUNIT_TEST_SUITE(TestLogMacros);
     CPPUNIT_TEST(Test);
+    CPPUNIT_TEST(TestDisabled);
+    CPPUNIT_TEST(TestMaxLevel);
+    CPPUNIT_TEST(TestCallSites);
+    CPPUNIT_TEST(TestNonLiteral);
     CPPUNIT_TEST_SUITE_END();
 
 public:
     void Test(void);
+    void TestDisabled(void);
+    void TestMaxLevel(void);
+    void TestCallSites(void);
+    void TestNonLiteral(void);
 };
 
+static unsigned int sEvaluations = 0;
+
+static int
+Evaluate(int inValue)
+{
+    sEvaluations++;
+
+    return (inValue);
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(TestLogMacros);
 
 void
@@ -58,4 +78,155 @@ TestLogMacros :: Test(void)
     LogDebug(lIndent, lLevel, "Test debug macro %d\n", 1);
     LogInfo(lIndent, lLevel, "Test info macro %d\n", 2);
     LogError(lIndent, lLevel, "Test error macro %d\n", 3);
+
+    LogDebug(lIndent, lLevel, "Test debug macro literal\n");
+    LogInfo(lIndent, lLevel, "Test info macro literal\n");
+    LogError(lIndent, lLevel, "Test error macro literal\n");
+}
+
+void
+TestLogMacros :: TestDisabled(void)
+{
+    const Log::Indent lIndent = 0;
+    Log::Level        lLevel;
+    bool              lQuiet;
+    bool              lStatus;
+
+    lStatus = Log::GetFilter(Log::Info(), lLevel, lQuiet);
+    CPPUNIT_ASSERT(lStatus);
+
+    // Test that the arguments to a message at a level the logger
+    // rejects are not evaluated and those to a message at a level it
+    // accepts are.
+
+    lStatus = Log::SetFilter(Log::Info(), 1, false);
+    CPPUNIT_ASSERT(lStatus);
+
+    sEvaluations = 0;
+
+    LogInfo(lIndent, 1, "Test enabled info macro %d\n", Evaluate(1));
+    CPPUNIT_ASSERT_EQUAL(1U, sEvaluations);
+
+    for (int lIteration = 0; lIteration < 10; lIteration++) {
+        LogInfo(lIndent, 2, "Test disabled info macro %d\n", Evaluate(lIteration));
+    }
+
+    CPPUNIT_ASSERT_EQUAL(1U, sEvaluations);
+
+    // Test that quieting the logger immediately disables every
+    // level.
+
+    lStatus = Log::SetFilter(Log::Info(), 1, true);
+    CPPUNIT_ASSERT(lStatus);
+
+    LogInfo(lIndent, 0, "Test quiet info macro %d\n", Evaluate(0));
+    CPPUNIT_ASSERT_EQUAL(1U, sEvaluations);
+
+    lStatus = Log::SetFilter(Log::Info(), lLevel, lQuiet);
+    CPPUNIT_ASSERT(lStatus);
+}
+
+void
+TestLogMacros :: TestMaxLevel(void)
+{
+    const Log::Indent lIndent = 0;
+    Log::Level        lLevel;
+    bool              lQuiet;
+    unsigned int      lExpected;
+    bool              lStatus;
+
+    lStatus = Log::GetFilter(Log::Info(), lLevel, lQuiet);
+    CPPUNIT_ASSERT(lStatus);
+
+    // Enable every level at run time such that only the compile-time
+    // maximum levels determine whether the arguments are evaluated.
+
+    lStatus = Log::SetFilter(Log::Info(), UINT_MAX, false);
+    CPPUNIT_ASSERT(lStatus);
+
+    sEvaluations = 0;
+    lExpected    = 0;
+
+    LogInfo(lIndent, 1, "Test info macro at level %d\n", Evaluate(1));
+    lExpected += (1 <= LOGUTILITIES_INFO_MAX_LEVEL);
+
+    LogInfo(lIndent, 2, "Test info macro at level %d\n", Evaluate(2));
+    lExpected += (2 <= LOGUTILITIES_INFO_MAX_LEVEL);
+
+    LogError(lIndent, 2, "Test error macro at level %d\n", Evaluate(2));
+    lExpected += (2 <= LOGUTILITIES_ERROR_MAX_LEVEL);
+
+    CPPUNIT_ASSERT_EQUAL(lExpected, sEvaluations);
+
+    lStatus = Log::SetFilter(Log::Info(), lLevel, lQuiet);
+    CPPUNIT_ASSERT(lStatus);
+}
+
+void
+TestLogMacros :: TestCallSites(void)
+{
+    const Log::Indent                  lIndent = 0;
+    std::vector<const Log::CallSite *> lCallSites;
+    size_t                             lMatches;
+
+    // Test that each statement registers its call site on first use.
+
+    sEvaluations = 0;
+
+    for (int lIteration = 0; lIteration < 2; lIteration++) {
+        LogInfo(lIndent, 0, "Test call site info macro %d\n", Evaluate(1));
+        LogError(lIndent, 0, "Test call site error macro %d\n", Evaluate(2));
+    }
+
+    CPPUNIT_ASSERT_EQUAL(4U, sEvaluations);
+
+    lMatches = Log::CallSite::Find("*TestLogMacros.cpp", "TestCallSites", lCallSites);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lMatches);
+    CPPUNIT_ASSERT(strcmp(lCallSites[0]->GetFunction(), "TestCallSites") == 0);
+
+    // Test that disabling the call sites of this function, by glob,
+    // skips the statements, arguments and all.
+
+    lMatches = Log::CallSite::SetEnabled("*TestLogMacros.cpp", "TestCall*", false);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lMatches);
+
+    sEvaluations = 0;
+
+    LogInfo(lIndent, 0, "Test call site info macro %d\n", Evaluate(1));
+    LogError(lIndent, 0, "Test call site error macro %d\n", Evaluate(2));
+
+    CPPUNIT_ASSERT_EQUAL(0U, sEvaluations);
+
+    Log::CallSite::Reset();
+}
+
+void
+TestLogMacros :: TestNonLiteral(void)
+{
+    const Log::Indent                  lIndent  = 0;
+    const char *                       lFormat  = "Test non-literal info macro %d\n";
+    const char *                       lMessage = "Test non-literal info macro message\n";
+    std::vector<const Log::CallSite *> lCallSites;
+    size_t                             lMatches;
+
+    // Test that formats which are not string literals, and so cannot
+    // be checked at compile time, are accepted, with and without
+    // arguments.
+
+    sEvaluations = 0;
+
+    LogInfo(lIndent, 0, lFormat, Evaluate(1));
+    LogInfo(lIndent, 0, lMessage);
+
+    CPPUNIT_ASSERT_EQUAL(1U, sEvaluations);
+
+    // Test that their call sites record no format, since theirs
+    // might not outlive them.
+
+    lMatches = Log::CallSite::Find("*TestLogMacros.cpp", "TestNonLiteral", lCallSites);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lMatches);
+    CPPUNIT_ASSERT(lCallSites[0]->GetFormat() == NULL);
+    CPPUNIT_ASSERT(lCallSites[1]->GetFormat() == NULL);
+
+    Log::CallSite::Reset();
 }
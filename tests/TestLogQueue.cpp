@@ -0,0 +1,243 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Queue.
+ */
+
+#include <LogUtilities/LogQueue.hpp>
+
+#include <thread>
+#include <vector>
+
+#include <stdint.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+class TestLogQueue :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogQueue);
+    CPPUNIT_TEST(TestCapacity);
+    CPPUNIT_TEST(TestPushPop);
+    CPPUNIT_TEST(TestFull);
+    CPPUNIT_TEST(TestProducers);
+    CPPUNIT_TEST(TestThrowingFiller);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestCapacity(void);
+    void TestPushPop(void);
+    void TestFull(void);
+    void TestProducers(void);
+    void TestThrowingFiller(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogQueue);
+
+void
+TestLogQueue :: TestCapacity(void)
+{
+    Log::Queue<int> lQueueA(0);
+    Log::Queue<int> lQueueB(8);
+    Log::Queue<int> lQueueC(9);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lQueueA.Capacity());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(8), lQueueB.Capacity());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(16), lQueueC.Capacity());
+
+    CPPUNIT_ASSERT(lQueueC.Empty());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lQueueC.Size());
+}
+
+void
+TestLogQueue :: TestPushPop(void)
+{
+    Log::Queue<int> lQueue(4);
+    int             lValue;
+    bool            lStatus;
+
+    // Test that popping an empty queue fails.
+
+    lStatus = lQueue.Pop([&lValue](int & inRecord) { lValue = inRecord; });
+    CPPUNIT_ASSERT(!lStatus);
+
+    // Test that records come out in the order they went in, across
+    // several trips around the ring.
+
+    for (int lIteration = 0; lIteration < 10; lIteration++) {
+        lStatus = lQueue.Push([lIteration](int & inRecord) { inRecord = lIteration; });
+        CPPUNIT_ASSERT(lStatus);
+
+        lStatus = lQueue.Push([lIteration](int & inRecord) { inRecord = -lIteration; });
+        CPPUNIT_ASSERT(lStatus);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lQueue.Size());
+
+        lStatus = lQueue.Pop([&lValue](int & inRecord) { lValue = inRecord; });
+        CPPUNIT_ASSERT(lStatus);
+        CPPUNIT_ASSERT_EQUAL(lIteration, lValue);
+
+        lStatus = lQueue.Pop([&lValue](int & inRecord) { lValue = inRecord; });
+        CPPUNIT_ASSERT(lStatus);
+        CPPUNIT_ASSERT_EQUAL(-lIteration, lValue);
+
+        CPPUNIT_ASSERT(lQueue.Empty());
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(20), lQueue.Pushed());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(20), lQueue.Popped());
+}
+
+void
+TestLogQueue :: TestFull(void)
+{
+    Log::Queue<int> lQueue(4);
+    int             lValue;
+    bool            lStatus;
+
+    for (int lIteration = 0; lIteration < 4; lIteration++) {
+        lStatus = lQueue.Push([lIteration](int & inRecord) { inRecord = lIteration; });
+        CPPUNIT_ASSERT(lStatus);
+    }
+
+    // Test that pushing a full queue fails and does not disturb its
+    // contents.
+
+    lStatus = lQueue.Push([](int & inRecord) { inRecord = 100; });
+    CPPUNIT_ASSERT(!lStatus);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), lQueue.Size());
+
+    // Test that popping a record makes room for exactly one more.
+
+    lStatus = lQueue.Pop([&lValue](int & inRecord) { lValue = inRecord; });
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(0, lValue);
+
+    lStatus = lQueue.Push([](int & inRecord) { inRecord = 4; });
+    CPPUNIT_ASSERT(lStatus);
+
+    lStatus = lQueue.Push([](int & inRecord) { inRecord = 5; });
+    CPPUNIT_ASSERT(!lStatus);
+
+    for (int lIteration = 1; lIteration <= 4; lIteration++) {
+        lStatus = lQueue.Pop([&lValue](int & inRecord) { lValue = inRecord; });
+        CPPUNIT_ASSERT(lStatus);
+        CPPUNIT_ASSERT_EQUAL(lIteration, lValue);
+    }
+}
+
+void
+TestLogQueue :: TestProducers(void)
+{
+    static const size_t       kProducers = 4;
+    static const uint32_t     kRecords   = 20000;
+    Log::Queue<uint64_t>      lQueue(64);
+    std::vector<std::thread>  lProducers;
+    std::vector<uint32_t>     lNext(kProducers, 0);
+    size_t                    lPopped = 0;
+
+    for (size_t lProducer = 0; lProducer < kProducers; lProducer++) {
+        lProducers.push_back(std::thread([&lQueue, lProducer](void) {
+            for (uint32_t lRecord = 0; lRecord < kRecords; lRecord++) {
+                const uint64_t lValue = (static_cast<uint64_t>(lProducer) << 32) | lRecord;
+
+                while (!lQueue.Push([lValue](uint64_t & inRecord) { inRecord = lValue; })) {
+                    std::this_thread::yield();
+                }
+            }
+        }));
+    }
+
+    // Test that every record is popped exactly once and that each
+    // producer's records are popped in the order it pushed them.
+
+    while (lPopped < (kProducers * kRecords)) {
+        const bool lStatus = lQueue.Pop([&lNext](uint64_t & inRecord) {
+            const size_t   lProducer = static_cast<size_t>(inRecord >> 32);
+            const uint32_t lRecord   = static_cast<uint32_t>(inRecord);
+
+            CPPUNIT_ASSERT(lProducer < kProducers);
+            CPPUNIT_ASSERT_EQUAL(lNext[lProducer], lRecord);
+
+            lNext[lProducer]++;
+        });
+
+        if (lStatus) {
+            lPopped++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    for (size_t lProducer = 0; lProducer < kProducers; lProducer++) {
+        lProducers[lProducer].join();
+
+        CPPUNIT_ASSERT_EQUAL(kRecords, lNext[lProducer]);
+    }
+
+    CPPUNIT_ASSERT(lQueue.Empty());
+}
+
+void
+TestLogQueue :: TestThrowingFiller(void)
+{
+    Log::Queue<int> lQueue(4);
+    int             lValue  = 0;
+    bool            lThrown = false;
+    bool            lStatus;
+
+    lStatus = lQueue.Push([](int & inRecord) { inRecord = 1; });
+    CPPUNIT_ASSERT(lStatus);
+
+    try {
+        lQueue.Push([](int & inRecord) { inRecord = 2; throw (inRecord); });
+    } catch (int lException) {
+        lThrown = (lException == 2);
+    }
+
+    CPPUNIT_ASSERT(lThrown);
+
+    lStatus = lQueue.Push([](int & inRecord) { inRecord = 3; });
+    CPPUNIT_ASSERT(lStatus);
+
+    // Test that the record whose filler threw is popped, rather than
+    // wedging the queue, but never drained.
+
+    lStatus = lQueue.Pop([&lValue](int & inRecord) { lValue = inRecord; });
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(1, lValue);
+
+    lStatus = lQueue.Pop([&lValue](int & inRecord) { lValue = inRecord; });
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(1, lValue);
+
+    lStatus = lQueue.Pop([&lValue](int & inRecord) { lValue = inRecord; });
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(3, lValue);
+
+    CPPUNIT_ASSERT(lQueue.Empty());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), lQueue.Popped());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lQueue.Skipped());
+}
@@ -0,0 +1,397 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Recorder::Binary.
+ */
+
+#include <LogUtilities/LogDecoder.hpp>
+#include <LogUtilities/LogFilterAlways.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogFormatterStamped.hpp>
+#include <LogUtilities/LogIndenterNone.hpp>
+#include <LogUtilities/LogIndenterSpace.hpp>
+#include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogRecorderBinary.hpp>
+#include <LogUtilities/LogValues.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+#include <LogUtilities/LogWriterStdio.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+/**
+ *  A writer that records the messages written to it.
+ */
+class TestLogWriterCollector :
+    public Log::Writer::Base
+{
+public:
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        (void)inLevel;
+
+        mMessages.push_back((inMessage != NULL) ? inMessage : "(null)");
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    std::vector<std::string> mMessages;
+};
+
+class TestLogRecorderBinary :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogRecorderBinary);
+    CPPUNIT_TEST(TestRoundTrip);
+    CPPUNIT_TEST(TestRegistration);
+    CPPUNIT_TEST(TestStamped);
+    CPPUNIT_TEST(TestThreads);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestRoundTrip(void);
+    void TestRegistration(void);
+    void TestStamped(void);
+    void TestThreads(void);
+
+private:
+    static void Log(Log::Logger & inLogger);
+    static void WriteList(Log::Logger & inLogger, const char * inFormat, ...)
+        __attribute__((format(printf, 2, 3)));
+    static std::string Read(FILE * inStream);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogRecorderBinary);
+
+// Log an assortment of messages through both the typed and variable
+// argument list interfaces.
+
+void
+TestLogRecorderBinary :: Log(Log::Logger & inLogger)
+{
+    int lObject;
+
+    inLogger.Write("Literal.\n");
+    inLogger.WriteTyped("%d %u %ld %lld %zu\n", -1, 2U, 3L, 4LL, static_cast<size_t>(5));
+    inLogger.WriteTyped("%hhu %ld %.1f %c\n", 257, 7, 2, 'x');
+    inLogger.WriteTyped(1, 2, "%s %.3s %ls %5.2f %Lg %p\n", "string", "truncated", L"wide", 3.14159, 2.5L, &lObject);
+    inLogger.WriteTyped(2, 1, "%*d|%-*.*s|\n", 6, 42, 8, 3, "abcdef");
+    inLogger.WriteTyped("%2$s %1$d\n", 1, "two");
+    inLogger.WriteTyped("%s %d\n", 5, 6);
+    inLogger.WriteTyped("%s\n", static_cast<const char *>(NULL));
+
+    errno = EPERM;
+
+    inLogger.Write("%m\n");
+
+    inLogger.Write(1, 1, "Literal, as from the macros.\n", Log::Values());
+
+    WriteList(inLogger, "%d %s %.2f\n", 1, "list", 0.5);
+    WriteList(inLogger, "%2$s, %1$d\n", 1, "list");
+}
+
+void
+TestLogRecorderBinary :: WriteList(Log::Logger & inLogger, const char * inFormat, ...)
+{
+    va_list lArguments;
+
+    va_start(lArguments, inFormat);
+
+    inLogger.Write(0, 0, inFormat, lArguments);
+
+    va_end(lArguments);
+}
+
+std::string
+TestLogRecorderBinary :: Read(FILE * inStream)
+{
+    std::string lData;
+    char        lBuffer[4096];
+    size_t      lSize;
+
+    fflush(inStream);
+    rewind(inStream);
+
+    while ((lSize = fread(lBuffer, 1, sizeof (lBuffer), inStream)) > 0) {
+        lData.append(lBuffer, lSize);
+    }
+
+    return (lData);
+}
+
+void
+TestLogRecorderBinary :: TestRoundTrip(void)
+{
+    Log::Filter::Always    lFilter;
+    Log::Indenter::Space   lIndenter(2);
+    Log::Formatter::Plain  lFormatter;
+    TestLogWriterCollector lExpected;
+    Log::Logger            lExpectedLogger(lFilter, lIndenter, lFormatter, lExpected);
+    FILE *                 lStream = tmpfile();
+    Log::Writer::Stdio     lWriter(lStream);
+    Log::Logger            lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Decoder           lDecoder;
+    std::string            lData;
+    std::string            lMessage;
+    bool                   lStatus;
+
+    CPPUNIT_ASSERT(lStream != NULL);
+
+    Log(lExpectedLogger);
+
+    {
+        Log::Recorder::Binary lRecorder(lWriter);
+
+        lLogger.SetRecorder(&lRecorder);
+
+        Log(lLogger);
+
+        lLogger.SetRecorder(NULL);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(lExpected.mMessages.size()), lRecorder.GetWritten());
+        CPPUNIT_ASSERT_EQUAL(lExpected.mMessages.size(), lRecorder.GetFormats());
+    }
+
+    // Test that every message decodes to exactly the text that would
+    // have been written synchronously.
+
+    lData = Read(lStream);
+
+    lStatus = lDecoder.Load(lData.data(), lData.size());
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(lData.size(), lDecoder.GetLoaded());
+    CPPUNIT_ASSERT_EQUAL(lExpected.mMessages.size(), lDecoder.GetMessages());
+
+    for (size_t lIndex = 0; lIndex < lDecoder.GetMessages(); lIndex++) {
+        lStatus = lDecoder.Decode(lIndex, lFormatter, lIndenter, lMessage);
+        CPPUNIT_ASSERT(lStatus);
+        CPPUNIT_ASSERT_EQUAL(lExpected.mMessages[lIndex], lMessage);
+    }
+
+    fclose(lStream);
+}
+
+void
+TestLogRecorderBinary :: TestRegistration(void)
+{
+    Log::Filter::Always    lFilter;
+    Log::Indenter::None    lIndenter;
+    Log::Formatter::Plain  lFormatter;
+    FILE *                 lStream = tmpfile();
+    Log::Writer::Stdio     lWriter(lStream);
+    Log::Logger            lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Decoder           lDecoder;
+    char                   lFormat[16];
+    std::string            lData;
+    std::string            lMessage;
+    bool                   lStatus;
+
+    CPPUNIT_ASSERT(lStream != NULL);
+
+    {
+        Log::Recorder::Binary lRecorder(lWriter);
+
+        lLogger.SetRecorder(&lRecorder);
+
+        // Test that a format string is registered only once, no
+        // matter how often it is used.
+
+        for (int lIteration = 0; lIteration < 100; lIteration++) {
+            lLogger.Write("Iteration %d.", lIteration);
+        }
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lRecorder.GetFormats());
+
+        // Test that a format string whose contents change at the same
+        // address is registered anew.
+
+        strcpy(lFormat, "First %d.");
+        lLogger.Write(lFormat, 1);
+
+        strcpy(lFormat, "Second %d.");
+        lLogger.Write(lFormat, 2);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), lRecorder.GetFormats());
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(102), lRecorder.GetWritten());
+
+        lLogger.SetRecorder(NULL);
+    }
+
+    lData = Read(lStream);
+
+    lStatus = lDecoder.Load(lData.data(), lData.size());
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(102), lDecoder.GetMessages());
+
+    lStatus = lDecoder.Decode(99, lFormatter, lIndenter, lMessage);
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(std::string("Iteration 99."), lMessage);
+
+    lStatus = lDecoder.Decode(100, lFormatter, lIndenter, lMessage);
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(std::string("First 1."), lMessage);
+
+    lStatus = lDecoder.Decode(101, lFormatter, lIndenter, lMessage);
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(std::string("Second 2."), lMessage);
+
+    fclose(lStream);
+}
+
+void
+TestLogRecorderBinary :: TestStamped(void)
+{
+    Log::Filter::Level      lFilter(3);
+    Log::Indenter::None     lIndenter;
+    Log::Formatter::Stamped lFormatter;
+    FILE *                  lStream = tmpfile();
+    Log::Writer::Stdio      lWriter(lStream);
+    Log::Logger             lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Decoder            lDecoder;
+    std::string             lData;
+    std::string             lMessage;
+    bool                    lStatus;
+
+    CPPUNIT_ASSERT(lStream != NULL);
+
+    {
+        Log::Recorder::Binary lRecorder(lWriter);
+
+        lLogger.SetRecorder(&lRecorder);
+
+        // Test that level filtering still applies ahead of the
+        // recorder.
+
+        lLogger.Write(3, "%s", "Stamped.");
+        lLogger.Write(4, "%s", "Rejected.");
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(1), lRecorder.GetWritten());
+
+        lLogger.SetRecorder(NULL);
+    }
+
+    lData = Read(lStream);
+
+    lStatus = lDecoder.Load(lData.data(), lData.size());
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lDecoder.GetMessages());
+
+    // Test that the stamp reflects the recording process and level.
+
+    lStatus = lDecoder.Decode(0, lFormatter, lIndenter, lMessage);
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT(lMessage.find("[" + std::to_string(getpid()) + ":") != std::string::npos);
+    CPPUNIT_ASSERT(lMessage.find("] (3) Stamped.") != std::string::npos);
+    CPPUNIT_ASSERT_EQUAL(lMessage.size(), lMessage.find("Stamped.") + strlen("Stamped."));
+
+    fclose(lStream);
+}
+
+void
+TestLogRecorderBinary :: TestThreads(void)
+{
+    static const int         kThreads  = 4;
+    static const int         kMessages = 1000;
+    Log::Filter::Always      lFilter;
+    Log::Indenter::None      lIndenter;
+    Log::Formatter::Plain    lFormatter;
+    FILE *                   lStream = tmpfile();
+    Log::Writer::Stdio       lWriter(lStream);
+    Log::Logger              lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Decoder             lDecoder;
+    std::vector<std::thread> lThreads;
+    std::vector<int>         lNext(kThreads, 0);
+    std::string              lData;
+    std::string              lMessage;
+    bool                     lStatus;
+
+    CPPUNIT_ASSERT(lStream != NULL);
+
+    {
+        Log::Recorder::Binary lRecorder(lWriter);
+
+        lLogger.SetRecorder(&lRecorder);
+
+        for (int lThread = 0; lThread < kThreads; lThread++) {
+            lThreads.push_back(std::thread([&lLogger, lThread](void) {
+                for (int lNumber = 0; lNumber < kMessages; lNumber++) {
+                    if (lNumber % 2) {
+                        lLogger.Write("%d odd %d", lThread, lNumber);
+                    } else {
+                        lLogger.Write("%d even %d", lThread, lNumber);
+                    }
+                }
+            }));
+        }
+
+        for (auto & lThread : lThreads) {
+            lThread.join();
+        }
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lRecorder.GetFormats());
+
+        lLogger.SetRecorder(NULL);
+    }
+
+    // Test that each message was written whole, after its format,
+    // and that each thread's messages are in the order it wrote them.
+
+    lData = Read(lStream);
+
+    lStatus = lDecoder.Load(lData.data(), lData.size());
+    CPPUNIT_ASSERT(lStatus);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(kThreads * kMessages), lDecoder.GetMessages());
+
+    for (size_t lIndex = 0; lIndex < lDecoder.GetMessages(); lIndex++) {
+        int  lThread;
+        int  lNumber;
+        char lParity[5];
+
+        lStatus = lDecoder.Decode(lIndex, lFormatter, lIndenter, lMessage);
+        CPPUNIT_ASSERT(lStatus);
+
+        CPPUNIT_ASSERT_EQUAL(3, sscanf(lMessage.c_str(), "%d %4s %d", &lThread, lParity, &lNumber));
+        CPPUNIT_ASSERT(lThread >= 0 && lThread < kThreads);
+        CPPUNIT_ASSERT_EQUAL(lNext[lThread], lNumber);
+        CPPUNIT_ASSERT_EQUAL(std::string((lNumber % 2) ? "odd" : "even"), std::string(lParity));
+
+        lNext[lThread]++;
+    }
+
+    fclose(lStream);
+}
@@ -0,0 +1,376 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Recorder::Deferred.
+ */
+
+#include <LogUtilities/LogFilterAlways.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogFormatterStamped.hpp>
+#include <LogUtilities/LogIndenterNone.hpp>
+#include <LogUtilities/LogIndenterSpace.hpp>
+#include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogRecorderDeferred.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+/**
+ *  A writer that records the messages written to it and the thread
+ *  each was written from.
+ */
+class TestLogWriterCollector :
+    public Log::Writer::Base
+{
+public:
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        std::lock_guard<std::mutex> lLock(mMutex);
+
+        mLevels.push_back(inLevel);
+        mMessages.push_back((inMessage != NULL) ? inMessage : "(null)");
+        mThreads.push_back(pthread_self());
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    std::vector<Log::Level>  mLevels;
+    std::vector<std::string> mMessages;
+    std::vector<pthread_t>   mThreads;
+
+private:
+    std::mutex               mMutex;
+};
+
+class TestLogRecorderDeferred :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogRecorderDeferred);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestFlush);
+    CPPUNIT_TEST(TestFilterAndIndent);
+    CPPUNIT_TEST(TestStamped);
+    CPPUNIT_TEST(TestTypedArguments);
+    CPPUNIT_TEST(TestStop);
+    CPPUNIT_TEST(TestThreads);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestConstruction(void);
+    void TestFlush(void);
+    void TestFilterAndIndent(void);
+    void TestStamped(void);
+    void TestTypedArguments(void);
+    void TestStop(void);
+    void TestThreads(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogRecorderDeferred);
+
+void
+TestLogRecorderDeferred :: TestConstruction(void)
+{
+    {
+        Log::Recorder::Deferred lRecorder;
+
+        CPPUNIT_ASSERT_EQUAL(Log::Recorder::Deferred::kCapacityDefault, lRecorder.GetCapacity());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lRecorder.GetDepth());
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lRecorder.GetWritten());
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lRecorder.GetDropped());
+    }
+
+    {
+        Log::Recorder::Deferred lRecorder(100);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(128), lRecorder.GetCapacity());
+    }
+
+    {
+        Log::Recorder::Deferred lRecorder(8, Log::Recorder::Deferred::Overflow::kBlock);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(8), lRecorder.GetCapacity());
+    }
+}
+
+void
+TestLogRecorderDeferred :: TestFlush(void)
+{
+    Log::Filter::Always       lFilter;
+    Log::Indenter::None       lIndenter;
+    Log::Formatter::Plain     lFormatter;
+    TestLogWriterCollector    lWriter;
+    Log::Logger               lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Recorder::Deferred   lRecorder(16, Log::Recorder::Deferred::Overflow::kBlock);
+    char                      lBuffer[32];
+
+    CPPUNIT_ASSERT(lLogger.GetRecorder() == NULL);
+
+    lLogger.SetRecorder(&lRecorder);
+
+    CPPUNIT_ASSERT(lLogger.GetRecorder() == &lRecorder);
+
+    // Test that messages are formatted from the arguments as they
+    // were when logged, in order, on the backend thread, and have all
+    // been written once a flush returns.
+
+    for (int lIteration = 0; lIteration < 100; lIteration++) {
+        snprintf(lBuffer, sizeof (lBuffer), "buffer %d", lIteration);
+
+        lLogger.Write(static_cast<Log::Level>(lIteration), "%d: %s", lIteration, lBuffer);
+
+        strcpy(lBuffer, "clobbered");
+    }
+
+    lRecorder.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(100), lWriter.mMessages.size());
+
+    for (int lIteration = 0; lIteration < 100; lIteration++) {
+        const std::string lExpected =
+            std::to_string(lIteration) + ": buffer " + std::to_string(lIteration);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(lIteration), lWriter.mLevels[lIteration]);
+        CPPUNIT_ASSERT_EQUAL(lExpected, lWriter.mMessages[lIteration]);
+        CPPUNIT_ASSERT(!pthread_equal(pthread_self(), lWriter.mThreads[lIteration]));
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(100), lRecorder.GetWritten());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lRecorder.GetDropped());
+
+    // Test that clearing the recorder restores synchronous writing.
+
+    lLogger.SetRecorder(NULL);
+
+    lLogger.Write("Synchronous.");
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(101), lWriter.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("Synchronous."), lWriter.mMessages.back());
+    CPPUNIT_ASSERT(pthread_equal(pthread_self(), lWriter.mThreads.back()));
+}
+
+void
+TestLogRecorderDeferred :: TestFilterAndIndent(void)
+{
+    Log::Filter::Level        lFilter(1);
+    Log::Indenter::Space      lIndenter(2);
+    Log::Formatter::Plain     lFormatter;
+    TestLogWriterCollector    lWriter;
+    Log::Logger               lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Recorder::Deferred   lRecorder;
+
+    lLogger.SetRecorder(&lRecorder);
+
+    // Test that messages rejected on level alone are never recorded
+    // and that recorded messages are indented.
+
+    lLogger.Write(1, 0, "%s", "Allowed.");
+    lLogger.Write(2, 2, "%s", "Rejected.");
+    lLogger.Write(1, 1, "%s", "Allowed.");
+
+    lRecorder.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(2), lRecorder.GetWritten());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lWriter.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("  Allowed."), lWriter.mMessages[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("  Allowed."), lWriter.mMessages[1]);
+}
+
+void
+TestLogRecorderDeferred :: TestStamped(void)
+{
+    Log::Filter::Always       lFilter;
+    Log::Indenter::None       lIndenter;
+    Log::Formatter::Stamped   lFormatter;
+    TestLogWriterCollector    lWriter;
+    Log::Logger               lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Recorder::Deferred   lRecorder;
+    std::string               lSynchronous;
+    std::string               lDeferred;
+
+    // Test that the stamp of a deferred message names the thread that
+    // logged it, rather than the backend thread that formatted it,
+    // just as the stamp of a synchronous message does.
+
+    lLogger.Write("%s", "Synchronous.");
+
+    lLogger.SetRecorder(&lRecorder);
+
+    lLogger.Write("%s", "Deferred.");
+
+    lRecorder.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lWriter.mMessages.size());
+
+    lSynchronous = lWriter.mMessages[0];
+    lDeferred    = lWriter.mMessages[1];
+
+    CPPUNIT_ASSERT(lSynchronous.find("Synchronous.") != std::string::npos);
+    CPPUNIT_ASSERT(lDeferred.find("Deferred.") != std::string::npos);
+
+    lSynchronous = lSynchronous.substr(lSynchronous.find('['), lSynchronous.find(']') - lSynchronous.find('[') + 1);
+    lDeferred    = lDeferred.substr(lDeferred.find('['), lDeferred.find(']') - lDeferred.find('[') + 1);
+
+    CPPUNIT_ASSERT_EQUAL(lSynchronous, lDeferred);
+}
+
+void
+TestLogRecorderDeferred :: TestTypedArguments(void)
+{
+    Log::Filter::Always       lFilter;
+    Log::Indenter::None       lIndenter;
+    Log::Formatter::Plain     lFormatter;
+    TestLogWriterCollector    lWriter;
+    Log::Logger               lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Recorder::Deferred   lRecorder;
+    int                       lObject;
+
+    lLogger.SetRecorder(&lRecorder);
+
+    // Test that typed arguments are captured, converted to the type
+    // each directive calls for, and that those which cannot be
+    // captured are rendered as they would be synchronously.
+
+    lLogger.WriteTyped("%hhu %ld %.1f %c", 257, 7, 2, 'x');
+    lLogger.WriteTyped("%p", &lObject);
+    lLogger.WriteTyped("%2$s %1$d", 1, "two");
+    lLogger.WriteTyped("%s %d", 5, 6);
+    lLogger.WriteTyped("%d %d", 1);
+
+    lRecorder.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), lWriter.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("1 7 2.0 x"), lWriter.mMessages[0]);
+    CPPUNIT_ASSERT_EQUAL(std::to_string(reinterpret_cast<uintptr_t>(&lObject)),
+                         std::to_string(strtoull(lWriter.mMessages[1].c_str(), NULL, 16)));
+    CPPUNIT_ASSERT_EQUAL(std::string("two 1"), lWriter.mMessages[2]);
+    CPPUNIT_ASSERT_EQUAL(std::string("%s 6"), lWriter.mMessages[3]);
+    CPPUNIT_ASSERT_EQUAL(std::string("1 %d"), lWriter.mMessages[4]);
+}
+
+void
+TestLogRecorderDeferred :: TestStop(void)
+{
+    Log::Filter::Always       lFilter;
+    Log::Indenter::None       lIndenter;
+    Log::Formatter::Plain     lFormatter;
+    TestLogWriterCollector    lWriter;
+    Log::Logger               lLogger(lFilter, lIndenter, lFormatter, lWriter);
+
+    {
+        Log::Recorder::Deferred lRecorder(64, Log::Recorder::Deferred::Overflow::kBlock);
+
+        lLogger.SetRecorder(&lRecorder);
+
+        for (int lIteration = 0; lIteration < 1000; lIteration++) {
+            lLogger.Write("Stopping %d.", lIteration);
+        }
+
+        // Test that stopping formats and writes everything queued.
+
+        lRecorder.Stop();
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1000), lWriter.mMessages.size());
+        CPPUNIT_ASSERT_EQUAL(std::string("Stopping 999."), lWriter.mMessages.back());
+
+        // Test that messages logged after stopping are written
+        // synchronously.
+
+        lLogger.Write("Stopped.");
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1001), lWriter.mMessages.size());
+        CPPUNIT_ASSERT_EQUAL(std::string("Stopped."), lWriter.mMessages.back());
+        CPPUNIT_ASSERT(pthread_equal(pthread_self(), lWriter.mThreads.back()));
+
+        // Test that stopping and flushing a stopped recorder are
+        // benign.
+
+        lRecorder.Stop();
+        lRecorder.Flush();
+
+        lLogger.SetRecorder(NULL);
+    }
+}
+
+void
+TestLogRecorderDeferred :: TestThreads(void)
+{
+    static const size_t       kThreads  = 4;
+    static const size_t       kMessages = 5000;
+    Log::Filter::Always       lFilter;
+    Log::Indenter::None       lIndenter;
+    Log::Formatter::Plain     lFormatter;
+    TestLogWriterCollector    lWriter;
+    Log::Logger               lLogger(lFilter, lIndenter, lFormatter, lWriter);
+    Log::Recorder::Deferred   lRecorder(8, Log::Recorder::Deferred::Overflow::kBlock);
+    std::vector<std::thread>  lThreads;
+    std::vector<size_t>       lNext(kThreads, 0);
+
+    lLogger.SetRecorder(&lRecorder);
+
+    // Test that, with several threads logging into a small queue, no
+    // message is dropped and each thread's messages are written in
+    // the order it logged them.
+
+    for (size_t lThread = 0; lThread < kThreads; lThread++) {
+        lThreads.push_back(std::thread([&lLogger, lThread](void) {
+            for (size_t lMessage = 0; lMessage < kMessages; lMessage++) {
+                lLogger.Write("%zu %zu", lThread, lMessage);
+            }
+        }));
+    }
+
+    for (size_t lThread = 0; lThread < kThreads; lThread++) {
+        lThreads[lThread].join();
+    }
+
+    lRecorder.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(kThreads * kMessages, lWriter.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lRecorder.GetDropped());
+
+    for (size_t lIndex = 0; lIndex < lWriter.mMessages.size(); lIndex++) {
+        size_t lThread;
+        size_t lMessage;
+
+        CPPUNIT_ASSERT_EQUAL(2, sscanf(lWriter.mMessages[lIndex].c_str(), "%zu %zu", &lThread, &lMessage));
+        CPPUNIT_ASSERT(lThread < kThreads);
+        CPPUNIT_ASSERT_EQUAL(lNext[lThread], lMessage);
+
+        lNext[lThread]++;
+    }
+}
@@ -0,0 +1,446 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::StaticLogger.
+ */
+
+#include <LogUtilities/LogFilterAlways.hpp>
+#include <LogUtilities/LogFilterChain.hpp>
+#include <LogUtilities/LogFilterLevel.hpp>
+#include <LogUtilities/LogFilterNever.hpp>
+#include <LogUtilities/LogFilterQuiet.hpp>
+#include <LogUtilities/LogFilterStaticChain.hpp>
+#include <LogUtilities/LogFormatterPlain.hpp>
+#include <LogUtilities/LogIndenterNone.hpp>
+#include <LogUtilities/LogIndenterTab.hpp>
+#include <LogUtilities/LogLogger.hpp>
+#include <LogUtilities/LogStaticLogger.hpp>
+#include <LogUtilities/LogWriterBase.hpp>
+#include <LogUtilities/LogWriterChain.hpp>
+#include <LogUtilities/LogWriterStaticChain.hpp>
+
+#include <string>
+#include <vector>
+
+#include <limits.h>
+#include <stdarg.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+/**
+ *  A writer that records the messages written to it.
+ */
+class TestLogWriterCollector :
+    public Log::Writer::Base
+{
+public:
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        mLevels.push_back(inLevel);
+        mMessages.push_back((inMessage != NULL) ? inMessage : "(null)");
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    std::vector<Log::Level>  mLevels;
+    std::vector<std::string> mMessages;
+};
+
+/**
+ *  A writer that, from within a write, logs through a logger, which
+ *  may be the very one writing to it.
+ */
+class TestLogWriterReentrant :
+    public Log::Writer::Base
+{
+public:
+    TestLogWriterReentrant(void) :
+        mLogger(NULL),
+        mIntact(true)
+    {
+        return;
+    }
+
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        const std::string lMessage(inMessage);
+
+        if (inLevel > 0) {
+            mLogger->Write(inLevel - 1, "Nested at level %u.\n", inLevel - 1);
+        }
+
+        // The message in flight must not have been clobbered by the
+        // nested write.
+
+        mIntact = mIntact && (lMessage == inMessage);
+
+        mMessages.push_back(lMessage);
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    Log::Logger *            mLogger;
+    bool                     mIntact;
+    std::vector<std::string> mMessages;
+};
+
+typedef Log::StaticLogger<Log::Filter::Level,
+                          Log::Indenter::Tab,
+                          Log::Formatter::Plain,
+                          TestLogWriterCollector> TestLevelLogger;
+
+typedef Log::StaticLogger<Log::Filter::Always,
+                          Log::Indenter::None,
+                          Log::Formatter::Plain,
+                          TestLogWriterCollector> TestAlwaysLogger;
+
+typedef Log::StaticLogger<Log::Filter::Never,
+                          Log::Indenter::None,
+                          Log::Formatter::Plain,
+                          TestLogWriterCollector> TestNeverLogger;
+
+typedef Log::StaticLogger<Log::Filter::StaticChain<Log::Filter::Quiet,
+                                                   Log::Filter::Level>,
+                          Log::Indenter::None,
+                          Log::Formatter::Plain,
+                          Log::Writer::StaticChain<TestLogWriterCollector,
+                                                   TestLogWriterCollector>> TestChainLogger;
+
+class TestLogStaticLogger :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogStaticLogger);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestObservation);
+    CPPUNIT_TEST(TestWrite);
+    CPPUNIT_TEST(TestRuntimeParity);
+    CPPUNIT_TEST(TestAlways);
+    CPPUNIT_TEST(TestNever);
+    CPPUNIT_TEST(TestStaticChains);
+    CPPUNIT_TEST(TestRuntimeStage);
+    CPPUNIT_TEST(TestWriterLevels);
+    CPPUNIT_TEST(TestReentrancy);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestConstruction(void);
+    void TestObservation(void);
+    void TestWrite(void);
+    void TestRuntimeParity(void);
+    void TestAlways(void);
+    void TestNever(void);
+    void TestStaticChains(void);
+    void TestRuntimeStage(void);
+    void TestWriterLevels(void);
+    void TestReentrancy(void);
+
+private:
+    template <typename Logger>
+    static void Log(Logger & inLogger);
+    template <typename Logger>
+    static void WriteList(Logger & inLogger, const char * inFormat, ...)
+        __attribute__((format(printf, 2, 3)));
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogStaticLogger);
+
+// Log an assortment of messages, at assorted levels and indents,
+// through each of the write interfaces.
+
+template <typename Logger>
+void
+TestLogStaticLogger :: Log(Logger & inLogger)
+{
+    inLogger.Write("Literal at the default level.\n");
+    inLogger.WriteTyped("%s %d at the default level.\n", "Typed", 1);
+    inLogger.WriteTyped(1, "%s %d at level 1.\n", "Typed", 2);
+    inLogger.WriteTyped(1, 2, "%s %d at level 2 and indent 1.\n", "Typed", 3);
+    inLogger.Write(1, 3, "Multi-line\nat level 3 and indent 1.\n");
+    inLogger.WriteTyped(0, UINT_MAX, "%s at level UINT_MAX.\n", "Typed");
+
+    WriteList(inLogger, "%s %d at the default level.\n", "Listed", 4);
+}
+
+template <typename Logger>
+void
+TestLogStaticLogger :: WriteList(Logger & inLogger, const char * inFormat, ...)
+{
+    va_list lArguments;
+
+    va_start(lArguments, inFormat);
+
+    inLogger.Write(inFormat, lArguments);
+
+    va_end(lArguments);
+}
+
+void
+TestLogStaticLogger :: TestConstruction(void)
+{
+    TestLevelLogger  lDefaultLogger;
+    TestLevelLogger  lLogger(2,
+                             Log::Indenter::String::Flags::kEvery,
+                             Log::Formatter::Plain(),
+                             TestLogWriterCollector());
+    TestChainLogger  lChainLogger;
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(0), lDefaultLogger.GetFilter().GetLevel());
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(2), lLogger.GetFilter().GetLevel());
+    CPPUNIT_ASSERT(lChainLogger.GetWriter().Size() == 2);
+}
+
+void
+TestLogStaticLogger :: TestObservation(void)
+{
+    TestLevelLogger         lLogger;
+    const TestLevelLogger & lConstLogger = lLogger;
+
+    // The runtime view is bound to the very same stages.
+
+    CPPUNIT_ASSERT(&lLogger.GetLogger().GetFilter()    == &lLogger.GetFilter());
+    CPPUNIT_ASSERT(&lLogger.GetLogger().GetIndenter()  == &lLogger.GetIndenter());
+    CPPUNIT_ASSERT(&lLogger.GetLogger().GetFormatter() == &lLogger.GetFormatter());
+    CPPUNIT_ASSERT(&lLogger.GetLogger().GetWriter()    == &lLogger.GetWriter());
+
+    CPPUNIT_ASSERT(&lConstLogger.GetFilter()    == &lLogger.GetFilter());
+    CPPUNIT_ASSERT(&lConstLogger.GetIndenter()  == &lLogger.GetIndenter());
+    CPPUNIT_ASSERT(&lConstLogger.GetFormatter() == &lLogger.GetFormatter());
+    CPPUNIT_ASSERT(&lConstLogger.GetWriter()    == &lLogger.GetWriter());
+    CPPUNIT_ASSERT(&lConstLogger.GetLogger()    == &lLogger.GetLogger());
+}
+
+void
+TestLogStaticLogger :: TestWrite(void)
+{
+    TestLevelLogger lLogger(2,
+                            Log::Indenter::String::Flags::kEvery,
+                            Log::Formatter::Plain(),
+                            TestLogWriterCollector());
+    const std::vector<std::string> & lMessages = lLogger.GetWriter().mMessages;
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(0));
+    CPPUNIT_ASSERT(lLogger.IsEnabled(2));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(3));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(UINT_MAX));
+
+    Log(lLogger);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), lMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("Literal at the default level.\n"), lMessages[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("Typed 1 at the default level.\n"), lMessages[1]);
+    CPPUNIT_ASSERT_EQUAL(std::string("Typed 2 at level 1.\n"), lMessages[2]);
+    CPPUNIT_ASSERT_EQUAL(std::string("\tTyped 3 at level 2 and indent 1.\n"), lMessages[3]);
+    CPPUNIT_ASSERT_EQUAL(std::string("Listed 4 at the default level.\n"), lMessages[4]);
+
+    // Raise the level such that every message passes.
+
+    lLogger.GetWriter().mMessages.clear();
+    lLogger.GetWriter().mLevels.clear();
+
+    lLogger.GetFilter().SetLevel(UINT_MAX);
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(UINT_MAX));
+
+    lLogger.Write(1, 3, "Multi-line\nat level %d and indent %d.\n", 3, 1);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("\tMulti-line\n\tat level 3 and indent 1.\n"), lMessages[0]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(3), lLogger.GetWriter().mLevels[0]);
+}
+
+void
+TestLogStaticLogger :: TestRuntimeParity(void)
+{
+    Log::Filter::Level      lLevelFilter(3);
+    Log::Indenter::Tab      lTabIndenter(Log::Indenter::String::Flags::kEvery);
+    Log::Formatter::Plain   lPlainFormatter;
+    TestLogWriterCollector  lCollector;
+    Log::Logger             lRuntimeLogger(lLevelFilter,
+                                           lTabIndenter,
+                                           lPlainFormatter,
+                                           lCollector);
+    TestLevelLogger         lStaticLogger(3,
+                                          Log::Indenter::String::Flags::kEvery,
+                                          Log::Formatter::Plain(),
+                                          TestLogWriterCollector());
+
+    // The static logger, and its runtime view, must write exactly
+    // what an equivalent runtime logger does.
+
+    Log(lRuntimeLogger);
+    Log(lStaticLogger);
+
+    CPPUNIT_ASSERT(!lCollector.mMessages.empty());
+    CPPUNIT_ASSERT(lCollector.mMessages == lStaticLogger.GetWriter().mMessages);
+    CPPUNIT_ASSERT(lCollector.mLevels   == lStaticLogger.GetWriter().mLevels);
+
+    lStaticLogger.GetWriter().mMessages.clear();
+    lStaticLogger.GetWriter().mLevels.clear();
+
+    Log(lStaticLogger.GetLogger());
+
+    CPPUNIT_ASSERT(lCollector.mMessages == lStaticLogger.GetWriter().mMessages);
+    CPPUNIT_ASSERT(lCollector.mLevels   == lStaticLogger.GetWriter().mLevels);
+}
+
+void
+TestLogStaticLogger :: TestAlways(void)
+{
+    TestAlwaysLogger lLogger;
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(0));
+    CPPUNIT_ASSERT(lLogger.IsEnabled(UINT_MAX));
+
+    Log(lLogger);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(7), lLogger.GetWriter().mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("Multi-line\nat level 3 and indent 1.\n"), lLogger.GetWriter().mMessages[4]);
+}
+
+void
+TestLogStaticLogger :: TestNever(void)
+{
+    TestNeverLogger lLogger;
+
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(0));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(UINT_MAX));
+
+    Log(lLogger);
+    Log(lLogger.GetLogger());
+
+    CPPUNIT_ASSERT(lLogger.GetWriter().mMessages.empty());
+}
+
+void
+TestLogStaticLogger :: TestStaticChains(void)
+{
+    TestChainLogger lLogger;
+
+    lLogger.GetFilter().Link<1>().SetLevel(1);
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(1));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(2));
+
+    lLogger.Write(0, "%s to both links.\n", "Written");
+    lLogger.Write(2, "%s by level.\n", "Rejected");
+
+    lLogger.GetFilter().Link<0>().SetQuiet(true);
+
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(0));
+
+    lLogger.Write(0, "%s by quiet.\n", "Rejected");
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lLogger.GetWriter().Link<0>().mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lLogger.GetWriter().Link<1>().mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("Written to both links.\n"), lLogger.GetWriter().Link<0>().mMessages[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("Written to both links.\n"), lLogger.GetWriter().Link<1>().mMessages[0]);
+}
+
+void
+TestLogStaticLogger :: TestRuntimeStage(void)
+{
+    Log::StaticLogger<Log::Filter::Chain,
+                      Log::Indenter::None,
+                      Log::Formatter::Plain,
+                      TestLogWriterCollector> lLogger;
+    Log::Filter::Level lLevelFilter(1);
+
+    // An empty runtime chain rejects everything.
+
+    lLogger.Write(0, "%s by the empty chain.\n", "Rejected");
+
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(0));
+
+    lLogger.GetFilter().Push(lLevelFilter);
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(1));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(2));
+
+    lLogger.Write(1, "%s by the chain.\n", "Passed");
+    lLogger.Write(2, "%s by the chain.\n", "Rejected");
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lLogger.GetWriter().mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("Passed by the chain.\n"), lLogger.GetWriter().mMessages[0]);
+}
+
+void
+TestLogStaticLogger :: TestWriterLevels(void)
+{
+    Log::StaticLogger<Log::Filter::Always,
+                      Log::Indenter::None,
+                      Log::Formatter::Plain,
+                      Log::Writer::Chain> lLogger;
+    TestLogWriterCollector lCollectorWriter;
+
+    // An empty writer chain writes at no level, so the logger is
+    // enabled at none, even though its filter allows everything.
+
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(0));
+
+    lLogger.GetWriter().Push(lCollectorWriter, 0, 2);
+
+    CPPUNIT_ASSERT(lLogger.IsEnabled(0));
+    CPPUNIT_ASSERT(lLogger.IsEnabled(2));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(3));
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(UINT_MAX));
+
+    // Changing the levels of a link is seen at once.
+
+    lLogger.GetWriter().SetLevels(0, 3, UINT_MAX);
+
+    CPPUNIT_ASSERT(!lLogger.IsEnabled(2));
+    CPPUNIT_ASSERT(lLogger.IsEnabled(3));
+    CPPUNIT_ASSERT(lLogger.IsEnabled(UINT_MAX));
+
+    lLogger.Write(2, "%s by the writer.\n", "Rejected");
+    lLogger.Write(3, "%s by the writer.\n", "Written");
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lLogger.GetWriter().Link<TestLogWriterCollector>(0)->mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("Written by the writer.\n"), lLogger.GetWriter().Link<TestLogWriterCollector>(0)->mMessages[0]);
+}
+
+void
+TestLogStaticLogger :: TestReentrancy(void)
+{
+    Log::StaticLogger<Log::Filter::Always,
+                      Log::Indenter::None,
+                      Log::Formatter::Plain,
+                      TestLogWriterReentrant> lLogger;
+
+    lLogger.GetWriter().mLogger = &lLogger.GetLogger();
+
+    lLogger.Write(2, "Outer at level %u.\n", 2U);
+
+    CPPUNIT_ASSERT(lLogger.GetWriter().mIntact);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), lLogger.GetWriter().mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("Nested at level 0.\n"), lLogger.GetWriter().mMessages[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("Nested at level 1.\n"), lLogger.GetWriter().mMessages[1]);
+    CPPUNIT_ASSERT_EQUAL(std::string("Outer at level 2.\n"), lLogger.GetWriter().mMessages[2]);
+}
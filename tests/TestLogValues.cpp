@@ -0,0 +1,329 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Values.
+ */
+
+#include <LogUtilities/LogValues.hpp>
+
+#include <string>
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <wchar.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+class TestLogValues :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogValues);
+    CPPUNIT_TEST(TestTypes);
+    CPPUNIT_TEST(TestIntegers);
+    CPPUNIT_TEST(TestFlags);
+    CPPUNIT_TEST(TestFloatingPoint);
+    CPPUNIT_TEST(TestStrings);
+    CPPUNIT_TEST(TestPointers);
+    CPPUNIT_TEST(TestStars);
+    CPPUNIT_TEST(TestPositional);
+    CPPUNIT_TEST(TestError);
+    CPPUNIT_TEST(TestMismatch);
+    CPPUNIT_TEST(TestLiteral);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestTypes(void);
+    void TestIntegers(void);
+    void TestFlags(void);
+    void TestFloatingPoint(void);
+    void TestStrings(void);
+    void TestPointers(void);
+    void TestStars(void);
+    void TestPositional(void);
+    void TestError(void);
+    void TestMismatch(void);
+    void TestLiteral(void);
+
+private:
+    template <typename... Args>
+    static std::string Render(const char * inFormat, const Args &... inArguments);
+    template <typename... Args>
+    static void Check(const char * inFormat, const Args &... inArguments);
+    static std::string Expect(const char * inFormat, ...);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogValues);
+
+template <typename... Args>
+std::string
+TestLogValues :: Render(const char * inFormat, const Args &... inArguments)
+{
+    const Log::Value lValues[sizeof...(Args) + 1] = { Log::Value(inArguments)..., Log::Value(nullptr) };
+    std::string      lActual;
+
+    Log::Values(lValues, sizeof...(Args)).Render(lActual, inFormat);
+
+    return (lActual);
+}
+
+// Render the typed arguments and check that the result matches
+// output conversion of the same arguments with vsnprintf.
+
+template <typename... Args>
+void
+TestLogValues :: Check(const char * inFormat, const Args &... inArguments)
+{
+    CPPUNIT_ASSERT_EQUAL(Expect(inFormat, inArguments...), Render(inFormat, inArguments...));
+}
+
+std::string
+TestLogValues :: Expect(const char * inFormat, ...)
+{
+    char    lExpected[512];
+    va_list lList;
+
+    va_start(lList, inFormat);
+    vsnprintf(lExpected, sizeof (lExpected), inFormat, lList);
+    va_end(lList);
+
+    return (std::string(lExpected));
+}
+
+void
+TestLogValues :: TestTypes(void)
+{
+    enum Color { kRed = 3 };
+    intmax_t      lInteger;
+    long double   lFloat;
+    const void *  lPointer;
+    const char *  lString;
+
+    // Test that each argument is captured with its type.
+
+    CPPUNIT_ASSERT(Log::Value('c').GetType()                 == Log::Value::Type::kSigned);
+    CPPUNIT_ASSERT(Log::Value(-1L).GetType()                 == Log::Value::Type::kSigned);
+    CPPUNIT_ASSERT(Log::Value(1U).GetType()                  == Log::Value::Type::kUnsigned);
+    CPPUNIT_ASSERT(Log::Value(true).GetType()                == Log::Value::Type::kUnsigned);
+    CPPUNIT_ASSERT(Log::Value(kRed).GetType()                == Log::Value::Type::kUnsigned ||
+                   Log::Value(kRed).GetType()                == Log::Value::Type::kSigned);
+    CPPUNIT_ASSERT(Log::Value(1.5f).GetType()                == Log::Value::Type::kDouble);
+    CPPUNIT_ASSERT(Log::Value(1.5L).GetType()                == Log::Value::Type::kLongDouble);
+    CPPUNIT_ASSERT(Log::Value(&lInteger).GetType()           == Log::Value::Type::kPointer);
+    CPPUNIT_ASSERT(Log::Value(nullptr).GetType()             == Log::Value::Type::kPointer);
+    CPPUNIT_ASSERT(Log::Value("string").GetType()            == Log::Value::Type::kString);
+    CPPUNIT_ASSERT(Log::Value(L"wide").GetType()             == Log::Value::Type::kWideString);
+
+    // Test the conversions between kinds that printf itself allows.
+
+    CPPUNIT_ASSERT(Log::Value(kRed).GetInteger(lInteger));
+    CPPUNIT_ASSERT_EQUAL(static_cast<intmax_t>(3), lInteger);
+
+    CPPUNIT_ASSERT(Log::Value(7).GetFloat(lFloat));
+    CPPUNIT_ASSERT(lFloat == 7.0L);
+
+    CPPUNIT_ASSERT(Log::Value("string").GetPointer(lPointer));
+    CPPUNIT_ASSERT(Log::Value(nullptr).GetString(lString));
+    CPPUNIT_ASSERT(lString == NULL);
+
+    CPPUNIT_ASSERT(!Log::Value(7).GetString(lString));
+    CPPUNIT_ASSERT(!Log::Value(1.5).GetInteger(lInteger));
+    CPPUNIT_ASSERT(!Log::Value("string").GetInteger(lInteger));
+    CPPUNIT_ASSERT(!Log::Value(&lInteger).GetString(lString));
+}
+
+void
+TestLogValues :: TestIntegers(void)
+{
+    CPPUNIT_ASSERT_EQUAL(std::string("No directives at all"), Render("No directives at all"));
+
+    Check("%% literal %d%%", 50);
+    Check("%d %i %u %x %X %o", -1, 42, 3000000000U, 0xbeef, 0xcafe, 0755);
+    Check("%d %d %u", 0, INT32_MIN, UINT32_MAX);
+    Check("%hhd %hhu %hd %hu", 300, 300, 70000, 70000);
+    Check("%ld %lu %lx", -1234567890L, 4000000000UL, 0xdeadbeefUL);
+    Check("%lld %llu", -9000000000000LL, 18000000000000000000ULL);
+    Check("%jd %jd %ju", INTMAX_MIN, INTMAX_MAX, UINTMAX_MAX);
+    Check("%jd %zu %zd %td", static_cast<intmax_t>(-7), sizeof (long), static_cast<ssize_t>(-3), static_cast<ptrdiff_t>(-9));
+    Check("%c%c%c", 'a', 'b', 'c');
+
+    // Test that narrower arguments are promoted as they would be
+    // for printf.
+
+    Check("%d %d %u", static_cast<signed char>(-5), static_cast<short>(-300), static_cast<unsigned short>(65535));
+}
+
+void
+TestLogValues :: TestFlags(void)
+{
+    Check("[%5d] [%-5d] [%05d] [%+d] [% d] [%+05d] [% 05d]", 42, 42, 42, 42, 42, 42, 42);
+    Check("[%5d] [%-5d] [%05d] [%+d] [% d] [%+05d] [% 05d]", -42, -42, -42, -42, -42, -42, -42);
+    Check("[%.3d] [%.0d] [%5.0d] [%08.3d] [%-8.3d] [%+.3d]", 7, 0, 0, 7, -7, 7);
+    Check("[%#x] [%#X] [%#o] [%#x] [%#o] [%#.0o] [%#.3o]", 255, 255, 8, 0, 0, 0, 8);
+    Check("[%#08x] [%-#8x] [%08x] [%#5o] [%.0x] [%.0u]", 255, 255, 255, 8, 0, 0);
+    Check("[%-3c] [%3c] [%3s]", 'x', 'y', "");
+    Check("[%'d] [%'u]", 1234567, 7654321U);
+}
+
+void
+TestLogValues :: TestFloatingPoint(void)
+{
+    Check("%f %e %g %a", 3.14159, 2.5e10, 0.0001, 1.0);
+    Check("%F %E %G %A", 3.14159, 2.5e10, 0.0001, 1.0);
+    Check("[%10.3f] [%-10.2e] [%+g] [%010.2f]", 3.14159, 2.5e10, 1.5, -2.5);
+    Check("%Lf %Lg", 1.25L, 6.5e-3L);
+    Check("%d %f %d %f", 1, 2.0, 3, 4.0);
+
+    // Test that a float is promoted as it would be for printf.
+
+    Check("%f", 0.5f);
+}
+
+void
+TestLogValues :: TestStrings(void)
+{
+    const char    lBuffer[] = { 'a', 'b', 'c', 'd' };
+    const wchar_t lWide[]   = L"wide";
+    char          lMutable[] = "mutable";
+
+    Check("%s", "string");
+    Check("[%10s] [%-10s] [%.3s] [%10.3s]", "right", "left", "truncated", "truncated");
+    Check("%s %d %s", "one", 2, "three");
+    Check("%s", "");
+    Check("%s", lMutable);
+    Check("%ls %S", lWide, lWide);
+    Check("%lc", static_cast<wint_t>(L'w'));
+
+    // Test that a precision bounds a string that is not
+    // null-terminated.
+
+    Check("%.*s", static_cast<int>(sizeof (lBuffer)), &lBuffer[0]);
+    Check("%.2s", &lBuffer[0]);
+
+    // Test that a null string is rendered the same as printf renders
+    // it.
+
+    {
+        const char * volatile lNull = NULL;
+
+        CPPUNIT_ASSERT_EQUAL(Expect("[%s] [%10s]", lNull, lNull), Render("[%s] [%10s]", lNull, lNull));
+    }
+}
+
+void
+TestLogValues :: TestPointers(void)
+{
+    int lObject;
+
+    Check("%p", static_cast<void *>(&lObject));
+    Check("[%20p] [%-20p]", static_cast<void *>(&lObject), static_cast<void *>(&lObject));
+    Check("%p", reinterpret_cast<void *>(0x1234));
+    Check("%p", static_cast<void *>(NULL));
+
+    // Test that a pointer to any object type may be passed.
+
+    CPPUNIT_ASSERT_EQUAL(Expect("%p", static_cast<const void *>(&lObject)), Render("%p", &lObject));
+}
+
+void
+TestLogValues :: TestStars(void)
+{
+    Check("[%*d] [%-*d]", 6, 42, 6, 42);
+    Check("[%.*f] [%*.*f]", 2, 3.14159, 10, 4, 2.71828);
+    Check("[%*s] [%.*s]", 8, "star", 2, "star");
+    Check("[%*d] [%.*d]", -6, 42, -1, 42);
+}
+
+void
+TestLogValues :: TestPositional(void)
+{
+    Check("%2$s %1$d", 1, "two");
+    Check("%1$d %1$d %2$x", 10, 255);
+    Check("[%1$*2$d]", 42, 6);
+}
+
+void
+TestLogValues :: TestError(void)
+{
+    std::string lActual;
+
+    errno = ENOENT;
+
+    {
+        const Log::Value  lValue(0);
+        const Log::Values lValues(&lValue, 0);
+
+        // Test that %m reflects errno as it was when the arguments
+        // were made, not as it is when they are rendered.
+
+        errno = 0;
+
+        lValues.Render(lActual, "[%m] [%.4m]");
+    }
+
+    CPPUNIT_ASSERT_EQUAL("[" + std::string(strerror(ENOENT)) + "] [" + std::string(strerror(ENOENT), 4) + "]", lActual);
+}
+
+void
+TestLogValues :: TestMismatch(void)
+{
+    // Test that a directive whose argument is of the wrong kind is
+    // reproduced verbatim rather than invoking undefined behavior.
+
+    CPPUNIT_ASSERT_EQUAL(std::string("[%s]"),       Render("[%s]", 5));
+    CPPUNIT_ASSERT_EQUAL(std::string("[%-8d] 5"),   Render("[%-8d] %d", "string", 5));
+    CPPUNIT_ASSERT_EQUAL(std::string("[%d]"),       Render("[%d]", 2.5));
+
+    // Test that a directive with no argument is reproduced verbatim.
+
+    CPPUNIT_ASSERT_EQUAL(std::string("1 %d"),       Render("%d %d", 1));
+    CPPUNIT_ASSERT_EQUAL(std::string("[%3$d]"),    Render("[%3$d]", 1, 2));
+    CPPUNIT_ASSERT_EQUAL(std::string("[%*d]"),      Render("[%*d]", 1));
+
+    // Test that surplus arguments and a trailing '%' are harmless.
+
+    CPPUNIT_ASSERT_EQUAL(std::string("1"),          Render("%d", 1, 2, 3));
+    CPPUNIT_ASSERT_EQUAL(std::string("100%"),       Render("100%"));
+}
+
+void
+TestLogValues :: TestLiteral(void)
+{
+    const Log::Values lLiteral;
+    std::string       lActual;
+
+    // Test that a literal view appends its format as is.
+
+    CPPUNIT_ASSERT(lLiteral.IsLiteral());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lLiteral.Size());
+
+    lLiteral.Render(lActual, "No directives at all");
+    CPPUNIT_ASSERT_EQUAL(std::string("No directives at all"), lActual);
+
+    lLiteral.Render(lActual, NULL);
+    CPPUNIT_ASSERT_EQUAL(std::string("No directives at all"), lActual);
+}
@@ -0,0 +1,482 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Writer::Asynchronous.
+ */
+
+#include <LogUtilities/LogWriterAsynchronous.hpp>
+#include <LogUtilities/LogWriterChain.hpp>
+#include <LogUtilities/LogWriterDescriptor.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "TestLogUtilitiesBasis.hpp"
+
+
+using namespace Nuovations;
+
+
+/**
+ *  A writer that records the messages written to it and, while
+ *  closed, stalls the thread writing to it.
+ */
+class TestLogWriterRecorder :
+    public Log::Writer::Base
+{
+public:
+    TestLogWriterRecorder(void) :
+        mOpen(true),
+        mWriting(false)
+    {
+        return;
+    }
+
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        std::unique_lock<std::mutex> lLock(mMutex);
+
+        mWriting = true;
+        mChanged.notify_all();
+
+        mChanged.wait(lLock, [this](void) { return (mOpen); });
+
+        mLevels.push_back(inLevel);
+        mMessages.push_back((inMessage != NULL) ? inMessage : "(null)");
+
+        mWriting = false;
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    void Close(void)
+    {
+        std::lock_guard<std::mutex> lLock(mMutex);
+
+        mOpen = false;
+    }
+
+    void Open(void)
+    {
+        std::lock_guard<std::mutex> lLock(mMutex);
+
+        mOpen = true;
+        mChanged.notify_all();
+    }
+
+    void WaitForWriting(void)
+    {
+        std::unique_lock<std::mutex> lLock(mMutex);
+
+        mChanged.wait(lLock, [this](void) { return (mWriting); });
+    }
+
+    std::vector<Log::Level>  mLevels;
+    std::vector<std::string> mMessages;
+
+private:
+    bool                     mOpen;
+    bool                     mWriting;
+    std::mutex               mMutex;
+    std::condition_variable  mChanged;
+};
+
+class TestLogWriterAsynchronous :
+    public TestLogUtilitiesBasis
+{
+    CPPUNIT_TEST_SUITE(TestLogWriterAsynchronous);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestFlush);
+    CPPUNIT_TEST(TestStop);
+    CPPUNIT_TEST(TestConcurrentStop);
+    CPPUNIT_TEST(TestOverflowDrop);
+    CPPUNIT_TEST(TestOverflowBlock);
+    CPPUNIT_TEST(TestStallTimeout);
+    CPPUNIT_TEST(TestWriterChain);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestConstruction(void);
+    void TestFlush(void);
+    void TestStop(void);
+    void TestConcurrentStop(void);
+    void TestOverflowDrop(void);
+    void TestOverflowBlock(void);
+    void TestStallTimeout(void);
+    void TestWriterChain(void);
+
+private:
+    int  CreateTemporaryFile(char * aPathBuffer);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogWriterAsynchronous);
+
+void
+TestLogWriterAsynchronous :: TestConstruction(void)
+{
+    TestLogWriterRecorder lRecorder;
+
+    {
+        Log::Writer::Asynchronous lWriter(lRecorder);
+
+        CPPUNIT_ASSERT_EQUAL(Log::Writer::Asynchronous::kCapacityDefault, lWriter.GetCapacity());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lWriter.GetDepth());
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lWriter.GetWritten());
+        CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lWriter.GetDropped());
+    }
+
+    {
+        Log::Writer::Asynchronous lWriter(lRecorder, 100);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(128), lWriter.GetCapacity());
+    }
+
+    {
+        Log::Writer::Asynchronous lWriter(lRecorder, 8, Log::Writer::Asynchronous::Overflow::kBlock);
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(8), lWriter.GetCapacity());
+    }
+
+    CPPUNIT_ASSERT(lRecorder.mMessages.empty());
+}
+
+void
+TestLogWriterAsynchronous :: TestFlush(void)
+{
+    TestLogWriterRecorder     lRecorder;
+    Log::Writer::Asynchronous lWriter(lRecorder, 16);
+
+    // Test that all messages queued before a flush have been written,
+    // in order and at their level, once the flush returns.
+
+    for (int lIteration = 0; lIteration < 100; lIteration++) {
+        lWriter.Write(static_cast<Log::Level>(lIteration), std::to_string(lIteration).c_str());
+
+        if ((lIteration % 10) == 9) {
+            lWriter.Flush();
+
+            CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(lIteration + 1), lRecorder.mMessages.size());
+        }
+    }
+
+    lWriter.Write(NULL);
+    lWriter.Write("Asynchronous writer w/o level.");
+    lWriter.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(102), lRecorder.mMessages.size());
+
+    for (size_t lIteration = 0; lIteration < 100; lIteration++) {
+        CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(lIteration), lRecorder.mLevels[lIteration]);
+        CPPUNIT_ASSERT_EQUAL(std::to_string(lIteration), lRecorder.mMessages[lIteration]);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(std::string("(null)"), lRecorder.mMessages[100]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<Log::Level>(0), lRecorder.mLevels[101]);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lWriter.GetDepth());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(102), lWriter.GetWritten());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lWriter.GetDropped());
+
+    // Test that flushing an idle writer returns.
+
+    lWriter.Flush();
+}
+
+void
+TestLogWriterAsynchronous :: TestStop(void)
+{
+    TestLogWriterRecorder lRecorder;
+
+    {
+        Log::Writer::Asynchronous lWriter(lRecorder, 64, Log::Writer::Asynchronous::Overflow::kBlock);
+
+        for (int lIteration = 0; lIteration < 1000; lIteration++) {
+            lWriter.Write("Stopping.");
+        }
+
+        // Test that stopping drains everything queued.
+
+        lWriter.Stop();
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1000), lRecorder.mMessages.size());
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lWriter.GetDepth());
+
+        // Test that writes after stopping occur synchronously.
+
+        lWriter.Write(1, "Stopped.");
+
+        CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1001), lRecorder.mMessages.size());
+        CPPUNIT_ASSERT_EQUAL(std::string("Stopped."), lRecorder.mMessages.back());
+
+        // Test that stopping and flushing a stopped writer are benign.
+
+        lWriter.Stop();
+        lWriter.Flush();
+    }
+
+    // Test that destruction drains everything queued.
+
+    {
+        Log::Writer::Asynchronous lWriter(lRecorder, 2048);
+
+        for (int lIteration = 0; lIteration < 1000; lIteration++) {
+            lWriter.Write("Destroying.");
+        }
+    }
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2001), lRecorder.mMessages.size());
+}
+
+void
+TestLogWriterAsynchronous :: TestConcurrentStop(void)
+{
+    static const size_t       kWriters  = 4;
+    static const size_t       kStoppers = 2;
+    static const size_t       kMessages = 2000;
+    TestLogWriterRecorder     lRecorder;
+    Log::Writer::Asynchronous lWriter(lRecorder, 64, Log::Writer::Asynchronous::Overflow::kBlock);
+    std::vector<std::thread>  lThreads;
+
+    for (size_t lThread = 0; lThread < kWriters; lThread++) {
+        lThreads.push_back(std::thread([&lWriter](void) {
+            for (size_t lMessage = 0; lMessage < kMessages; lMessage++) {
+                lWriter.Write("Racing.");
+            }
+        }));
+    }
+
+    for (size_t lThread = 0; lThread < kStoppers; lThread++) {
+        lThreads.push_back(std::thread([&lWriter](void) {
+            lWriter.Stop();
+        }));
+    }
+
+    for (size_t lThread = 0; lThread < lThreads.size(); lThread++) {
+        lThreads[lThread].join();
+    }
+
+    // Test that, with the writer stopped from several threads at
+    // once while others write to it, every message is written by the
+    // time the writes return, none being left queued.
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lWriter.GetDepth());
+    CPPUNIT_ASSERT_EQUAL(kWriters * kMessages, lRecorder.mMessages.size());
+}
+
+void
+TestLogWriterAsynchronous :: TestOverflowDrop(void)
+{
+    TestLogWriterRecorder     lRecorder;
+    Log::Writer::Asynchronous lWriter(lRecorder, 4, Log::Writer::Asynchronous::Overflow::kDrop);
+    size_t                    lDepth;
+    uint64_t                  lDropped;
+
+    // Stall the backend thread on the first message such that the
+    // queue fills behind it. The stalled message continues to occupy
+    // its slot until it has been written.
+
+    lRecorder.Close();
+
+    lWriter.Write("Stalled.");
+
+    lRecorder.WaitForWriting();
+
+    for (int lIteration = 0; lIteration < 10; lIteration++) {
+        lWriter.Write("Overflowing.");
+    }
+
+    lDepth = lWriter.GetDepth();
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), lDepth);
+
+    lDropped = lWriter.GetDropped();
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(7), lDropped);
+
+    // Test that the messages that made it onto the queue are written
+    // once the backend thread resumes.
+
+    lRecorder.Open();
+
+    lWriter.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), lRecorder.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(4), lWriter.GetWritten());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(7), lWriter.GetDropped());
+}
+
+void
+TestLogWriterAsynchronous :: TestOverflowBlock(void)
+{
+    static const size_t       kWriters  = 4;
+    static const size_t       kMessages = 5000;
+    TestLogWriterRecorder     lRecorder;
+    Log::Writer::Asynchronous lWriter(lRecorder, 8, Log::Writer::Asynchronous::Overflow::kBlock);
+    std::vector<std::thread>  lWriters;
+
+    // Test that, with several threads writing into a small queue, no
+    // message is dropped.
+
+    for (size_t lThread = 0; lThread < kWriters; lThread++) {
+        lWriters.push_back(std::thread([&lWriter, lThread](void) {
+            for (size_t lMessage = 0; lMessage < kMessages; lMessage++) {
+                lWriter.Write(static_cast<Log::Level>(lThread), "Blocking.");
+            }
+        }));
+    }
+
+    for (size_t lThread = 0; lThread < kWriters; lThread++) {
+        lWriters[lThread].join();
+    }
+
+    lWriter.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(kWriters * kMessages, lRecorder.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(kWriters * kMessages), lWriter.GetWritten());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lWriter.GetDropped());
+}
+
+void
+TestLogWriterAsynchronous :: TestStallTimeout(void)
+{
+    static const uint32_t                 kStallTimeout = 20;
+    static const uint64_t                 kStallTicks   = kStallTimeout * 1000000ULL;
+    TestLogWriterRecorder                 lRecorder;
+    Log::Writer::Asynchronous             lWriter(lRecorder, 4, Log::Writer::Asynchronous::Overflow::kBlock, kStallTimeout);
+    std::chrono::steady_clock::time_point lStart;
+    std::chrono::milliseconds             lElapsed;
+
+    CPPUNIT_ASSERT(!lWriter.IsStalled());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lWriter.GetMeanLatency());
+
+    // Stall the backend thread on the first message for longer than
+    // the stall timeout.
+
+    lRecorder.Close();
+
+    lWriter.Write("Stalled.");
+
+    lRecorder.WaitForWriting();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(kStallTimeout * 2));
+
+    CPPUNIT_ASSERT(lWriter.IsStalled());
+
+    // Test that, once stalled, writes to a full queue are dropped
+    // rather than each waiting out the timeout.
+
+    lStart = std::chrono::steady_clock::now();
+
+    for (int lIteration = 0; lIteration < 100; lIteration++) {
+        lWriter.Write("Overflowing.");
+    }
+
+    lElapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - lStart);
+
+    CPPUNIT_ASSERT(lElapsed.count() < (kStallTimeout * 25));
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(97), lWriter.GetDropped());
+
+    // Test that the stalled message's latency is accounted for once
+    // it has been written.
+
+    lRecorder.Open();
+
+    lWriter.Flush();
+
+    CPPUNIT_ASSERT(!lWriter.IsStalled());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(4), lRecorder.mMessages.size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(4), lWriter.GetWritten());
+    CPPUNIT_ASSERT(lWriter.GetMaxLatency() >= kStallTicks);
+    CPPUNIT_ASSERT(lWriter.GetMeanLatency() > 0);
+    CPPUNIT_ASSERT(lWriter.GetMeanLatency() <= lWriter.GetMaxLatency());
+}
+
+void
+TestLogWriterAsynchronous :: TestWriterChain(void)
+{
+    const std::string kExpected =
+        "Asynchronous writer w/o level.\n"
+        "Asynchronous writer w/ level 0.\n"
+        "Asynchronous writer w/ level UINT_MAX.\n";
+    char                    lPathBufferA[PATH_MAX];
+    char                    lPathBufferB[PATH_MAX];
+    int                     lDescriptorA;
+    int                     lDescriptorB;
+
+    lDescriptorA = CreateTemporaryFile(lPathBufferA);
+    CPPUNIT_ASSERT(lDescriptorA > 0);
+
+    lDescriptorB = CreateTemporaryFile(lPathBufferB);
+    CPPUNIT_ASSERT(lDescriptorB > 0);
+
+    {
+        Log::Writer::Descriptor   lDescriptorWriterA(lDescriptorA);
+        Log::Writer::Descriptor   lDescriptorWriterB(lDescriptorB);
+        Log::Writer::Chain        lChainWriter;
+
+        lChainWriter.Push(lDescriptorWriterA);
+        lChainWriter.Push(lDescriptorWriterB);
+
+        {
+            Log::Writer::Asynchronous lWriter(lChainWriter);
+
+            lWriter.Write(NULL);
+            lWriter.Write(0, NULL);
+            lWriter.Write(UINT_MAX, NULL);
+
+            lWriter.Write("");
+            lWriter.Write(0, "");
+            lWriter.Write(UINT_MAX, "");
+
+            lWriter.Write("Asynchronous writer w/o level.\n");
+            lWriter.Write(0, "Asynchronous writer w/ level 0.\n");
+            lWriter.Write(UINT_MAX, "Asynchronous writer w/ level UINT_MAX.\n");
+        }
+    }
+
+    close(lDescriptorA);
+    close(lDescriptorB);
+
+    CheckResults(lPathBufferA, kExpected);
+    CheckResults(lPathBufferB, kExpected);
+}
+
+int
+TestLogWriterAsynchronous :: CreateTemporaryFile(char * aPathBuffer)
+{
+    static const char * const kTestName = "writer-asynchronous";
+    int                       lStatus;
+
+    lStatus = CreateTemporaryFileFromName(kTestName, aPathBuffer);
+
+    return (lStatus);
+}
@@ -23,9 +23,17 @@
 #include <LogUtilities/LogWriterChain.hpp>
 #include <LogUtilities/LogWriterDescriptor.hpp>
 
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
 #include <fcntl.h>
 #include <limits.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <unistd.h>
 
 #include <sys/stat.h>
@@ -38,6 +46,91 @@
 
 using namespace Nuovations;
 
+/**
+ *  A writer that records the messages written to it and, while
+ *  closed, stalls the thread writing to it. Copies share the same
+ *  record, such that the writer may be pushed onto a chain.
+ */
+class TestLogWriterValve :
+    public Log::Writer::Base
+{
+public:
+    TestLogWriterValve(void) :
+        mState(new State())
+    {
+        return;
+    }
+
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        std::unique_lock<std::mutex> lLock(mState->mMutex);
+
+        (void)inLevel;
+
+        mState->mWriting = true;
+        mState->mChanged.notify_all();
+
+        mState->mChanged.wait(lLock, [this](void) { return (mState->mOpen); });
+
+        mState->mMessages.push_back(inMessage);
+
+        mState->mWriting = false;
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    void Close(void)
+    {
+        std::lock_guard<std::mutex> lLock(mState->mMutex);
+
+        mState->mOpen = false;
+    }
+
+    void Open(void)
+    {
+        std::lock_guard<std::mutex> lLock(mState->mMutex);
+
+        mState->mOpen = true;
+        mState->mChanged.notify_all();
+    }
+
+    void WaitForWriting(void)
+    {
+        std::unique_lock<std::mutex> lLock(mState->mMutex);
+
+        mState->mChanged.wait(lLock, [this](void) { return (mState->mWriting); });
+    }
+
+    std::vector<std::string> GetMessages(void) const
+    {
+        std::lock_guard<std::mutex> lLock(mState->mMutex);
+
+        return (mState->mMessages);
+    }
+
+private:
+    struct State
+    {
+        State(void) :
+            mOpen(true),
+            mWriting(false)
+        {
+            return;
+        }
+
+        bool                     mOpen;
+        bool                     mWriting;
+        std::vector<std::string> mMessages;
+        std::mutex               mMutex;
+        std::condition_variable  mChanged;
+    };
+
+    std::shared_ptr<State> mState;
+};
+
 
 class TestLogWriterChain :
     public TestLogUtilitiesBasis
@@ -47,6 +140,10 @@ class TestLogWriterChain :
     CPPUNIT_TEST(TestCopyConstruction);
     CPPUNIT_TEST(TestObservation);
     CPPUNIT_TEST(TestWriterChain);
+    CPPUNIT_TEST(TestFanOut);
+    CPPUNIT_TEST(TestLevels);
+    CPPUNIT_TEST(TestAssignment);
+    CPPUNIT_TEST(TestFailedPush);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -54,6 +151,10 @@ public:
     void TestCopyConstruction(void);
     void TestObservation(void);
     void TestWriterChain(void);
+    void TestFanOut(void);
+    void TestLevels(void);
+    void TestAssignment(void);
+    void TestFailedPush(void);
 
 private:
     void TestObservation(const Log::Writer::Chain & inChain);
@@ -213,3 +314,205 @@ TestLogWriterChain :: CreateTemporaryFile(char * aPathBuffer)
 
     return (lStatus);
 }
+
+void
+TestLogWriterChain :: TestFanOut(void)
+{
+    static const size_t      kMessages = 50;
+    TestLogWriterValve       lStalledWriter;
+    TestLogWriterValve       lQueuedWriter;
+    TestLogWriterValve       lDirectWriter;
+    Log::Writer::Chain       lChainWriter;
+    Log::Writer::Chain       lCopiedChain(lChainWriter);
+    std::vector<std::string> lMessages;
+    char                     lBuffer[32];
+    uint64_t                 lDropped;
+
+    lChainWriter.Push(lStalledWriter, 8, Log::Writer::Asynchronous::Overflow::kDrop, 0);
+    lChainWriter.Push(lQueuedWriter, 64, Log::Writer::Asynchronous::Overflow::kBlock, 0);
+    lChainWriter.Push(lDirectWriter);
+
+    CPPUNIT_ASSERT(lChainWriter.GetQueue(0) != NULL);
+    CPPUNIT_ASSERT(lChainWriter.GetQueue(1) != NULL);
+    CPPUNIT_ASSERT(lChainWriter.GetQueue(2) == NULL);
+    CPPUNIT_ASSERT(lChainWriter.GetQueue(3) == NULL);
+    CPPUNIT_ASSERT(lCopiedChain.GetQueue(0) == lChainWriter.GetQueue(0));
+
+    // Stall the first link on its first message.
+
+    lStalledWriter.Close();
+
+    lChainWriter.Write("0\n");
+
+    lStalledWriter.WaitForWriting();
+
+    // Test that writes to the chain neither wait on, nor are lost by,
+    // the other links while the first is stalled.
+
+    for (size_t lMessage = 1; lMessage < kMessages; lMessage++) {
+        snprintf(lBuffer, sizeof (lBuffer), "%zu\n", lMessage);
+
+        lChainWriter.Write(lBuffer);
+    }
+
+    CPPUNIT_ASSERT_EQUAL(kMessages, lDirectWriter.GetMessages().size());
+
+    lChainWriter.GetQueue(1)->Flush();
+
+    lMessages = lQueuedWriter.GetMessages();
+    CPPUNIT_ASSERT_EQUAL(kMessages, lMessages.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("0\n"), lMessages[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("49\n"), lMessages[kMessages - 1]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lChainWriter.GetQueue(1)->GetDropped());
+
+    lDropped = lChainWriter.GetQueue(0)->GetDropped();
+    CPPUNIT_ASSERT(lDropped > 0);
+
+    // Test that the stalled link writes what it queued, in order,
+    // once it resumes.
+
+    lStalledWriter.Open();
+
+    lCopiedChain.Flush();
+
+    lMessages = lStalledWriter.GetMessages();
+    CPPUNIT_ASSERT_EQUAL(kMessages, lMessages.size() + lDropped);
+    CPPUNIT_ASSERT_EQUAL(std::string("0\n"), lMessages[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("1\n"), lMessages[1]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(lMessages.size()), lChainWriter.GetQueue(0)->GetWritten());
+
+    // Test that popping a queued link writes out, and removes, its
+    // queue.
+
+    lChainWriter.Pop();
+    lChainWriter.Pop();
+
+    CPPUNIT_ASSERT(lChainWriter.GetQueue(1) == NULL);
+
+    lChainWriter.Reset();
+
+    CPPUNIT_ASSERT(lChainWriter.GetQueue(0) == NULL);
+}
+
+void
+TestLogWriterChain :: TestLevels(void)
+{
+    TestLogWriterValve lAllWriter;
+    TestLogWriterValve lLowWriter;
+    TestLogWriterValve lHighWriter;
+    Log::Writer::Chain lChainWriter;
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0), lChainWriter.GetLevels());
+
+    lChainWriter.Push(lAllWriter);
+    lChainWriter.Push(lLowWriter, 0, 2);
+    lChainWriter.Push(lHighWriter, 64, Log::Writer::Asynchronous::Overflow::kBlock, 0);
+    lChainWriter.SetLevels(2, 5, 7);
+
+    CPPUNIT_ASSERT_EQUAL(~static_cast<uint64_t>(0), lChainWriter.GetLevels());
+
+    // Test that each link is written to only within its range.
+
+    lChainWriter.Write("0\n");
+    lChainWriter.Write(2, "2\n");
+    lChainWriter.Write(3, "3\n");
+    lChainWriter.Write(6, "6\n");
+    lChainWriter.Write(UINT_MAX, "UINT_MAX\n");
+
+    lChainWriter.Flush();
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), lAllWriter.GetMessages().size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lLowWriter.GetMessages().size());
+    CPPUNIT_ASSERT_EQUAL(std::string("2\n"), lLowWriter.GetMessages()[1]);
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lHighWriter.GetMessages().size());
+    CPPUNIT_ASSERT_EQUAL(std::string("6\n"), lHighWriter.GetMessages()[0]);
+
+    // Test that the chain's levels are the union of the remaining
+    // links' ranges.
+
+    lChainWriter.SetLevels(0, 1, 0);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<uint64_t>(0xE7), lChainWriter.GetLevels());
+
+    lChainWriter.Write(3, "3\n");
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(5), lAllWriter.GetMessages().size());
+}
+
+void
+TestLogWriterChain :: TestAssignment(void)
+{
+    static const size_t kMessages = 16;
+    TestLogWriterValve  lQueuedWriter;
+    Log::Writer::Chain  lChainWriterA;
+    Log::Writer::Chain  lChainWriterB;
+    char                lBuffer[32];
+
+    lChainWriterA.Push(lQueuedWriter, kMessages, Log::Writer::Asynchronous::Overflow::kBlock, 0);
+
+    for (size_t lMessage = 0; lMessage < kMessages; lMessage++) {
+        snprintf(lBuffer, sizeof (lBuffer), "%zu\n", lMessage);
+
+        lChainWriterA.Write(lBuffer);
+    }
+
+    // Test that assigning over the only chain holding a queued link
+    // writes what was queued for the link before the link is
+    // destroyed.
+
+    lChainWriterA = lChainWriterB;
+
+    CPPUNIT_ASSERT(lChainWriterA.Empty());
+    CPPUNIT_ASSERT(lChainWriterA.GetQueue(0) == NULL);
+    CPPUNIT_ASSERT_EQUAL(kMessages, lQueuedWriter.GetMessages().size());
+    CPPUNIT_ASSERT_EQUAL(std::string("15\n"), lQueuedWriter.GetMessages()[kMessages - 1]);
+}
+
+void
+TestLogWriterChain :: TestFailedPush(void)
+{
+    static const size_t kCapacity = (static_cast<size_t>(1) << ((sizeof (size_t) * 8) - 1));
+    TestLogWriterValve  lDirectWriter;
+    TestLogWriterValve  lFailedWriter;
+    TestLogWriterValve  lLowWriter;
+    Log::Writer::Chain  lChainWriter;
+    bool                lThrown = false;
+
+    lChainWriter.Push(lDirectWriter);
+
+    // Test that a link whose queue cannot be created is not left on
+    // the chain without a route. AddressSanitizer aborts, rather than
+    // throws, on an allocation as large as the queue's, so this is
+    // only tested without it.
+
+#if !defined(__SANITIZE_ADDRESS__)
+    try {
+        lChainWriter.Push(lFailedWriter,
+                          kCapacity,
+                          Log::Writer::Asynchronous::Overflow::kDrop,
+                          0);
+    } catch (const std::bad_alloc & lException) {
+        lThrown = true;
+    }
+
+    CPPUNIT_ASSERT(lThrown);
+#else
+    (void)kCapacity;
+    (void)lThrown;
+#endif
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lChainWriter.Size());
+    CPPUNIT_ASSERT(lChainWriter.GetQueue(1) == NULL);
+
+    // Test that links and routes remain in step afterward.
+
+    lChainWriter.Push(lLowWriter, 0, 2);
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), lChainWriter.Size());
+    CPPUNIT_ASSERT_EQUAL(~static_cast<uint64_t>(0), lChainWriter.GetLevels());
+
+    lChainWriter.Write(3, "3\n");
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(1), lDirectWriter.GetMessages().size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lLowWriter.GetMessages().size());
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(0), lFailedWriter.GetMessages().size());
+}
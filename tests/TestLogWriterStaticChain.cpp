@@ -0,0 +1,165 @@
+/*
+ *    Copyright (c) 2026 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a unit test for Log::Writer::StaticChain.
+ */
+
+#include <LogUtilities/LogWriterBase.hpp>
+#include <LogUtilities/LogWriterChain.hpp>
+#include <LogUtilities/LogWriterStaticChain.hpp>
+
+#include <string>
+#include <vector>
+
+#include <limits.h>
+
+#include <cppunit/TestAssert.h>
+#include <cppunit/extensions/HelperMacros.h>
+
+
+using namespace Nuovations;
+
+
+/**
+ *  A writer that records the messages written to it, prefixed with
+ *  its name, to a log it may share with other writers.
+ */
+class TestLogWriterCollector :
+    public Log::Writer::Base
+{
+public:
+    TestLogWriterCollector(std::vector<std::string> * inLog) :
+        mName("anonymous"),
+        mLog(inLog)
+    {
+        return;
+    }
+
+    TestLogWriterCollector(const char * inName, std::vector<std::string> * inLog) :
+        mName(inName),
+        mLog(inLog)
+    {
+        return;
+    }
+
+    void Write(Log::Level inLevel, const char * inMessage) final
+    {
+        mLog->push_back(mName + "/" + std::to_string(inLevel) + ": " + inMessage);
+    }
+
+    void Write(const char * inMessage) final
+    {
+        Write(0, inMessage);
+    }
+
+    std::string                mName;
+    std::vector<std::string> * mLog;
+};
+
+typedef Log::Writer::StaticChain<TestLogWriterCollector,
+                                 TestLogWriterCollector> TestChain;
+
+class TestLogWriterStaticChain :
+    public CppUnit::TestFixture
+{
+    CPPUNIT_TEST_SUITE(TestLogWriterStaticChain);
+    CPPUNIT_TEST(TestConstruction);
+    CPPUNIT_TEST(TestObservation);
+    CPPUNIT_TEST(TestWriterChain);
+    CPPUNIT_TEST(TestRuntimeChain);
+    CPPUNIT_TEST_SUITE_END();
+
+public:
+    void TestConstruction(void);
+    void TestObservation(void);
+    void TestWriterChain(void);
+    void TestRuntimeChain(void);
+};
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TestLogWriterStaticChain);
+
+void
+TestLogWriterStaticChain :: TestConstruction(void)
+{
+    std::vector<std::string> lLog;
+    TestChain                lWriterChainA(&lLog, &lLog);
+    TestChain                lWriterChainB(TestLogWriterCollector("a", &lLog),
+                                           TestLogWriterCollector("b", &lLog));
+
+    CPPUNIT_ASSERT_EQUAL(std::string("anonymous"), lWriterChainA.Link<0>().mName);
+    CPPUNIT_ASSERT_EQUAL(std::string("b"), lWriterChainB.Link<1>().mName);
+}
+
+void
+TestLogWriterStaticChain :: TestObservation(void)
+{
+    std::vector<std::string> lLog;
+    TestChain                lWriterChain(&lLog, &lLog);
+    const TestChain &        lConstWriterChain = lWriterChain;
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(2), TestChain::Size());
+
+    CPPUNIT_ASSERT(&lConstWriterChain.Link<0>() == &lWriterChain.Link<0>());
+    CPPUNIT_ASSERT(&lConstWriterChain.Link<1>() == &lWriterChain.Link<1>());
+    CPPUNIT_ASSERT(&lWriterChain.Link<0>() != &lWriterChain.Link<1>());
+}
+
+void
+TestLogWriterStaticChain :: TestWriterChain(void)
+{
+    std::vector<std::string> lLog;
+    TestChain                lWriterChain(TestLogWriterCollector("a", &lLog),
+                                          TestLogWriterCollector("b", &lLog));
+
+    // Each message is written to every link, in order.
+
+    lWriterChain.Write("Chained writer w/o level.\n");
+    lWriterChain.Write(0, "Chained writer w/ level 0.\n");
+    lWriterChain.Write(UINT_MAX, "Chained writer w/ level UINT_MAX.\n");
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(6), lLog.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("a/0: Chained writer w/o level.\n"), lLog[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("b/0: Chained writer w/o level.\n"), lLog[1]);
+    CPPUNIT_ASSERT_EQUAL(std::string("a/0: Chained writer w/ level 0.\n"), lLog[2]);
+    CPPUNIT_ASSERT_EQUAL(std::string("b/0: Chained writer w/ level 0.\n"), lLog[3]);
+    CPPUNIT_ASSERT_EQUAL(std::string("a/4294967295: Chained writer w/ level UINT_MAX.\n"), lLog[4]);
+    CPPUNIT_ASSERT_EQUAL(std::string("b/4294967295: Chained writer w/ level UINT_MAX.\n"), lLog[5]);
+}
+
+void
+TestLogWriterStaticChain :: TestRuntimeChain(void)
+{
+    std::vector<std::string> lLog;
+    TestChain                lStaticChain(TestLogWriterCollector("a", &lLog),
+                                          TestLogWriterCollector("b", &lLog));
+    TestLogWriterCollector   lCollector("c", &lLog);
+    Log::Writer::Chain       lRuntimeChain;
+
+    // Through its virtual interface, the chain is just another writer.
+
+    lRuntimeChain.Push(lStaticChain);
+    lRuntimeChain.Push(lCollector);
+
+    lRuntimeChain.Write(1, "Runtime chain.\n");
+
+    CPPUNIT_ASSERT_EQUAL(static_cast<size_t>(3), lLog.size());
+    CPPUNIT_ASSERT_EQUAL(std::string("a/1: Runtime chain.\n"), lLog[0]);
+    CPPUNIT_ASSERT_EQUAL(std::string("b/1: Runtime chain.\n"), lLog[1]);
+    CPPUNIT_ASSERT_EQUAL(std::string("c/1: Runtime chain.\n"), lLog[2]);
+}
@@ -48,6 +48,7 @@ class TestLogWriterStdio :
     CPPUNIT_TEST(TestStderrWriter);
     CPPUNIT_TEST(TestStdoutWriter);
     CPPUNIT_TEST(TestPathWriter);
+    CPPUNIT_TEST(TestData);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -55,6 +56,7 @@ public:
     void TestStderrWriter(void);
     void TestStdoutWriter(void);
     void TestPathWriter(void);
+    void TestData(void);
 
 private:
     int  CreateTemporaryFile(char * aPathBuffer);
@@ -184,6 +186,39 @@ TestLogWriterStdio :: TestPathWriter(void)
     CheckResults(lPathBuffer, kExpected);
 }
 
+void
+TestLogWriterStdio :: TestData(void)
+{
+    const std::string kExpected("Raw \x01\x02\xff data.\n");
+    char              lPathBuffer[PATH_MAX];
+    int               lDescriptor;
+    FILE *            lStream;
+
+    lDescriptor = CreateTemporaryFile(lPathBuffer);
+
+    lStream = fdopen(lDescriptor, "w");
+    CPPUNIT_ASSERT(lStream != NULL);
+
+    {
+        Log::Writer::Stdio lStreamWriter(lStream);
+
+        lStreamWriter.WriteData(NULL, 0);
+        lStreamWriter.WriteData(kExpected.data(), 0);
+
+        // Test that the data, non-text bytes included, is written
+        // as is.
+
+        lStreamWriter.WriteData(kExpected.data(), kExpected.size());
+
+        lStreamWriter.Flush();
+
+        CheckResults(lPathBuffer, kExpected);
+    }
+
+    fclose(lStream);
+    close(lDescriptor);
+}
+
 int
 TestLogWriterStdio :: CreateTemporaryFile(char * aPathBuffer)
 {